@@ -0,0 +1,101 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/amd_openvx/CMakeLists.txt"
+  "/root/repo/amd_openvx/cmake/FindAMDRPP.cmake"
+  "/root/repo/amd_openvx/cmake/FindFFmpeg.cmake"
+  "/root/repo/amd_openvx/cmake/FindOpenCL.cmake"
+  "/root/repo/amd_openvx/cmake/FindTurboJpeg.cmake"
+  "/root/repo/amd_openvx/openvx/CMakeLists.txt"
+  "/root/repo/amd_openvx_extensions/CMakeLists.txt"
+  "/root/repo/rocAL/CMakeLists.txt"
+  "/root/repo/rocAL/rocAL/CMakeLists.txt"
+  "/root/repo/rocAL/rocAL_pybind/CMakeLists.txt"
+  "/root/repo/tests/openvx_api_tests/CMakeLists.txt"
+  "/root/repo/utilities/CMakeLists.txt"
+  "/root/repo/utilities/runvx/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindProtobuf.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "amd_openvx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "amd_openvx/openvx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "amd_openvx_extensions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utilities/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utilities/runvx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/openvx_api_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rocAL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rocAL/rocAL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "rocAL/rocAL_pybind/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "amd_openvx/openvx/CMakeFiles/openvx.dir/DependInfo.cmake"
+  "amd_openvx/openvx/CMakeFiles/vxu.dir/DependInfo.cmake"
+  "utilities/runvx/CMakeFiles/runvx.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_buffer_alias.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_color_convert_p016.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_cost_table.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_graph_batch.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_incremental_execution.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_integral_image.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_latency_histogram.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_rect_execution.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_remap_table.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_replicate_node.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_scale_merge.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_scheduler.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_separable_convolution.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_tensor_ops.dir/DependInfo.cmake"
+  "tests/openvx_api_tests/CMakeFiles/test_user_data_object.dir/DependInfo.cmake"
+  )
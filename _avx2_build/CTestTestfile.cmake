@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_avx2_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("amd_openvx")
+subdirs("amd_openvx_extensions")
+subdirs("utilities")
+subdirs("tests/openvx_api_tests")
+subdirs("rocAL")
@@ -0,0 +1,55 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/amd_openvx/openvx/ago/ago_drama.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_drama_alloc.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama_alloc.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama_alloc.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_drama_analyze.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama_analyze.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama_analyze.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_drama_divide.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama_divide.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama_divide.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_drama_merge.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama_merge.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama_merge.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_drama_partition.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama_partition.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama_partition.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_drama_remove.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama_remove.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_drama_remove.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_arithmetic.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_arithmetic.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_arithmetic.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_canny.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_canny.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_canny.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_ch_extract_combine.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_ch_extract_combine.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_ch_extract_combine.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_color_convert.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_color_convert.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_color_convert.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_fast_corners.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_fast_corners.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_fast_corners.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_filter.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_filter.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_filter.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_generic_functions.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_generic_functions.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_generic_functions.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_geometric.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_geometric.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_geometric.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_harris.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_harris.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_harris.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_histogram.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_histogram.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_histogram.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_logical.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_logical.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_logical.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_opticalflow.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_opticalflow.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_opticalflow.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_pyramid.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_pyramid.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_pyramid.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_cpu_tensor.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_tensor.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_cpu_tensor.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_gpu_common.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_gpu_common.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_gpu_common.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_gpu_conversion.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_gpu_conversion.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_gpu_conversion.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_gpu_corners.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_gpu_corners.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_gpu_corners.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_gpu_linear_filter.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_gpu_linear_filter.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_gpu_linear_filter.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_haf_gpu_special_filters.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_gpu_special_filters.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_haf_gpu_special_filters.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_interface.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_interface.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_interface.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_kernel_api.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_kernel_api.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_kernel_api.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_kernel_list.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_kernel_list.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_kernel_list.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_platform.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_platform.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_platform.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_util.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_util.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_util.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_util_hip.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_util_hip.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_util_hip.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/ago/ago_util_opencl.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_util_opencl.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/ago/ago_util_opencl.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/api/vx_api.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/api/vx_api.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/api/vx_api.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/api/vx_nodes.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/api/vx_nodes.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/api/vx_nodes.cpp.o.d"
+  "/root/repo/amd_openvx/openvx/api/vxu.cpp" "amd_openvx/openvx/CMakeFiles/openvx.dir/api/vxu.cpp.o" "gcc" "amd_openvx/openvx/CMakeFiles/openvx.dir/api/vxu.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
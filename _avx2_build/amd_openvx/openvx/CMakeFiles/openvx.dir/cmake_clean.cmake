@@ -0,0 +1,83 @@
+file(REMOVE_RECURSE
+  "../../lib/libopenvx.pdb"
+  "../../lib/libopenvx.so"
+  "CMakeFiles/openvx.dir/ago/ago_drama.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_drama.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_drama_alloc.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_drama_alloc.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_drama_analyze.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_drama_analyze.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_drama_divide.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_drama_divide.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_drama_merge.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_drama_merge.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_drama_partition.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_drama_partition.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_drama_remove.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_drama_remove.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_arithmetic.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_arithmetic.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_canny.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_canny.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_ch_extract_combine.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_ch_extract_combine.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_color_convert.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_color_convert.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_fast_corners.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_fast_corners.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_filter.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_filter.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_generic_functions.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_generic_functions.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_geometric.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_geometric.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_harris.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_harris.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_histogram.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_histogram.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_logical.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_logical.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_opticalflow.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_opticalflow.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_pyramid.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_pyramid.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_tensor.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_cpu_tensor.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_gpu_common.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_gpu_common.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_gpu_conversion.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_gpu_conversion.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_gpu_corners.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_gpu_corners.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_gpu_linear_filter.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_gpu_linear_filter.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_haf_gpu_special_filters.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_haf_gpu_special_filters.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_interface.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_interface.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_kernel_api.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_kernel_api.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_kernel_list.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_kernel_list.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_platform.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_platform.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_util.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_util.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_util_hip.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_util_hip.cpp.o.d"
+  "CMakeFiles/openvx.dir/ago/ago_util_opencl.cpp.o"
+  "CMakeFiles/openvx.dir/ago/ago_util_opencl.cpp.o.d"
+  "CMakeFiles/openvx.dir/api/vx_api.cpp.o"
+  "CMakeFiles/openvx.dir/api/vx_api.cpp.o.d"
+  "CMakeFiles/openvx.dir/api/vx_nodes.cpp.o"
+  "CMakeFiles/openvx.dir/api/vx_nodes.cpp.o.d"
+  "CMakeFiles/openvx.dir/api/vxu.cpp.o"
+  "CMakeFiles/openvx.dir/api/vxu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openvx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libvxu.pdb"
+  "../../lib/libvxu.so"
+  "CMakeFiles/vxu.dir/api/vxu.cpp.o"
+  "CMakeFiles/vxu.dir/api/vxu.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vxu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
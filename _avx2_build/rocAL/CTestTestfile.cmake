@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/rocAL
+# Build directory: /root/repo/_avx2_build/rocAL
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("rocAL")
+subdirs("rocAL_pybind")
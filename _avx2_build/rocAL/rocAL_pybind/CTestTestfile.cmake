@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/rocAL/rocAL_pybind
+# Build directory: /root/repo/_avx2_build/rocAL/rocAL_pybind
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
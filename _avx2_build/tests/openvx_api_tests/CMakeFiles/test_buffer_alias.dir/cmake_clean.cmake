@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_buffer_alias"
+  "../../bin/test_buffer_alias.pdb"
+  "CMakeFiles/test_buffer_alias.dir/buffer_alias.cpp.o"
+  "CMakeFiles/test_buffer_alias.dir/buffer_alias.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_buffer_alias.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_color_convert_p016"
+  "../../bin/test_color_convert_p016.pdb"
+  "CMakeFiles/test_color_convert_p016.dir/color_convert_p016.cpp.o"
+  "CMakeFiles/test_color_convert_p016.dir/color_convert_p016.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_color_convert_p016.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/openvx_api_tests/graph_batch.cpp" "tests/openvx_api_tests/CMakeFiles/test_graph_batch.dir/graph_batch.cpp.o" "gcc" "tests/openvx_api_tests/CMakeFiles/test_graph_batch.dir/graph_batch.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx2_build/amd_openvx/openvx/CMakeFiles/openvx.dir/DependInfo.cmake"
+  "/root/repo/_avx2_build/amd_openvx/openvx/CMakeFiles/vxu.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
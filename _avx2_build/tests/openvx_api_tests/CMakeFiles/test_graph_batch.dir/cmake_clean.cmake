@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_graph_batch"
+  "../../bin/test_graph_batch.pdb"
+  "CMakeFiles/test_graph_batch.dir/graph_batch.cpp.o"
+  "CMakeFiles/test_graph_batch.dir/graph_batch.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_graph_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_incremental_execution"
+  "../../bin/test_incremental_execution.pdb"
+  "CMakeFiles/test_incremental_execution.dir/incremental_execution.cpp.o"
+  "CMakeFiles/test_incremental_execution.dir/incremental_execution.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_incremental_execution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_integral_image"
+  "../../bin/test_integral_image.pdb"
+  "CMakeFiles/test_integral_image.dir/integral_image.cpp.o"
+  "CMakeFiles/test_integral_image.dir/integral_image.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_integral_image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_latency_histogram"
+  "../../bin/test_latency_histogram.pdb"
+  "CMakeFiles/test_latency_histogram.dir/latency_histogram.cpp.o"
+  "CMakeFiles/test_latency_histogram.dir/latency_histogram.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_latency_histogram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
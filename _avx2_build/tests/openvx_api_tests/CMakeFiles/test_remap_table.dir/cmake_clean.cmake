@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_remap_table"
+  "../../bin/test_remap_table.pdb"
+  "CMakeFiles/test_remap_table.dir/remap_table.cpp.o"
+  "CMakeFiles/test_remap_table.dir/remap_table.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_remap_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_replicate_node"
+  "../../bin/test_replicate_node.pdb"
+  "CMakeFiles/test_replicate_node.dir/replicate_node.cpp.o"
+  "CMakeFiles/test_replicate_node.dir/replicate_node.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_replicate_node.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
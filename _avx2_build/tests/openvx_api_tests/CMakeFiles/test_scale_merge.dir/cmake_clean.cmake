@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_scale_merge"
+  "../../bin/test_scale_merge.pdb"
+  "CMakeFiles/test_scale_merge.dir/scale_merge.cpp.o"
+  "CMakeFiles/test_scale_merge.dir/scale_merge.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_scale_merge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_scheduler"
+  "../../bin/test_scheduler.pdb"
+  "CMakeFiles/test_scheduler.dir/scheduler.cpp.o"
+  "CMakeFiles/test_scheduler.dir/scheduler.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_scheduler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
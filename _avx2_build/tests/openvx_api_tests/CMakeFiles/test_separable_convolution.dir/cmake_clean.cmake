@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_separable_convolution"
+  "../../bin/test_separable_convolution.pdb"
+  "CMakeFiles/test_separable_convolution.dir/separable_convolution.cpp.o"
+  "CMakeFiles/test_separable_convolution.dir/separable_convolution.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_separable_convolution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
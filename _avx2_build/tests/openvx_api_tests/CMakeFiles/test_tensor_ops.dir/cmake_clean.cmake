@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_tensor_ops"
+  "../../bin/test_tensor_ops.pdb"
+  "CMakeFiles/test_tensor_ops.dir/tensor_ops.cpp.o"
+  "CMakeFiles/test_tensor_ops.dir/tensor_ops.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_tensor_ops.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
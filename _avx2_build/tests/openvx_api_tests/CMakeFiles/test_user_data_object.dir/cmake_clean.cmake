@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_user_data_object"
+  "../../bin/test_user_data_object.pdb"
+  "CMakeFiles/test_user_data_object.dir/user_data_object.cpp.o"
+  "CMakeFiles/test_user_data_object.dir/user_data_object.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_user_data_object.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
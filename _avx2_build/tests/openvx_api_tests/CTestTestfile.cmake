@@ -0,0 +1,74 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/openvx_api_tests
+# Build directory: /root/repo/_avx2_build/tests/openvx_api_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(buffer_alias "/root/repo/_avx2_build/bin/test_buffer_alias")
+set_tests_properties(buffer_alias PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(buffer_alias_threads_4 "/root/repo/_avx2_build/bin/test_buffer_alias")
+set_tests_properties(buffer_alias_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(color_convert_p016 "/root/repo/_avx2_build/bin/test_color_convert_p016")
+set_tests_properties(color_convert_p016 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(color_convert_p016_threads_4 "/root/repo/_avx2_build/bin/test_color_convert_p016")
+set_tests_properties(color_convert_p016_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(cost_table "/root/repo/_avx2_build/bin/test_cost_table")
+set_tests_properties(cost_table PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(cost_table_threads_4 "/root/repo/_avx2_build/bin/test_cost_table")
+set_tests_properties(cost_table_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(graph_batch "/root/repo/_avx2_build/bin/test_graph_batch")
+set_tests_properties(graph_batch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(graph_batch_threads_4 "/root/repo/_avx2_build/bin/test_graph_batch")
+set_tests_properties(graph_batch_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(incremental_execution "/root/repo/_avx2_build/bin/test_incremental_execution")
+set_tests_properties(incremental_execution PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(incremental_execution_threads_4 "/root/repo/_avx2_build/bin/test_incremental_execution")
+set_tests_properties(incremental_execution_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(integral_image "/root/repo/_avx2_build/bin/test_integral_image")
+set_tests_properties(integral_image PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(integral_image_threads_4 "/root/repo/_avx2_build/bin/test_integral_image")
+set_tests_properties(integral_image_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(latency_histogram "/root/repo/_avx2_build/bin/test_latency_histogram")
+set_tests_properties(latency_histogram PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(latency_histogram_threads_4 "/root/repo/_avx2_build/bin/test_latency_histogram")
+set_tests_properties(latency_histogram_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(rect_execution "/root/repo/_avx2_build/bin/test_rect_execution")
+set_tests_properties(rect_execution PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(rect_execution_threads_4 "/root/repo/_avx2_build/bin/test_rect_execution")
+set_tests_properties(rect_execution_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(remap_table "/root/repo/_avx2_build/bin/test_remap_table")
+set_tests_properties(remap_table PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(remap_table_threads_4 "/root/repo/_avx2_build/bin/test_remap_table")
+set_tests_properties(remap_table_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(replicate_node "/root/repo/_avx2_build/bin/test_replicate_node")
+set_tests_properties(replicate_node PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(replicate_node_threads_4 "/root/repo/_avx2_build/bin/test_replicate_node")
+set_tests_properties(replicate_node_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(scale_merge "/root/repo/_avx2_build/bin/test_scale_merge")
+set_tests_properties(scale_merge PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(scale_merge_threads_4 "/root/repo/_avx2_build/bin/test_scale_merge")
+set_tests_properties(scale_merge_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(scheduler "/root/repo/_avx2_build/bin/test_scheduler")
+set_tests_properties(scheduler PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(scheduler_threads_4 "/root/repo/_avx2_build/bin/test_scheduler")
+set_tests_properties(scheduler_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(separable_convolution "/root/repo/_avx2_build/bin/test_separable_convolution")
+set_tests_properties(separable_convolution PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(separable_convolution_threads_4 "/root/repo/_avx2_build/bin/test_separable_convolution")
+set_tests_properties(separable_convolution_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(tensor_ops "/root/repo/_avx2_build/bin/test_tensor_ops")
+set_tests_properties(tensor_ops PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(tensor_ops_threads_4 "/root/repo/_avx2_build/bin/test_tensor_ops")
+set_tests_properties(tensor_ops_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(user_data_object "/root/repo/_avx2_build/bin/test_user_data_object")
+set_tests_properties(user_data_object PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;50;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(user_data_object_threads_4 "/root/repo/_avx2_build/bin/test_user_data_object")
+set_tests_properties(user_data_object_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;52;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(gdf_integral_image_reference "/root/repo/_avx2_build/bin/runvx" "-frames:1" "-affinity:CPU" "-root:/root/repo/tests/openvx_api_tests/../smoke_tests/OpenVX" "file" "/root/repo/tests/openvx_api_tests/gdfs/integral_image_odd_height.gdf" "image:1280,719,U032:COMPARE,/root/repo/_avx2_build/tests/openvx_api_tests/integral_image_odd_height_1.txt,checksum-save-instead-of-test" "image:1001,715,U032:COMPARE,/root/repo/_avx2_build/tests/openvx_api_tests/integral_image_odd_height_2.txt,checksum-save-instead-of-test")
+set_tests_properties(gdf_integral_image_reference PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=1" FIXTURES_SETUP "integral_image_reference" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;62;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;68;add_gdf_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(gdf_integral_image_threads_2 "/root/repo/_avx2_build/bin/runvx" "-frames:1" "-affinity:CPU" "-root:/root/repo/tests/openvx_api_tests/../smoke_tests/OpenVX" "file" "/root/repo/tests/openvx_api_tests/gdfs/integral_image_odd_height.gdf" "image:1280,719,U032:COMPARE,/root/repo/_avx2_build/tests/openvx_api_tests/integral_image_odd_height_1.txt,checksum" "image:1001,715,U032:COMPARE,/root/repo/_avx2_build/tests/openvx_api_tests/integral_image_odd_height_2.txt,checksum")
+set_tests_properties(gdf_integral_image_threads_2 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=2" FIXTURES_REQUIRED "integral_image_reference" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;62;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;73;add_gdf_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(gdf_integral_image_threads_3 "/root/repo/_avx2_build/bin/runvx" "-frames:1" "-affinity:CPU" "-root:/root/repo/tests/openvx_api_tests/../smoke_tests/OpenVX" "file" "/root/repo/tests/openvx_api_tests/gdfs/integral_image_odd_height.gdf" "image:1280,719,U032:COMPARE,/root/repo/_avx2_build/tests/openvx_api_tests/integral_image_odd_height_1.txt,checksum" "image:1001,715,U032:COMPARE,/root/repo/_avx2_build/tests/openvx_api_tests/integral_image_odd_height_2.txt,checksum")
+set_tests_properties(gdf_integral_image_threads_3 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=3" FIXTURES_REQUIRED "integral_image_reference" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;62;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;73;add_gdf_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
+add_test(gdf_integral_image_threads_4 "/root/repo/_avx2_build/bin/runvx" "-frames:1" "-affinity:CPU" "-root:/root/repo/tests/openvx_api_tests/../smoke_tests/OpenVX" "file" "/root/repo/tests/openvx_api_tests/gdfs/integral_image_odd_height.gdf" "image:1280,719,U032:COMPARE,/root/repo/_avx2_build/tests/openvx_api_tests/integral_image_odd_height_1.txt,checksum" "image:1001,715,U032:COMPARE,/root/repo/_avx2_build/tests/openvx_api_tests/integral_image_odd_height_2.txt,checksum")
+set_tests_properties(gdf_integral_image_threads_4 PROPERTIES  ENVIRONMENT "AGO_CPU_THREADS=4" FIXTURES_REQUIRED "integral_image_reference" _BACKTRACE_TRIPLES "/root/repo/tests/openvx_api_tests/CMakeLists.txt;62;add_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;73;add_gdf_test;/root/repo/tests/openvx_api_tests/CMakeLists.txt;0;")
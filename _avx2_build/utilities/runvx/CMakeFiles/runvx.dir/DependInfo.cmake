@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/utilities/runvx/runvx.cpp" "utilities/runvx/CMakeFiles/runvx.dir/runvx.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/runvx.cpp.o.d"
+  "/root/repo/utilities/runvx/vxArray.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxArray.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxArray.cpp.o.d"
+  "/root/repo/utilities/runvx/vxConvolution.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxConvolution.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxConvolution.cpp.o.d"
+  "/root/repo/utilities/runvx/vxDistribution.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxDistribution.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxDistribution.cpp.o.d"
+  "/root/repo/utilities/runvx/vxEngine.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxEngine.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxEngine.cpp.o.d"
+  "/root/repo/utilities/runvx/vxEngineUtil.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxEngineUtil.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxEngineUtil.cpp.o.d"
+  "/root/repo/utilities/runvx/vxImage.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxImage.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxImage.cpp.o.d"
+  "/root/repo/utilities/runvx/vxLUT.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxLUT.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxLUT.cpp.o.d"
+  "/root/repo/utilities/runvx/vxMatrix.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxMatrix.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxMatrix.cpp.o.d"
+  "/root/repo/utilities/runvx/vxParamHelper.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxParamHelper.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxParamHelper.cpp.o.d"
+  "/root/repo/utilities/runvx/vxParameter.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxParameter.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxParameter.cpp.o.d"
+  "/root/repo/utilities/runvx/vxPyramid.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxPyramid.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxPyramid.cpp.o.d"
+  "/root/repo/utilities/runvx/vxRemap.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxRemap.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxRemap.cpp.o.d"
+  "/root/repo/utilities/runvx/vxScalar.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxScalar.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxScalar.cpp.o.d"
+  "/root/repo/utilities/runvx/vxTensor.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxTensor.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxTensor.cpp.o.d"
+  "/root/repo/utilities/runvx/vxThreshold.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxThreshold.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxThreshold.cpp.o.d"
+  "/root/repo/utilities/runvx/vxUtils.cpp" "utilities/runvx/CMakeFiles/runvx.dir/vxUtils.cpp.o" "gcc" "utilities/runvx/CMakeFiles/runvx.dir/vxUtils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_avx2_build/amd_openvx/openvx/CMakeFiles/openvx.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
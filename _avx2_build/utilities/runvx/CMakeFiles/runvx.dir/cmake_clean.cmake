@@ -0,0 +1,43 @@
+file(REMOVE_RECURSE
+  "../../bin/runvx"
+  "../../bin/runvx.pdb"
+  "CMakeFiles/runvx.dir/runvx.cpp.o"
+  "CMakeFiles/runvx.dir/runvx.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxArray.cpp.o"
+  "CMakeFiles/runvx.dir/vxArray.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxConvolution.cpp.o"
+  "CMakeFiles/runvx.dir/vxConvolution.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxDistribution.cpp.o"
+  "CMakeFiles/runvx.dir/vxDistribution.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxEngine.cpp.o"
+  "CMakeFiles/runvx.dir/vxEngine.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxEngineUtil.cpp.o"
+  "CMakeFiles/runvx.dir/vxEngineUtil.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxImage.cpp.o"
+  "CMakeFiles/runvx.dir/vxImage.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxLUT.cpp.o"
+  "CMakeFiles/runvx.dir/vxLUT.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxMatrix.cpp.o"
+  "CMakeFiles/runvx.dir/vxMatrix.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxParamHelper.cpp.o"
+  "CMakeFiles/runvx.dir/vxParamHelper.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxParameter.cpp.o"
+  "CMakeFiles/runvx.dir/vxParameter.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxPyramid.cpp.o"
+  "CMakeFiles/runvx.dir/vxPyramid.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxRemap.cpp.o"
+  "CMakeFiles/runvx.dir/vxRemap.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxScalar.cpp.o"
+  "CMakeFiles/runvx.dir/vxScalar.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxTensor.cpp.o"
+  "CMakeFiles/runvx.dir/vxTensor.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxThreshold.cpp.o"
+  "CMakeFiles/runvx.dir/vxThreshold.cpp.o.d"
+  "CMakeFiles/runvx.dir/vxUtils.cpp.o"
+  "CMakeFiles/runvx.dir/vxUtils.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runvx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
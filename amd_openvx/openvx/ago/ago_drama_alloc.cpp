@@ -571,6 +571,7 @@ static int agoOptimizeDramaAllocSetDefaultTargets(AgoGraph * agraph)
         }
     }
 
+    std::vector<AgoNode *> freeNodeList; // nodes without user specified affinity
     for (AgoNode * node = agraph->nodeList.head; node; node = node->next) {
         // get target support info
         node->target_support_flags = 0;
@@ -669,6 +670,7 @@ static int agoOptimizeDramaAllocSetDefaultTargets(AgoGraph * agraph)
             }
         }
         else {
+            freeNodeList.push_back(node);
             if (default_target == AGO_KERNEL_FLAG_DEVICE_GPU) {
                 // choose GPU as default if supported
                 if (node->target_support_flags & AGO_KERNEL_FLAG_DEVICE_GPU) {
@@ -709,6 +711,13 @@ static int agoOptimizeDramaAllocSetDefaultTargets(AgoGraph * agraph)
             }
         }
     }
+
+    // re-assign nodes without user specified affinity using measured costs
+    if (agraph->targetPartition != VX_TARGET_PARTITION_AMD_AFFINITY && freeNodeList.size() > 0) {
+        if (agoOptimizeDramaPartition(agraph, freeNodeList, nextAvailGroupId) < 0) {
+            return -1;
+        }
+    }
     return 0;
 }
 
@@ -842,6 +851,268 @@ static int agoOptimizeDramaAllocMergeSuperNodes(AgoGraph * graph)
 }
 #endif
 
+static void agoOptimizeDramaAllocResetBufferAliases(AgoGraph * agraph)
+{
+    // drop aliases from an earlier verify, since the graph may have changed since then:
+    // an aliased image gets its own buffer again unless it is picked again
+    for (AgoData * data = agraph->dataList.head; data; data = data->next) {
+        if (data->buffer_alias_data) {
+            if (data->buffer && !data->buffer_allocated && data->buffer == data->buffer_alias_data->buffer)
+                data->buffer = nullptr;
+            data->buffer_alias_data = nullptr;
+        }
+    }
+    for (AgoNode * node = agraph->nodeList.head; node; node = node->next)
+        node->incremental_rerun = false;
+}
+
+static int agoOptimizeDramaAllocBufferAliases(AgoGraph * agraph)
+{
+    // check and mark data usage
+    agoOptimizeDramaMarkDataUsage(agraph);
+
+    // data accessed by nodes outside CPU keep their own CPU buffers
+    std::vector<AgoData *> excludeList;
+    for (AgoNode * node = agraph->nodeList.head; node; node = node->next) {
+        if (node->attr_affinity.device_type != AGO_KERNEL_FLAG_DEVICE_CPU || node->akernel->opencl_buffer_access_enable) {
+            for (vx_uint32 i = 0; i < node->paramCount; i++) {
+                if (node->paramList[i])
+                    excludeList.push_back(node->paramList[i]);
+            }
+        }
+    }
+    auto isAliasCandidate = [&](AgoData * data) -> bool {
+        return data && data->ref.type == VX_TYPE_IMAGE && data->isVirtual && !data->buffer &&
+               !data->u.img.isROI && !data->u.img.isUniform && !data->numChildren && !data->parent &&
+               data->roiDepList.empty() && !data->inoutUsageCount && !agoIsPartOfDelay(data) &&
+               std::find(excludeList.begin(), excludeList.end(), data) == excludeList.end();
+    };
+
+    // an output can share the buffer of an input of the same node, when the kernel supports
+    // in-place processing of that parameter pair and the input is not used after this node
+    for (AgoNode * node = agraph->nodeList.head; node; node = node->next) {
+        AgoKernel * kernel = node->akernel;
+        // requests for sparse processing get priority since those kernels benefit the most
+        for (int pass = 0; pass < 2; pass++) {
+            vx_enum processing_type = (pass == 0) ? VX_BUFFER_ALIASING_PROCESSING_TYPE_SPARSE : VX_BUFFER_ALIASING_PROCESSING_TYPE_DENSE;
+            for (vx_uint32 out = 0; out < node->paramCount; out++) {
+                if (!kernel->alias_param_index_plus1[out] || kernel->alias_processing_type[out] != processing_type)
+                    continue;
+                vx_uint32 inp = kernel->alias_param_index_plus1[out] - 1;
+                if (inp >= node->paramCount ||
+                    (kernel->argConfig[out] & (AGO_KERNEL_ARG_INPUT_FLAG | AGO_KERNEL_ARG_OUTPUT_FLAG)) != AGO_KERNEL_ARG_OUTPUT_FLAG ||
+                    (kernel->argConfig[inp] & (AGO_KERNEL_ARG_INPUT_FLAG | AGO_KERNEL_ARG_OUTPUT_FLAG)) != AGO_KERNEL_ARG_INPUT_FLAG)
+                    continue;
+                AgoData * odata = node->paramList[out];
+                AgoData * idata = node->paramList[inp];
+                if (isAliasCandidate(odata) && isAliasCandidate(idata) && odata != idata && !odata->buffer_alias_data &&
+                    odata->outputUsageCount == 1 && idata->inputUsageCount == 1 &&
+                    odata->u.img.format == idata->u.img.format && odata->u.img.width == idata->u.img.width &&
+                    odata->u.img.height == idata->u.img.height && odata->u.img.stride_in_bytes == idata->u.img.stride_in_bytes &&
+                    odata->size == idata->size)
+                {
+                    odata->buffer_alias_data = idata;
+                    // the input buffer now belongs to the output
+                    excludeList.push_back(idata);
+                    // with incremental execution, the writer of the input has to refresh it before this node
+                    // can run again, so neither of them can be skipped
+                    node->incremental_rerun = true;
+                    for (AgoNode * writer = agraph->nodeList.head; writer; writer = writer->next) {
+                        for (vx_uint32 i = 0; i < writer->paramCount; i++) {
+                            if (writer->paramList[i] == idata && writer->parameters[i].direction != VX_INPUT)
+                                writer->incremental_rerun = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+static bool agoIsRectEmpty(const vx_rectangle_t& rect)
+{
+    return rect.start_x >= rect.end_x || rect.start_y >= rect.end_y;
+}
+
+static void agoMergeRect(vx_rectangle_t& rect, const vx_rectangle_t& other)
+{
+    if (agoIsRectEmpty(other))
+        return;
+    if (agoIsRectEmpty(rect)) {
+        rect = other;
+        return;
+    }
+    rect.start_x = std::min(rect.start_x, other.start_x);
+    rect.start_y = std::min(rect.start_y, other.start_y);
+    rect.end_x = std::max(rect.end_x, other.end_x);
+    rect.end_y = std::max(rect.end_y, other.end_y);
+}
+
+static bool agoIsRectExecutionSupported(AgoNode * node)
+{
+    // only element-wise and fixed-neighborhood low-level kernels on CPU can process an arbitrary window
+    // of their images, given all the images are plain single plane images of same dimensions
+    AgoKernel * kernel = node->akernel;
+    if (!kernel->func || (kernel->flags & AGO_KERNEL_FLAG_GROUP_MASK) != AGO_KERNEL_FLAG_GROUP_AMDLL ||
+        (kernel->kernOpType != AGO_KERNEL_OP_TYPE_ELEMENT_WISE && kernel->kernOpType != AGO_KERNEL_OP_TYPE_FIXED_NEIGHBORS) ||
+        node->attr_affinity.device_type != AGO_KERNEL_FLAG_DEVICE_CPU || node->replica_group)
+        return false;
+    AgoData * first = nullptr;
+    bool hasOutput = false;
+    for (vx_uint32 i = 0; i < node->paramCount; i++) {
+        AgoData * data = node->paramList[i];
+        if (!data)
+            continue;
+        if (node->parameters[i].direction == VX_BIDIRECTIONAL)
+            return false;
+        if (data->ref.type == VX_TYPE_IMAGE) {
+            if (data->parent || data->numChildren || data->u.img.isROI || !data->roiDepList.empty() || data->u.img.isUniform ||
+                data->u.img.pixel_size_in_bits_denom != 1 || data->u.img.x_scale_factor_is_2 || data->u.img.y_scale_factor_is_2 ||
+                agoIsPartOfDelay(data))
+                return false;
+            if (first && (first->u.img.width != data->u.img.width || first->u.img.height != data->u.img.height))
+                return false;
+            first = data;
+            if (node->parameters[i].direction == VX_OUTPUT)
+                hasOutput = true;
+        }
+        else if (node->parameters[i].direction == VX_OUTPUT)
+            return false;
+    }
+    return hasOutput;
+}
+
+static int agoOptimizeDramaAllocExecRectangles(AgoGraph * agraph)
+{
+    // image regions that consumers (or the application) read, back-propagated from the last node;
+    // virtual images only need what their consumers read, other images are fully needed unless
+    // the application declared a smaller region of interest
+    std::map<AgoData *, vx_rectangle_t> required;
+    auto getRequiredRect = [&](AgoData * data) -> vx_rectangle_t {
+        vx_rectangle_t rect = { 0, 0, 0, 0 };
+        if (!agoIsRectEmpty(data->u.img.rect_interest))
+            rect = data->u.img.rect_interest;
+        else if (!data->isVirtual)
+            rect = { 0, 0, data->u.img.width, data->u.img.height };
+        auto it = required.find(data);
+        if (it != required.end())
+            agoMergeRect(rect, it->second);
+        return rect;
+    };
+    std::vector<AgoNode *> nodeList;
+    for (AgoNode * node = agraph->nodeList.head; node; node = node->next)
+        nodeList.push_back(node);
+    for (auto it = nodeList.rbegin(); it != nodeList.rend(); it++) {
+        AgoNode * node = *it;
+        node->rect_exec_enable = false;
+        if ((agraph->optimizer_flags & AGO_GRAPH_OPTIMIZER_FLAG_NO_RECT_EXECUTION) || !agoIsRectExecutionSupported(node)) {
+            // all input images are read completely
+            for (vx_uint32 i = 0; i < node->paramCount; i++) {
+                AgoData * data = node->paramList[i];
+                if (data && data->ref.type == VX_TYPE_IMAGE && node->parameters[i].direction != VX_OUTPUT)
+                    required[data] = { 0, 0, data->u.img.width, data->u.img.height };
+            }
+            continue;
+        }
+        // output region to compute: the part of the outputs that is needed and valid
+        vx_uint32 width = 0, height = 0;
+        vx_rectangle_t rect = { 0, 0, 0, 0 };
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            AgoData * data = node->paramList[i];
+            if (data && data->ref.type == VX_TYPE_IMAGE && node->parameters[i].direction == VX_OUTPUT) {
+                agoMergeRect(rect, getRequiredRect(data));
+                width = data->u.img.width;
+                height = data->u.img.height;
+            }
+        }
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            AgoData * data = node->paramList[i];
+            if (data && data->ref.type == VX_TYPE_IMAGE && node->parameters[i].direction == VX_OUTPUT &&
+                !agoIsRectEmpty(data->u.img.rect_valid) && !agoIsRectEmpty(rect))
+            {
+                rect.start_x = std::max(rect.start_x, data->u.img.rect_valid.start_x);
+                rect.start_y = std::max(rect.start_y, data->u.img.rect_valid.start_y);
+                rect.end_x = std::min(rect.end_x, data->u.img.rect_valid.end_x);
+                rect.end_y = std::min(rect.end_y, data->u.img.rect_valid.end_y);
+            }
+        }
+        // kernel window: the output region plus the filter neighborhood, where the kernel skips the
+        // neighborhood rows itself; the first column is aligned to 128 pixels to keep the 16-byte
+        // alignment of buffers for all pixel sizes and the width is padded to keep kernels on their
+        // vector path (the extra pixels are computed from data nobody needs, and nobody reads them)
+        vx_rectangle_t window = { 0, 0, 0, 0 };
+        vx_uint32 radius = (node->akernel->kernOpType == AGO_KERNEL_OP_TYPE_FIXED_NEIGHBORS) ? node->akernel->kernOpInfo / 2 : 0;
+        if (!agoIsRectEmpty(rect)) {
+            window.start_x = (rect.start_x > radius) ? ((rect.start_x - radius) & ~127u) : 0;
+            window.start_y = (rect.start_y > radius) ? (rect.start_y - radius) : 0;
+            window.end_x = std::min((rect.end_x + radius + 15) & ~15u, width);
+            window.end_y = std::min(rect.end_y + radius, height);
+            vx_rectangle_t input = { (rect.start_x > radius) ? (rect.start_x - radius) : 0, window.start_y, window.end_x, window.end_y };
+            for (vx_uint32 i = 0; i < node->paramCount; i++) {
+                AgoData * data = node->paramList[i];
+                if (data && data->ref.type == VX_TYPE_IMAGE && node->parameters[i].direction == VX_INPUT)
+                    agoMergeRect(required[data], input);
+            }
+        }
+        if (window.start_x == 0 && window.start_y == 0 && window.end_x == width && window.end_y == height)
+            continue;
+        node->rect_exec_enable = true;
+        node->rect_exec = window;
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            AgoData * data = node->paramList[i];
+            if (data && data->ref.type == VX_TYPE_IMAGE && !node->rect_exec_window[i]) {
+                node->rect_exec_window[i] = new AgoData;
+                if (!node->rect_exec_window[i]) {
+                    agoAddLogEntry(&node->ref, VX_ERROR_NO_MEMORY, "ERROR: agoOptimizeDramaAllocExecRectangles: out of memory\n");
+                    return -1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+static void agoSaveExecRectangleDependencies(AgoGraph * agraph)
+{
+    // exec rectangles depend on the valid rectangles and regions of interest of non-virtual images,
+    // which the application can change after the graph is verified
+    agraph->rectExecImages.clear();
+    agraph->rectExecImageRects.clear();
+    if (agraph->optimizer_flags & AGO_GRAPH_OPTIMIZER_FLAG_NO_RECT_EXECUTION)
+        return;
+    for (AgoNode * node = agraph->nodeList.head; node; node = node->next) {
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            AgoData * data = node->paramList[i];
+            if (data && data->ref.type == VX_TYPE_IMAGE && !data->isVirtual &&
+                std::find(agraph->rectExecImages.begin(), agraph->rectExecImages.end(), data) == agraph->rectExecImages.end())
+            {
+                agraph->rectExecImages.push_back(data);
+                agraph->rectExecImageRects.push_back(data->u.img.rect_valid);
+                agraph->rectExecImageRects.push_back(data->u.img.rect_interest);
+            }
+        }
+    }
+}
+
+int agoUpdateExecRectangles(AgoGraph * agraph)
+{
+    // recompute valid rectangles and exec rectangles when the application changed any of the rectangles
+    // they were computed from, so that nodes don't keep working on a stale window
+    bool changed = false;
+    for (size_t i = 0; !changed && i < agraph->rectExecImages.size(); i++) {
+        AgoData * data = agraph->rectExecImages[i];
+        changed = memcmp(&data->u.img.rect_valid, &agraph->rectExecImageRects[2 * i], sizeof(vx_rectangle_t)) ||
+                  memcmp(&data->u.img.rect_interest, &agraph->rectExecImageRects[2 * i + 1], sizeof(vx_rectangle_t));
+    }
+    if (!changed)
+        return 0;
+    if (agoComputeImageValidRectangleOutputs(agraph) || agoOptimizeDramaAllocExecRectangles(agraph) < 0)
+        return -1;
+    agoSaveExecRectangleDependencies(agraph);
+    return 0;
+}
+
 int agoOptimizeDramaAlloc(AgoGraph * agraph)
 {
     // return success if there is nothing to do
@@ -888,6 +1159,20 @@ int agoOptimizeDramaAlloc(AgoGraph * agraph)
     // remove unused data
     if (agoOptimizeDramaAllocRemoveUnusedData(agraph)) return -1;
 
+    // share buffers between parameters of in-place kernels
+    agoOptimizeDramaAllocResetBufferAliases(agraph);
+    if (!(agraph->optimizer_flags & AGO_GRAPH_OPTIMIZER_FLAG_NO_BUFFER_ALIASING)) {
+        if (agoOptimizeDramaAllocBufferAliases(agraph) < 0) {
+            return -1;
+        }
+    }
+
+    // restrict kernels to the part of their outputs that is valid and used
+    if (agoOptimizeDramaAllocExecRectangles(agraph) < 0) {
+        return -1;
+    }
+    agoSaveExecRectangleDependencies(agraph);
+
     // make sure all buffers are allocated and initialized
     for (AgoData * adata = agraph->dataList.head; adata; adata = adata->next) {
         if (agoAllocData(adata)) {
@@ -112,6 +112,13 @@ int agoDramaDivideColorConvertNode(AgoNodeList * nodeList, AgoNode * anode)
 			anode->paramCount = 4;
 			return agoDramaDivideAppend(nodeList, anode, VX_KERNEL_AMD_COLOR_CONVERT_RGB_IYUV);
 		}
+		else if (itype == VX_DF_IMAGE_P010_AMD || itype == VX_DF_IMAGE_P016_AMD) {
+			anode->paramList[0] = dstParam;
+			anode->paramList[1] = srcParam->children[0];
+			anode->paramList[2] = srcParam->children[1];
+			anode->paramCount = 3;
+			return agoDramaDivideAppend(nodeList, anode, VX_KERNEL_AMD_COLOR_CONVERT_RGB_P016);
+		}
 	}
 	else if (otype == VX_DF_IMAGE_RGBX) {
 		if (itype == VX_DF_IMAGE_RGB) {
@@ -154,6 +161,13 @@ int agoDramaDivideColorConvertNode(AgoNodeList * nodeList, AgoNode * anode)
 			anode->paramCount = 4;
 			return agoDramaDivideAppend(nodeList, anode, VX_KERNEL_AMD_COLOR_CONVERT_RGBX_IYUV);
 		}
+		else if (itype == VX_DF_IMAGE_P010_AMD || itype == VX_DF_IMAGE_P016_AMD) {
+			anode->paramList[0] = dstParam;
+			anode->paramList[1] = srcParam->children[0];
+			anode->paramList[2] = srcParam->children[1];
+			anode->paramCount = 3;
+			return agoDramaDivideAppend(nodeList, anode, VX_KERNEL_AMD_COLOR_CONVERT_RGBX_P016);
+		}
 	}
 	else if (otype == VX_DF_IMAGE_NV12) {
 		if (itype == VX_DF_IMAGE_UYVY) {
@@ -201,6 +215,35 @@ int agoDramaDivideColorConvertNode(AgoNodeList * nodeList, AgoNode * anode)
 			anode->paramCount = 2;
 			return agoDramaDivideAppend(nodeList, anode, VX_KERNEL_AMD_COLOR_CONVERT_UV12_RGBX);
 		}
+		else if (itype == VX_DF_IMAGE_P010_AMD || itype == VX_DF_IMAGE_P016_AMD) {
+			anode->paramList[0] = dstParam->children[0];
+			anode->paramList[1] = dstParam->children[1];
+			anode->paramList[2] = srcParam->children[0];
+			anode->paramList[3] = srcParam->children[1];
+			anode->paramCount = 4;
+			return agoDramaDivideAppend(nodeList, anode, VX_KERNEL_AMD_FORMAT_CONVERT_NV12_P016);
+		}
+	}
+	else if (otype == VX_DF_IMAGE_P010_AMD || otype == VX_DF_IMAGE_P016_AMD) {
+		bool p010 = (otype == VX_DF_IMAGE_P010_AMD);
+		if (itype == VX_DF_IMAGE_RGB || itype == VX_DF_IMAGE_RGBX) {
+			anode->paramList[0] = dstParam->children[0];
+			anode->paramList[1] = dstParam->children[1];
+			anode->paramList[2] = srcParam;
+			anode->paramCount = 3;
+			if (itype == VX_DF_IMAGE_RGB)
+				return agoDramaDivideAppend(nodeList, anode, p010 ? VX_KERNEL_AMD_COLOR_CONVERT_P010_RGB : VX_KERNEL_AMD_COLOR_CONVERT_P016_RGB);
+			else
+				return agoDramaDivideAppend(nodeList, anode, p010 ? VX_KERNEL_AMD_COLOR_CONVERT_P010_RGBX : VX_KERNEL_AMD_COLOR_CONVERT_P016_RGBX);
+		}
+		else if (itype == VX_DF_IMAGE_NV12) {
+			anode->paramList[0] = dstParam->children[0];
+			anode->paramList[1] = dstParam->children[1];
+			anode->paramList[2] = srcParam->children[0];
+			anode->paramList[3] = srcParam->children[1];
+			anode->paramCount = 4;
+			return agoDramaDivideAppend(nodeList, anode, p010 ? VX_KERNEL_AMD_FORMAT_CONVERT_P010_NV12 : VX_KERNEL_AMD_FORMAT_CONVERT_P016_NV12);
+		}
 	}
 	else if (otype == VX_DF_IMAGE_IYUV) {
 		if (itype == VX_DF_IMAGE_UYVY) {
@@ -585,7 +628,23 @@ int agoDramaDivideScaleImageNode(AgoNodeList * nodeList, AgoNode * anode)
 		anode->paramList[0] = paramList[1];
 		anode->paramList[1] = paramList[0];
 		anode->paramCount = 2;
-		if (anode->attr_border_mode.mode == VX_BORDER_MODE_UNDEFINED) {
+		// fixed downscale ratios never sample outside the input image, so ratio specific CPU kernels can be used with any border mode
+		vx_uint32 iw = paramList[0]->u.img.width, ih = paramList[0]->u.img.height;
+		vx_uint32 ow = paramList[1]->u.img.width, oh = paramList[1]->u.img.height;
+		vx_enum ratio_kernel_id = VX_KERNEL_AMD_INVALID;
+		if (anode->attr_affinity.device_type != AGO_KERNEL_FLAG_DEVICE_GPU &&
+			(interpolation == VX_INTERPOLATION_TYPE_BILINEAR || interpolation == VX_INTERPOLATION_TYPE_AREA))
+		{
+			bool area = (interpolation == VX_INTERPOLATION_TYPE_AREA);
+			if (iw == ow * 2 && ih == oh * 2) ratio_kernel_id = area ? VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_HALF : VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_HALF;
+			else if (iw == ow * 3 && ih == oh * 3) ratio_kernel_id = area ? VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_THIRD : VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_THIRD;
+			else if (iw == ow * 4 && ih == oh * 4) ratio_kernel_id = area ? VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_QUARTER : VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_QUARTER;
+			else if (iw * 2 == ow * 3 && ih * 2 == oh * 3) ratio_kernel_id = area ? VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_TWO_THIRDS : VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_TWO_THIRDS;
+		}
+		if (ratio_kernel_id != VX_KERNEL_AMD_INVALID) {
+			new_kernel_id = ratio_kernel_id;
+		}
+		else if (anode->attr_border_mode.mode == VX_BORDER_MODE_UNDEFINED) {
 			if (interpolation == VX_INTERPOLATION_TYPE_NEAREST_NEIGHBOR) new_kernel_id = VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_NEAREST;
 			else if (interpolation == VX_INTERPOLATION_TYPE_BILINEAR) new_kernel_id = VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR;
 			else if (interpolation == VX_INTERPOLATION_TYPE_AREA) new_kernel_id = VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA;
@@ -780,7 +839,9 @@ int agoDramaDivideIntegralImageNode(AgoNodeList * nodeList, AgoNode * anode)
 	anode->paramList[0] = paramList[1];
 	anode->paramList[1] = paramList[0];
 	anode->paramCount = 2;
-	return agoDramaDivideAppend(nodeList, anode, VX_KERNEL_AMD_INTEGRAL_IMAGE_U32_U8);
+	vx_enum new_kernel_id = VX_KERNEL_AMD_INTEGRAL_IMAGE_U32_U8;
+	if (paramList[1]->u.img.format == VX_DF_IMAGE_U64_AMD) new_kernel_id = VX_KERNEL_AMD_INTEGRAL_IMAGE_U64_U8;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
 }
 
 int agoDramaDivideDilate3x3Node(AgoNodeList * nodeList, AgoNode * anode)
@@ -889,7 +950,13 @@ int agoDramaDivideCustomConvolutionNode(AgoNodeList * nodeList, AgoNode * anode)
 	anode->paramCount = 3;
 	vx_df_image dst_image_format = paramList[2]->u.img.format;
 	vx_enum new_kernel_id = VX_KERNEL_AMD_INVALID;
-	if ((paramList[1]->u.conv.rows & 1) && (paramList[1]->u.conv.columns & 1)) new_kernel_id = (dst_image_format == VX_DF_IMAGE_U8) ? VX_KERNEL_AMD_CONVOLVE_U8_U8 : VX_KERNEL_AMD_CONVOLVE_S16_U8;
+	if ((paramList[1]->u.conv.rows & 1) && (paramList[1]->u.conv.columns & 1)) {
+		new_kernel_id = (dst_image_format == VX_DF_IMAGE_U8) ? VX_KERNEL_AMD_CONVOLVE_U8_U8 : VX_KERNEL_AMD_CONVOLVE_S16_U8;
+		// rank-1 integer matrix: horizontal and vertical passes need M+N instead of M*N multiplies per pixel
+		vx_int16 rowCoeff[AGO_MAX_CONVOLUTION_DIM], colCoeff[AGO_MAX_CONVOLUTION_DIM];
+		if (agoGetSeparableConvolution(paramList[1], rowCoeff, colCoeff))
+			new_kernel_id = (dst_image_format == VX_DF_IMAGE_U8) ? VX_KERNEL_AMD_CONVOLVE_SEPARABLE_U8_U8 : VX_KERNEL_AMD_CONVOLVE_SEPARABLE_S16_U8;
+	}
 	else {
 		agoAddLogEntry(&paramList[1]->ref, VX_FAILURE, "ERROR: agoDramaDivideCustomConvolutionNode: convolution size " VX_FMT_SIZE "x" VX_FMT_SIZE " not supported\n", paramList[1]->u.conv.rows, paramList[1]->u.conv.columns);
 		return -1;
@@ -1989,6 +2056,138 @@ int agoDramaDivideLaplacianReconstructNode(AgoNodeList * nodeList, AgoNode * ano
 	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
 }
 
+int agoDramaDivideTensorAddNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_TENSOR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[3];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[1];
+	anode->paramList[3] = paramList[2];
+	anode->paramCount = 4;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_ADD_DATA_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
+int agoDramaDivideTensorSubtractNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_TENSOR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[3];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[1];
+	anode->paramList[3] = paramList[2];
+	anode->paramCount = 4;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_SUBTRACT_DATA_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
+int agoDramaDivideTensorMultiplyNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[4], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[5], VX_TYPE_TENSOR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[5];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[1];
+	anode->paramList[3] = paramList[2];
+	anode->paramList[4] = paramList[3];
+	anode->paramList[5] = paramList[4];
+	anode->paramCount = 6;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_MULTIPLY_DATA_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
+int agoDramaDivideTensorTableLookupNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_LUT);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_TENSOR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[2];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[1];
+	anode->paramCount = 3;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_TABLE_LOOKUP_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
+int agoDramaDivideTensorTransposeNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_SCALAR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[1];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[2];
+	anode->paramList[3] = paramList[3];
+	anode->paramCount = 4;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_TRANSPOSE_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
+int agoDramaDivideTensorConvertDepthNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[4], VX_TYPE_TENSOR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[4];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[1];
+	anode->paramList[3] = paramList[2];
+	anode->paramList[4] = paramList[3];
+	anode->paramCount = 5;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_CONVERT_DEPTH_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
+int agoDramaDivideTensorMatrixMultiplyNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE_OPTIONAL(anode->paramList[2], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[4], VX_TYPE_TENSOR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[4];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[1];
+	anode->paramList[3] = paramList[2];
+	anode->paramList[4] = paramList[3];
+	anode->paramCount = 5;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_MATRIX_MULTIPLY_DATA_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
 int agoDramaDivideNode(AgoNodeList * nodeList, AgoNode * anode)
 {
 	// save parameter list
@@ -2139,6 +2338,27 @@ int agoDramaDivideNode(AgoNodeList * nodeList, AgoNode * anode)
 		case VX_KERNEL_LAPLACIAN_RECONSTRUCT:
 			status = agoDramaDivideLaplacianReconstructNode(nodeList, anode);
 			break;
+		case VX_KERNEL_TENSOR_ADD:
+			status = agoDramaDivideTensorAddNode(nodeList, anode);
+			break;
+		case VX_KERNEL_TENSOR_SUBTRACT:
+			status = agoDramaDivideTensorSubtractNode(nodeList, anode);
+			break;
+		case VX_KERNEL_TENSOR_MULTIPLY:
+			status = agoDramaDivideTensorMultiplyNode(nodeList, anode);
+			break;
+		case VX_KERNEL_TENSOR_TABLE_LOOKUP:
+			status = agoDramaDivideTensorTableLookupNode(nodeList, anode);
+			break;
+		case VX_KERNEL_TENSOR_TRANSPOSE:
+			status = agoDramaDivideTensorTransposeNode(nodeList, anode);
+			break;
+		case VX_KERNEL_TENSOR_CONVERT_DEPTH:
+			status = agoDramaDivideTensorConvertDepthNode(nodeList, anode);
+			break;
+		case VX_KERNEL_TENSOR_MATRIX_MULTIPLY:
+			status = agoDramaDivideTensorMatrixMultiplyNode(nodeList, anode);
+			break;
 		default:
 			break;
 	}
@@ -0,0 +1,367 @@
+/*
+Copyright (c) 2015 - 2020 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "ago_internal.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// node cost table
+//   each entry keeps the average execution time of a kernel on a given problem size
+//   for CPU [0] and GPU [1]. The table is loaded from and saved to the text file
+//   named by AGO_COST_TABLE, with one entry per line:
+//     transfer <ns-per-byte> <ns-per-copy>
+//     cost <kernel>:<dims> <cpu-count> <cpu-ns> <gpu-count> <gpu-ns>
+#define AGO_COST_TARGET_CPU         0
+#define AGO_COST_TARGET_GPU         1
+#define AGO_COST_AVERAGE_WINDOW     64    // samples beyond this count update the average as a moving average
+#define AGO_COST_PARTITION_PASSES   8     // maximum number of refinement passes over the nodes
+
+std::string agoCostTableKey(AgoNode * node)
+{
+    // the problem size is identified by the dimensions of the first image or tensor parameter
+    char dims[128] = "-";
+    for (vx_uint32 i = 0; i < node->paramCount; i++) {
+        AgoData * data = node->paramList[i];
+        if (!data) continue;
+        if (data->ref.type == VX_TYPE_IMAGE) {
+            sprintf(dims, "%dx%d", data->u.img.width, data->u.img.height);
+            break;
+        }
+        else if (data->ref.type == VX_TYPE_PYRAMID) {
+            sprintf(dims, "%dx%d", data->u.pyr.width, data->u.pyr.height);
+            break;
+        }
+        else if (data->ref.type == VX_TYPE_TENSOR) {
+            dims[0] = '\0';
+            for (vx_size d = 0; d < data->u.tensor.num_dims; d++) {
+                sprintf(dims + strlen(dims), "%s" VX_FMT_SIZE, d ? "x" : "", data->u.tensor.dims[d]);
+            }
+            break;
+        }
+    }
+    return std::string(node->akernel->name) + ":" + dims;
+}
+
+int agoCostTableLoad(AgoContext * acontext)
+{
+    FILE * fp = fopen(acontext->costTableFile.c_str(), "r");
+    if (!fp) {
+        // a missing table is not an error: it gets created when the context is released
+        return 0;
+    }
+    char line[1024], key[512];
+    vx_uint32 lineNum = 0;
+    while (fgets(line, sizeof(line), fp)) {
+        lineNum++;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r')
+            continue;
+        AgoNodeCost cost = { 0 };
+        unsigned long long count[2] = { 0, 0 };
+        vx_float64 perByte = 0, fixed = 0;
+        if (sscanf(line, "transfer %lf %lf", &perByte, &fixed) == 2) {
+            acontext->costTransferPerByte = perByte;
+            acontext->costTransferFixed = fixed;
+        }
+        else if (sscanf(line, "cost %511s %llu %lf %llu %lf", key, &count[0], &cost.time[0], &count[1], &cost.time[1]) == 5) {
+            cost.count[0] = count[0];
+            cost.count[1] = count[1];
+            acontext->costTable[key] = cost;
+        }
+        else {
+            agoAddLogEntry(&acontext->ref, VX_SUCCESS, "WARNING: agoCostTableLoad: %s:%d: ignored invalid line\n", acontext->costTableFile.c_str(), lineNum);
+        }
+    }
+    fclose(fp);
+    return 0;
+}
+
+int agoCostTableSave(AgoContext * acontext)
+{
+    if (acontext->costTableFile.empty())
+        return 0;
+    FILE * fp = fopen(acontext->costTableFile.c_str(), "w");
+    if (!fp) {
+        agoAddLogEntry(&acontext->ref, VX_FAILURE, "ERROR: agoCostTableSave: unable to create: %s\n", acontext->costTableFile.c_str());
+        return -1;
+    }
+    fprintf(fp, "# AGO node cost table: times in nanoseconds\n");
+    fprintf(fp, "transfer %.6f %.1f\n", acontext->costTransferPerByte, acontext->costTransferFixed);
+    for (auto it = acontext->costTable.begin(); it != acontext->costTable.end(); it++) {
+        const AgoNodeCost& cost = it->second;
+        fprintf(fp, "cost %s %llu %.1f %llu %.1f\n", it->first.c_str(),
+            (unsigned long long)cost.count[0], cost.time[0], (unsigned long long)cost.count[1], cost.time[1]);
+    }
+    fclose(fp);
+    acontext->costTableModified = false;
+    return 0;
+}
+
+void agoCostTableSampleBegin(AgoGraph * graph)
+{
+    // nodes that ran in a failed execution must not be sampled by the next successful one
+    for (AgoNode * node = graph->nodeList.head; node; node = node->next)
+        node->cost_perf_num = node->perf.num;
+}
+
+void agoCostTableRecord(AgoGraph * graph)
+{
+    // batched execution measures several frames per node, so only single frame executions are sampled
+    if (graph->batchFrameCount > 1)
+        return;
+    AgoContext * context = graph->ref.context;
+    vx_float64 nsPerClock = 1000000000.0 / (vx_float64)agoGetClockFrequency();
+    CAgoLock lock(context->cs);
+    for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+        // skip nodes that didn't execute (e.g., incremental execution) in this graph execution
+        if (node->perf.num == node->cost_perf_num)
+            continue;
+        vx_uint32 target = AGO_COST_TARGET_CPU;
+        if (node->attr_affinity.device_type == AGO_KERNEL_FLAG_DEVICE_GPU) {
+            // time of a super node can't be split among its nodes
+            if (node->supernode)
+                continue;
+            target = AGO_COST_TARGET_GPU;
+        }
+        AgoNodeCost& cost = context->costTable[agoCostTableKey(node)];
+        if (cost.count[target] < AGO_COST_AVERAGE_WINDOW)
+            cost.count[target]++;
+        cost.time[target] += ((vx_float64)node->perf.tmp * nsPerClock - cost.time[target]) / (vx_float64)cost.count[target];
+        context->costTableModified = true;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// cost based partitioning of nodes between CPU and GPU
+//   graph latency is estimated level by level, since GPU nodes of a hierarchical level
+//   are launched before its CPU nodes execute, plus the copies needed whenever a data
+//   object is produced on one device and consumed on the other.
+struct AgoPartitionNode {
+    AgoNode * node;
+    vx_uint32 target;      // AGO_COST_TARGET_CPU or AGO_COST_TARGET_GPU
+    bool movable;          // cost is known and target can be changed
+    bool supported[2];     // target is supported by the kernel
+    vx_float64 cost[2];    // execution time estimate in nanoseconds (negative if unknown)
+    vx_uint64 count[2];    // number of cost samples
+};
+struct AgoPartitionData {
+    int producer;                  // index of producer node or -1 for data from application
+    std::vector<int> consumers;    // index of consumer nodes
+    vx_float64 transfer;           // time to copy the data between CPU and GPU
+    bool isVirtual;
+};
+
+static vx_float64 agoCostDataBytes(AgoData * data)
+{
+    if (data->ref.type == VX_TYPE_IMAGE) {
+        if (data->children && data->u.img.planes > 1) {
+            vx_float64 bytes = 0;
+            for (vx_uint32 i = 0; i < data->numChildren; i++) {
+                if (data->children[i])
+                    bytes += agoCostDataBytes(data->children[i]);
+            }
+            return bytes;
+        }
+        return (vx_float64)data->u.img.width * data->u.img.height * data->u.img.pixel_size_in_bits_num / (8.0 * data->u.img.pixel_size_in_bits_denom);
+    }
+    return (vx_float64)data->size;
+}
+
+static vx_float64 agoPartitionEstimate(std::vector<AgoPartitionNode>& nodes, std::vector<AgoPartitionData>& dataList)
+{
+    vx_float64 latency = 0, levelTime[2] = { 0, 0 };
+    vx_uint32 level = 0;
+    for (auto& pnode : nodes) {
+        if (pnode.node->hierarchical_level != level) {
+            latency += std::max(levelTime[0], levelTime[1]);
+            levelTime[0] = levelTime[1] = 0;
+            level = pnode.node->hierarchical_level;
+        }
+        if (pnode.cost[pnode.target] > 0)
+            levelTime[pnode.target] += pnode.cost[pnode.target];
+    }
+    latency += std::max(levelTime[0], levelTime[1]);
+    for (auto& pdata : dataList) {
+        // data from the application and outputs returned to it are in CPU memory
+        vx_uint32 source = (pdata.producer >= 0) ? nodes[pdata.producer].target : AGO_COST_TARGET_CPU;
+        bool copied = (source == AGO_COST_TARGET_GPU && !pdata.isVirtual);
+        for (int consumer : pdata.consumers) {
+            if (nodes[consumer].target != source)
+                copied = true;
+        }
+        if (copied)
+            latency += pdata.transfer;
+    }
+    return latency;
+}
+
+static vx_float64 agoPartitionRefine(std::vector<AgoPartitionNode>& nodes, std::vector<AgoPartitionData>& dataList)
+{
+    // greedy refinement: flip one node at a time while the estimate improves
+    vx_float64 best = agoPartitionEstimate(nodes, dataList);
+    for (int pass = 0; pass < AGO_COST_PARTITION_PASSES; pass++) {
+        bool improved = false;
+        for (auto& pnode : nodes) {
+            if (!pnode.movable)
+                continue;
+            pnode.target ^= 1;
+            vx_float64 latency = agoPartitionEstimate(nodes, dataList);
+            if (latency < best) {
+                best = latency;
+                improved = true;
+            }
+            else {
+                pnode.target ^= 1;
+            }
+        }
+        if (!improved)
+            break;
+    }
+    return best;
+}
+
+int agoOptimizeDramaPartition(AgoGraph * agraph, std::vector<AgoNode *>& freeNodeList, vx_uint32& nextAvailGroupId)
+{
+    AgoContext * context = agraph->ref.context;
+    bool mockGpu = context->costMockGpuScale > 0;
+    std::vector<AgoPartitionNode> nodes;
+    std::map<AgoNode *, int> nodeIndex;
+    {
+        CAgoLock lock(context->cs);
+        for (AgoNode * node = agraph->nodeList.head; node; node = node->next) {
+            AgoPartitionNode pnode = { node };
+            pnode.target = (node->attr_affinity.device_type == AGO_KERNEL_FLAG_DEVICE_GPU) ? AGO_COST_TARGET_GPU : AGO_COST_TARGET_CPU;
+            pnode.cost[0] = pnode.cost[1] = -1;
+            auto it = context->costTable.find(agoCostTableKey(node));
+            if (it != context->costTable.end()) {
+                for (int t = 0; t < 2; t++) {
+                    pnode.count[t] = it->second.count[t];
+                    if (pnode.count[t] > 0)
+                        pnode.cost[t] = it->second.time[t];
+                }
+            }
+            pnode.supported[AGO_COST_TARGET_CPU] = (node->target_support_flags & AGO_KERNEL_FLAG_DEVICE_CPU) ? true : false;
+            pnode.supported[AGO_COST_TARGET_GPU] = (node->target_support_flags & AGO_KERNEL_FLAG_DEVICE_GPU) ? true : false;
+            if (mockGpu) {
+                // model GPU from CPU measurements so that partitioning can be exercised without a GPU.
+                // limitation: only node times are modeled; copies between CPU and GPU are estimated from the
+                // costTransfer* parameters alone and are never measured, so the result doesn't predict a real GPU
+                pnode.supported[AGO_COST_TARGET_GPU] = true;
+                pnode.count[AGO_COST_TARGET_GPU] = pnode.count[AGO_COST_TARGET_CPU];
+                if (pnode.cost[AGO_COST_TARGET_CPU] >= 0)
+                    pnode.cost[AGO_COST_TARGET_GPU] = pnode.cost[AGO_COST_TARGET_CPU] * context->costMockGpuScale + context->costMockGpuLaunch;
+            }
+            nodeIndex[node] = (int)nodes.size();
+            nodes.push_back(pnode);
+        }
+    }
+    for (AgoNode * node : freeNodeList) {
+        AgoPartitionNode& pnode = nodes[nodeIndex[node]];
+        pnode.movable = pnode.supported[0] && pnode.supported[1] && pnode.cost[0] >= 0 && pnode.cost[1] >= 0;
+    }
+
+    // choose target for each node
+    if (agraph->targetPartition == VX_TARGET_PARTITION_AMD_CALIBRATE) {
+        // measure the target with fewest samples, so that repeated runs fill the table
+        for (AgoNode * node : freeNodeList) {
+            AgoPartitionNode& pnode = nodes[nodeIndex[node]];
+            if (pnode.supported[0] && pnode.supported[1] && pnode.count[0] != pnode.count[1]) {
+                pnode.target = (pnode.count[AGO_COST_TARGET_GPU] < pnode.count[AGO_COST_TARGET_CPU]) ? AGO_COST_TARGET_GPU : AGO_COST_TARGET_CPU;
+            }
+        }
+    }
+    else {
+        std::vector<AgoPartitionData> dataList;
+        std::map<AgoData *, int> dataIndex;
+        for (size_t index = 0; index < nodes.size(); index++) {
+            AgoNode * node = nodes[index].node;
+            for (vx_uint32 i = 0; i < node->paramCount; i++) {
+                AgoData * data = node->paramList[i];
+                if (!data) continue;
+                auto it = dataIndex.find(data);
+                if (it == dataIndex.end()) {
+                    AgoPartitionData pdata;
+                    pdata.producer = -1;
+                    pdata.transfer = context->costTransferFixed + context->costTransferPerByte * agoCostDataBytes(data);
+                    pdata.isVirtual = data->isVirtual ? true : false;
+                    it = dataIndex.insert(std::pair<AgoData *, int>(data, (int)dataList.size())).first;
+                    dataList.push_back(pdata);
+                }
+                AgoPartitionData& pdata = dataList[it->second];
+                if (node->parameters[i].direction == VX_INPUT)
+                    pdata.consumers.push_back((int)index);
+                else
+                    pdata.producer = (int)index;
+            }
+        }
+        vx_float64 latencyDefault = agoPartitionEstimate(nodes, dataList);
+        // refine from the default assignment, from all-CPU, from all-GPU, and from per-node best targets
+        std::vector<vx_uint32> bestTargets;
+        vx_float64 best = 0;
+        for (int start = 0; start < 4; start++) {
+            for (auto& pnode : nodes) {
+                if (!pnode.movable) continue;
+                if (start == 1) pnode.target = AGO_COST_TARGET_CPU;
+                else if (start == 2) pnode.target = AGO_COST_TARGET_GPU;
+                else if (start == 3) pnode.target = (pnode.cost[AGO_COST_TARGET_GPU] < pnode.cost[AGO_COST_TARGET_CPU]) ? AGO_COST_TARGET_GPU : AGO_COST_TARGET_CPU;
+            }
+            vx_float64 latency = agoPartitionRefine(nodes, dataList);
+            if (start == 0 || latency < best) {
+                best = latency;
+                bestTargets.clear();
+                for (auto& pnode : nodes)
+                    bestTargets.push_back(pnode.target);
+            }
+        }
+        for (size_t index = 0; index < nodes.size(); index++)
+            nodes[index].target = bestTargets[index];
+        agoAddLogEntry(&agraph->ref, VX_SUCCESS, "DEBUG: agoOptimizeDramaPartition: estimated latency %.3f ms with affinity, %.3f ms with cost partition\n",
+            latencyDefault * 1e-6, best * 1e-6);
+    }
+
+    // apply targets to the nodes
+    for (AgoNode * node : freeNodeList) {
+        AgoPartitionNode& pnode = nodes[nodeIndex[node]];
+        bool applied = false;
+        if (pnode.target == AGO_COST_TARGET_GPU && (node->target_support_flags & AGO_KERNEL_FLAG_DEVICE_GPU)) {
+            if (node->attr_affinity.device_type != AGO_KERNEL_FLAG_DEVICE_GPU) {
+                node->attr_affinity.device_type = AGO_KERNEL_FLAG_DEVICE_GPU;
+                node->attr_affinity.device_info = 0;
+                node->attr_affinity.group = 0;
+                if (node->target_support_flags & (AGO_KERNEL_FLAG_GPU_INTEG_R2R | AGO_KERNEL_FLAG_GPU_INTEG_M2R)) {
+                    // use an unsed group Id
+                    node->attr_affinity.group = nextAvailGroupId++;
+                }
+            }
+            applied = true;
+        }
+        else if (pnode.target == AGO_COST_TARGET_CPU && (node->target_support_flags & AGO_KERNEL_FLAG_DEVICE_CPU)) {
+            node->attr_affinity.device_type = AGO_KERNEL_FLAG_DEVICE_CPU;
+            node->attr_affinity.device_info = 0;
+            node->attr_affinity.group = 0;
+            applied = true;
+        }
+        agoAddLogEntry(&node->ref, VX_SUCCESS, "DEBUG: agoOptimizeDramaPartition: %s => %s%s (cpu %.0f ns, gpu %.0f ns)\n",
+            node->akernel->name, pnode.target == AGO_COST_TARGET_GPU ? "GPU" : "CPU", applied ? "" : " (not supported)",
+            pnode.cost[AGO_COST_TARGET_CPU], pnode.cost[AGO_COST_TARGET_GPU]);
+    }
+    return 0;
+}
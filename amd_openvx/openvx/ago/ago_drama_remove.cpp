@@ -834,6 +834,24 @@ static AgoNodeMergeRule s_merge_rule[] = {
 				{ VX_KERNEL_AMD_SET_FF_U8, { 2 } },
 			}
 		},
+		{ // SCALE-AREA 1/2 and 1/4 to SCALE-AREA 1/2+1/4
+			{
+				{ VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_HALF, { 2, 1 } },
+				{ VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_QUARTER, { 3, 1 } },
+			},
+			{
+				{ VX_KERNEL_AMD_SCALE_IMAGE_U8U8_U8_AREA_HALF_QUARTER, { 2, 3, 1 } },
+			}
+		},
+		{ // SCALE-BILINEAR 1/2 and 1/4 to SCALE-BILINEAR 1/2+1/4
+			{
+				{ VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_HALF, { 2, 1 } },
+				{ VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_QUARTER, { 3, 1 } },
+			},
+			{
+				{ VX_KERNEL_AMD_SCALE_IMAGE_U8U8_U8_BILINEAR_HALF_QUARTER, { 2, 3, 1 } },
+			}
+		},
 };
 static vx_uint32 s_merge_rule_count = sizeof(s_merge_rule) / sizeof(s_merge_rule[0]);
 
@@ -1839,6 +1839,112 @@ int HafCpu_ColorConvert_UV12_RGBX
 		vx_uint8    * pSrcImage,
 		vx_uint32     srcImageStrideInBytes
 	);
+// P010/P016: 16-bit luma plane and interleaved 16-bit chroma plane (P010 samples in most significant 10 bits)
+int HafCpu_ColorConvert_RGB_P016
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcLumaImage,
+		vx_uint32     srcLumaImageStrideInBytes,
+		vx_uint8    * pSrcChromaImage,
+		vx_uint32     srcChromaImageStrideInBytes
+	);
+int HafCpu_ColorConvert_RGBX_P016
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcLumaImage,
+		vx_uint32     srcLumaImageStrideInBytes,
+		vx_uint8    * pSrcChromaImage,
+		vx_uint32     srcChromaImageStrideInBytes
+	);
+int HafCpu_ColorConvert_P010_RGB
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	);
+int HafCpu_ColorConvert_P010_RGBX
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	);
+int HafCpu_ColorConvert_P016_RGB
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	);
+int HafCpu_ColorConvert_P016_RGBX
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	);
+int HafCpu_FormatConvert_NV12_P016
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcLumaImage,
+		vx_uint32     srcLumaImageStrideInBytes,
+		vx_uint8    * pSrcChromaImage,
+		vx_uint32     srcChromaImageStrideInBytes
+	);
+int HafCpu_FormatConvert_P010_NV12
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcLumaImage,
+		vx_uint32     srcLumaImageStrideInBytes,
+		vx_uint8    * pSrcChromaImage,
+		vx_uint32     srcChromaImageStrideInBytes
+	);
+int HafCpu_FormatConvert_P016_NV12
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcLumaImage,
+		vx_uint32     srcLumaImageStrideInBytes,
+		vx_uint8    * pSrcChromaImage,
+		vx_uint32     srcChromaImageStrideInBytes
+	);
 int HafCpu_Box_U8_U8_3x3
 	(
 		vx_uint32     dstWidth,
@@ -2042,6 +2148,36 @@ int HafCpu_Convolve_S16_U8_MxN
 		vx_uint32     convolutionHeight,
 		vx_int32      shift
 	);
+int HafCpu_ConvolveSeparable_U8_U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		vx_int16    * rowCoeff,
+		vx_uint32     convolutionWidth,
+		vx_int16    * colCoeff,
+		vx_uint32     convolutionHeight,
+		vx_int32      shift,
+		vx_int32    * pRowBuffer
+	);
+int HafCpu_ConvolveSeparable_S16_U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		vx_int16    * rowCoeff,
+		vx_uint32     convolutionWidth,
+		vx_int16    * colCoeff,
+		vx_uint32     convolutionHeight,
+		vx_int32      shift,
+		vx_int32    * pRowBuffer
+	);
 int HafCpu_SobelMagnitude_S16_U8_3x3
 	(
 		vx_uint32     dstWidth,
@@ -2481,6 +2617,44 @@ int HafCpu_Remap_U8_U8_Bilinear_Constant
 		vx_uint32              mapStrideInBytes,
 		vx_uint8               border
 	);
+// Remap tables in fast format: each row has (tableStrideInBytes/8) source byte offsets (vx_int32) of the
+// top-left neighbor followed by as many packed bilinear weights (4 x vx_uint8 in 1/64 units) of
+// the [x,y], [x+1,y], [x,y+1], [x+1,y+1] neighbors. Constant border locations have all weights zero.
+int HafCpu_Remap_Prepare_Bilinear_Table
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint32              srcImageStrideInBytes,
+		vx_int32             * pTable,
+		vx_uint32              tableStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits,
+		bool                   constantBorder
+	);
+int HafCpu_Remap_U8_U8_Bilinear_Table
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		vx_int32             * pTable,
+		vx_uint32              tableStrideInBytes
+	);
+int HafCpu_Remap_U8_U8_Bilinear_Constant_Table
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		vx_int32             * pTable,
+		vx_uint32              tableStrideInBytes,
+		vx_uint8               border
+	);
 int HafCpu_WarpAffine_U8_U8_Nearest
 	(
 		vx_uint32             dstWidth,
@@ -2664,6 +2838,100 @@ int HafCpu_ScaleImage_U8_U8_Area
 		vx_uint32            srcImageStrideInBytes,
 		ago_scale_matrix_t * matrix
 	);
+int HafCpu_ScaleImage_U8_U8_Area_Half
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	);
+int HafCpu_ScaleImage_U8_U8_Area_Third
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	);
+int HafCpu_ScaleImage_U8_U8_Area_Quarter
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	);
+int HafCpu_ScaleImage_U8_U8_Area_TwoThirds
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	);
+int HafCpu_ScaleImage_U8_U8_Bilinear_Half
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	);
+int HafCpu_ScaleImage_U8_U8_Bilinear_Third
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	);
+int HafCpu_ScaleImage_U8_U8_Bilinear_Quarter
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	);
+int HafCpu_ScaleImage_U8_U8_Bilinear_TwoThirds
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	);
+int HafCpu_ScaleImage_U8U8_U8_Area_HalfQuarter
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstHalfImage,
+		vx_uint32            dstHalfImageStrideInBytes,
+		vx_uint8           * pDstQuarterImage,
+		vx_uint32            dstQuarterImageStrideInBytes,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	);
+int HafCpu_ScaleImage_U8U8_U8_Bilinear_HalfQuarter
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstHalfImage,
+		vx_uint32            dstHalfImageStrideInBytes,
+		vx_uint8           * pDstQuarterImage,
+		vx_uint32            dstQuarterImageStrideInBytes,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	);
 int HafCpu_OpticalFlowPyrLK_XY_XY_Generic
 (
 	vx_keypoint_t      newKeyPoint[],
@@ -2731,6 +2999,51 @@ int HafCpu_IntegralImage_U32_U8
 		vx_uint8    * pSrcImage,
 		vx_uint32     srcImageStrideInBytes
 	);
+// Integral image of a horizontal strip: pass 1 computes local sums of the strip with
+// HafCpu_IntegralImageStrip_*, pass 2 adds the last row above the strip with HafCpu_IntegralImageCarry_*
+int HafCpu_IntegralImageStrip_U32_U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint32   * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	);
+int HafCpu_IntegralImageCarry_U32
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint32   * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint32   * pCarryRow
+	);
+int HafCpu_IntegralImage_U64_U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint64   * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	);
+int HafCpu_IntegralImageStrip_U64_U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint64   * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	);
+int HafCpu_IntegralImageCarry_U64
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint64   * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint64   * pCarryRow
+	);
 int HafCpu_Histogram_DATA_U8
 	(
 		vx_uint32     dstHist[],
@@ -3117,4 +3430,109 @@ int HafCpu_LaplacianReconstruct_DATA_DATA_DATA
 	vx_image input,
 	vx_image output
 );
+
+int HafCpu_TensorAdd_DATA_DATA_DATA
+	(
+		vx_enum           dataType,
+		vx_enum           overflowPolicy,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc1,
+		const vx_size   * src1Stride,
+		const vx_uint8  * pSrc2,
+		const vx_size   * src2Stride
+	);
+
+int HafCpu_TensorSubtract_DATA_DATA_DATA
+	(
+		vx_enum           dataType,
+		vx_enum           overflowPolicy,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc1,
+		const vx_size   * src1Stride,
+		const vx_uint8  * pSrc2,
+		const vx_size   * src2Stride
+	);
+
+int HafCpu_TensorMultiply_DATA_DATA_DATA
+	(
+		vx_enum           dataType,
+		vx_uint32         fixedPointPos,
+		vx_float32        scale,
+		vx_enum           overflowPolicy,
+		vx_enum           roundingPolicy,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc1,
+		const vx_size   * src1Stride,
+		const vx_uint8  * pSrc2,
+		const vx_size   * src2Stride
+	);
+
+int HafCpu_TensorTableLookup_DATA_DATA
+	(
+		vx_enum           dataType,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc,
+		const vx_size   * srcStride,
+		const vx_uint8  * pLut,
+		vx_uint32         lutCount,
+		vx_uint32         lutOffset
+	);
+
+int HafCpu_TensorTranspose_DATA_DATA
+	(
+		vx_size           elemSize,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc,
+		const vx_size   * srcStride,
+		vx_size           dim1,
+		vx_size           dim2
+	);
+
+int HafCpu_TensorConvertDepth_DATA_DATA
+	(
+		vx_enum           dstType,
+		vx_uint32         dstFixedPointPos,
+		vx_enum           srcType,
+		vx_uint32         srcFixedPointPos,
+		vx_enum           overflowPolicy,
+		vx_float32        norm,
+		vx_float32        offset,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc,
+		const vx_size   * srcStride
+	);
+
+int HafCpu_TensorMatrixMultiply_DATA_DATA_DATA
+	(
+		vx_enum           dataType,
+		vx_uint32         fixedPointPos,
+		vx_size           M,
+		vx_size           N,
+		vx_size           K,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc1,
+		const vx_size   * src1Stride,
+		bool              transpose1,
+		const vx_uint8  * pSrc2,
+		const vx_size   * src2Stride,
+		bool              transpose2,
+		const vx_uint8  * pSrc3,
+		const vx_size   * src3Stride,
+		bool              transpose3,
+		vx_uint8        * pScratch
+	);
+
 #endif // __ago_haf_cpu_h__
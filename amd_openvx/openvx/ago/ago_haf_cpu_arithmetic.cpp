@@ -7054,6 +7054,138 @@ int HafCpu_MeanStdDevMerge_DATA_DATA
 	return AGO_SUCCESS;
 }
 
+/*
+Integral image is computed in horizontal strips so that the strips can be processed independently:
+  pass 1: HafCpu_IntegralImageStrip_* computes the local integral image of a strip (i.e., as if strip starts at row 0)
+  pass 2: HafCpu_IntegralImageCarry_* adds the last row of the integral image above the strip (the carry) to all rows of the strip
+The row prefix sums are computed in registers: 16 pixels in 16-bit lanes (max 16*255 fits) and then widened to 32-bit lanes.
+*/
+static inline __m128i HafCpu_PrefixSum8_U16(__m128i v)
+{
+	v = _mm_add_epi16(v, _mm_slli_si128(v, 2));
+	v = _mm_add_epi16(v, _mm_slli_si128(v, 4));
+	v = _mm_add_epi16(v, _mm_slli_si128(v, 8));
+	return v;
+}
+
+int HafCpu_IntegralImageStrip_U32_U8
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint32   * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	const __m128i zeromask = _mm_setzero_si128();
+	vx_uint32 alignedWidth = dstWidth & ~15;
+	vx_uint32 * pPrevRow = nullptr;
+	for (vx_uint32 y = 0; y < dstHeight; y++)
+	{
+		vx_uint8 * pSrcRow = pSrcImage + y * srcImageStrideInBytes;
+		vx_uint32 * pDstRow = (vx_uint32 *)((vx_uint8 *)pDstImage + y * dstImageStrideInBytes);
+		vx_uint32 x = 0;
+#if USE_AVX2
+		__m256i rowsum = _mm256_setzero_si256();
+		const __m256i lastlane = _mm256_set1_epi32(7);
+		for (; x < (dstWidth & ~31); x += 32)
+		{
+			// prefix sums of 8 pixels in each 128-bit lane
+			__m256i pixels1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)&pSrcRow[x]));
+			__m256i pixels2 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)&pSrcRow[x + 16]));
+			pixels1 = _mm256_add_epi16(pixels1, _mm256_slli_si256(pixels1, 2));
+			pixels2 = _mm256_add_epi16(pixels2, _mm256_slli_si256(pixels2, 2));
+			pixels1 = _mm256_add_epi16(pixels1, _mm256_slli_si256(pixels1, 4));
+			pixels2 = _mm256_add_epi16(pixels2, _mm256_slli_si256(pixels2, 4));
+			pixels1 = _mm256_add_epi16(pixels1, _mm256_slli_si256(pixels1, 8));
+			pixels2 = _mm256_add_epi16(pixels2, _mm256_slli_si256(pixels2, 8));
+			// widen to dwords and propagate the running sum across the groups of 8 pixels
+			__m256i sum[4];
+			sum[0] = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(pixels1));
+			sum[1] = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(pixels1, 1));
+			sum[2] = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(pixels2));
+			sum[3] = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(pixels2, 1));
+			for (int i = 0; i < 4; i++)
+			{
+				sum[i] = _mm256_add_epi32(sum[i], rowsum);
+				rowsum = _mm256_permutevar8x32_epi32(sum[i], lastlane);
+				if (pPrevRow)
+					sum[i] = _mm256_add_epi32(sum[i], _mm256_loadu_si256((const __m256i *)&pPrevRow[x + 8 * i]));
+				_mm256_storeu_si256((__m256i *)&pDstRow[x + 8 * i], sum[i]);
+			}
+		}
+		__m128i prevsum = _mm256_castsi256_si128(rowsum);
+#else
+		__m128i prevsum = _mm_setzero_si128();
+#endif
+		for (; x < alignedWidth; x += 16)
+		{
+			__m128i pixels1 = _mm_loadu_si128((const __m128i *)&pSrcRow[x]);
+			__m128i pixels2 = _mm_unpackhi_epi8(pixels1, zeromask);
+			pixels1 = _mm_cvtepu8_epi16(pixels1);
+			pixels1 = HafCpu_PrefixSum8_U16(pixels1);
+			pixels2 = HafCpu_PrefixSum8_U16(pixels2);
+			// for the second 8 sum, add the last of first 8
+			pixels2 = _mm_add_epi16(pixels2, _mm_shuffle_epi32(_mm_shufflehi_epi16(pixels1, 0xff), 0xff));
+			__m128i sum[4];
+			sum[0] = _mm_add_epi32(_mm_cvtepu16_epi32(pixels1), prevsum);
+			sum[1] = _mm_add_epi32(_mm_unpackhi_epi16(pixels1, zeromask), prevsum);
+			sum[2] = _mm_add_epi32(_mm_cvtepu16_epi32(pixels2), prevsum);
+			sum[3] = _mm_add_epi32(_mm_unpackhi_epi16(pixels2, zeromask), prevsum);
+			prevsum = _mm_shuffle_epi32(sum[3], 0xff);
+			for (int i = 0; i < 4; i++)
+			{
+				if (pPrevRow)
+					sum[i] = _mm_add_epi32(sum[i], _mm_loadu_si128((const __m128i *)&pPrevRow[x + 4 * i]));
+				_mm_storeu_si128((__m128i *)&pDstRow[x + 4 * i], sum[i]);
+			}
+		}
+		// process extra pixels if any
+		vx_uint32 rowsum32 = (vx_uint32)_mm_cvtsi128_si32(prevsum);
+		for (; x < dstWidth; x++)
+		{
+			rowsum32 += pSrcRow[x];
+			pDstRow[x] = rowsum32 + (pPrevRow ? pPrevRow[x] : 0);
+		}
+		pPrevRow = pDstRow;
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_IntegralImageCarry_U32
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint32   * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint32   * pCarryRow
+)
+{
+	for (vx_uint32 y = 0; y < dstHeight; y++)
+	{
+		vx_uint32 * pDstRow = (vx_uint32 *)((vx_uint8 *)pDstImage + y * dstImageStrideInBytes);
+		vx_uint32 x = 0;
+#if USE_AVX2
+		for (; x < (dstWidth & ~7); x += 8)
+		{
+			__m256i sum = _mm256_loadu_si256((const __m256i *)&pDstRow[x]);
+			sum = _mm256_add_epi32(sum, _mm256_loadu_si256((const __m256i *)&pCarryRow[x]));
+			_mm256_storeu_si256((__m256i *)&pDstRow[x], sum);
+		}
+#endif
+		for (; x < (dstWidth & ~3); x += 4)
+		{
+			__m128i sum = _mm_loadu_si128((const __m128i *)&pDstRow[x]);
+			sum = _mm_add_epi32(sum, _mm_loadu_si128((const __m128i *)&pCarryRow[x]));
+			_mm_storeu_si128((__m128i *)&pDstRow[x], sum);
+		}
+		for (; x < dstWidth; x++)
+			pDstRow[x] += pCarryRow[x];
+	}
+	return AGO_SUCCESS;
+}
+
 int HafCpu_IntegralImage_U32_U8
 (
 	vx_uint32     dstWidth,
@@ -7064,165 +7196,100 @@ int HafCpu_IntegralImage_U32_U8
 	vx_uint32     srcImageStrideInBytes
 )
 {
-	__m128i pixels1, pixels2, pixels3, pixels4;
-	__m128i zeromask = _mm_setzero_si128();
-	// process 16 at a time (shift and add for cur and previous)
-	unsigned char *pSrcImage1 = pSrcImage;
-	unsigned char *pchDst = (unsigned char*)pDstImage;
-	unsigned char *pchDstlast = (unsigned char*)pDstImage + dstHeight*dstImageStrideInBytes;
-	
-	while (pchDst < pchDstlast)
+	// whole image is a single strip without carry
+	return HafCpu_IntegralImageStrip_U32_U8(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage, srcImageStrideInBytes);
+}
+
+int HafCpu_IntegralImageStrip_U64_U8
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint64   * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	const __m128i zeromask = _mm_setzero_si128();
+	vx_uint32 alignedWidth = dstWidth & ~15;
+	vx_uint64 * pPrevRow = nullptr;
+	for (vx_uint32 y = 0; y < dstHeight; y++)
 	{
-		__m128i * src = (__m128i*)pSrcImage1;
-		__m128i * dst = (__m128i*)pchDst;
-		__m128i * dstlast = dst + (dstWidth >> 2);
+		vx_uint8 * pSrcRow = pSrcImage + y * srcImageStrideInBytes;
+		vx_uint64 * pDstRow = (vx_uint64 *)((vx_uint8 *)pDstImage + y * dstImageStrideInBytes);
 		__m128i prevsum = _mm_setzero_si128();
-		if (pSrcImage1 == pSrcImage){
-			while (dst < dstlast)
-			{
-				pixels1 = _mm_loadu_si128(src++);		// src (0-15)
-				pixels2 = _mm_unpackhi_epi8(pixels1, zeromask);
-				pixels1 = _mm_cvtepu8_epi16(pixels1);
-				// shift and add
-				pixels3 = pixels1;
-				pixels4 = pixels2;
-				for (int i = 0; i < 7; i++)
-				{
-					pixels3 = _mm_slli_si128(pixels3, 2);
-					pixels4 = _mm_slli_si128(pixels4, 2);
-					pixels1 = _mm_add_epi16(pixels1, pixels3);
-					pixels2 = _mm_add_epi16(pixels2, pixels4);
-				}
-				// for the second 8 sum, add to the first 8
-				pixels3 = _mm_shufflehi_epi16(pixels1, 0xff);
-				pixels3 = _mm_shuffle_epi32(pixels3, 0xff);
-				pixels2 = _mm_add_epi16(pixels2, pixels3);
-				// unpack to dwords and add with prevsum
-				pixels3 = _mm_unpackhi_epi16(pixels1, zeromask);
-				pixels4 = _mm_unpackhi_epi16(pixels2, zeromask);
-				pixels1 = _mm_cvtepu16_epi32(pixels1);
-				pixels2 = _mm_cvtepu16_epi32(pixels2);
-				pixels1 = _mm_add_epi32(pixels1, prevsum);
-				pixels2 = _mm_add_epi32(pixels2, prevsum);
-				pixels3 = _mm_add_epi32(pixels3, prevsum);
-				pixels4 = _mm_add_epi32(pixels4, prevsum);
-
-				// copy to dst (sum in words)
-				_mm_store_si128(dst++, pixels1);
-				_mm_store_si128(dst++, pixels3);
-				_mm_store_si128(dst++, pixels2);
-				_mm_store_si128(dst++, pixels4);
-				prevsum = _mm_shuffle_epi32(pixels4, 0xff);
-
+		vx_uint32 x = 0;
+		for (; x < alignedWidth; x += 16)
+		{
+			__m128i pixels1 = _mm_loadu_si128((const __m128i *)&pSrcRow[x]);
+			__m128i pixels2 = _mm_unpackhi_epi8(pixels1, zeromask);
+			pixels1 = _mm_cvtepu8_epi16(pixels1);
+			pixels1 = HafCpu_PrefixSum8_U16(pixels1);
+			pixels2 = HafCpu_PrefixSum8_U16(pixels2);
+			pixels2 = _mm_add_epi16(pixels2, _mm_shuffle_epi32(_mm_shufflehi_epi16(pixels1, 0xff), 0xff));
+			// local sums of 16 pixels fit in 16 bits: widen to qwords and add the running row sum
+			__m128i words[2] = { pixels1, pixels2 };
+			for (int i = 0; i < 8; i++)
+			{
+				__m128i sum = _mm_add_epi64(_mm_cvtepu16_epi64(words[i >> 2]), prevsum);
+				words[i >> 2] = _mm_srli_si128(words[i >> 2], 4);
+				if (i == 7)
+					prevsum = _mm_unpackhi_epi64(sum, sum);
+				if (pPrevRow)
+					sum = _mm_add_epi64(sum, _mm_loadu_si128((const __m128i *)&pPrevRow[x + 2 * i]));
+				_mm_storeu_si128((__m128i *)&pDstRow[x + 2 * i], sum);
 			}
 		}
-		else
+		// process extra pixels if any
+		vx_uint64 rowsum64 = (vx_uint64)_mm_cvtsi128_si64(prevsum);
+		for (; x < dstWidth; x++)
 		{
-			unsigned int prev_dword = 0;
-			__m128i prevdword = _mm_setzero_si128();
-			__m128i prevsum1 = _mm_setzero_si128();
-			__m128i * prevdst = (__m128i*)(pchDst - dstImageStrideInBytes);
-			while (dst < dstlast)
-			{
-				__m128i prev1, prev2, prev3, prev4, temp, temp1, temp2, temp3;
-				pixels1 = _mm_loadu_si128(src++);		// src (0-15)
-				pixels2 = _mm_unpackhi_epi8(pixels1, zeromask);
-				pixels1 = _mm_cvtepu8_epi16(pixels1);
-				// shift and add
-				pixels3 = pixels1;
-				pixels4 = pixels2;
-				for (int i = 0; i < 7; i++)
-				{
-					pixels3 = _mm_slli_si128(pixels3, 2);
-					pixels4 = _mm_slli_si128(pixels4, 2);
-					pixels1 = _mm_add_epi16(pixels1, pixels3);
-					pixels2 = _mm_add_epi16(pixels2, pixels4);
-				}
-				// for the second 8 sum, add to the first 8
-				pixels3 = _mm_shufflehi_epi16(pixels1, 0xff);
-				pixels3 = _mm_shuffle_epi32(pixels3, 0xff);
-				pixels2 = _mm_add_epi16(pixels2, pixels3);
-				// unpack to dwords and add with prevsum
-				pixels3 = _mm_unpackhi_epi16(pixels1, zeromask);
-				pixels4 = _mm_unpackhi_epi16(pixels2, zeromask);
-				pixels1 = _mm_cvtepu16_epi32(pixels1);
-				pixels2 = _mm_cvtepu16_epi32(pixels2);
-
-				// calculate with prevsum(x) - prevsum(x-1)
-				prev1 = _mm_load_si128(prevdst++);
-
-				// subtract sum(x-1, y-1)
-				temp = _mm_srli_si128(prev1, 12);
-				temp1 = _mm_slli_si128(prev1, 4);
-				prev2 = _mm_load_si128(prevdst++);
-				temp1 = _mm_or_si128(temp1, prevdword);
-				prev1 = _mm_sub_epi32(prev1, temp1);
-
-				prevdword = _mm_srli_si128(prev2, 12);
-				temp1 = _mm_slli_si128(prev2, 4);
-				prev3 = _mm_load_si128(prevdst++);
-				temp1 = _mm_or_si128(temp1, temp);
-				prev2 = _mm_sub_epi32(prev2, temp1);
-
-				temp = _mm_srli_si128(prev3, 12);
-				temp1 = _mm_slli_si128(prev3, 4);
-				prev4 = _mm_load_si128(prevdst++);
-				temp1 = _mm_or_si128(temp1, prevdword);
-				prev3 = _mm_sub_epi32(prev3, temp1);
-
-				prevdword = _mm_srli_si128(prev4, 12);
-				temp1 = _mm_slli_si128(prev4, 4);
-				temp1 = _mm_or_si128(temp1, temp);
-				prev4 = _mm_sub_epi32(prev4, temp1);
-				temp = prev1;
-				temp1 = prev2;
-				temp2 = prev3;
-				temp3 = prev4;
-
-				for (int i = 0; i < 3; i++)
-				{
-					temp = _mm_slli_si128(temp, 4);
-					temp1 = _mm_slli_si128(temp1, 4);
-					temp2 = _mm_slli_si128(temp2, 4);
-					temp3 = _mm_slli_si128(temp3, 4);
-					prev1 = _mm_add_epi32(prev1, temp);
-					prev2 = _mm_add_epi32(prev2, temp1);
-					prev3 = _mm_add_epi32(prev3, temp2);
-					prev4 = _mm_add_epi32(prev4, temp3);
-				}
-				// for the second 4 sum, add to the first 4
-				temp = _mm_shuffle_epi32(prev1, 0xff);
-				prev2 = _mm_add_epi32(prev2, temp);
-				temp1 = _mm_shuffle_epi32(prev2, 0xff);
-				prev3 = _mm_add_epi32(prev3, temp1);
-				temp = _mm_shuffle_epi32(prev3, 0xff);
-				prev4 = _mm_add_epi32(prev4, temp);
-
-				// add to pixels1 to pixels4
-				pixels1 = _mm_add_epi32(pixels1, prev1);
-				pixels3 = _mm_add_epi32(pixels3, prev2);
-				pixels2 = _mm_add_epi32(pixels2, prev3);
-				pixels4 = _mm_add_epi32(pixels4, prev4);
-				prevsum1 = _mm_shuffle_epi32(prev4, 0xff);
-
-				pixels1 = _mm_add_epi32(pixels1, prevsum);
-				pixels3 = _mm_add_epi32(pixels3, prevsum);
-				pixels2 = _mm_add_epi32(pixels2, prevsum);
-				pixels4 = _mm_add_epi32(pixels4, prevsum);
-				// copy to dst (sum in words)
-				_mm_store_si128(dst++, pixels1);
-				_mm_store_si128(dst++, pixels3);
-				_mm_store_si128(dst++, pixels2);
-				_mm_store_si128(dst++, pixels4);
-				prevsum = _mm_shuffle_epi32(pixels4, 0xff);
-			}
+			rowsum64 += pSrcRow[x];
+			pDstRow[x] = rowsum64 + (pPrevRow ? pPrevRow[x] : 0);
 		}
-		pSrcImage1 += srcImageStrideInBytes;
-		pchDst += dstImageStrideInBytes;
+		pPrevRow = pDstRow;
 	}
 	return AGO_SUCCESS;
 }
 
+int HafCpu_IntegralImageCarry_U64
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint64   * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint64   * pCarryRow
+)
+{
+	for (vx_uint32 y = 0; y < dstHeight; y++)
+	{
+		vx_uint64 * pDstRow = (vx_uint64 *)((vx_uint8 *)pDstImage + y * dstImageStrideInBytes);
+		vx_uint32 x = 0;
+		for (; x < (dstWidth & ~1); x += 2)
+		{
+			__m128i sum = _mm_loadu_si128((const __m128i *)&pDstRow[x]);
+			sum = _mm_add_epi64(sum, _mm_loadu_si128((const __m128i *)&pCarryRow[x]));
+			_mm_storeu_si128((__m128i *)&pDstRow[x], sum);
+		}
+		for (; x < dstWidth; x++)
+			pDstRow[x] += pCarryRow[x];
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_IntegralImage_U64_U8
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint64   * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	return HafCpu_IntegralImageStrip_U64_U8(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage, srcImageStrideInBytes);
+}
+
 #if 0
 // keeping the implementation in case we need it in future
 int HafCpu_Histogram_DATA_U8
@@ -4800,3 +4800,415 @@ int HafCpu_FormatConvert_UV_UV12
 	}
 	return AGO_SUCCESS;
 }
+
+/*
+10/16-bit YUV 4:2:0 formats (P010 and P016) have a 16-bit Y plane and an interleaved 16-bit UV plane.
+P010 keeps the 10-bit samples in the most significant bits, so the conversions to 8-bit formats
+take the most significant byte (or scale by 1/257) and work for both P010 and P016.
+*/
+static inline void HafCpu_ColorConvert_RGBX_P016_Pixels
+	(
+		__m128 Y,
+		__m128 U,
+		__m128 V,
+		vx_uint8 * pDst,
+		bool rgbx
+	)
+{
+	// BT 709 conversion factors with scaling from 16-bit to 8-bit range
+	const __m128 scale = _mm_set1_ps(1.0f / 257.0f);
+	__m128 R = _mm_mul_ps(_mm_add_ps(Y, _mm_mul_ps(V, _mm_set1_ps(1.5748f))), scale);
+	__m128 G = _mm_mul_ps(_mm_sub_ps(Y, _mm_add_ps(_mm_mul_ps(U, _mm_set1_ps(0.1873f)), _mm_mul_ps(V, _mm_set1_ps(0.4681f)))), scale);
+	__m128 B = _mm_mul_ps(_mm_add_ps(Y, _mm_mul_ps(U, _mm_set1_ps(1.8556f))), scale);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i maxval = _mm_set1_epi32(255);
+	__m128i r = _mm_min_epi32(_mm_max_epi32(_mm_cvtps_epi32(R), zero), maxval);
+	__m128i g = _mm_min_epi32(_mm_max_epi32(_mm_cvtps_epi32(G), zero), maxval);
+	__m128i b = _mm_min_epi32(_mm_max_epi32(_mm_cvtps_epi32(B), zero), maxval);
+	__m128i pixels = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)), _mm_or_si128(_mm_slli_epi32(b, 16), _mm_set1_epi32((int)0xFF000000)));
+	if (rgbx) {
+		_mm_storeu_si128((__m128i *)pDst, pixels);
+	}
+	else {
+		pixels = _mm_shuffle_epi8(pixels, _mm_load_si128((__m128i *)dataColorConvert + 8));
+		_mm_storel_epi64((__m128i *)pDst, pixels);
+		*(int *)(pDst + 8) = _mm_extract_epi32(pixels, 2);
+	}
+}
+
+static inline int HafCpu_ColorConvert_RGBX_P016_Process
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcLumaImage,
+		vx_uint32     srcLumaImageStrideInBytes,
+		vx_uint8    * pSrcChromaImage,
+		vx_uint32     srcChromaImageStrideInBytes,
+		bool          rgbx
+	)
+{
+	int alignedWidth = dstWidth & ~3;
+	int bytesPerPixel = rgbx ? 4 : 3;
+	const __m128 const32768 = _mm_set1_ps(32768.0f);
+
+	for (int height = 0; height < (int)dstHeight; height += 2)
+	{
+		vx_uint16 * pLocalSrcLuma0 = (vx_uint16 *)pSrcLumaImage;
+		vx_uint16 * pLocalSrcLuma1 = (vx_uint16 *)(pSrcLumaImage + srcLumaImageStrideInBytes);
+		vx_uint16 * pLocalSrcChroma = (vx_uint16 *)pSrcChromaImage;
+		vx_uint8 * pLocalDst0 = pDstImage;
+		vx_uint8 * pLocalDst1 = pDstImage + dstImageStrideInBytes;
+
+		int width = 0;
+		for (; width < alignedWidth; width += 4)	// Process 4 pixels from two rows at a time
+		{
+			__m128 Y0 = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i *)&pLocalSrcLuma0[width])));
+			__m128 Y1 = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i *)&pLocalSrcLuma1[width])));
+			__m128 UV = _mm_sub_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i *)&pLocalSrcChroma[width]))), const32768);
+			__m128 U = _mm_shuffle_ps(UV, UV, _MM_SHUFFLE(2, 2, 0, 0));
+			__m128 V = _mm_shuffle_ps(UV, UV, _MM_SHUFFLE(3, 3, 1, 1));
+			HafCpu_ColorConvert_RGBX_P016_Pixels(Y0, U, V, pLocalDst0 + width * bytesPerPixel, rgbx);
+			HafCpu_ColorConvert_RGBX_P016_Pixels(Y1, U, V, pLocalDst1 + width * bytesPerPixel, rgbx);
+		}
+
+		for (; width < (int)dstWidth; width += 2)		// Processing two pixels at a time in a row
+		{
+			float Upix = (float)pLocalSrcChroma[width] - 32768.0f;
+			float Vpix = (float)pLocalSrcChroma[width + 1] - 32768.0f;
+			float Rpix = Vpix * 1.5748f;
+			float Gpix = (Upix * 0.1873f) + (Vpix * 0.4681f);
+			float Bpix = Upix * 1.8556f;
+			for (int i = 0; i < 4; i++)
+			{
+				float Ypix = (float)((i < 2) ? pLocalSrcLuma0 : pLocalSrcLuma1)[width + (i & 1)];
+				vx_uint8 * pDst = ((i < 2) ? pLocalDst0 : pLocalDst1) + (width + (i & 1)) * bytesPerPixel;
+				pDst[0] = (vx_uint8)fminf(fmaxf(roundf((Ypix + Rpix) / 257.0f), 0.0f), 255.0f);
+				pDst[1] = (vx_uint8)fminf(fmaxf(roundf((Ypix - Gpix) / 257.0f), 0.0f), 255.0f);
+				pDst[2] = (vx_uint8)fminf(fmaxf(roundf((Ypix + Bpix) / 257.0f), 0.0f), 255.0f);
+				if (rgbx)
+					pDst[3] = 255;
+			}
+		}
+		pSrcLumaImage += (srcLumaImageStrideInBytes + srcLumaImageStrideInBytes);
+		pSrcChromaImage += srcChromaImageStrideInBytes;
+		pDstImage += (dstImageStrideInBytes + dstImageStrideInBytes);
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_ColorConvert_RGB_P016
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcLumaImage,
+		vx_uint32     srcLumaImageStrideInBytes,
+		vx_uint8    * pSrcChromaImage,
+		vx_uint32     srcChromaImageStrideInBytes
+	)
+{
+	return HafCpu_ColorConvert_RGBX_P016_Process(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes,
+		pSrcLumaImage, srcLumaImageStrideInBytes, pSrcChromaImage, srcChromaImageStrideInBytes, false);
+}
+
+int HafCpu_ColorConvert_RGBX_P016
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcLumaImage,
+		vx_uint32     srcLumaImageStrideInBytes,
+		vx_uint8    * pSrcChromaImage,
+		vx_uint32     srcChromaImageStrideInBytes
+	)
+{
+	return HafCpu_ColorConvert_RGBX_P016_Process(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes,
+		pSrcLumaImage, srcLumaImageStrideInBytes, pSrcChromaImage, srcChromaImageStrideInBytes, true);
+}
+
+/*
+RGB/RGBX to P010/P016: samples are computed in floating-point and scaled to 10 or 16 bits, i.e., 
+scale is 65535/255 for P016 and 1023/255 for P010 (shifted into the most significant bits).
+Saturated chroma exceeds 255 before scaling, so samples are clamped to the maximum of the format
+before the shift.
+*/
+static inline __m128i HafCpu_ColorConvert_P016_Pack
+	(
+		__m128 value,
+		__m128 scale,
+		__m128i maxValue,
+		int shift
+	)
+{
+	__m128i packed = _mm_packus_epi32(_mm_min_epi32(_mm_cvtps_epi32(_mm_mul_ps(value, scale)), maxValue), _mm_setzero_si128());
+	return _mm_sll_epi16(packed, _mm_cvtsi32_si128(shift));
+}
+
+static inline int HafCpu_ColorConvert_P016_RGBX_Process
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		bool          rgbx,
+		bool          p010
+	)
+{
+	int alignedWidth = dstWidth & ~3;
+	int bytesPerPixel = rgbx ? 4 : 3;
+	int shift = p010 ? 6 : 0;
+	float fscale = p010 ? (1023.0f / 255.0f) : 257.0f;
+	float fmaxValue = p010 ? 1023.0f : 65535.0f;
+	__m128 scale = _mm_set1_ps(fscale);
+	__m128i maxValue = _mm_set1_epi32((int)fmaxValue);
+	__m128i maskRGB = _mm_load_si128((__m128i *)dataColorConvert + 14);
+	__m128i cvtmask = _mm_set1_epi32(255);
+	__m128 const128 = _mm_set1_ps(128.0f), const025 = _mm_set1_ps(0.25f);
+	__m128 weights_toY[3] = { _mm_set1_ps(0.2126f), _mm_set1_ps(0.7152f), _mm_set1_ps(0.0722f) };
+	__m128 weights_toU[3] = { _mm_set1_ps(-0.1146f), _mm_set1_ps(-0.3854f), _mm_set1_ps(0.5f) };
+	__m128 weights_toV[3] = { _mm_set1_ps(0.5f), _mm_set1_ps(-0.4542f), _mm_set1_ps(-0.0458f) };
+
+	for (int height = 0; height < (int)dstHeight; height += 2)
+	{
+		vx_uint16 * pLocalDstLuma0 = (vx_uint16 *)pDstLumaImage;
+		vx_uint16 * pLocalDstLuma1 = (vx_uint16 *)(pDstLumaImage + dstLumaImageStrideInBytes);
+		vx_uint16 * pLocalDstChroma = (vx_uint16 *)pDstChromaImage;
+
+		int width = 0;
+		for (; width < alignedWidth; width += 4)	// Process 4 pixels from two rows at a time
+		{
+			__m128 U = _mm_setzero_ps(), V = _mm_setzero_ps();
+			for (int row = 0; row < 2; row++)
+			{
+				vx_uint8 * pLocalSrc = pSrcImage + row * srcImageStrideInBytes + width * bytesPerPixel;
+				__m128i pixels;
+				if (rgbx) {
+					pixels = _mm_loadu_si128((__m128i *)pLocalSrc);
+				}
+				else {
+					pixels = _mm_insert_epi32(_mm_loadl_epi64((__m128i *)pLocalSrc), *(int *)(pLocalSrc + 8), 2);
+					pixels = _mm_shuffle_epi8(pixels, maskRGB);
+				}
+				__m128 R = _mm_cvtepi32_ps(_mm_and_si128(pixels, cvtmask));
+				__m128 G = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 8), cvtmask));
+				__m128 B = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 16), cvtmask));
+				__m128 Y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(R, weights_toY[0]), _mm_mul_ps(G, weights_toY[1])), _mm_mul_ps(B, weights_toY[2]));
+				U = _mm_add_ps(U, _mm_add_ps(_mm_add_ps(_mm_mul_ps(R, weights_toU[0]), _mm_mul_ps(G, weights_toU[1])), _mm_mul_ps(B, weights_toU[2])));
+				V = _mm_add_ps(V, _mm_add_ps(_mm_add_ps(_mm_mul_ps(R, weights_toV[0]), _mm_mul_ps(G, weights_toV[1])), _mm_mul_ps(B, weights_toV[2])));
+				_mm_storel_epi64((__m128i *)&(row ? pLocalDstLuma1 : pLocalDstLuma0)[width], HafCpu_ColorConvert_P016_Pack(Y, scale, maxValue, shift));
+			}
+			// average of 2x2 pixels: [U01 U23 V01 V23] -> [U01 V01 U23 V23]
+			__m128 UV = _mm_hadd_ps(U, V);
+			UV = _mm_shuffle_ps(UV, UV, _MM_SHUFFLE(3, 1, 2, 0));
+			UV = _mm_add_ps(_mm_mul_ps(UV, const025), const128);
+			_mm_storel_epi64((__m128i *)&pLocalDstChroma[width], HafCpu_ColorConvert_P016_Pack(UV, scale, maxValue, shift));
+		}
+
+		for (; width < (int)dstWidth; width += 2)		// Processing two pixels at a time in a row
+		{
+			float U = 0.0f, V = 0.0f;
+			for (int i = 0; i < 4; i++)
+			{
+				vx_uint8 * pLocalSrc = pSrcImage + (i >> 1) * srcImageStrideInBytes + (width + (i & 1)) * bytesPerPixel;
+				float R = (float)pLocalSrc[0], G = (float)pLocalSrc[1], B = (float)pLocalSrc[2];
+				float Y = (R * 0.2126f) + (G * 0.7152f) + (B * 0.0722f);
+				U += (R * -0.1146f) + (G * -0.3854f) + (B * 0.5f);
+				V += (R * 0.5f) + (G * -0.4542f) + (B * -0.0458f);
+				((i < 2) ? pLocalDstLuma0 : pLocalDstLuma1)[width + (i & 1)] = (vx_uint16)((vx_uint32)fminf(fmaxf(roundf(Y * fscale), 0.0f), fmaxValue) << shift);
+			}
+			pLocalDstChroma[width] = (vx_uint16)((vx_uint32)fminf(fmaxf(roundf((U * 0.25f + 128.0f) * fscale), 0.0f), fmaxValue) << shift);
+			pLocalDstChroma[width + 1] = (vx_uint16)((vx_uint32)fminf(fmaxf(roundf((V * 0.25f + 128.0f) * fscale), 0.0f), fmaxValue) << shift);
+		}
+		pSrcImage += (srcImageStrideInBytes + srcImageStrideInBytes);
+		pDstLumaImage += (dstLumaImageStrideInBytes + dstLumaImageStrideInBytes);
+		pDstChromaImage += dstChromaImageStrideInBytes;
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_ColorConvert_P010_RGB
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	)
+{
+	return HafCpu_ColorConvert_P016_RGBX_Process(dstWidth, dstHeight, pDstLumaImage, dstLumaImageStrideInBytes,
+		pDstChromaImage, dstChromaImageStrideInBytes, pSrcImage, srcImageStrideInBytes, false, true);
+}
+
+int HafCpu_ColorConvert_P010_RGBX
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	)
+{
+	return HafCpu_ColorConvert_P016_RGBX_Process(dstWidth, dstHeight, pDstLumaImage, dstLumaImageStrideInBytes,
+		pDstChromaImage, dstChromaImageStrideInBytes, pSrcImage, srcImageStrideInBytes, true, true);
+}
+
+int HafCpu_ColorConvert_P016_RGB
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	)
+{
+	return HafCpu_ColorConvert_P016_RGBX_Process(dstWidth, dstHeight, pDstLumaImage, dstLumaImageStrideInBytes,
+		pDstChromaImage, dstChromaImageStrideInBytes, pSrcImage, srcImageStrideInBytes, false, false);
+}
+
+int HafCpu_ColorConvert_P016_RGBX
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	)
+{
+	return HafCpu_ColorConvert_P016_RGBX_Process(dstWidth, dstHeight, pDstLumaImage, dstLumaImageStrideInBytes,
+		pDstChromaImage, dstChromaImageStrideInBytes, pSrcImage, srcImageStrideInBytes, true, false);
+}
+
+/*
+NV12 <-> P010/P016 format conversion: both planes are converted sample by sample,
+the chroma plane row has the same number of samples as the luma plane row.
+*/
+int HafCpu_FormatConvert_NV12_P016
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcLumaImage,
+		vx_uint32     srcLumaImageStrideInBytes,
+		vx_uint8    * pSrcChromaImage,
+		vx_uint32     srcChromaImageStrideInBytes
+	)
+{
+	int alignedWidth = dstWidth & ~15;
+	for (int height = 0; height < (int)dstHeight; height++)
+	{
+		// luma for every row, chroma for every other row
+		for (int plane = 0; plane < ((height & 1) ? 1 : 2); plane++)
+		{
+			vx_uint16 * pLocalSrc = (vx_uint16 *)(plane ? pSrcChromaImage + (height >> 1) * srcChromaImageStrideInBytes : pSrcLumaImage + height * srcLumaImageStrideInBytes);
+			vx_uint8 * pLocalDst = plane ? pDstChromaImage + (height >> 1) * dstChromaImageStrideInBytes : pDstLumaImage + height * dstLumaImageStrideInBytes;
+			int width = 0;
+			for (; width < alignedWidth; width += 16)
+			{
+				__m128i pixels0 = _mm_srli_epi16(_mm_loadu_si128((__m128i *)&pLocalSrc[width]), 8);
+				__m128i pixels1 = _mm_srli_epi16(_mm_loadu_si128((__m128i *)&pLocalSrc[width + 8]), 8);
+				_mm_storeu_si128((__m128i *)&pLocalDst[width], _mm_packus_epi16(pixels0, pixels1));
+			}
+			for (; width < (int)dstWidth; width++)
+				pLocalDst[width] = (vx_uint8)(pLocalSrc[width] >> 8);
+		}
+	}
+	return AGO_SUCCESS;
+}
+
+static inline int HafCpu_FormatConvert_P016_NV12_Process
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcLumaImage,
+		vx_uint32     srcLumaImageStrideInBytes,
+		vx_uint8    * pSrcChromaImage,
+		vx_uint32     srcChromaImageStrideInBytes,
+		vx_uint16     mask
+	)
+{
+	int alignedWidth = dstWidth & ~15;
+	__m128i mask16 = _mm_set1_epi16((short)mask);
+	for (int height = 0; height < (int)dstHeight; height++)
+	{
+		// luma for every row, chroma for every other row
+		for (int plane = 0; plane < ((height & 1) ? 1 : 2); plane++)
+		{
+			vx_uint8 * pLocalSrc = plane ? pSrcChromaImage + (height >> 1) * srcChromaImageStrideInBytes : pSrcLumaImage + height * srcLumaImageStrideInBytes;
+			vx_uint16 * pLocalDst = (vx_uint16 *)(plane ? pDstChromaImage + (height >> 1) * dstChromaImageStrideInBytes : pDstLumaImage + height * dstLumaImageStrideInBytes);
+			int width = 0;
+			for (; width < alignedWidth; width += 16)
+			{
+				// 8-bit to 16-bit by replicating the bits: x * 257
+				__m128i pixels = _mm_loadu_si128((__m128i *)&pLocalSrc[width]);
+				_mm_storeu_si128((__m128i *)&pLocalDst[width], _mm_and_si128(_mm_unpacklo_epi8(pixels, pixels), mask16));
+				_mm_storeu_si128((__m128i *)&pLocalDst[width + 8], _mm_and_si128(_mm_unpackhi_epi8(pixels, pixels), mask16));
+			}
+			for (; width < (int)dstWidth; width++)
+				pLocalDst[width] = (vx_uint16)((pLocalSrc[width] * 257) & mask);
+		}
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_FormatConvert_P010_NV12
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcLumaImage,
+		vx_uint32     srcLumaImageStrideInBytes,
+		vx_uint8    * pSrcChromaImage,
+		vx_uint32     srcChromaImageStrideInBytes
+	)
+{
+	return HafCpu_FormatConvert_P016_NV12_Process(dstWidth, dstHeight, pDstLumaImage, dstLumaImageStrideInBytes, pDstChromaImage, dstChromaImageStrideInBytes,
+		pSrcLumaImage, srcLumaImageStrideInBytes, pSrcChromaImage, srcChromaImageStrideInBytes, 0xffc0);
+}
+
+int HafCpu_FormatConvert_P016_NV12
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstLumaImage,
+		vx_uint32     dstLumaImageStrideInBytes,
+		vx_uint8    * pDstChromaImage,
+		vx_uint32     dstChromaImageStrideInBytes,
+		vx_uint8    * pSrcLumaImage,
+		vx_uint32     srcLumaImageStrideInBytes,
+		vx_uint8    * pSrcChromaImage,
+		vx_uint32     srcChromaImageStrideInBytes
+	)
+{
+	return HafCpu_FormatConvert_P016_NV12_Process(dstWidth, dstHeight, pDstLumaImage, dstLumaImageStrideInBytes, pDstChromaImage, dstChromaImageStrideInBytes,
+		pSrcLumaImage, srcLumaImageStrideInBytes, pSrcChromaImage, srcChromaImageStrideInBytes, 0xffff);
+}
@@ -2721,6 +2721,7 @@ int HafCpu_Convolve_S16_U8_3xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -2816,10 +2817,10 @@ int HafCpu_Convolve_S16_U8_3xN
 				result0 = _mm_add_epi32(result0, temp0);
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -2842,6 +2843,7 @@ int HafCpu_Convolve_S16_U8_3xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -2901,6 +2903,7 @@ int HafCpu_Convolve_U8_U8_3xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -2995,10 +2998,10 @@ int HafCpu_Convolve_U8_U8_3xN
 				result0 = _mm_add_epi32(result0, temp0);
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3021,6 +3024,7 @@ int HafCpu_Convolve_U8_U8_3xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3082,6 +3086,7 @@ int HafCpu_Convolve_S16_U8_5xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -3128,10 +3133,10 @@ int HafCpu_Convolve_S16_U8_5xN
 				}
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3154,6 +3159,7 @@ int HafCpu_Convolve_S16_U8_5xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -3213,6 +3219,7 @@ int HafCpu_Convolve_U8_U8_5xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3259,10 +3266,10 @@ int HafCpu_Convolve_U8_U8_5xN
 				}
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3285,6 +3292,7 @@ int HafCpu_Convolve_U8_U8_5xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3346,6 +3354,7 @@ int HafCpu_Convolve_S16_U8_7xN
 					temp += ((int)pLocalSrc[i*srcStride - j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -3392,10 +3401,10 @@ int HafCpu_Convolve_S16_U8_7xN
 				}
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3418,6 +3427,7 @@ int HafCpu_Convolve_S16_U8_7xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -3477,6 +3487,7 @@ int HafCpu_Convolve_U8_U8_7xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3523,10 +3534,10 @@ int HafCpu_Convolve_U8_U8_7xN
 				}
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3549,6 +3560,7 @@ int HafCpu_Convolve_U8_U8_7xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3610,6 +3622,7 @@ int HafCpu_Convolve_S16_U8_9xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -3656,10 +3669,10 @@ int HafCpu_Convolve_S16_U8_9xN
 				}
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3682,6 +3695,7 @@ int HafCpu_Convolve_S16_U8_9xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -3741,6 +3755,7 @@ int HafCpu_Convolve_U8_U8_9xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3787,10 +3802,10 @@ int HafCpu_Convolve_U8_U8_9xN
 				}
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3813,6 +3828,7 @@ int HafCpu_Convolve_U8_U8_9xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3826,6 +3842,187 @@ int HafCpu_Convolve_U8_U8_9xN
 	return AGO_SUCCESS;
 }
 
+/*
+Separable convolution: the horizontal pass of rowCoeff writes 32-bit sums into a rolling buffer of
+convolutionHeight rows and the vertical pass of colCoeff combines the buffered rows into the output.
+The coefficients are in convolution matrix order, i.e., applied to the pixels in reverse, so the result
+is bit-exact with the 2D convolution by colCoeff x rowCoeff. The border columns of the output are set to zero.
+pRowBuffer must hold convolutionHeight * ALIGN16(dstWidth) 32-bit values.
+*/
+static inline void HafCpu_ConvolveSeparable_Row
+	(
+		vx_uint32     dstWidth,
+		vx_int32    * pDst,
+		vx_uint8    * pSrc,
+		__m128i     * coeffPair,
+		vx_int16    * rowCoeff,
+		vx_uint32     convolutionWidth
+	)
+{
+	int radius = (int)(convolutionWidth >> 1);
+	int pairCount = (int)(convolutionWidth >> 1);
+	int xEnd = (int)dstWidth - radius;
+	int x = radius;
+	for (; x + 8 <= xEnd; x += 8)
+	{
+		vx_uint8 * pLocalSrc = pSrc + x - radius;
+		__m128i sum0 = _mm_setzero_si128(), sum1 = _mm_setzero_si128();
+		for (int k = 0; k < pairCount; k++, pLocalSrc += 2)
+		{
+			// interleave pixels at neighboring taps so that each madd applies two coefficients
+			__m128i pix0 = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i *)pLocalSrc));
+			__m128i pix1 = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i *)(pLocalSrc + 1)));
+			sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_unpacklo_epi16(pix0, pix1), coeffPair[k]));
+			sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_unpackhi_epi16(pix0, pix1), coeffPair[k]));
+		}
+		// last tap of the odd sized filter
+		__m128i pix0 = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i *)pLocalSrc));
+		__m128i zero = _mm_setzero_si128();
+		sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_unpacklo_epi16(pix0, zero), coeffPair[pairCount]));
+		sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_unpackhi_epi16(pix0, zero), coeffPair[pairCount]));
+		_mm_storeu_si128((__m128i *)&pDst[x], sum0);
+		_mm_storeu_si128((__m128i *)&pDst[x + 4], sum1);
+	}
+	for (; x < xEnd; x++)
+	{
+		int sum = 0;
+		for (int j = -radius; j <= radius; j++)
+			sum += (int)pSrc[x + j] * (int)rowCoeff[radius - j];
+		pDst[x] = sum;
+	}
+}
+
+static inline int HafCpu_ConvolveSeparable_Process
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		vx_int16    * rowCoeff,
+		vx_uint32     convolutionWidth,
+		vx_int16    * colCoeff,
+		vx_uint32     convolutionHeight,
+		vx_int32      shift,
+		vx_int32    * pRowBuffer,
+		bool          dstIsS16
+	)
+{
+	if (convolutionWidth > AGO_MAX_CONVOLUTION_DIM || convolutionHeight > AGO_MAX_CONVOLUTION_DIM)
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	int radius = (int)(convolutionWidth >> 1);
+	int rowLimit = (int)(convolutionHeight >> 1);
+	vx_uint32 bufferStride = (vx_uint32)ALIGN16(dstWidth);
+
+	// coefficient pairs for the horizontal pass: pixel at offset j uses rowCoeff[radius - j]
+	__m128i coeffPair[(AGO_MAX_CONVOLUTION_DIM >> 1) + 1];
+	for (int k = 0; k <= radius; k++)
+	{
+		vx_int32 c0 = rowCoeff[convolutionWidth - 1 - 2 * k];
+		vx_int32 c1 = (2 * k + 1 < (int)convolutionWidth) ? rowCoeff[convolutionWidth - 2 - 2 * k] : 0;
+		coeffPair[k] = _mm_set1_epi32((int)(((vx_uint32)c0 & 0xffff) | ((vx_uint32)c1 << 16)));
+	}
+
+	// the border columns of the row buffer stay zero
+	memset(pRowBuffer, 0, convolutionHeight * bufferStride * sizeof(vx_int32));
+	vx_int32 * pRows[AGO_MAX_CONVOLUTION_DIM];
+	for (int i = 0; i < (int)convolutionHeight; i++)
+		pRows[i] = pRowBuffer + i * bufferStride;
+	for (int i = 0; i < (int)convolutionHeight - 1; i++)
+		HafCpu_ConvolveSeparable_Row(dstWidth, pRows[i], pSrcImage + (i - rowLimit) * (int)srcImageStrideInBytes, coeffPair, rowCoeff, convolutionWidth);
+
+	__m128i colCoeffX[AGO_MAX_CONVOLUTION_DIM];
+	for (int i = 0; i < (int)convolutionHeight; i++)
+		colCoeffX[i] = _mm_set1_epi32((int)colCoeff[convolutionHeight - 1 - i]);
+	__m128i shiftX = _mm_cvtsi32_si128(shift);
+	int alignedWidth = (int)dstWidth & ~7;
+
+	for (vx_uint32 y = 0; y < dstHeight; y++)
+	{
+		// horizontal pass of the bottom row, the rest are already in the rolling buffer
+		HafCpu_ConvolveSeparable_Row(dstWidth, pRows[convolutionHeight - 1], pSrcImage + rowLimit * (int)srcImageStrideInBytes, coeffPair, rowCoeff, convolutionWidth);
+
+		// vertical pass
+		int x = 0;
+		for (; x < alignedWidth; x += 8)
+		{
+			__m128i sum0 = _mm_setzero_si128(), sum1 = _mm_setzero_si128();
+			for (int i = 0; i < (int)convolutionHeight; i++)
+			{
+				sum0 = _mm_add_epi32(sum0, _mm_mullo_epi32(_mm_loadu_si128((__m128i *)&pRows[i][x]), colCoeffX[i]));
+				sum1 = _mm_add_epi32(sum1, _mm_mullo_epi32(_mm_loadu_si128((__m128i *)&pRows[i][x + 4]), colCoeffX[i]));
+			}
+			sum0 = _mm_packs_epi32(_mm_sra_epi32(sum0, shiftX), _mm_sra_epi32(sum1, shiftX));
+			if (dstIsS16)
+				_mm_storeu_si128((__m128i *)&((vx_int16 *)pDstImage)[x], sum0);
+			else
+				_mm_storel_epi64((__m128i *)&pDstImage[x], _mm_packus_epi16(sum0, sum0));
+		}
+		for (; x < (int)dstWidth; x++)
+		{
+			int sum = 0;
+			for (int i = 0; i < (int)convolutionHeight; i++)
+				sum += pRows[i][x] * (int)colCoeff[convolutionHeight - 1 - i];
+			sum >>= shift;
+			if (dstIsS16)
+				((vx_int16 *)pDstImage)[x] = (vx_int16)max(min(sum, SHRT_MAX), SHRT_MIN);
+			else
+				pDstImage[x] = (vx_uint8)max(min(sum, 255), 0);
+		}
+
+		// rotate the rolling buffer by one row
+		vx_int32 * pTop = pRows[0];
+		for (int i = 0; i < (int)convolutionHeight - 1; i++)
+			pRows[i] = pRows[i + 1];
+		pRows[convolutionHeight - 1] = pTop;
+
+		pSrcImage += srcImageStrideInBytes;
+		pDstImage += dstImageStrideInBytes;
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_ConvolveSeparable_U8_U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		vx_int16    * rowCoeff,
+		vx_uint32     convolutionWidth,
+		vx_int16    * colCoeff,
+		vx_uint32     convolutionHeight,
+		vx_int32      shift,
+		vx_int32    * pRowBuffer
+	)
+{
+	return HafCpu_ConvolveSeparable_Process(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage, srcImageStrideInBytes,
+		rowCoeff, convolutionWidth, colCoeff, convolutionHeight, shift, pRowBuffer, false);
+}
+
+int HafCpu_ConvolveSeparable_S16_U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		vx_int16    * rowCoeff,
+		vx_uint32     convolutionWidth,
+		vx_int16    * colCoeff,
+		vx_uint32     convolutionHeight,
+		vx_int32      shift,
+		vx_int32    * pRowBuffer
+	)
+{
+	return HafCpu_ConvolveSeparable_Process(dstWidth, dstHeight, (vx_uint8 *)pDstImage, dstImageStrideInBytes, pSrcImage, srcImageStrideInBytes,
+		rowCoeff, convolutionWidth, colCoeff, convolutionHeight, shift, pRowBuffer, true);
+}
+
 static inline void CompareAndSwap(__m128i& p1, __m128i& p2)
 {
 	__m128i First = _mm_min_epu8(p1, p2);
@@ -503,6 +503,182 @@ int HafCpu_Remap_U8_U8_Bilinear_Constant
 	return AGO_SUCCESS;
 }
 
+/*
+Prepare remap table in fast format for bilinear interpolation
+The compact map table has 16 bit coordinates with mapFractionalBits of fraction. The fast table keeps the source offset
+of the top-left neighbor and the four bilinear weights (3 bit fractions, sum of weights is 64) so that the kernels
+don't need to decode the coordinates for every frame.
+Assumption: the value of 0xffff in map table corresponds to border: replaced by pixel (1,1) or flagged with zero weights for constant border.
+*/
+int HafCpu_Remap_Prepare_Bilinear_Table
+(
+	vx_uint32              dstWidth,
+	vx_uint32              dstHeight,
+	vx_uint32              srcImageStrideInBytes,
+	vx_int32             * pTable,
+	vx_uint32              tableStrideInBytes,
+	ago_coord2d_ushort_t * pMap,
+	vx_uint32              mapStrideInBytes,
+	vx_uint32              mapFractionalBits,
+	bool                   constantBorder
+)
+{
+	vx_uint32 tableWidth = tableStrideInBytes >> 3;
+	vx_uint32 fracMask = (1 << mapFractionalBits) - 1;
+	vx_uint32 fracShift = 3 - mapFractionalBits;
+	for (vx_uint32 y = 0; y < dstHeight; y++)
+	{
+		ago_coord2d_ushort_t * pMapRow = (ago_coord2d_ushort_t *)((vx_uint8 *)pMap + y * mapStrideInBytes);
+		vx_int32 * pOffset = (vx_int32 *)((vx_uint8 *)pTable + y * tableStrideInBytes);
+		vx_uint32 * pWeight = (vx_uint32 *)(pOffset + tableWidth);
+		for (vx_uint32 x = 0; x < dstWidth; x++)
+		{
+			vx_uint32 mx = pMapRow[x].x, my = pMapRow[x].y;
+			if (mx == 0xffff || my == 0xffff) {
+				pOffset[x] = constantBorder ? 0 : (vx_int32)(srcImageStrideInBytes + 1);
+				pWeight[x] = constantBorder ? 0 : 64;
+				continue;
+			}
+			vx_uint32 fx = (mx & fracMask) << fracShift, fy = (my & fracMask) << fracShift;
+			pOffset[x] = (vx_int32)((my >> mapFractionalBits) * srcImageStrideInBytes + (mx >> mapFractionalBits));
+			pWeight[x] = ((8 - fx) * (8 - fy)) | ((fx * (8 - fy)) << 8) | (((8 - fx) * fy) << 16) | ((fx * fy) << 24);
+		}
+		// padding entries are safe to sample
+		for (vx_uint32 x = dstWidth; x < tableWidth; x++)
+		{
+			pOffset[x] = 0;
+			pWeight[x] = 64;
+		}
+	}
+	return AGO_SUCCESS;
+}
+
+static inline int HafCpu_Remap_U8_U8_Bilinear_Table_Process
+(
+	vx_uint32              dstWidth,
+	vx_uint32              dstHeight,
+	vx_uint8             * pDstImage,
+	vx_uint32              dstImageStrideInBytes,
+	vx_uint8             * pSrcImage,
+	vx_uint32              srcImageStrideInBytes,
+	vx_int32             * pTable,
+	vx_uint32              tableStrideInBytes,
+	bool                   constantBorder,
+	vx_uint8               border
+)
+{
+	vx_uint32 tableWidth = tableStrideInBytes >> 3;
+#if USE_AVX2
+	const vx_uint8 * pSrcNextRow = pSrcImage + srcImageStrideInBytes;
+	const __m256i ones = _mm256_set1_epi16((short)1);
+	const __m256i round = _mm256_set1_epi32((int)32);
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i pborder = _mm256_set1_epi32((int)border);
+	vx_uint32 alignedWidth = dstWidth & ~7;
+#else
+	const __m128i ones = _mm_set1_epi16((short)1);
+	const __m128i round = _mm_set1_epi32((int)32);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i pborder = _mm_set1_epi32((int)border);
+	vx_uint32 alignedWidth = dstWidth & ~3;
+#endif
+	for (vx_uint32 y = 0; y < dstHeight; y++)
+	{
+		const vx_int32 * pOffset = (const vx_int32 *)((vx_uint8 *)pTable + y * tableStrideInBytes);
+		const vx_uint32 * pWeight = (const vx_uint32 *)(pOffset + tableWidth);
+		vx_uint8 * pDst = pDstImage + y * dstImageStrideInBytes;
+		vx_uint32 x = 0;
+#if USE_AVX2
+		for (; x < alignedWidth; x += 8)
+		{
+			__m256i offset = _mm256_loadu_si256((const __m256i *)&pOffset[x]);
+			__m256i weight = _mm256_loadu_si256((const __m256i *)&pWeight[x]);
+			// gather [x,y],[x+1,y] and [x,y+1],[x+1,y+1] pairs into [p11 p10 p01 p00] for each pixel
+			__m256i row0 = _mm256_i32gather_epi32((const int *)pSrcImage, offset, 1);
+			__m256i row1 = _mm256_i32gather_epi32((const int *)pSrcNextRow, offset, 1);
+			__m256i pix = _mm256_blend_epi16(row0, _mm256_slli_epi32(row1, 16), 0xAA);
+			// weighted sum: pair of 8-bit products doesn't exceed 16 bits since weights add up to 64
+			__m256i sum = _mm256_madd_epi16(_mm256_maddubs_epi16(pix, weight), ones);
+			sum = _mm256_srli_epi32(_mm256_add_epi32(sum, round), 6);
+			if (constantBorder)
+				sum = _mm256_blendv_epi8(sum, pborder, _mm256_cmpeq_epi32(weight, zero));
+			sum = _mm256_packus_epi32(sum, zero);
+			sum = _mm256_packus_epi16(sum, zero);
+			*(vx_uint32 *)&pDst[x] = (vx_uint32)_mm256_extract_epi32(sum, 0);
+			*(vx_uint32 *)&pDst[x + 4] = (vx_uint32)_mm256_extract_epi32(sum, 4);
+		}
+#else
+		for (; x < alignedWidth; x += 4)
+		{
+			__m128i weight = _mm_loadu_si128((const __m128i *)&pWeight[x]);
+			const vx_uint8 * p0 = pSrcImage + pOffset[x];
+			const vx_uint8 * p1 = pSrcImage + pOffset[x + 1];
+			const vx_uint8 * p2 = pSrcImage + pOffset[x + 2];
+			const vx_uint8 * p3 = pSrcImage + pOffset[x + 3];
+			__m128i pix = _mm_setr_epi32(
+				*(const vx_uint16 *)p0 | (*(const vx_uint16 *)(p0 + srcImageStrideInBytes) << 16),
+				*(const vx_uint16 *)p1 | (*(const vx_uint16 *)(p1 + srcImageStrideInBytes) << 16),
+				*(const vx_uint16 *)p2 | (*(const vx_uint16 *)(p2 + srcImageStrideInBytes) << 16),
+				*(const vx_uint16 *)p3 | (*(const vx_uint16 *)(p3 + srcImageStrideInBytes) << 16));
+			__m128i sum = _mm_madd_epi16(_mm_maddubs_epi16(pix, weight), ones);
+			sum = _mm_srli_epi32(_mm_add_epi32(sum, round), 6);
+			if (constantBorder)
+				sum = _mm_blendv_epi8(sum, pborder, _mm_cmpeq_epi32(weight, zero));
+			sum = _mm_packus_epi32(sum, zero);
+			sum = _mm_packus_epi16(sum, zero);
+			*(vx_uint32 *)&pDst[x] = (vx_uint32)_mm_cvtsi128_si32(sum);
+		}
+#endif
+		// process extra pixels if any
+		for (; x < dstWidth; x++)
+		{
+			vx_uint32 w = pWeight[x];
+			if (constantBorder && !w) {
+				pDst[x] = border;
+				continue;
+			}
+			const vx_uint8 * p = pSrcImage + pOffset[x];
+			vx_uint32 sum = p[0] * (w & 0xff) + p[1] * ((w >> 8) & 0xff) +
+				p[srcImageStrideInBytes] * ((w >> 16) & 0xff) + p[srcImageStrideInBytes + 1] * (w >> 24);
+			pDst[x] = (vx_uint8)((sum + 32) >> 6);
+		}
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_Remap_U8_U8_Bilinear_Table
+(
+	vx_uint32              dstWidth,
+	vx_uint32              dstHeight,
+	vx_uint8             * pDstImage,
+	vx_uint32              dstImageStrideInBytes,
+	vx_uint8             * pSrcImage,
+	vx_uint32              srcImageStrideInBytes,
+	vx_int32             * pTable,
+	vx_uint32              tableStrideInBytes
+)
+{
+	return HafCpu_Remap_U8_U8_Bilinear_Table_Process(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes,
+		pSrcImage, srcImageStrideInBytes, pTable, tableStrideInBytes, false, 0);
+}
+
+int HafCpu_Remap_U8_U8_Bilinear_Constant_Table
+(
+	vx_uint32              dstWidth,
+	vx_uint32              dstHeight,
+	vx_uint8             * pDstImage,
+	vx_uint32              dstImageStrideInBytes,
+	vx_uint8             * pSrcImage,
+	vx_uint32              srcImageStrideInBytes,
+	vx_int32             * pTable,
+	vx_uint32              tableStrideInBytes,
+	vx_uint8               border
+)
+{
+	return HafCpu_Remap_U8_U8_Bilinear_Table_Process(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes,
+		pSrcImage, srcImageStrideInBytes, pTable, tableStrideInBytes, true, border);
+}
+
 // The dst pixels are nearest affine transformed (truncate towards zero rounding). Bounday_mode is not specified. 
 // If the transformed location is out of bounds: 0 or max pixel will be used as substitution.
 int HafCpu_WarpAffine_U8_U8_Nearest
@@ -2761,6 +2937,463 @@ ago_scale_matrix_t * matrix
 	return HafCpu_ScaleImage_U8_U8_Area(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix);
 }
 
+/*
+Scale image kernels specialized for fixed downscale ratios (1/2, 1/3, 1/4 and 2/3 in both directions)
+The source image dimensions must be exact multiples of the ratio, so that no border pixels are ever accessed.
+Area kernels compute the rounded average of the source area covered by each destination pixel.
+Bilinear kernels produce bit-exact results of HafCpu_ScaleImage_U8_U8_Bilinear for these ratios, where
+the interpolation weights are fixed: 1/2 and 1/4 average two pixels, 1/3 picks the center pixel and
+2/3 uses 3:1 and 1:3 weights.
+*/
+static inline vx_uint8 HafCpu_Avg_U8(int a, int b)
+{
+	return (vx_uint8)((a + b + 1) >> 1);
+}
+
+int HafCpu_ScaleImage_U8_U8_Area_Half
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint8    * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	const __m128i ones = _mm_set1_epi8((char)1);
+	const __m128i round = _mm_set1_epi16((short)2);
+	for (vx_uint32 y = 0; y < dstHeight; y++)
+	{
+		const vx_uint8 * S0 = pSrcImage + 2 * y * srcImageStrideInBytes;
+		const vx_uint8 * S1 = S0 + srcImageStrideInBytes;
+		vx_uint32 x = 0;
+		for (; x + 16 <= dstWidth; x += 16)
+		{
+			__m128i s0 = _mm_add_epi16(_mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S0 + 2 * x)), ones),
+				_mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S1 + 2 * x)), ones));
+			__m128i s1 = _mm_add_epi16(_mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S0 + 2 * x + 16)), ones),
+				_mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S1 + 2 * x + 16)), ones));
+			s0 = _mm_srli_epi16(_mm_add_epi16(s0, round), 2);
+			s1 = _mm_srli_epi16(_mm_add_epi16(s1, round), 2);
+			_mm_storeu_si128((__m128i *)(pDstImage + x), _mm_packus_epi16(s0, s1));
+		}
+		for (; x < dstWidth; x++)
+			pDstImage[x] = (vx_uint8)((S0[2 * x] + S0[2 * x + 1] + S1[2 * x] + S1[2 * x + 1] + 2) >> 2);
+		pDstImage += dstImageStrideInBytes;
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_ScaleImage_U8_U8_Area_Third
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint8    * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	// gather [p0+p1, p3+p4, p6+p7, p9+p10, p2, p5, p8, p11] of each 3-pixel group with pshufb and maddubs
+	const __m128i shuffle0 = _mm_setr_epi8(0, 1, 3, 4, 6, 7, 9, 10, 2, -1, 5, -1, 8, -1, 11, -1);
+	const __m128i shuffle1 = _mm_setr_epi8(4, 5, 7, 8, 10, 11, 13, 14, 6, -1, 9, -1, 12, -1, 15, -1);
+	const __m128i ones = _mm_set1_epi8((char)1);
+	// sum * 3641 / 32768 with rounding is identical to (sum + 4) / 9 for sum <= 9 * 255
+	const __m128i div9 = _mm_set1_epi16((short)3641);
+	for (vx_uint32 y = 0; y < dstHeight; y++)
+	{
+		const vx_uint8 * S0 = pSrcImage + 3 * y * srcImageStrideInBytes;
+		vx_uint32 x = 0;
+		for (; x + 8 <= dstWidth; x += 8)
+		{
+			__m128i sum0 = _mm_setzero_si128(), sum1 = _mm_setzero_si128();
+			const vx_uint8 * S = S0 + 3 * x;
+			for (int i = 0; i < 3; i++, S += srcImageStrideInBytes)
+			{
+				sum0 = _mm_add_epi16(sum0, _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)S), shuffle0), ones));
+				sum1 = _mm_add_epi16(sum1, _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(S + 8)), shuffle1), ones));
+			}
+			sum0 = _mm_add_epi16(sum0, _mm_srli_si128(sum0, 8));
+			sum1 = _mm_add_epi16(sum1, _mm_srli_si128(sum1, 8));
+			sum0 = _mm_mulhrs_epi16(_mm_unpacklo_epi64(sum0, sum1), div9);
+			_mm_storel_epi64((__m128i *)(pDstImage + x), _mm_packus_epi16(sum0, sum0));
+		}
+		for (; x < dstWidth; x++)
+		{
+			int sum = 0;
+			for (int i = 0; i < 3; i++)
+			{
+				const vx_uint8 * S = S0 + i * srcImageStrideInBytes + 3 * x;
+				sum += S[0] + S[1] + S[2];
+			}
+			pDstImage[x] = (vx_uint8)((sum * 3641 + 16384) >> 15);
+		}
+		pDstImage += dstImageStrideInBytes;
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_ScaleImage_U8_U8_Area_Quarter
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint8    * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	const __m128i ones = _mm_set1_epi8((char)1);
+	const __m128i round = _mm_set1_epi16((short)8);
+	for (vx_uint32 y = 0; y < dstHeight; y++)
+	{
+		const vx_uint8 * S0 = pSrcImage + 4 * y * srcImageStrideInBytes;
+		vx_uint32 x = 0;
+		for (; x + 8 <= dstWidth; x += 8)
+		{
+			__m128i sum0 = _mm_setzero_si128(), sum1 = _mm_setzero_si128();
+			const vx_uint8 * S = S0 + 4 * x;
+			for (int i = 0; i < 4; i++, S += srcImageStrideInBytes)
+			{
+				sum0 = _mm_add_epi16(sum0, _mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)S), ones));
+				sum1 = _mm_add_epi16(sum1, _mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S + 16)), ones));
+			}
+			sum0 = _mm_srli_epi16(_mm_add_epi16(_mm_hadd_epi16(sum0, sum1), round), 4);
+			_mm_storel_epi64((__m128i *)(pDstImage + x), _mm_packus_epi16(sum0, sum0));
+		}
+		for (; x < dstWidth; x++)
+		{
+			int sum = 0;
+			for (int i = 0; i < 4; i++)
+			{
+				const vx_uint8 * S = S0 + i * srcImageStrideInBytes + 4 * x;
+				sum += S[0] + S[1] + S[2] + S[3];
+			}
+			pDstImage[x] = (vx_uint8)((sum + 8) >> 4);
+		}
+		pDstImage += dstImageStrideInBytes;
+	}
+	return AGO_SUCCESS;
+}
+
+// load 12 pixels of 4 groups [a b c] and return [a0 c0 a1 c1 a2 c2 a3 c3] and [b0 b0 b1 b1 b2 b2 b3 b3] as 16-bit values
+static inline void HafCpu_ScaleImage_TwoThirds_Load(const vx_uint8 * S, __m128i& ac, __m128i& bb)
+{
+	const __m128i shuffleAC = _mm_setr_epi8(0, -1, 2, -1, 3, -1, 5, -1, 6, -1, 8, -1, 9, -1, 11, -1);
+	const __m128i shuffleBB = _mm_setr_epi8(1, -1, 1, -1, 4, -1, 4, -1, 7, -1, 7, -1, 10, -1, 10, -1);
+	__m128i pix = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)S), _mm_cvtsi32_si128(*(const int *)(S + 8)));
+	ac = _mm_shuffle_epi8(pix, shuffleAC);
+	bb = _mm_shuffle_epi8(pix, shuffleBB);
+}
+
+int HafCpu_ScaleImage_U8_U8_Area_TwoThirds
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint8    * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	// each 3x3 source block covers 2x2 destination pixels with 2:1 and 1:2 area weights in each direction
+	const __m128i div9 = _mm_set1_epi16((short)3641);
+	for (vx_uint32 y = 0; y < dstHeight; y += 2)
+	{
+		const vx_uint8 * S0 = pSrcImage + (y >> 1) * 3 * srcImageStrideInBytes;
+		const vx_uint8 * S1 = S0 + srcImageStrideInBytes;
+		const vx_uint8 * S2 = S1 + srcImageStrideInBytes;
+		vx_uint8 * D0 = pDstImage;
+		vx_uint8 * D1 = pDstImage + dstImageStrideInBytes;
+		vx_uint32 x = 0;
+		for (; x + 8 <= dstWidth; x += 8)
+		{
+			__m128i ac, bb, h0, h1, h2;
+			vx_uint32 offset = (x >> 1) * 3;
+			HafCpu_ScaleImage_TwoThirds_Load(S0 + offset, ac, bb); h0 = _mm_add_epi16(_mm_slli_epi16(ac, 1), bb);
+			HafCpu_ScaleImage_TwoThirds_Load(S1 + offset, ac, bb); h1 = _mm_add_epi16(_mm_slli_epi16(ac, 1), bb);
+			HafCpu_ScaleImage_TwoThirds_Load(S2 + offset, ac, bb); h2 = _mm_add_epi16(_mm_slli_epi16(ac, 1), bb);
+			__m128i v0 = _mm_mulhrs_epi16(_mm_add_epi16(_mm_slli_epi16(h0, 1), h1), div9);
+			__m128i v1 = _mm_mulhrs_epi16(_mm_add_epi16(_mm_slli_epi16(h2, 1), h1), div9);
+			_mm_storel_epi64((__m128i *)(D0 + x), _mm_packus_epi16(v0, v0));
+			_mm_storel_epi64((__m128i *)(D1 + x), _mm_packus_epi16(v1, v1));
+		}
+		for (; x < dstWidth; x++)
+		{
+			int ix = (x >> 1) * 3 + (x & 1);
+			int h0 = (x & 1) ? S0[ix] + 2 * S0[ix + 1] : 2 * S0[ix] + S0[ix + 1];
+			int h1 = (x & 1) ? S1[ix] + 2 * S1[ix + 1] : 2 * S1[ix] + S1[ix + 1];
+			int h2 = (x & 1) ? S2[ix] + 2 * S2[ix + 1] : 2 * S2[ix] + S2[ix + 1];
+			D0[x] = (vx_uint8)(((2 * h0 + h1) * 3641 + 16384) >> 15);
+			D1[x] = (vx_uint8)(((h1 + 2 * h2) * 3641 + 16384) >> 15);
+		}
+		pDstImage += 2 * dstImageStrideInBytes;
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_ScaleImage_U8_U8_Bilinear_Half
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint8    * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	const __m128i mask = _mm_set1_epi16((short)0x00ff);
+	for (vx_uint32 y = 0; y < dstHeight; y++)
+	{
+		const vx_uint8 * S0 = pSrcImage + 2 * y * srcImageStrideInBytes;
+		const vx_uint8 * S1 = S0 + srcImageStrideInBytes;
+		vx_uint32 x = 0;
+		for (; x + 16 <= dstWidth; x += 16)
+		{
+			// horizontal average first, in the same order as the generic kernel, then vertical average
+			__m128i r0 = _mm_loadu_si128((const __m128i *)(S0 + 2 * x));
+			__m128i r1 = _mm_loadu_si128((const __m128i *)(S1 + 2 * x));
+			__m128i p0 = _mm_avg_epu8(_mm_avg_epu8(r0, _mm_srli_si128(r0, 1)), _mm_avg_epu8(r1, _mm_srli_si128(r1, 1)));
+			r0 = _mm_loadu_si128((const __m128i *)(S0 + 2 * x + 16));
+			r1 = _mm_loadu_si128((const __m128i *)(S1 + 2 * x + 16));
+			__m128i p1 = _mm_avg_epu8(_mm_avg_epu8(r0, _mm_srli_si128(r0, 1)), _mm_avg_epu8(r1, _mm_srli_si128(r1, 1)));
+			_mm_storeu_si128((__m128i *)(pDstImage + x), _mm_packus_epi16(_mm_and_si128(p0, mask), _mm_and_si128(p1, mask)));
+		}
+		for (; x < dstWidth; x++)
+			pDstImage[x] = HafCpu_Avg_U8(HafCpu_Avg_U8(S0[2 * x], S0[2 * x + 1]), HafCpu_Avg_U8(S1[2 * x], S1[2 * x + 1]));
+		pDstImage += dstImageStrideInBytes;
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_ScaleImage_U8_U8_Bilinear_Third
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint8    * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	// sampling position falls on the center pixel of each 3x3 block
+	const __m128i shuffle0 = _mm_setr_epi8(1, 4, 7, 10, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+	const __m128i shuffle1 = _mm_setr_epi8(-1, -1, -1, -1, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1);
+	for (vx_uint32 y = 0; y < dstHeight; y++)
+	{
+		const vx_uint8 * S = pSrcImage + (3 * y + 1) * srcImageStrideInBytes;
+		vx_uint32 x = 0;
+		for (; x + 8 <= dstWidth; x += 8)
+		{
+			__m128i p0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(S + 3 * x)), shuffle0);
+			__m128i p1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(S + 3 * x + 8)), shuffle1);
+			_mm_storel_epi64((__m128i *)(pDstImage + x), _mm_or_si128(p0, p1));
+		}
+		for (; x < dstWidth; x++)
+			pDstImage[x] = S[3 * x + 1];
+		pDstImage += dstImageStrideInBytes;
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_ScaleImage_U8_U8_Bilinear_Quarter
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint8    * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	// sampling position falls between the two center pixels of each 4x4 block
+	const __m128i shuffle0 = _mm_setr_epi8(1, 5, 9, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+	const __m128i shuffle1 = _mm_setr_epi8(-1, -1, -1, -1, 1, 5, 9, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+	for (vx_uint32 y = 0; y < dstHeight; y++)
+	{
+		const vx_uint8 * S1 = pSrcImage + (4 * y + 1) * srcImageStrideInBytes;
+		const vx_uint8 * S2 = S1 + srcImageStrideInBytes;
+		vx_uint32 x = 0;
+		for (; x + 8 <= dstWidth; x += 8)
+		{
+			__m128i r1 = _mm_loadu_si128((const __m128i *)(S1 + 4 * x));
+			__m128i r2 = _mm_loadu_si128((const __m128i *)(S2 + 4 * x));
+			__m128i p0 = _mm_avg_epu8(_mm_avg_epu8(r1, _mm_srli_si128(r1, 1)), _mm_avg_epu8(r2, _mm_srli_si128(r2, 1)));
+			r1 = _mm_loadu_si128((const __m128i *)(S1 + 4 * x + 16));
+			r2 = _mm_loadu_si128((const __m128i *)(S2 + 4 * x + 16));
+			__m128i p1 = _mm_avg_epu8(_mm_avg_epu8(r1, _mm_srli_si128(r1, 1)), _mm_avg_epu8(r2, _mm_srli_si128(r2, 1)));
+			_mm_storel_epi64((__m128i *)(pDstImage + x), _mm_or_si128(_mm_shuffle_epi8(p0, shuffle0), _mm_shuffle_epi8(p1, shuffle1)));
+		}
+		for (; x < dstWidth; x++)
+			pDstImage[x] = HafCpu_Avg_U8(HafCpu_Avg_U8(S1[4 * x + 1], S1[4 * x + 2]), HafCpu_Avg_U8(S2[4 * x + 1], S2[4 * x + 2]));
+		pDstImage += dstImageStrideInBytes;
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_ScaleImage_U8_U8_Bilinear_TwoThirds
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint8    * pDstImage,
+	vx_uint32     dstImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	// sampling positions are at 1/4 and 7/4 of each 3x3 block: (3 * a + b + 2) >> 2 and (b + 3 * c + 2) >> 2
+	const __m128i round = _mm_set1_epi16((short)2);
+	for (vx_uint32 y = 0; y < dstHeight; y += 2)
+	{
+		const vx_uint8 * S0 = pSrcImage + (y >> 1) * 3 * srcImageStrideInBytes;
+		const vx_uint8 * S1 = S0 + srcImageStrideInBytes;
+		const vx_uint8 * S2 = S1 + srcImageStrideInBytes;
+		vx_uint8 * D0 = pDstImage;
+		vx_uint8 * D1 = pDstImage + dstImageStrideInBytes;
+		vx_uint32 x = 0;
+		for (; x + 8 <= dstWidth; x += 8)
+		{
+			__m128i ac, bb, h0, h1, h2;
+			vx_uint32 offset = (x >> 1) * 3;
+			HafCpu_ScaleImage_TwoThirds_Load(S0 + offset, ac, bb);
+			h0 = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_add_epi16(_mm_slli_epi16(ac, 1), ac), bb), round), 2);
+			HafCpu_ScaleImage_TwoThirds_Load(S1 + offset, ac, bb);
+			h1 = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_add_epi16(_mm_slli_epi16(ac, 1), ac), bb), round), 2);
+			HafCpu_ScaleImage_TwoThirds_Load(S2 + offset, ac, bb);
+			h2 = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_add_epi16(_mm_slli_epi16(ac, 1), ac), bb), round), 2);
+			__m128i v0 = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_add_epi16(_mm_slli_epi16(h0, 1), h0), h1), round), 2);
+			__m128i v1 = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_add_epi16(_mm_slli_epi16(h2, 1), h2), h1), round), 2);
+			_mm_storel_epi64((__m128i *)(D0 + x), _mm_packus_epi16(v0, v0));
+			_mm_storel_epi64((__m128i *)(D1 + x), _mm_packus_epi16(v1, v1));
+		}
+		for (; x < dstWidth; x++)
+		{
+			int ix = (x >> 1) * 3 + (x & 1);
+			int h0 = (x & 1) ? (S0[ix] + 3 * S0[ix + 1] + 2) >> 2 : (3 * S0[ix] + S0[ix + 1] + 2) >> 2;
+			int h1 = (x & 1) ? (S1[ix] + 3 * S1[ix + 1] + 2) >> 2 : (3 * S1[ix] + S1[ix + 1] + 2) >> 2;
+			int h2 = (x & 1) ? (S2[ix] + 3 * S2[ix + 1] + 2) >> 2 : (3 * S2[ix] + S2[ix + 1] + 2) >> 2;
+			D0[x] = (vx_uint8)((3 * h0 + h1 + 2) >> 2);
+			D1[x] = (vx_uint8)((h1 + 3 * h2 + 2) >> 2);
+		}
+		pDstImage += 2 * dstImageStrideInBytes;
+	}
+	return AGO_SUCCESS;
+}
+
+/*
+Fused 1/2 and 1/4 downscale: each group of four source rows is read once to produce
+two rows of the half size image and one row of the quarter size image.
+The results are identical to the corresponding single output kernels.
+*/
+int HafCpu_ScaleImage_U8U8_U8_Area_HalfQuarter
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint8    * pDstHalfImage,
+	vx_uint32     dstHalfImageStrideInBytes,
+	vx_uint8    * pDstQuarterImage,
+	vx_uint32     dstQuarterImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	const __m128i ones = _mm_set1_epi8((char)1);
+	const __m128i round2 = _mm_set1_epi16((short)2);
+	const __m128i round8 = _mm_set1_epi16((short)8);
+	// dstWidth and dstHeight are dimensions of the half size image
+	for (vx_uint32 y = 0; y < (dstHeight >> 1); y++)
+	{
+		const vx_uint8 * S0 = pSrcImage + 4 * y * srcImageStrideInBytes;
+		const vx_uint8 * S1 = S0 + srcImageStrideInBytes;
+		const vx_uint8 * S2 = S1 + srcImageStrideInBytes;
+		const vx_uint8 * S3 = S2 + srcImageStrideInBytes;
+		vx_uint8 * H0 = pDstHalfImage + 2 * y * dstHalfImageStrideInBytes;
+		vx_uint8 * H1 = H0 + dstHalfImageStrideInBytes;
+		vx_uint8 * Q = pDstQuarterImage + y * dstQuarterImageStrideInBytes;
+		vx_uint32 x = 0;
+		for (; x + 16 <= dstWidth; x += 16)
+		{
+			__m128i h00 = _mm_add_epi16(_mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S0 + 2 * x)), ones), _mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S1 + 2 * x)), ones));
+			__m128i h01 = _mm_add_epi16(_mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S0 + 2 * x + 16)), ones), _mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S1 + 2 * x + 16)), ones));
+			__m128i h10 = _mm_add_epi16(_mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S2 + 2 * x)), ones), _mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S3 + 2 * x)), ones));
+			__m128i h11 = _mm_add_epi16(_mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S2 + 2 * x + 16)), ones), _mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)(S3 + 2 * x + 16)), ones));
+			__m128i q = _mm_hadd_epi16(_mm_add_epi16(h00, h10), _mm_add_epi16(h01, h11));
+			_mm_storeu_si128((__m128i *)(H0 + x), _mm_packus_epi16(_mm_srli_epi16(_mm_add_epi16(h00, round2), 2), _mm_srli_epi16(_mm_add_epi16(h01, round2), 2)));
+			_mm_storeu_si128((__m128i *)(H1 + x), _mm_packus_epi16(_mm_srli_epi16(_mm_add_epi16(h10, round2), 2), _mm_srli_epi16(_mm_add_epi16(h11, round2), 2)));
+			q = _mm_srli_epi16(_mm_add_epi16(q, round8), 4);
+			_mm_storel_epi64((__m128i *)(Q + (x >> 1)), _mm_packus_epi16(q, q));
+		}
+		for (; x < dstWidth; x += 2)
+		{
+			int s00 = S0[2 * x] + S0[2 * x + 1] + S1[2 * x] + S1[2 * x + 1];
+			int s01 = S0[2 * x + 2] + S0[2 * x + 3] + S1[2 * x + 2] + S1[2 * x + 3];
+			int s10 = S2[2 * x] + S2[2 * x + 1] + S3[2 * x] + S3[2 * x + 1];
+			int s11 = S2[2 * x + 2] + S2[2 * x + 3] + S3[2 * x + 2] + S3[2 * x + 3];
+			H0[x] = (vx_uint8)((s00 + 2) >> 2);
+			H0[x + 1] = (vx_uint8)((s01 + 2) >> 2);
+			H1[x] = (vx_uint8)((s10 + 2) >> 2);
+			H1[x + 1] = (vx_uint8)((s11 + 2) >> 2);
+			Q[x >> 1] = (vx_uint8)((s00 + s01 + s10 + s11 + 8) >> 4);
+		}
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_ScaleImage_U8U8_U8_Bilinear_HalfQuarter
+(
+	vx_uint32     dstWidth,
+	vx_uint32     dstHeight,
+	vx_uint8    * pDstHalfImage,
+	vx_uint32     dstHalfImageStrideInBytes,
+	vx_uint8    * pDstQuarterImage,
+	vx_uint32     dstQuarterImageStrideInBytes,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	const __m128i mask = _mm_set1_epi16((short)0x00ff);
+	const __m128i shuffle0 = _mm_setr_epi8(1, 5, 9, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+	const __m128i shuffle1 = _mm_setr_epi8(-1, -1, -1, -1, 1, 5, 9, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+	// dstWidth and dstHeight are dimensions of the half size image
+	for (vx_uint32 y = 0; y < (dstHeight >> 1); y++)
+	{
+		const vx_uint8 * S0 = pSrcImage + 4 * y * srcImageStrideInBytes;
+		const vx_uint8 * S1 = S0 + srcImageStrideInBytes;
+		const vx_uint8 * S2 = S1 + srcImageStrideInBytes;
+		const vx_uint8 * S3 = S2 + srcImageStrideInBytes;
+		vx_uint8 * H0 = pDstHalfImage + 2 * y * dstHalfImageStrideInBytes;
+		vx_uint8 * H1 = H0 + dstHalfImageStrideInBytes;
+		vx_uint8 * Q = pDstQuarterImage + y * dstQuarterImageStrideInBytes;
+		vx_uint32 x = 0;
+		for (; x + 16 <= dstWidth; x += 16)
+		{
+			// horizontal averages of neighboring pixels are shared by both outputs
+			__m128i h[4][2];
+			for (int i = 0; i < 4; i++)
+			{
+				const vx_uint8 * S = S0 + i * srcImageStrideInBytes + 2 * x;
+				__m128i r = _mm_loadu_si128((const __m128i *)S);
+				h[i][0] = _mm_avg_epu8(r, _mm_srli_si128(r, 1));
+				r = _mm_loadu_si128((const __m128i *)(S + 16));
+				h[i][1] = _mm_avg_epu8(r, _mm_srli_si128(r, 1));
+			}
+			_mm_storeu_si128((__m128i *)(H0 + x), _mm_packus_epi16(_mm_and_si128(_mm_avg_epu8(h[0][0], h[1][0]), mask), _mm_and_si128(_mm_avg_epu8(h[0][1], h[1][1]), mask)));
+			_mm_storeu_si128((__m128i *)(H1 + x), _mm_packus_epi16(_mm_and_si128(_mm_avg_epu8(h[2][0], h[3][0]), mask), _mm_and_si128(_mm_avg_epu8(h[2][1], h[3][1]), mask)));
+			__m128i q = _mm_or_si128(_mm_shuffle_epi8(_mm_avg_epu8(h[1][0], h[2][0]), shuffle0), _mm_shuffle_epi8(_mm_avg_epu8(h[1][1], h[2][1]), shuffle1));
+			_mm_storel_epi64((__m128i *)(Q + (x >> 1)), q);
+		}
+		for (; x < dstWidth; x += 2)
+		{
+			H0[x] = HafCpu_Avg_U8(HafCpu_Avg_U8(S0[2 * x], S0[2 * x + 1]), HafCpu_Avg_U8(S1[2 * x], S1[2 * x + 1]));
+			H0[x + 1] = HafCpu_Avg_U8(HafCpu_Avg_U8(S0[2 * x + 2], S0[2 * x + 3]), HafCpu_Avg_U8(S1[2 * x + 2], S1[2 * x + 3]));
+			H1[x] = HafCpu_Avg_U8(HafCpu_Avg_U8(S2[2 * x], S2[2 * x + 1]), HafCpu_Avg_U8(S3[2 * x], S3[2 * x + 1]));
+			H1[x + 1] = HafCpu_Avg_U8(HafCpu_Avg_U8(S2[2 * x + 2], S2[2 * x + 3]), HafCpu_Avg_U8(S3[2 * x + 2], S3[2 * x + 3]));
+			Q[x >> 1] = HafCpu_Avg_U8(HafCpu_Avg_U8(S1[2 * x + 1], S1[2 * x + 2]), HafCpu_Avg_U8(S2[2 * x + 1], S2[2 * x + 2]));
+		}
+	}
+	return AGO_SUCCESS;
+}
+
 /*
 Performs a Gaussian blur(3x3) and half scales it
 gaussian filter
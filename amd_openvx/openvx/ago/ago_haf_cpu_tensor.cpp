@@ -0,0 +1,749 @@
+/*
+Copyright (c) 2015 - 2020 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "ago_internal.h"
+
+// tensors are processed as rows along dims[0]: dims[1..3] are walked by the caller of the row function
+#define HAF_TENSOR_MIN_ELEMENTS_PER_THREAD   (256*1024) // smaller tensors are processed by the calling thread
+#define HAF_TENSOR_ROW_BLOCK                 256        // row block size used for F32 conversion of non-F32 tensors
+
+enum {
+	HAF_TENSOR_OP_ADD,
+	HAF_TENSOR_OP_SUBTRACT,
+	HAF_TENSOR_OP_MULTIPLY,
+};
+
+// runs body(start,end) on [0,count) items split across the CPU worker pool when there is enough work
+static void HafCpu_TensorParallelFor(vx_size count, vx_size elementsPerItem, const std::function<void(vx_size, vx_size)>& body)
+{
+	vx_size numChunks = std::min((vx_size)agoGetCpuThreadCount(), (count * elementsPerItem) / HAF_TENSOR_MIN_ELEMENTS_PER_THREAD);
+	numChunks = std::min(numChunks, count);
+	if (numChunks < 2) {
+		body(0, count);
+		return;
+	}
+	vx_size chunk = (count + numChunks - 1) / numChunks;
+	agoParallelFor((count + chunk - 1) / chunk, [&](vx_size index) {
+		vx_size start = index * chunk;
+		body(start, std::min(start + chunk, count));
+	});
+}
+
+// byte offset of row (dims[1..3] index) in a tensor with the given strides
+static inline vx_size HafCpu_TensorRowOffset(vx_size row, const vx_size * dims, const vx_size * stride)
+{
+	vx_size i1 = row % dims[1]; row /= dims[1];
+	vx_size i2 = row % dims[2]; row /= dims[2];
+	return i1 * stride[1] + i2 * stride[2] + row * stride[3];
+}
+
+////////////////////////////////////////////////////////////////////////
+// FP16 <-> FP32 conversion of four lanes using SSE2 integer operations:
+//   - F16 input/output values are in the low 16-bits of each 32-bit lane
+//   - F32 to F16 conversion uses round-to-nearest-even, with overflow to infinity
+static inline __m128 HafCpu_CvtF16toF32(__m128i h)
+{
+	const __m128i maskNoSign = _mm_set1_epi32(0x7fff);
+	const __m128  magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+	const __m128i wasInfNan = _mm_set1_epi32(0x7bff);
+	const __m128  expInfNan = _mm_castsi128_ps(_mm_set1_epi32(255 << 23));
+	__m128i expmant = _mm_and_si128(maskNoSign, h);
+	__m128i sign = _mm_slli_epi32(_mm_xor_si128(h, expmant), 16);
+	__m128  scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expmant, 13)), magic);
+	__m128  infnan = _mm_and_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(expmant, wasInfNan)), expInfNan);
+	return _mm_or_ps(scaled, _mm_or_ps(_mm_castsi128_ps(sign), infnan));
+}
+
+static inline __m128i HafCpu_CvtF32toF16(__m128 f)
+{
+	const __m128i maskSign = _mm_set1_epi32(0x80000000);
+	const __m128i f16max = _mm_set1_epi32((127 + 16) << 23);
+	const __m128i infAsF32 = _mm_set1_epi32(0x7f800000);
+	const __m128i nanBit = _mm_set1_epi32(0x200);
+	const __m128i infAsF16 = _mm_set1_epi32(0x7c00);
+	const __m128i minNormal = _mm_set1_epi32((127 - 14) << 23);
+	const __m128i subnormMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+	const __m128i normalBias = _mm_set1_epi32(0xfff - ((127 - 15) << 23));
+	__m128  justSign = _mm_and_ps(_mm_castsi128_ps(maskSign), f);
+	__m128i absf = _mm_castps_si128(_mm_xor_ps(f, justSign));
+	__m128i isNan = _mm_cmpgt_epi32(absf, infAsF32);
+	__m128i isRegular = _mm_cmpgt_epi32(f16max, absf);
+	__m128i infOrNan = _mm_or_si128(_mm_and_si128(isNan, nanBit), infAsF16);
+	__m128i isSubnormal = _mm_cmpgt_epi32(minNormal, absf);
+	// subnormal results: let the FP adder round the mantissa
+	__m128i subnorm = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(absf), _mm_castsi128_ps(subnormMagic))), subnormMagic);
+	// normal results: re-bias exponent and round mantissa to nearest even
+	__m128i mantOdd = _mm_srai_epi32(_mm_slli_epi32(absf, 31 - 13), 31);
+	__m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absf, normalBias), mantOdd), 13);
+	__m128i result = _mm_or_si128(_mm_and_si128(subnorm, isSubnormal), _mm_andnot_si128(isSubnormal, normal));
+	result = _mm_or_si128(_mm_and_si128(result, isRegular), _mm_andnot_si128(isRegular, infOrNan));
+	return _mm_or_si128(result, _mm_srai_epi32(_mm_castps_si128(justSign), 16));
+}
+
+static inline void HafCpu_CvtRow_F32_F16(vx_size n, vx_float32 * pDst, const vx_uint16 * pSrc)
+{
+	vx_size x = 0;
+	for (; x + 8 <= n; x += 8) {
+		__m128i h = _mm_loadu_si128((const __m128i *)&pSrc[x]);
+		_mm_storeu_ps(&pDst[x], HafCpu_CvtF16toF32(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+		_mm_storeu_ps(&pDst[x + 4], HafCpu_CvtF16toF32(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
+	}
+	for (; x < n; x++) {
+		pDst[x] = _mm_cvtss_f32(HafCpu_CvtF16toF32(_mm_cvtsi32_si128(pSrc[x])));
+	}
+}
+
+static inline void HafCpu_CvtRow_F16_F32(vx_size n, vx_uint16 * pDst, const vx_float32 * pSrc)
+{
+	vx_size x = 0;
+	for (; x + 8 <= n; x += 8) {
+		__m128i lo = HafCpu_CvtF32toF16(_mm_loadu_ps(&pSrc[x]));
+		__m128i hi = HafCpu_CvtF32toF16(_mm_loadu_ps(&pSrc[x + 4]));
+		_mm_storeu_si128((__m128i *)&pDst[x], _mm_packs_epi32(lo, hi));
+	}
+	for (; x < n; x++) {
+		pDst[x] = (vx_uint16)_mm_cvtsi128_si32(HafCpu_CvtF32toF16(_mm_set_ss(pSrc[x])));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+// conversion of a row of U8/S16/F16/F32 tensor elements to/from F32 real values:
+//   - fixed-point elements are scaled by 2^-fixedPointPos on load and 2^fixedPointPos on store
+//   - integer stores round to nearest even and either saturate or wrap
+static void HafCpu_LoadRow_F32(vx_enum dataType, vx_uint32 fixedPointPos, vx_size n, vx_float32 * pDst, const vx_uint8 * pSrc)
+{
+	vx_size x = 0;
+	if (dataType == VX_TYPE_FLOAT32) {
+		memcpy(pDst, pSrc, n * sizeof(vx_float32));
+	}
+	else if (dataType == VX_TYPE_FLOAT16) {
+		HafCpu_CvtRow_F32_F16(n, pDst, (const vx_uint16 *)pSrc);
+	}
+	else if (dataType == VX_TYPE_INT16) {
+		const vx_int16 * pSrcS16 = (const vx_int16 *)pSrc;
+		vx_float32 scale = 1.0f / (vx_float32)(1 << fixedPointPos);
+		__m128 scale4 = _mm_set1_ps(scale);
+		for (; x + 8 <= n; x += 8) {
+			__m128i s = _mm_loadu_si128((const __m128i *)&pSrcS16[x]);
+			_mm_storeu_ps(&pDst[x], _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(s)), scale4));
+			_mm_storeu_ps(&pDst[x + 4], _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(s, 8))), scale4));
+		}
+		for (; x < n; x++) {
+			pDst[x] = pSrcS16[x] * scale;
+		}
+	}
+	else if (dataType == VX_TYPE_UINT8) {
+		vx_float32 scale = 1.0f / (vx_float32)(1 << fixedPointPos);
+		__m128 scale4 = _mm_set1_ps(scale);
+		for (; x + 8 <= n; x += 8) {
+			__m128i s = _mm_loadl_epi64((const __m128i *)&pSrc[x]);
+			_mm_storeu_ps(&pDst[x], _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(s)), scale4));
+			_mm_storeu_ps(&pDst[x + 4], _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(s, 4))), scale4));
+		}
+		for (; x < n; x++) {
+			pDst[x] = pSrc[x] * scale;
+		}
+	}
+}
+
+static void HafCpu_StoreRow_F32(vx_enum dataType, vx_uint32 fixedPointPos, vx_enum policy, vx_size n, vx_uint8 * pDst, const vx_float32 * pSrc)
+{
+	vx_size x = 0;
+	if (dataType == VX_TYPE_FLOAT32) {
+		memcpy(pDst, pSrc, n * sizeof(vx_float32));
+	}
+	else if (dataType == VX_TYPE_FLOAT16) {
+		HafCpu_CvtRow_F16_F32(n, (vx_uint16 *)pDst, pSrc);
+	}
+	else if (dataType == VX_TYPE_INT16) {
+		vx_int16 * pDstS16 = (vx_int16 *)pDst;
+		vx_float32 scale = (vx_float32)(1 << fixedPointPos);
+		__m128 scale4 = _mm_set1_ps(scale);
+		if (policy == VX_CONVERT_POLICY_SATURATE) {
+			__m128 minv = _mm_set1_ps(-32768.0f), maxv = _mm_set1_ps(32767.0f);
+			for (; x + 8 <= n; x += 8) {
+				__m128i lo = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&pSrc[x]), scale4), minv), maxv));
+				__m128i hi = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&pSrc[x + 4]), scale4), minv), maxv));
+				_mm_storeu_si128((__m128i *)&pDstS16[x], _mm_packs_epi32(lo, hi));
+			}
+			for (; x < n; x++) {
+				vx_float32 v = std::min(std::max(pSrc[x] * scale, -32768.0f), 32767.0f);
+				pDstS16[x] = (vx_int16)_mm_cvtss_si32(_mm_set_ss(v));
+			}
+		}
+		else {
+			for (; x + 8 <= n; x += 8) {
+				__m128i lo = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&pSrc[x]), scale4));
+				__m128i hi = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&pSrc[x + 4]), scale4));
+				lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+				hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+				_mm_storeu_si128((__m128i *)&pDstS16[x], _mm_packs_epi32(lo, hi));
+			}
+			for (; x < n; x++) {
+				pDstS16[x] = (vx_int16)_mm_cvtss_si32(_mm_set_ss(pSrc[x] * scale));
+			}
+		}
+	}
+	else if (dataType == VX_TYPE_UINT8) {
+		vx_float32 scale = (vx_float32)(1 << fixedPointPos);
+		__m128 scale4 = _mm_set1_ps(scale);
+		if (policy == VX_CONVERT_POLICY_SATURATE) {
+			__m128 minv = _mm_setzero_ps(), maxv = _mm_set1_ps(255.0f);
+			for (; x + 8 <= n; x += 8) {
+				__m128i lo = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&pSrc[x]), scale4), minv), maxv));
+				__m128i hi = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&pSrc[x + 4]), scale4), minv), maxv));
+				__m128i s16 = _mm_packs_epi32(lo, hi);
+				_mm_storel_epi64((__m128i *)&pDst[x], _mm_packus_epi16(s16, s16));
+			}
+			for (; x < n; x++) {
+				vx_float32 v = std::min(std::max(pSrc[x] * scale, 0.0f), 255.0f);
+				pDst[x] = (vx_uint8)_mm_cvtss_si32(_mm_set_ss(v));
+			}
+		}
+		else {
+			__m128i mask = _mm_set1_epi32(0xff);
+			for (; x + 8 <= n; x += 8) {
+				__m128i lo = _mm_and_si128(_mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&pSrc[x]), scale4)), mask);
+				__m128i hi = _mm_and_si128(_mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&pSrc[x + 4]), scale4)), mask);
+				__m128i s16 = _mm_packs_epi32(lo, hi);
+				_mm_storel_epi64((__m128i *)&pDst[x], _mm_packus_epi16(s16, s16));
+			}
+			for (; x < n; x++) {
+				pDst[x] = (vx_uint8)_mm_cvtss_si32(_mm_set_ss(pSrc[x] * scale));
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+// element-wise row operations: pSrc2 is broadcast when src2Scalar is true
+static void HafCpu_TensorRowOp_F32(int op, vx_size n, vx_float32 * pDst, const vx_float32 * pSrc1, const vx_float32 * pSrc2, bool src2Scalar, vx_float32 scale)
+{
+	vx_size x = 0;
+	__m128 scale4 = _mm_set1_ps(scale);
+	__m128 b = _mm_set1_ps(pSrc2[0]);
+	for (; x + 8 <= n; x += 8) {
+		__m128 a0 = _mm_loadu_ps(&pSrc1[x]), a1 = _mm_loadu_ps(&pSrc1[x + 4]);
+		__m128 b0 = b, b1 = b;
+		if (!src2Scalar) {
+			b0 = _mm_loadu_ps(&pSrc2[x]);
+			b1 = _mm_loadu_ps(&pSrc2[x + 4]);
+		}
+		if (op == HAF_TENSOR_OP_ADD) {
+			a0 = _mm_add_ps(a0, b0); a1 = _mm_add_ps(a1, b1);
+		}
+		else if (op == HAF_TENSOR_OP_SUBTRACT) {
+			a0 = _mm_sub_ps(a0, b0); a1 = _mm_sub_ps(a1, b1);
+		}
+		else {
+			a0 = _mm_mul_ps(_mm_mul_ps(a0, b0), scale4); a1 = _mm_mul_ps(_mm_mul_ps(a1, b1), scale4);
+		}
+		_mm_storeu_ps(&pDst[x], a0);
+		_mm_storeu_ps(&pDst[x + 4], a1);
+	}
+	for (; x < n; x++) {
+		vx_float32 a = pSrc1[x], bv = pSrc2[src2Scalar ? 0 : x];
+		pDst[x] = (op == HAF_TENSOR_OP_ADD) ? a + bv : ((op == HAF_TENSOR_OP_SUBTRACT) ? a - bv : a * bv * scale);
+	}
+}
+
+static void HafCpu_TensorRowAddSub_S16(bool subtract, bool saturate, vx_size n, vx_int16 * pDst, const vx_int16 * pSrc1, const vx_int16 * pSrc2, bool src2Scalar)
+{
+	vx_size x = 0;
+	__m128i b = _mm_set1_epi16(pSrc2[0]);
+	for (; x + 8 <= n; x += 8) {
+		__m128i a = _mm_loadu_si128((const __m128i *)&pSrc1[x]);
+		__m128i bv = src2Scalar ? b : _mm_loadu_si128((const __m128i *)&pSrc2[x]);
+		if (subtract) a = saturate ? _mm_subs_epi16(a, bv) : _mm_sub_epi16(a, bv);
+		else          a = saturate ? _mm_adds_epi16(a, bv) : _mm_add_epi16(a, bv);
+		_mm_storeu_si128((__m128i *)&pDst[x], a);
+	}
+	for (; x < n; x++) {
+		vx_int32 v = subtract ? (vx_int32)pSrc1[x] - pSrc2[src2Scalar ? 0 : x] : (vx_int32)pSrc1[x] + pSrc2[src2Scalar ? 0 : x];
+		pDst[x] = saturate ? (vx_int16)std::min(std::max(v, -32768), 32767) : (vx_int16)v;
+	}
+}
+
+static void HafCpu_TensorRowAddSub_U8(bool subtract, bool saturate, vx_size n, vx_uint8 * pDst, const vx_uint8 * pSrc1, const vx_uint8 * pSrc2, bool src2Scalar)
+{
+	vx_size x = 0;
+	__m128i b = _mm_set1_epi8((char)pSrc2[0]);
+	for (; x + 16 <= n; x += 16) {
+		__m128i a = _mm_loadu_si128((const __m128i *)&pSrc1[x]);
+		__m128i bv = src2Scalar ? b : _mm_loadu_si128((const __m128i *)&pSrc2[x]);
+		if (subtract) a = saturate ? _mm_subs_epu8(a, bv) : _mm_sub_epi8(a, bv);
+		else          a = saturate ? _mm_adds_epu8(a, bv) : _mm_add_epi8(a, bv);
+		_mm_storeu_si128((__m128i *)&pDst[x], a);
+	}
+	for (; x < n; x++) {
+		vx_int32 v = subtract ? (vx_int32)pSrc1[x] - pSrc2[src2Scalar ? 0 : x] : (vx_int32)pSrc1[x] + pSrc2[src2Scalar ? 0 : x];
+		pDst[x] = saturate ? (vx_uint8)std::min(std::max(v, 0), 255) : (vx_uint8)v;
+	}
+}
+
+// Q-format multiply with unit scale: (a * b) >> fixedPointPos with exact 32-bit products
+static void HafCpu_TensorRowMul_S16(vx_uint32 fixedPointPos, bool saturate, bool roundToZero, vx_size n, vx_int16 * pDst, const vx_int16 * pSrc1, const vx_int16 * pSrc2, bool src2Scalar)
+{
+	vx_size x = 0;
+	vx_int32 half = fixedPointPos ? (1 << (fixedPointPos - 1)) : 0, lsbMask = (1 << fixedPointPos) - 1;
+	__m128i b = _mm_set1_epi16(pSrc2[0]);
+	__m128i halfm1 = _mm_set1_epi32(std::max(half - 1, 0)), one = _mm_set1_epi32(fixedPointPos ? 1 : 0), mask = _mm_set1_epi32(lsbMask);
+	__m128i shift = _mm_cvtsi32_si128(fixedPointPos);
+	for (; x + 8 <= n; x += 8) {
+		__m128i a = _mm_loadu_si128((const __m128i *)&pSrc1[x]);
+		__m128i bv = src2Scalar ? b : _mm_loadu_si128((const __m128i *)&pSrc2[x]);
+		__m128i plo = _mm_mullo_epi16(a, bv), phi = _mm_mulhi_epi16(a, bv);
+		__m128i p0 = _mm_unpacklo_epi16(plo, phi), p1 = _mm_unpackhi_epi16(plo, phi);
+		if (roundToZero) {
+			// bias negative products so that the arithmetic shift truncates towards zero
+			p0 = _mm_add_epi32(p0, _mm_and_si128(_mm_srai_epi32(p0, 31), mask));
+			p1 = _mm_add_epi32(p1, _mm_and_si128(_mm_srai_epi32(p1, 31), mask));
+		}
+		else {
+			// round half to even: add (half - 1) plus the LSB of the truncated result
+			p0 = _mm_add_epi32(p0, _mm_add_epi32(halfm1, _mm_and_si128(_mm_sra_epi32(p0, shift), one)));
+			p1 = _mm_add_epi32(p1, _mm_add_epi32(halfm1, _mm_and_si128(_mm_sra_epi32(p1, shift), one)));
+		}
+		p0 = _mm_sra_epi32(p0, shift);
+		p1 = _mm_sra_epi32(p1, shift);
+		if (!saturate) {
+			p0 = _mm_srai_epi32(_mm_slli_epi32(p0, 16), 16);
+			p1 = _mm_srai_epi32(_mm_slli_epi32(p1, 16), 16);
+		}
+		_mm_storeu_si128((__m128i *)&pDst[x], _mm_packs_epi32(p0, p1));
+	}
+	for (; x < n; x++) {
+		vx_int32 p = (vx_int32)pSrc1[x] * pSrc2[src2Scalar ? 0 : x];
+		if (roundToZero) p += (p >> 31) & lsbMask;
+		else if (fixedPointPos) p += (half - 1) + ((p >> fixedPointPos) & 1);
+		p >>= fixedPointPos;
+		pDst[x] = saturate ? (vx_int16)std::min(std::max(p, -32768), 32767) : (vx_int16)p;
+	}
+}
+
+// generic integer multiply with arbitrary scale: computed in double precision
+static void HafCpu_TensorRowMul_Generic(vx_enum dataType, vx_uint32 fixedPointPos, vx_float32 scale, bool saturate, bool roundToZero,
+	vx_size n, vx_uint8 * pDst, const vx_uint8 * pSrc1, const vx_uint8 * pSrc2, bool src2Scalar)
+{
+	vx_float64 multiplier = (vx_float64)scale / (vx_float64)(1 << fixedPointPos);
+	for (vx_size x = 0; x < n; x++) {
+		vx_size xb = src2Scalar ? 0 : x;
+		vx_float64 a, b;
+		if (dataType == VX_TYPE_INT16) { a = ((const vx_int16 *)pSrc1)[x]; b = ((const vx_int16 *)pSrc2)[xb]; }
+		else                           { a = pSrc1[x]; b = pSrc2[xb]; }
+		vx_float64 v = roundToZero ? trunc(a * b * multiplier) : nearbyint(a * b * multiplier);
+		if (dataType == VX_TYPE_INT16) {
+			((vx_int16 *)pDst)[x] = saturate ? (vx_int16)std::min(std::max(v, -32768.0), 32767.0) : (vx_int16)(vx_int64)v;
+		}
+		else {
+			pDst[x] = saturate ? (vx_uint8)std::min(std::max(v, 0.0), 255.0) : (vx_uint8)(vx_int64)v;
+		}
+	}
+}
+
+static int HafCpu_TensorElementwise_DATA_DATA_DATA
+	(
+		int               op,
+		vx_enum           dataType,
+		vx_uint32         fixedPointPos,
+		vx_enum           overflowPolicy,
+		vx_enum           roundingPolicy,
+		vx_float32        scale,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc1,
+		const vx_size   * src1Stride,
+		const vx_uint8  * pSrc2,
+		const vx_size   * src2Stride
+	)
+{
+	bool saturate = (overflowPolicy == VX_CONVERT_POLICY_SATURATE);
+	bool roundToZero = (roundingPolicy == VX_ROUND_POLICY_TO_ZERO);
+	bool src2Scalar = (src2Stride[0] == 0);
+	vx_size n = dims[0];
+	vx_size numRows = dims[1] * dims[2] * dims[3];
+	HafCpu_TensorParallelFor(numRows, n, [=](vx_size rowStart, vx_size rowEnd) {
+		vx_float32 bufA[HAF_TENSOR_ROW_BLOCK], bufB[HAF_TENSOR_ROW_BLOCK], bufD[HAF_TENSOR_ROW_BLOCK];
+		for (vx_size row = rowStart; row < rowEnd; row++) {
+			vx_uint8 * d = pDst + HafCpu_TensorRowOffset(row, dims, dstStride);
+			const vx_uint8 * a = pSrc1 + HafCpu_TensorRowOffset(row, dims, src1Stride);
+			const vx_uint8 * b = pSrc2 + HafCpu_TensorRowOffset(row, dims, src2Stride);
+			if (dataType == VX_TYPE_FLOAT32) {
+				HafCpu_TensorRowOp_F32(op, n, (vx_float32 *)d, (const vx_float32 *)a, (const vx_float32 *)b, src2Scalar, scale);
+			}
+			else if (dataType == VX_TYPE_FLOAT16) {
+				// convert blocks of the row to F32, compute, and convert back
+				for (vx_size x = 0; x < n; x += HAF_TENSOR_ROW_BLOCK) {
+					vx_size m = std::min((vx_size)HAF_TENSOR_ROW_BLOCK, n - x);
+					HafCpu_CvtRow_F32_F16(m, bufA, (const vx_uint16 *)a + x);
+					HafCpu_CvtRow_F32_F16(src2Scalar ? 1 : m, bufB, (const vx_uint16 *)b + (src2Scalar ? 0 : x));
+					HafCpu_TensorRowOp_F32(op, m, bufD, bufA, bufB, src2Scalar, scale);
+					HafCpu_CvtRow_F16_F32(m, (vx_uint16 *)d + x, bufD);
+				}
+			}
+			else if (op != HAF_TENSOR_OP_MULTIPLY) {
+				if (dataType == VX_TYPE_INT16)
+					HafCpu_TensorRowAddSub_S16(op == HAF_TENSOR_OP_SUBTRACT, saturate, n, (vx_int16 *)d, (const vx_int16 *)a, (const vx_int16 *)b, src2Scalar);
+				else
+					HafCpu_TensorRowAddSub_U8(op == HAF_TENSOR_OP_SUBTRACT, saturate, n, d, a, b, src2Scalar);
+			}
+			else if (dataType == VX_TYPE_INT16 && scale == 1.0f) {
+				HafCpu_TensorRowMul_S16(fixedPointPos, saturate, roundToZero, n, (vx_int16 *)d, (const vx_int16 *)a, (const vx_int16 *)b, src2Scalar);
+			}
+			else {
+				HafCpu_TensorRowMul_Generic(dataType, fixedPointPos, scale, saturate, roundToZero, n, d, a, b, src2Scalar);
+			}
+		}
+	});
+	return AGO_SUCCESS;
+}
+
+int HafCpu_TensorAdd_DATA_DATA_DATA
+	(
+		vx_enum           dataType,
+		vx_enum           overflowPolicy,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc1,
+		const vx_size   * src1Stride,
+		const vx_uint8  * pSrc2,
+		const vx_size   * src2Stride
+	)
+{
+	return HafCpu_TensorElementwise_DATA_DATA_DATA(HAF_TENSOR_OP_ADD, dataType, 0, overflowPolicy, VX_ROUND_POLICY_TO_ZERO, 1.0f,
+		dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride);
+}
+
+int HafCpu_TensorSubtract_DATA_DATA_DATA
+	(
+		vx_enum           dataType,
+		vx_enum           overflowPolicy,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc1,
+		const vx_size   * src1Stride,
+		const vx_uint8  * pSrc2,
+		const vx_size   * src2Stride
+	)
+{
+	return HafCpu_TensorElementwise_DATA_DATA_DATA(HAF_TENSOR_OP_SUBTRACT, dataType, 0, overflowPolicy, VX_ROUND_POLICY_TO_ZERO, 1.0f,
+		dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride);
+}
+
+int HafCpu_TensorMultiply_DATA_DATA_DATA
+	(
+		vx_enum           dataType,
+		vx_uint32         fixedPointPos,
+		vx_float32        scale,
+		vx_enum           overflowPolicy,
+		vx_enum           roundingPolicy,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc1,
+		const vx_size   * src1Stride,
+		const vx_uint8  * pSrc2,
+		const vx_size   * src2Stride
+	)
+{
+	return HafCpu_TensorElementwise_DATA_DATA_DATA(HAF_TENSOR_OP_MULTIPLY, dataType, fixedPointPos, overflowPolicy, roundingPolicy, scale,
+		dims, pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride);
+}
+
+int HafCpu_TensorTableLookup_DATA_DATA
+	(
+		vx_enum           dataType,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc,
+		const vx_size   * srcStride,
+		const vx_uint8  * pLut,
+		vx_uint32         lutCount,
+		vx_uint32         lutOffset
+	)
+{
+	vx_size n = dims[0];
+	HafCpu_TensorParallelFor(dims[1] * dims[2] * dims[3], n, [=](vx_size rowStart, vx_size rowEnd) {
+		for (vx_size row = rowStart; row < rowEnd; row++) {
+			vx_uint8 * d = pDst + HafCpu_TensorRowOffset(row, dims, dstStride);
+			const vx_uint8 * s = pSrc + HafCpu_TensorRowOffset(row, dims, srcStride);
+			if (dataType == VX_TYPE_UINT8) {
+				vx_size x = 0;
+				for (; x + 4 <= n; x += 4) {
+					d[x] = pLut[s[x]]; d[x + 1] = pLut[s[x + 1]];
+					d[x + 2] = pLut[s[x + 2]]; d[x + 3] = pLut[s[x + 3]];
+				}
+				for (; x < n; x++) d[x] = pLut[s[x]];
+			}
+			else {
+				// out-of-range indices are clamped to the table
+				const vx_int16 * lut = (const vx_int16 *)pLut;
+				const vx_int16 * src = (const vx_int16 *)s;
+				vx_int16 * dst = (vx_int16 *)d;
+				vx_int32 maxIndex = (vx_int32)lutCount - 1;
+				for (vx_size x = 0; x < n; x++) {
+					vx_int32 index = std::min(std::max((vx_int32)src[x] + (vx_int32)lutOffset, 0), maxIndex);
+					dst[x] = lut[index];
+				}
+			}
+		}
+	});
+	return AGO_SUCCESS;
+}
+
+int HafCpu_TensorTranspose_DATA_DATA
+	(
+		vx_size           elemSize,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc,
+		const vx_size   * srcStride,
+		vx_size           dim1,
+		vx_size           dim2
+	)
+{
+	// source strides in output order
+	vx_size stride[AGO_MAX_TENSOR_DIMENSIONS];
+	for (vx_size i = 0; i < AGO_MAX_TENSOR_DIMENSIONS; i++) stride[i] = srcStride[i];
+	std::swap(stride[dim1], stride[dim2]);
+	vx_size n = dims[0];
+	if (dim1 != 0 && dim2 != 0) {
+		// rows stay contiguous: plain row copies
+		HafCpu_TensorParallelFor(dims[1] * dims[2] * dims[3], n, [=](vx_size rowStart, vx_size rowEnd) {
+			for (vx_size row = rowStart; row < rowEnd; row++) {
+				memcpy(pDst + HafCpu_TensorRowOffset(row, dims, dstStride), pSrc + HafCpu_TensorRowOffset(row, dims, stride), n * elemSize);
+			}
+		});
+	}
+	else {
+		// dims[0] is swapped with dims[d]: transpose 2D planes of [dims[d], dims[0]] in cache-sized tiles
+		const vx_size tile = 32;
+		vx_size d = dim1 + dim2, m = dims[d];
+		vx_size outer[2], outerStrideDst[2], outerStrideSrc[2], k = 0;
+		for (vx_size i = 1; i < AGO_MAX_TENSOR_DIMENSIONS; i++) {
+			if (i != d) {
+				outer[k] = dims[i];
+				outerStrideDst[k] = dstStride[i];
+				outerStrideSrc[k] = stride[i];
+				k++;
+			}
+		}
+		vx_size srcRowStride = stride[0], dstRowStride = dstStride[d], srcColStride = stride[d];
+		vx_size numTiles = (m + tile - 1) / tile;
+		HafCpu_TensorParallelFor(outer[0] * outer[1] * numTiles, n * tile, [=](vx_size itemStart, vx_size itemEnd) {
+			for (vx_size item = itemStart; item < itemEnd; item++) {
+				vx_size t = item % numTiles, plane = item / numTiles;
+				vx_size j0 = plane % outer[0], j1 = plane / outer[0];
+				vx_uint8 * dPlane = pDst + j0 * outerStrideDst[0] + j1 * outerStrideDst[1];
+				const vx_uint8 * sPlane = pSrc + j0 * outerStrideSrc[0] + j1 * outerStrideSrc[1];
+				vx_size yEnd = std::min(m, (t + 1) * tile);
+				for (vx_size x0 = 0; x0 < n; x0 += tile) {
+					vx_size xEnd = std::min(n, x0 + tile);
+					for (vx_size y = t * tile; y < yEnd; y++) {
+						vx_uint8 * dRow = dPlane + y * dstRowStride;
+						const vx_uint8 * sCol = sPlane + y * srcColStride;
+						if (elemSize == 4) {
+							for (vx_size x = x0; x < xEnd; x++) ((vx_uint32 *)dRow)[x] = *(const vx_uint32 *)(sCol + x * srcRowStride);
+						}
+						else if (elemSize == 2) {
+							for (vx_size x = x0; x < xEnd; x++) ((vx_uint16 *)dRow)[x] = *(const vx_uint16 *)(sCol + x * srcRowStride);
+						}
+						else if (elemSize == 1) {
+							for (vx_size x = x0; x < xEnd; x++) dRow[x] = sCol[x * srcRowStride];
+						}
+						else {
+							for (vx_size x = x0; x < xEnd; x++) memcpy(dRow + x * elemSize, sCol + x * srcRowStride, elemSize);
+						}
+					}
+				}
+			}
+		});
+	}
+	return AGO_SUCCESS;
+}
+
+int HafCpu_TensorConvertDepth_DATA_DATA
+	(
+		vx_enum           dstType,
+		vx_uint32         dstFixedPointPos,
+		vx_enum           srcType,
+		vx_uint32         srcFixedPointPos,
+		vx_enum           overflowPolicy,
+		vx_float32        norm,
+		vx_float32        offset,
+		const vx_size   * dims,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc,
+		const vx_size   * srcStride
+	)
+{
+	vx_size n = dims[0];
+	HafCpu_TensorParallelFor(dims[1] * dims[2] * dims[3], n, [=](vx_size rowStart, vx_size rowEnd) {
+		vx_float32 buf[HAF_TENSOR_ROW_BLOCK];
+		__m128 offset4 = _mm_set1_ps(offset), norm4 = _mm_set1_ps(norm);
+		vx_size srcElemSize = (srcType == VX_TYPE_FLOAT32) ? 4 : ((srcType == VX_TYPE_UINT8) ? 1 : 2);
+		vx_size dstElemSize = (dstType == VX_TYPE_FLOAT32) ? 4 : ((dstType == VX_TYPE_UINT8) ? 1 : 2);
+		for (vx_size row = rowStart; row < rowEnd; row++) {
+			vx_uint8 * d = pDst + HafCpu_TensorRowOffset(row, dims, dstStride);
+			const vx_uint8 * s = pSrc + HafCpu_TensorRowOffset(row, dims, srcStride);
+			for (vx_size x = 0; x < n; x += HAF_TENSOR_ROW_BLOCK) {
+				vx_size m = std::min((vx_size)HAF_TENSOR_ROW_BLOCK, n - x), i = 0;
+				HafCpu_LoadRow_F32(srcType, srcFixedPointPos, m, buf, s + x * srcElemSize);
+				for (; i + 4 <= m; i += 4) {
+					_mm_storeu_ps(&buf[i], _mm_div_ps(_mm_sub_ps(_mm_loadu_ps(&buf[i]), offset4), norm4));
+				}
+				for (; i < m; i++) {
+					buf[i] = (buf[i] - offset) / norm;
+				}
+				HafCpu_StoreRow_F32(dstType, dstFixedPointPos, overflowPolicy, m, d + x * dstElemSize, buf);
+			}
+		}
+	});
+	return AGO_SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////
+// matrix multiply: output[M][N] = op(input1)[M][K] * op(input2)[K][N] + op(input3)[M][N]
+//   - tensor dims[0] is the column index and dims[1] is the row index
+//   - F32/F16 operands are packed into F32 matrices: A as [M][K] and B as [K][N]
+//   - U8/S16 operands are packed into S16 matrices: A as [M][K] and B transposed as [N][K],
+//     and the dot products are accumulated exactly in 64-bit integers
+static inline const vx_uint8 * HafCpu_MatrixElement(const vx_uint8 * p, const vx_size * stride, bool transpose, vx_size row, vx_size col)
+{
+	return transpose ? p + col * stride[1] + row * stride[0] : p + row * stride[1] + col * stride[0];
+}
+
+static inline vx_int64 HafCpu_DotProduct_S16(vx_size k, const vx_int16 * a, const vx_int16 * b)
+{
+	vx_size i = 0;
+	__m128i acc = _mm_setzero_si128();
+	for (; i + 8 <= k; i += 8) {
+		__m128i p = _mm_madd_epi16(_mm_loadu_si128((const __m128i *)&a[i]), _mm_loadu_si128((const __m128i *)&b[i]));
+		acc = _mm_add_epi64(acc, _mm_add_epi64(_mm_cvtepi32_epi64(p), _mm_cvtepi32_epi64(_mm_srli_si128(p, 8))));
+	}
+	vx_int64 sum = _mm_cvtsi128_si64(acc) + _mm_cvtsi128_si64(_mm_srli_si128(acc, 8));
+	for (; i < k; i++) sum += (vx_int32)a[i] * b[i];
+	return sum;
+}
+
+int HafCpu_TensorMatrixMultiply_DATA_DATA_DATA
+	(
+		vx_enum           dataType,
+		vx_uint32         fixedPointPos,
+		vx_size           M,
+		vx_size           N,
+		vx_size           K,
+		vx_uint8        * pDst,
+		const vx_size   * dstStride,
+		const vx_uint8  * pSrc1,
+		const vx_size   * src1Stride,
+		bool              transpose1,
+		const vx_uint8  * pSrc2,
+		const vx_size   * src2Stride,
+		bool              transpose2,
+		const vx_uint8  * pSrc3,
+		const vx_size   * src3Stride,
+		bool              transpose3,
+		vx_uint8        * pScratch
+	)
+{
+	bool isFloat = (dataType == VX_TYPE_FLOAT32 || dataType == VX_TYPE_FLOAT16);
+	vx_size packedElemSize = isFloat ? sizeof(vx_float32) : sizeof(vx_int16);
+	vx_uint8 * pA = pScratch;
+	vx_uint8 * pB = pScratch + ALIGN32(M * K * packedElemSize);
+	// pack A[M][K] and B as [K][N] (float) or [N][K] (integer)
+	HafCpu_TensorParallelFor(M, K, [=](vx_size rowStart, vx_size rowEnd) {
+		for (vx_size i = rowStart; i < rowEnd; i++) {
+			for (vx_size k = 0; k < K; k++) {
+				const vx_uint8 * e = HafCpu_MatrixElement(pSrc1, src1Stride, transpose1, i, k);
+				if (dataType == VX_TYPE_FLOAT32)      ((vx_float32 *)pA)[i * K + k] = *(const vx_float32 *)e;
+				else if (dataType == VX_TYPE_FLOAT16) HafCpu_CvtRow_F32_F16(1, (vx_float32 *)pA + i * K + k, (const vx_uint16 *)e);
+				else if (dataType == VX_TYPE_INT16)   ((vx_int16 *)pA)[i * K + k] = *(const vx_int16 *)e;
+				else                                  ((vx_int16 *)pA)[i * K + k] = *e;
+			}
+		}
+	});
+	HafCpu_TensorParallelFor(K, N, [=](vx_size rowStart, vx_size rowEnd) {
+		for (vx_size k = rowStart; k < rowEnd; k++) {
+			for (vx_size j = 0; j < N; j++) {
+				const vx_uint8 * e = HafCpu_MatrixElement(pSrc2, src2Stride, transpose2, k, j);
+				if (dataType == VX_TYPE_FLOAT32)      ((vx_float32 *)pB)[k * N + j] = *(const vx_float32 *)e;
+				else if (dataType == VX_TYPE_FLOAT16) HafCpu_CvtRow_F32_F16(1, (vx_float32 *)pB + k * N + j, (const vx_uint16 *)e);
+				else if (dataType == VX_TYPE_INT16)   ((vx_int16 *)pB)[j * K + k] = *(const vx_int16 *)e;
+				else                                  ((vx_int16 *)pB)[j * K + k] = *e;
+			}
+		}
+	});
+	// compute output rows
+	HafCpu_TensorParallelFor(M, N * K, [=](vx_size rowStart, vx_size rowEnd) {
+		std::vector<vx_float32> acc(isFloat ? N : 0), bias(isFloat && pSrc3 ? N : 0);
+		for (vx_size i = rowStart; i < rowEnd; i++) {
+			vx_uint8 * d = pDst + i * dstStride[1];
+			if (isFloat) {
+				const vx_float32 * a = (const vx_float32 *)pA + i * K;
+				std::fill(acc.begin(), acc.end(), 0.0f);
+				for (vx_size k = 0; k < K; k++) {
+					const vx_float32 * b = (const vx_float32 *)pB + k * N;
+					__m128 a4 = _mm_set1_ps(a[k]);
+					vx_size j = 0;
+					for (; j + 8 <= N; j += 8) {
+						_mm_storeu_ps(&acc[j], _mm_add_ps(_mm_loadu_ps(&acc[j]), _mm_mul_ps(a4, _mm_loadu_ps(&b[j]))));
+						_mm_storeu_ps(&acc[j + 4], _mm_add_ps(_mm_loadu_ps(&acc[j + 4]), _mm_mul_ps(a4, _mm_loadu_ps(&b[j + 4]))));
+					}
+					for (; j < N; j++) acc[j] += a[k] * b[j];
+				}
+				if (pSrc3) {
+					for (vx_size j = 0; j < N; j++) {
+						const vx_uint8 * e = HafCpu_MatrixElement(pSrc3, src3Stride, transpose3, i, j);
+						if (dataType == VX_TYPE_FLOAT32) bias[j] = *(const vx_float32 *)e;
+						else HafCpu_CvtRow_F32_F16(1, &bias[j], (const vx_uint16 *)e);
+					}
+					HafCpu_TensorRowOp_F32(HAF_TENSOR_OP_ADD, N, &acc[0], &acc[0], &bias[0], false, 1.0f);
+				}
+				HafCpu_StoreRow_F32(dataType, 0, VX_CONVERT_POLICY_SATURATE, N, d, &acc[0]);
+			}
+			else {
+				const vx_int16 * a = (const vx_int16 *)pA + i * K;
+				vx_int64 half = fixedPointPos ? ((vx_int64)1 << (fixedPointPos - 1)) : 0;
+				for (vx_size j = 0; j < N; j++) {
+					vx_int64 sum = HafCpu_DotProduct_S16(K, a, (const vx_int16 *)pB + j * K);
+					// round to nearest, drop the extra fraction bits of the products
+					sum = (sum + half) >> fixedPointPos;
+					if (pSrc3) {
+						const vx_uint8 * e = HafCpu_MatrixElement(pSrc3, src3Stride, transpose3, i, j);
+						sum += (dataType == VX_TYPE_INT16) ? *(const vx_int16 *)e : *e;
+					}
+					if (dataType == VX_TYPE_INT16) ((vx_int16 *)d)[j] = (vx_int16)std::min(std::max(sum, (vx_int64)-32768), (vx_int64)32767);
+					else                           d[j] = (vx_uint8)std::min(std::max(sum, (vx_int64)0), (vx_int64)255);
+				}
+			}
+		}
+	});
+	return AGO_SUCCESS;
+}
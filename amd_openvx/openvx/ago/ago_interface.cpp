@@ -51,6 +51,178 @@ static void agoGraphThreadFunction(LPVOID graph_)
 #endif
 }
 
+static bool agoSchedulerIsBefore(AgoGraph * graph, AgoGraph * other)
+{
+    // higher priority first, then earliest deadline, then first queued
+    if (graph->schedPriority != other->schedPriority)
+        return graph->schedPriority > other->schedPriority;
+    int64_t deadline = graph->schedRequestList.front().deadline;
+    int64_t deadlineOther = other->schedRequestList.front().deadline;
+    if (deadline != deadlineOther) {
+        if (!deadline || !deadlineOther)
+            return deadline != 0;
+        return deadline < deadlineOther;
+    }
+    return graph->schedSequence < other->schedSequence;
+}
+
+static void agoSchedulerQueueGraph(AgoScheduler& scheduler, AgoGraph * graph)
+{
+    // must be called with scheduler.mutex locked
+    graph->schedReady = true;
+    graph->schedSequence = scheduler.sequence++;
+    scheduler.readyList.push_back(graph);
+    if (scheduler.readyList.size() > scheduler.queueDepthMax)
+        scheduler.queueDepthMax = (vx_uint32)scheduler.readyList.size();
+    scheduler.cvWork.notify_one();
+}
+
+static void agoSchedulerWorker(AgoContext * context)
+{
+    AgoScheduler& scheduler = context->scheduler;
+    std::unique_lock<std::mutex> lock(scheduler.mutex);
+    for (;;) {
+        scheduler.cvWork.wait(lock, [&] { return scheduler.terminate || !scheduler.readyList.empty(); });
+        if (scheduler.terminate)
+            break;
+
+        // pick the next graph: a graph is in the ready list only when it isn't running, so
+        // executions of a graph stay in order while different graphs run concurrently
+        auto it = scheduler.readyList.begin();
+        for (auto itc = it + 1; itc != scheduler.readyList.end(); itc++) {
+            if (agoSchedulerIsBefore(*itc, *it))
+                it = itc;
+        }
+        AgoGraph * graph = *it;
+        scheduler.readyList.erase(it);
+        AgoScheduleRequest request = graph->schedRequestList.front();
+        graph->schedRequestList.pop_front();
+        graph->schedReady = false;
+        graph->schedRunning = true;
+        scheduler.running++;
+        int64_t start = agoGetClockCounter();
+        agoLatencyHistogramAdd(&scheduler.wait, (vx_uint64)(start - request.scheduled));
+        agoLatencyHistogramAdd(&graph->schedWait, (vx_uint64)(start - request.scheduled));
+        lock.unlock();
+
+        // execute graph
+        vx_status status = agoProcessGraph(graph);
+
+        int64_t end = agoGetClockCounter();
+        lock.lock();
+        graph->status = status;
+        if (request.deadline && end > request.deadline) {
+            graph->schedDeadlineMissed++;
+            scheduler.deadlineMissed++;
+        }
+        graph->threadExecuteCount++;
+        graph->schedRunning = false;
+        scheduler.running--;
+        scheduler.completed++;
+        if (!graph->schedRequestList.empty()) {
+            agoSchedulerQueueGraph(scheduler, graph);
+        }
+        scheduler.cvDone.notify_all();
+    }
+}
+
+static int agoSchedulerEnqueue(AgoGraph * graph)
+{
+    AgoContext * context = graph->ref.context;
+    AgoScheduler& scheduler = context->scheduler;
+    std::lock_guard<std::mutex> lock(scheduler.mutex);
+    if (scheduler.terminate)
+        return VX_FAILURE;
+    if (graph->schedRequestList.size() >= 1000) {
+        // same limit as pending requests of graph threads
+        return VX_ERROR_NO_RESOURCES;
+    }
+    if (scheduler.workers.empty()) {
+        // start worker threads on first use
+        for (vx_uint32 i = 0; i < scheduler.threadCount; i++) {
+            scheduler.workers.push_back(std::thread(agoSchedulerWorker, context));
+        }
+    }
+    AgoScheduleRequest request;
+    request.scheduled = agoGetClockCounter();
+    request.deadline = 0;
+    if (graph->schedDeadline > 0) {
+        request.deadline = request.scheduled + (int64_t)((vx_float64)graph->schedDeadline * (vx_float64)agoGetClockFrequency() / 1000000000.0);
+    }
+    graph->schedRequestList.push_back(request);
+    graph->threadScheduleCount++;
+    scheduler.scheduled++;
+    if (!graph->schedReady && !graph->schedRunning) {
+        agoSchedulerQueueGraph(scheduler, graph);
+    }
+    return VX_SUCCESS;
+}
+
+static int agoSchedulerWait(AgoGraph * graph)
+{
+    AgoScheduler& scheduler = graph->ref.context->scheduler;
+    std::unique_lock<std::mutex> lock(scheduler.mutex);
+    scheduler.cvDone.wait(lock, [&] { return scheduler.terminate || graph->threadExecuteCount >= graph->threadScheduleCount; });
+    return (graph->threadExecuteCount >= graph->threadScheduleCount) ? VX_SUCCESS : VX_FAILURE;
+}
+
+static void agoSchedulerRemoveGraph(AgoGraph * graph)
+{
+    // drop pending requests of the graph and wait for its execution in progress
+    AgoScheduler& scheduler = graph->ref.context->scheduler;
+    std::unique_lock<std::mutex> lock(scheduler.mutex);
+    auto it = std::find(scheduler.readyList.begin(), scheduler.readyList.end(), graph);
+    if (it != scheduler.readyList.end())
+        scheduler.readyList.erase(it);
+    graph->schedReady = false;
+    vx_int32 dropped = (vx_int32)graph->schedRequestList.size();
+    graph->schedRequestList.clear();
+    scheduler.cvDone.wait(lock, [&] { return scheduler.terminate || !graph->schedRunning; });
+    if (dropped > 0) {
+        // dropped requests will never execute: take them out of the count and report them to waiters
+        graph->threadScheduleCount -= dropped;
+        graph->status = VX_ERROR_GRAPH_ABANDONED;
+        scheduler.cvDone.notify_all();
+    }
+}
+
+static void agoSchedulerShutdown(AgoContext * context)
+{
+    AgoScheduler& scheduler = context->scheduler;
+    {
+        std::lock_guard<std::mutex> lock(scheduler.mutex);
+        scheduler.terminate = true;
+        scheduler.cvWork.notify_all();
+        scheduler.cvDone.notify_all();
+    }
+    for (auto& worker : scheduler.workers) {
+        worker.join();
+    }
+    scheduler.workers.clear();
+}
+
+void agoSchedulerGetInfo(AgoContext * context, AgoSchedulerInfo * info)
+{
+    AgoScheduler& scheduler = context->scheduler;
+    std::lock_guard<std::mutex> lock(scheduler.mutex);
+    info->num_threads = scheduler.threadCount;
+    info->queue_depth = (vx_uint32)scheduler.readyList.size();
+    info->queue_depth_max = scheduler.queueDepthMax;
+    info->running = scheduler.running;
+    info->scheduled = scheduler.scheduled;
+    info->completed = scheduler.completed;
+    info->deadline_missed = scheduler.deadlineMissed;
+    agoLatencyHistogramGetInfo(context, &info->wait, &scheduler.wait);
+}
+
+void agoSchedulerGetGraphInfo(AgoGraph * graph, AgoGraphScheduleInfo * info)
+{
+    std::lock_guard<std::mutex> lock(graph->ref.context->scheduler.mutex);
+    info->pending = (vx_uint32)graph->schedRequestList.size();
+    info->deadline_missed = graph->schedDeadlineMissed;
+    agoLatencyHistogramGetInfo(graph->ref.context, &info->wait, &graph->schedWait);
+}
+
 AgoContext * agoCreateContextFromPlatform(struct _vx_platform * platform)
 {
     CAgoLockGlobalContext lock;
@@ -83,6 +255,26 @@ AgoContext * agoCreateContextFromPlatform(struct _vx_platform * platform)
         if (agoGetEnvironmentVariable("AGO_THREAD_CONFIG", textBuffer, sizeof(textBuffer))) {
             acontext->thread_config = atoi(textBuffer);
         }
+        // initialize node cost table used for CPU/GPU partitioning
+        if (agoGetEnvironmentVariable("AGO_COST_MOCK_GPU", textBuffer, sizeof(textBuffer))) {
+            // format: scale[,launch_ns] -- GPU cost of a node is modeled from its CPU cost
+            if (sscanf(textBuffer, "%lf,%lf", &acontext->costMockGpuScale, &acontext->costMockGpuLaunch) < 1) {
+                acontext->costMockGpuScale = 0.0;
+                acontext->costMockGpuLaunch = 0.0;
+            }
+            else {
+                agoAddLogEntry(&acontext->ref, VX_SUCCESS, "WARNING: AGO_COST_MOCK_GPU: GPU node times are modeled as CPU time * %g + %g ns and CPU/GPU copies aren't measured\n",
+                    acontext->costMockGpuScale, acontext->costMockGpuLaunch);
+            }
+        }
+        if (agoGetEnvironmentVariable("AGO_SCHEDULER_THREADS", textBuffer, sizeof(textBuffer))) {
+            acontext->scheduler.threadCount = atoi(textBuffer);
+        }
+        agoCpuWorkerPoolAcquire();
+        if (agoGetEnvironmentVariable("AGO_COST_TABLE", textBuffer, sizeof(textBuffer))) {
+            acontext->costTableFile = textBuffer;
+            agoCostTableLoad(acontext);
+        }
     }
     return (AgoContext *)acontext;
 }
@@ -101,8 +293,14 @@ int agoReleaseContext(AgoContext * acontext)
 
     if(ref->external_count == 0)
     {
+        // stop scheduler worker threads
+        agoSchedulerShutdown(acontext);
+        agoCpuWorkerPoolRelease();
         EnterCriticalSection(&acontext->cs);
         // release all the resources
+        if (acontext->costTableModified) {
+            agoCostTableSave(acontext);
+        }
         LeaveCriticalSection(&acontext->cs);
         delete acontext;
     }
@@ -125,6 +323,14 @@ AgoGraph * agoCreateGraph(AgoContext * acontext)
             agoAddLogEntry(&agraph->ref, VX_SUCCESS, "DEBUG: VX_GRAPH_ATTRIBUTE_AMD_OPTIMIZER_FLAGS = 0x%08x\n", agraph->optimizer_flags);
         }
     }
+    if (agoGetEnvironmentVariable("AGO_TARGET_PARTITION", textBuffer, sizeof(textBuffer))) {
+        if (!strcmp(textBuffer, "COST")) {
+            agraph->targetPartition = VX_TARGET_PARTITION_AMD_COST;
+        }
+        else if (!strcmp(textBuffer, "CALIBRATE")) {
+            agraph->targetPartition = VX_TARGET_PARTITION_AMD_CALIBRATE;
+        }
+    }
 
     { // link graph to the context
         CAgoLock lock(acontext->cs);
@@ -132,7 +338,11 @@ AgoGraph * agoCreateGraph(AgoContext * acontext)
         agraph->ref.external_count++;
         acontext->num_active_references++;
     }
-    if (acontext->thread_config & 1) {
+    if (acontext->scheduler.threadCount > 0) {
+        // graph scheduling uses the context worker pool
+        agraph->schedUsePool = true;
+    }
+    else if (acontext->thread_config & 1) {
         // create semaphore and thread for graph scheduling: limit 1000 pending requests
         agraph->hSemToThread = CreateSemaphore(nullptr, 0, 1000, nullptr);
         agraph->hSemFromThread = CreateSemaphore(nullptr, 0, 1000, nullptr);
@@ -168,6 +378,10 @@ int agoReleaseGraph(AgoGraph * agraph)
     if(agraph->ref.external_count >= 0)
         agraph->ref.context->num_active_references--;
     if (agraph->ref.external_count == 0) {
+        // drop pending requests from the context worker pool
+        if (agraph->schedUsePool) {
+            agoSchedulerRemoveGraph(agraph);
+        }
         EnterCriticalSection(&agraph->cs);
         // stop graph thread
         if (agraph->hThread) {
@@ -1245,6 +1459,10 @@ vx_status agoVerifyNode(AgoNode * node)
                     meta->data.u.pyr.rect_valid.end_x = INT_MAX;
                     meta->data.u.pyr.rect_valid.end_y = INT_MAX;
                 }
+                else if (data->ref.type == VX_TYPE_USER_DATA_OBJECT) {
+                    meta->data.size = 0;
+                    meta->data.u.udo.type_name[0] = '\0';
+                }
             }
         }
     }
@@ -1564,6 +1782,38 @@ vx_status agoVerifyNode(AgoNode * node)
                         return VX_ERROR_INVALID_TYPE;
                     }
                 }
+                else if (meta->data.ref.type == VX_TYPE_USER_DATA_OBJECT) {
+                    bool updated = false;
+                    if (data->isVirtual) {
+                        // update size/type name if not specified
+                        if (data->size == 0) {
+                            data->size = meta->data.size;
+                            updated = true;
+                        }
+                        if (data->u.udo.type_name[0] == '\0' && meta->data.u.udo.type_name[0] != '\0') {
+                            strncpy(data->u.udo.type_name, meta->data.u.udo.type_name, VX_MAX_REFERENCE_NAME - 1);
+                            updated = true;
+                        }
+                    }
+                    // make sure that the data come from output validator matches with object
+                    if (meta->data.u.udo.type_name[0] != '\0' && strncmp(data->u.udo.type_name, meta->data.u.udo.type_name, VX_MAX_REFERENCE_NAME)) {
+                        agoAddLogEntry(&kernel->ref, VX_ERROR_INVALID_TYPE, "ERROR: agoVerifyGraph: kernel %s: invalid user data object type name for argument#%d\n", kernel->name, arg);
+                        return VX_ERROR_INVALID_TYPE;
+                    }
+                    else if (!data->size || (meta->data.size && meta->data.size != data->size)) {
+                        agoAddLogEntry(&kernel->ref, VX_ERROR_INVALID_DIMENSION, "ERROR: agoVerifyGraph: kernel %s: invalid user data object size for argument#%d\n", kernel->name, arg);
+                        return VX_ERROR_INVALID_DIMENSION;
+                    }
+                    if (updated) {
+                        data->isNotFullyConfigured = vx_true_e;
+                        char desc[64 + VX_MAX_REFERENCE_NAME]; sprintf(desc, "user-data-object-virtual:" VX_FMT_SIZE ",%s", data->size, data->u.udo.type_name);
+                        if (agoGetDataFromDescription(graph->ref.context, graph, data, desc)) {
+                            agoAddLogEntry(&graph->ref, VX_FAILURE, "ERROR: agoVerifyGraph: agoVerifyGraph update failed for %s\n", desc);
+                            return -1;
+                        }
+                        data->isNotFullyConfigured = vx_false_e;
+                    }
+                }
                 else if (meta->data.ref.type == AGO_TYPE_CANNY_STACK) {
                     // nothing to do
                 }
@@ -1875,6 +2125,128 @@ int agoInitializeGraph(AgoGraph * graph)
     return VX_SUCCESS;
 }
 
+static bool agoMapBatchData(AgoGraph * graph, AgoData * data, std::vector<AgoData *>& frameData)
+{
+    // map data and all its children (image planes, pyramid levels, ...) to their per-frame instances
+    for (auto fdata : frameData) {
+        if (!fdata || fdata->ref.type != data->ref.type || fdata->numChildren != data->numChildren)
+            return false;
+    }
+    graph->batchDataMap[data] = frameData;
+    for (vx_uint32 child = 0; child < data->numChildren; child++) {
+        if (data->children[child]) {
+            std::vector<AgoData *> frameChild;
+            for (auto fdata : frameData)
+                frameChild.push_back(fdata->children[child]);
+            if (!agoMapBatchData(graph, data->children[child], frameChild))
+                return false;
+        }
+    }
+    return true;
+}
+
+static AgoData * agoCreateBatchDataCopy(AgoGraph * graph, AgoData * data)
+{
+    char desc[1024];
+    agoGetDescriptionFromData(graph->ref.context, desc, data);
+    AgoData * copy = agoCreateDataFromDescription(graph->ref.context, graph, desc, false);
+    if (!copy)
+        return nullptr;
+    agoGenerateVirtualDataName(graph, "batch", copy->name);
+    // keep the whole tree in batchDataList so that it gets released with the graph
+    std::vector<AgoData *> stack(1, copy);
+    while (!stack.empty()) {
+        AgoData * item = stack.back(); stack.pop_back();
+        agoAddData(&graph->batchDataList, item);
+        for (vx_uint32 child = 0; child < item->numChildren; child++) {
+            if (item->children[child])
+                stack.push_back(item->children[child]);
+        }
+    }
+    if (agoAllocData(copy)) {
+        agoAddLogEntry(&data->ref, VX_FAILURE, "ERROR: agoCreateBatchDataCopy: agoAllocData(%s) failed\n", desc);
+        return nullptr;
+    }
+    return copy;
+}
+
+int agoPrepareGraphBatch(AgoGraph * graph)
+{
+    graph->batchDataMap.clear();
+    graph->batchNodeMajor = false;
+    agoResetDataList(&graph->batchDataList);
+    if (graph->batchFrameCount <= 1)
+        return VX_SUCCESS;
+
+    // frame k of a graph parameter bound to an object array is the k-th item of the array
+    for (size_t index = 0; index < graph->batchParameters.size(); index++) {
+        AgoData * objarr = graph->batchParameters[index];
+        if (objarr) {
+            std::vector<AgoData *> frameData(objarr->children, objarr->children + objarr->numChildren);
+            if (!agoMapBatchData(graph, objarr->children[0], frameData)) {
+                agoAddLogEntry(&graph->ref, VX_ERROR_INVALID_PARAMETERS, "ERROR: agoPrepareGraphBatch: object array items of graph parameter#%d are not identical\n", (int)index);
+                return VX_ERROR_INVALID_PARAMETERS;
+            }
+            for (auto item : frameData) {
+                if (agoAllocData(item)) {
+                    agoAddLogEntry(&graph->ref, VX_FAILURE, "ERROR: agoPrepareGraphBatch: agoAllocData(%s) failed\n", item->name.c_str());
+                    return VX_FAILURE;
+                }
+            }
+        }
+    }
+
+    // all frames can be taken through one node before the next only when every node runs on CPU,
+    // no delays are involved, and no node parameter shares its buffer with other data via ROI
+    const char * fallbackReason = graph->autoAgeDelayList.empty() ? nullptr : "graph has delays";
+    AgoNode * fallbackNode = nullptr;
+    for (AgoNode * node = graph->nodeList.head; !fallbackReason && node; node = node->next) {
+        if (node->attr_affinity.device_type != AGO_KERNEL_FLAG_DEVICE_CPU)
+            fallbackReason = "node doesn't run on CPU";
+        for (vx_uint32 arg = 0; !fallbackReason && arg < node->paramCount; arg++) {
+            AgoData * data = node->paramList[arg];
+            if (data && agoIsPartOfDelay(data))
+                fallbackReason = "node parameter is part of a delay";
+            else if (data && ((data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI) ||
+                              (data->ref.type == VX_TYPE_TENSOR && data->u.tensor.roiMaster)))
+                fallbackReason = "node parameter is an ROI";
+        }
+        if (fallbackReason)
+            fallbackNode = node;
+    }
+    if (fallbackReason) {
+        agoAddLogEntry(&graph->ref, VX_SUCCESS, "WARNING: agoPrepareGraphBatch: %s%s%s, running the whole graph once per frame\n",
+            fallbackReason, fallbackNode ? ": " : "", fallbackNode ? fallbackNode->akernel->name : "");
+        return VX_SUCCESS;
+    }
+
+    // node outputs need a separate instance per frame: the existing object is used for the last
+    // frame, so that non-virtual outputs hold the same result as with sequential processing
+    for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+        for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+            AgoData * data = node->paramList[arg];
+            if (!data || node->parameters[arg].direction != VX_OUTPUT || graph->batchDataMap.find(data) != graph->batchDataMap.end())
+                continue;
+            while (data->parent && data->parent->ref.type != VX_TYPE_DELAY && graph->batchDataMap.find(data->parent) == graph->batchDataMap.end())
+                data = data->parent;
+            std::vector<AgoData *> frameData;
+            for (vx_uint32 frame = 0; frame < graph->batchFrameCount - 1; frame++) {
+                AgoData * copy = agoCreateBatchDataCopy(graph, data);
+                if (!copy)
+                    return VX_FAILURE;
+                frameData.push_back(copy);
+            }
+            frameData.push_back(data);
+            if (!agoMapBatchData(graph, data, frameData)) {
+                agoAddLogEntry(&graph->ref, VX_FAILURE, "ERROR: agoPrepareGraphBatch: unable to create per-frame copies of %s\n", data->name.c_str());
+                return VX_FAILURE;
+            }
+        }
+    }
+    graph->batchNodeMajor = true;
+    return VX_SUCCESS;
+}
+
 #if ENABLE_OPENCL
 static int agoWaitForNodesCompletion(AgoGraph * graph)
 {
@@ -1887,7 +2259,7 @@ static int agoWaitForNodesCompletion(AgoGraph * graph)
                     agoAddLogEntry(&node->ref, VX_FAILURE, "ERROR: agoWaitForNodesCompletion: launched=%d supernode wait failed\n", node->supernode->launched);
                     return VX_FAILURE;
                 }
-                agoPerfCaptureStop(&node->perf);
+                agoPerfCaptureStop(&node->perf, &node->latency);
                 for (size_t index = 0; index < node->supernode->nodeList.size(); index++) {
                     AgoNode * anode = node->supernode->nodeList[index];
                     // node callback
@@ -1906,7 +2278,7 @@ static int agoWaitForNodesCompletion(AgoGraph * graph)
                     agoAddLogEntry(&node->ref, VX_FAILURE, "ERROR: agoWaitForNodesCompletion: single node wait failed\n");
                     return VX_FAILURE;
                 }
-                agoPerfCaptureStop(&node->perf);
+                agoPerfCaptureStop(&node->perf, &node->latency);
                 // node callback
                 if (node->callback) {
                     vx_action action = node->callback(node);
@@ -2015,7 +2387,7 @@ static int agoWaitForNodesCompletion(AgoGraph * graph)
                     agoAddLogEntry(&node->ref, VX_FAILURE, "ERROR: agoWaitForNodesCompletion: launched=%d supernode wait failed\n", node->supernode->launched);
                     return VX_FAILURE;
                 }
-                agoPerfCaptureStop(&node->perf);
+                agoPerfCaptureStop(&node->perf, &node->latency);
                 for (size_t index = 0; index < node->supernode->nodeList.size(); index++) {
                     AgoNode * anode = node->supernode->nodeList[index];
                     // node callback
@@ -2033,7 +2405,7 @@ static int agoWaitForNodesCompletion(AgoGraph * graph)
                     agoAddLogEntry(&node->ref, VX_FAILURE, "ERROR: agoWaitForNodesCompletion: single node wait failed\n");
                     return VX_FAILURE;
                 }
-                agoPerfCaptureStop(&node->perf);
+                agoPerfCaptureStop(&node->perf, &node->latency);
                 // node callback
                 if (node->callback) {
                     vx_action action = node->callback(node);
@@ -2153,6 +2525,228 @@ int agoUpdateDelaySlots(AgoNode * node)
     return 0;
 }
 
+static void agoMarkCpuNodeOutputsDirty(AgoNode * node)
+{
+    for (vx_uint32 i = 0; i < node->paramCount; i++) {
+#if ENABLE_OPENCL
+        AgoData * data = node->paramList[i];
+        if (data && data->opencl_buffer &&
+            (node->parameters[i].direction == VX_OUTPUT || node->parameters[i].direction == VX_BIDIRECTIONAL))
+        {
+            auto dataToSync = (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI) ? data->u.img.roiMasterImage : data;
+            dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
+            dataToSync->buffer_sync_flags |=
+                ((node->akernel->opencl_buffer_access_enable || data->u.img.enableUserBufferGPU)
+                    ? AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL
+                    : AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE);
+        }
+#elif ENABLE_HIP
+        AgoData * data = node->paramList[i];
+        if (data && data->hip_memory &&
+                (node->parameters[i].direction == VX_OUTPUT || node->parameters[i].direction == VX_BIDIRECTIONAL))
+        {
+            auto dataToSync = (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI) ? data->u.img.roiMasterImage : data;
+            dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
+            dataToSync->buffer_sync_flags |=
+                ((node->akernel->opencl_buffer_access_enable || data->u.img.enableUserBufferGPU)
+                    ? AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL
+                    : AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE);
+        }
+#endif
+    }
+}
+
+static void agoMarkNodeOutputsModified(AgoNode * node)
+{
+    for (vx_uint32 i = 0; i < node->paramCount; i++) {
+        AgoData * data = node->paramList[i];
+        if (data && (node->parameters[i].direction == VX_OUTPUT || node->parameters[i].direction == VX_BIDIRECTIONAL))
+            agoDataMarkModified(data);
+    }
+}
+
+static void agoSaveNodeGenerations(AgoGraph * graph, AgoNode * node)
+{
+    // only nodes that are a pure function of their inputs can be skipped: bidirectional parameters
+    // carry state across frames and a callback expects to be invoked for every frame
+    bool hasInput = false;
+    node->incremental_valid = graph->incrementalExecution && !node->callback;
+    for (vx_uint32 i = 0; node->incremental_valid && i < node->paramCount; i++) {
+        AgoData * data = node->paramList[i];
+        node->incremental_param[i] = data;
+        if (data) {
+            if (node->parameters[i].direction == VX_BIDIRECTIONAL)
+                node->incremental_valid = false;
+            else if (node->parameters[i].direction == VX_INPUT)
+                hasInput = true;
+            // outputs are compared by their own generation, so that nodes writing into siblings
+            // (e.g., items of the same object array) don't invalidate each other
+            node->incremental_generation[i] = (node->parameters[i].direction == VX_INPUT) ? agoDataGetGeneration(data) : data->generation;
+        }
+    }
+    node->incremental_valid = node->incremental_valid && hasInput;
+}
+
+static bool agoIsNodeUnchanged(AgoGraph * graph, AgoNode * node)
+{
+    if (!graph->incrementalExecution || !node->incremental_valid)
+        return false;
+    for (vx_uint32 i = 0; i < node->paramCount; i++) {
+        AgoData * data = node->paramList[i];
+        if (data != node->incremental_param[i])
+            return false;
+        if (data && node->incremental_generation[i] != ((node->parameters[i].direction == VX_INPUT) ? agoDataGetGeneration(data) : data->generation))
+            return false;
+    }
+    return true;
+}
+
+static bool agoIsSameReplicaGroup(AgoNode * node, AgoNode * replica)
+{
+    return node->replica_group == replica->replica_group && node->akernel == replica->akernel &&
+           node->attr_affinity.device_type == AGO_KERNEL_FLAG_DEVICE_CPU;
+}
+
+static bool agoHasPendingReplica(AgoNode * node, AgoNode * enode)
+{
+    for (auto rnode = node->next; rnode != enode; rnode = rnode->next) {
+        if (agoIsSameReplicaGroup(rnode, node))
+            return true;
+    }
+    return false;
+}
+
+static void agoBindNodeExecRectangle(AgoNode * node)
+{
+    // substitute image parameters with views of node->rect_exec, so that the kernel only touches that window
+    const vx_rectangle_t& rect = node->rect_exec;
+    for (vx_uint32 i = 0; i < node->paramCount; i++) {
+        AgoData * data = node->paramList[i];
+        AgoData * window = node->rect_exec_window[i];
+        if (data && window) {
+            window->ref.type = VX_TYPE_IMAGE;
+            window->ref.context = data->ref.context;
+            window->u.img = data->u.img;
+            window->u.img.width = rect.end_x - rect.start_x;
+            window->u.img.height = rect.end_y - rect.start_y;
+            window->size = data->size;
+            window->buffer = data->buffer + rect.start_y * data->u.img.stride_in_bytes + ImageWidthInBytesFloor(rect.start_x, data);
+            node->paramList[i] = window;
+        }
+    }
+}
+
+static vx_status agoExecuteCpuNode(AgoNode * node, bool capturePerf = true)
+{
+    AgoKernel * kernel = node->akernel;
+    vx_status status = VX_SUCCESS;
+    AgoData * paramListSaved[AGO_MAX_PARAMS];
+    if (node->rect_exec_enable) {
+        // none of the outputs is needed
+        if (node->rect_exec.end_x <= node->rect_exec.start_x || node->rect_exec.end_y <= node->rect_exec.start_y)
+            return VX_SUCCESS;
+        memcpy(paramListSaved, node->paramList, sizeof(paramListSaved));
+        agoBindNodeExecRectangle(node);
+    }
+    if (capturePerf)
+        agoPerfCaptureStart(&node->perf);
+    if (kernel->func) {
+        status = kernel->func(node, ago_kernel_cmd_execute);
+        if (status == AGO_ERROR_KERNEL_NOT_IMPLEMENTED)
+            status = VX_ERROR_NOT_IMPLEMENTED;
+    }
+    else if (kernel->kernel_f) {
+        status = kernel->kernel_f(node, (vx_reference *)node->paramList, node->paramCount);
+    }
+    if (capturePerf && status == VX_SUCCESS)
+        agoPerfCaptureStop(&node->perf, &node->latency);
+    if (node->rect_exec_enable)
+        memcpy(node->paramList, paramListSaved, sizeof(paramListSaved));
+    return status;
+}
+
+static void agoPerfCaptureStopBatch(std::vector<AgoNode *>& batch, vx_uint64 beg)
+{
+    // every replica reports the time of the whole batch, so that each of them accounts for the replicated node
+    for (auto bnode : batch) {
+        bnode->perf.beg = beg;
+        agoPerfCaptureStop(&bnode->perf, &bnode->latency);
+    }
+}
+
+static vx_status agoExecuteCpuNodeBatch(AgoGraph * graph, std::vector<AgoNode *>& batch)
+{
+    AgoKernel * kernel = batch[0]->akernel;
+    vx_status status = VX_SUCCESS;
+    if (batch.size() == 1) {
+        status = agoExecuteCpuNode(batch[0]);
+        if (status) {
+            agoAddLogEntry((vx_reference)graph, VX_FAILURE, "ERROR: kernel %s exec failed (%d:%s)\n", kernel->name, status, agoEnum2Name(status));
+        }
+        return status;
+    }
+    vx_uint64 beg = agoGetClockCounter();
+    if (kernel->flags & AGO_KERNEL_FLAG_REPLICATE_BATCH) {
+        // invoke the kernel once with parent object arrays/pyramids in place of replicated parameters,
+        // but only when all replicas are part of this batch
+        AgoNode * node = nullptr;
+        for (auto bnode : batch) {
+            if (bnode->replica_index == 0)
+                node = bnode;
+        }
+        vx_reference paramList[AGO_MAX_PARAMS] = { 0 };
+        for (vx_uint32 i = 0; node && i < node->paramCount; i++) {
+            AgoData * data = node->paramList[i];
+            if (data && (node->replica_param_mask & (1u << i))) {
+                if (!data->parent || data->parent->numChildren != batch.size()) {
+                    node = nullptr;
+                    break;
+                }
+                data = data->parent;
+            }
+            paramList[i] = &data->ref;
+        }
+        if (node) {
+            status = kernel->kernel_f(node, paramList, node->paramCount);
+            if (status) {
+                agoAddLogEntry((vx_reference)graph, VX_FAILURE, "ERROR: kernel %s batch exec failed (%d:%s)\n", kernel->name, status, agoEnum2Name(status));
+                return status;
+            }
+            agoPerfCaptureStopBatch(batch, beg);
+            return VX_SUCCESS;
+        }
+    }
+    // execute replicas of built-in kernels in parallel on the CPU worker pool (user kernels may not be thread-safe)
+    std::vector<vx_status> statusList(batch.size(), VX_SUCCESS);
+    if (kernel->func) {
+        agoParallelFor(batch.size(), [&](vx_size i) {
+            statusList[i] = agoExecuteCpuNode(batch[i], false);
+        });
+    }
+    else {
+        for (vx_size i = 0; i < batch.size(); i++)
+            statusList[i] = agoExecuteCpuNode(batch[i], false);
+    }
+    for (vx_size i = 0; i < batch.size(); i++) {
+        if (statusList[i]) {
+            status = statusList[i];
+            agoAddLogEntry((vx_reference)graph, VX_FAILURE, "ERROR: kernel %s exec failed (%d:%s)\n", kernel->name, status, agoEnum2Name(status));
+            return status;
+        }
+    }
+    agoPerfCaptureStopBatch(batch, beg);
+    return status;
+}
+
+static void agoBindBatchFrame(AgoGraph * graph, AgoNode * node, AgoData * const * paramListOriginal, vx_uint32 frame)
+{
+    for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+        AgoData * data = paramListOriginal[arg];
+        auto it = data ? graph->batchDataMap.find(data) : graph->batchDataMap.end();
+        node->paramList[arg] = (it != graph->batchDataMap.end()) ? it->second[frame] : data;
+    }
+}
+
 int agoExecuteGraph(AgoGraph * graph)
 {
     if (graph->detectedInvalidNode) {
@@ -2165,6 +2759,15 @@ int agoExecuteGraph(AgoGraph * graph)
     graph->state = VX_GRAPH_STATE_RUNNING;
     agoPerfProfileEntry(graph, ago_profile_type_exec_begin, &graph->ref);
     agoPerfCaptureStart(&graph->perf);
+    if (graph->targetPartition != VX_TARGET_PARTITION_AMD_AFFINITY) {
+        agoCostTableSampleBegin(graph);
+    }
+
+    // update node exec rectangles if the application changed image valid rectangles
+    if (agoUpdateExecRectangles(graph)) {
+        agoAddLogEntry(&graph->ref, VX_FAILURE, "ERROR: agoExecuteGraph: agoUpdateExecRectangles failed\n");
+        return VX_FAILURE;
+    }
 
     // update delay slots
     for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
@@ -2264,6 +2867,7 @@ int agoExecuteGraph(AgoGraph * graph)
                     }
                 }
                 agoPerfProfileEntry(graph, ago_profile_type_launch_end, &node->ref);
+                agoMarkNodeOutputsModified(node);
             }
         }
 #elif ENABLE_HIP
@@ -2297,12 +2901,18 @@ int agoExecuteGraph(AgoGraph * graph)
                     }
                 }
                 agoPerfProfileEntry(graph, ago_profile_type_launch_end, &node->ref);
+                agoMarkNodeOutputsModified(node);
             }
         }
 #endif
         // process CPU nodes at current hierarchical level
         for (auto node = snode; node != enode; node = node->next) {
             if (node->attr_affinity.device_type == AGO_KERNEL_FLAG_DEVICE_CPU) {
+                // with incremental execution, outputs of a node whose parameters are unchanged are still valid,
+                // except when buffer aliasing let another node overwrite them: those nodes recompute the same outputs
+                bool unchanged = agoIsNodeUnchanged(graph, node);
+                if (unchanged && !node->incremental_rerun)
+                    continue;
 #if (ENABLE_OPENCL||ENABLE_HIP)
                 opencl_buffer_access_enable |= (node->akernel->opencl_buffer_access_enable ? true : false);
                 if (!node->akernel->opencl_buffer_access_enable) {
@@ -2385,60 +2995,64 @@ int agoExecuteGraph(AgoGraph * graph)
                 }
                 agoPerfProfileEntry(graph, ago_profile_type_copy_end, &node->ref);
 #endif
-                // execute node
-                agoPerfProfileEntry(graph, ago_profile_type_exec_begin, &node->ref);
-                agoPerfCaptureStart(&node->perf);
-                AgoKernel * kernel = node->akernel;
-                status = VX_SUCCESS;
-                if (kernel->func) {
-                    status = kernel->func(node, ago_kernel_cmd_execute);
-                    if (status == AGO_ERROR_KERNEL_NOT_IMPLEMENTED)
-                        status = VX_ERROR_NOT_IMPLEMENTED;
+                // replicas of a node at this level are executed as one batch after inputs of the last one are ready
+                if (node->replica_group && agoHasPendingReplica(node, enode))
+                    continue;
+                std::vector<AgoNode *> batch;
+                if (node->replica_group) {
+                    for (auto rnode = snode; rnode != enode; rnode = rnode->next) {
+                        if (agoIsSameReplicaGroup(rnode, node))
+                            batch.push_back(rnode);
+                    }
+                }
+                else {
+                    batch.push_back(node);
+                }
+                // with graph batching, take all frames through the node(s) before moving to the next
+                vx_uint32 frameCount = graph->batchNodeMajor ? graph->batchFrameCount : 1;
+                std::vector<AgoData *> paramListOriginal;
+                if (frameCount > 1) {
+                    for (auto bnode : batch)
+                        paramListOriginal.insert(paramListOriginal.end(), bnode->paramList, bnode->paramList + AGO_MAX_PARAMS);
+                }
+                for (vx_uint32 frame = 0; frame < frameCount; frame++) {
+                    if (frameCount > 1) {
+                        for (size_t i = 0; i < batch.size(); i++)
+                            agoBindBatchFrame(graph, batch[i], &paramListOriginal[i * AGO_MAX_PARAMS], frame);
+                    }
+                    // execute node(s)
+                    for (auto bnode : batch)
+                        agoPerfProfileEntry(graph, ago_profile_type_exec_begin, &bnode->ref);
+                    status = agoExecuteCpuNodeBatch(graph, batch);
+                    for (auto bnode : batch) {
+                        if (status)
+                            break;
+                        agoPerfProfileEntry(graph, ago_profile_type_exec_end, &bnode->ref);
+                        // mark that node outputs are dirty
+                        agoMarkCpuNodeOutputsDirty(bnode);
+                        if (!unchanged)
+                            agoMarkNodeOutputsModified(bnode);
+                        // node callback
+                        if (bnode->callback) {
+                            vx_action action = bnode->callback(bnode);
+                            if (action == VX_ACTION_ABANDON) {
+                                graph->state = VX_GRAPH_STATE_ABANDONED;
+                                status = VX_ERROR_GRAPH_ABANDONED;
+                            }
+                        }
+                    }
+                    if (status)
+                        break;
                 }
-                else if (kernel->kernel_f) {
-                    status = kernel->kernel_f(node, (vx_reference *)node->paramList, node->paramCount);
+                if (frameCount > 1) {
+                    for (size_t i = 0; i < batch.size(); i++)
+                        memcpy(batch[i]->paramList, &paramListOriginal[i * AGO_MAX_PARAMS], sizeof(batch[i]->paramList));
                 }
                 if (status) {
-                    agoAddLogEntry((vx_reference)graph, VX_FAILURE, "ERROR: kernel %s exec failed (%d:%s)\n", kernel->name, status, agoEnum2Name(status));
                     return status;
                 }
-                agoPerfCaptureStop(&node->perf);
-                agoPerfProfileEntry(graph, ago_profile_type_exec_end, &node->ref);
-                // mark that node outputs are dirty
-                for (vx_uint32 i = 0; i < node->paramCount; i++) {
-#if ENABLE_OPENCL
-                    AgoData * data = node->paramList[i];
-                    if (data && data->opencl_buffer &&
-                        (node->parameters[i].direction == VX_OUTPUT || node->parameters[i].direction == VX_BIDIRECTIONAL))
-                    {
-                        auto dataToSync = (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI) ? data->u.img.roiMasterImage : data;
-                        dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
-                        dataToSync->buffer_sync_flags |=
-                            ((node->akernel->opencl_buffer_access_enable || data->u.img.enableUserBufferGPU)
-                                ? AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL
-                                : AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE);
-                    }
-#elif ENABLE_HIP
-                    AgoData * data = node->paramList[i];
-                    if (data && data->hip_memory &&
-                            (node->parameters[i].direction == VX_OUTPUT || node->parameters[i].direction == VX_BIDIRECTIONAL))
-                    {
-                        auto dataToSync = (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI) ? data->u.img.roiMasterImage : data;
-                        dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
-                        dataToSync->buffer_sync_flags |=
-                            ((node->akernel->opencl_buffer_access_enable || data->u.img.enableUserBufferGPU)
-                                ? AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL
-                                : AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE);
-                    }
-#endif
-                }
-                // node callback
-                if (node->callback) {
-                    vx_action action = node->callback(node);
-                    if (action == VX_ACTION_ABANDON) {
-                        graph->state = VX_GRAPH_STATE_ABANDONED;
-                        return VX_ERROR_GRAPH_ABANDONED;
-                    }
+                if (frameCount == 1 && !node->replica_group) {
+                    agoSaveNodeGenerations(graph, node);
                 }
             }
         }
@@ -2482,8 +3096,16 @@ int agoExecuteGraph(AgoGraph * graph)
     }
 
     agoPerfCaptureStop(&graph->perf);
+    // one latency sample per frame, as nodes and graphs that run the whole graph once per frame record
+    vx_uint32 frameCount = graph->batchNodeMajor ? graph->batchFrameCount : 1;
+    for (vx_uint32 frame = 0; frame < frameCount; frame++)
+        agoLatencyHistogramAdd(&graph->latency, graph->perf.tmp / frameCount);
     agoPerfProfileEntry(graph, ago_profile_type_exec_end, &graph->ref);
-    graph->execFrameCount++;
+    if (status == VX_SUCCESS && graph->targetPartition != VX_TARGET_PARTITION_AMD_AFFINITY) {
+        // only successful executions are sampled
+        agoCostTableRecord(graph);
+    }
+    graph->execFrameCount += frameCount;
 
     if (status == VX_SUCCESS)
         graph->state = VX_GRAPH_STATE_COMPLETED;
@@ -2704,23 +3326,29 @@ vx_status agoGraphDumpPerformanceProfile(AgoGraph * graph, const char * fileName
             return VX_FAILURE;
         }
     }
-    fprintf(fp, " COUNT,tmp(ms),avg(ms),min(ms),max(ms),DEV,KERNEL\n");
+    fprintf(fp, " COUNT,tmp(ms),avg(ms),min(ms),max(ms),p50(ms),p99(ms),p999(ms),DEV,KERNEL\n");
     int64_t freq = agoGetClockFrequency();
     float factor = 1000.0f / (float)freq; // to convert clock counter to ms
     if (graph->perf.num > 0) {
-        fprintf(fp, "%6d,%7.3f,%7.3f,%7.3f,%7.3f,%s,%s\n",
+        fprintf(fp, "%6d,%7.3f,%7.3f,%7.3f,%7.3f,%7.3f,%7.3f,%7.3f,%s,%s\n",
             (int)graph->perf.num, (float)graph->perf.tmp * factor,
             (float)graph->perf.sum * factor / (float)graph->perf.num,
             (float)graph->perf.min * factor, (float)graph->perf.max * factor,
+            (float)agoLatencyHistogramPercentile(&graph->latency, 0.50) * factor,
+            (float)agoLatencyHistogramPercentile(&graph->latency, 0.99) * factor,
+            (float)agoLatencyHistogramPercentile(&graph->latency, 0.999) * factor,
             graph->attr_affinity.device_type == AGO_TARGET_AFFINITY_GPU ? "GPU" : "CPU",
             "GRAPH");
     }
     for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
         if (node->perf.num > 0) {
-            fprintf(fp, "%6d,%7.3f,%7.3f,%7.3f,%7.3f,%s,%s\n",
+            fprintf(fp, "%6d,%7.3f,%7.3f,%7.3f,%7.3f,%7.3f,%7.3f,%7.3f,%s,%s\n",
                 (int)node->perf.num, (float)node->perf.tmp * factor,
                 (float)node->perf.sum * factor / (float)node->perf.num,
                 (float)node->perf.min * factor, (float)node->perf.max * factor,
+                (float)agoLatencyHistogramPercentile(&node->latency, 0.50) * factor,
+                (float)agoLatencyHistogramPercentile(&node->latency, 0.99) * factor,
+                (float)agoLatencyHistogramPercentile(&node->latency, 0.999) * factor,
                 node->attr_affinity.device_type == AGO_TARGET_AFFINITY_GPU ? "GPU" : "CPU",
                 node->akernel->name);
         }
@@ -2763,7 +3391,23 @@ int agoProcessGraph(AgoGraph * graph)
         // execute graph if possible
         if (status == VX_SUCCESS) {
             if (graph->verified && graph->isReadyToExecute) {
-                status = agoExecuteGraph(graph);
+                if (graph->batchFrameCount > 1 && !graph->batchNodeMajor) {
+                    // execute the whole graph once per frame with graph parameters bound to frame items
+                    for (vx_uint32 frame = 0; status == VX_SUCCESS && frame < graph->batchFrameCount; frame++) {
+                        std::vector<AgoData *> paramListOriginal;
+                        for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+                            paramListOriginal.insert(paramListOriginal.end(), node->paramList, node->paramList + AGO_MAX_PARAMS);
+                            agoBindBatchFrame(graph, node, &paramListOriginal[paramListOriginal.size() - AGO_MAX_PARAMS], frame);
+                        }
+                        status = agoExecuteGraph(graph);
+                        size_t i = 0;
+                        for (AgoNode * node = graph->nodeList.head; node; node = node->next, i += AGO_MAX_PARAMS)
+                            memcpy(node->paramList, &paramListOriginal[i], sizeof(node->paramList));
+                    }
+                }
+                else {
+                    status = agoExecuteGraph(graph);
+                }
             }
             else {
                 agoAddLogEntry(&graph->ref, VX_FAILURE, "ERROR: agoProcessGraph: not verified (%d) or not ready to execute (%d)\n", graph->verified, graph->isReadyToExecute);
@@ -2779,6 +3423,17 @@ int agoScheduleGraph(AgoGraph * graph)
     vx_status status = VX_ERROR_INVALID_REFERENCE;
     if (agoIsValidGraph(graph)) {
         status = VX_SUCCESS;
+        if (graph->schedUsePool) {
+            if (!graph->verified) {
+                // make sure to verify the graph in master thread
+                CAgoLock lock(graph->cs);
+                status = vxVerifyGraph(graph);
+            }
+            if (status == VX_SUCCESS) {
+                status = agoSchedulerEnqueue(graph);
+            }
+            return status;
+        }
         graph->threadScheduleCount++;
         if (graph->hThread) {
             if (!graph->verified) {
@@ -2808,7 +3463,10 @@ int agoWaitGraph(AgoGraph * graph)
         graph->threadWaitCount++;
         if (graph->threadScheduleCount <= 0) // the graph was never scheduled so return VX_FAILURE
             return VX_FAILURE;
-        if (graph->hThread) {
+        if (graph->schedUsePool) {
+            status = agoSchedulerWait(graph);
+        }
+        else if (graph->hThread) {
             graph->threadThreadWaitState = 1;
             while (graph->threadThreadWaitState == 1) {
                 // wait for the agoGraphThreadFunction to be done
@@ -28,6 +28,8 @@ THE SOFTWARE.
 #include "ago_kernels.h"
 #include "ago_haf_cpu.h"
 #include "vx_ext_amd.h"
+#include <VX/vx_khr_buffer_aliasing.h>
+#include <VX/vx_khr_user_data_object.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // configuration flags and constants
@@ -52,6 +54,14 @@ THE SOFTWARE.
 // Flag to enable AVX instructions (256 bit operations) in primitives
 #define USE_AVX 0
 
+// Flag to enable AVX2 instructions (256 bit integer operations and gathers) in primitives: set by building with -DAVX2=ON
+// (cmake), which compiles the library with -mavx2
+#if defined(__AVX2__)
+#define USE_AVX2 1
+#else
+#define USE_AVX2 0
+#endif
+
 // AGO configuration
 #define USE_AGO_CANNY_SOBEL_SUPP_THRESHOLD    0// 0:seperate-sobel-and-nonmaxsupression 1:combine-sobel-and-nonmaxsupression
 #define AGO_MEMORY_ALLOC_EXTRA_PADDING       64 // extra bytes to the left and right of buffer allocations
@@ -78,6 +88,8 @@ THE SOFTWARE.
 #define AGO_KERNEL_FLAG_GPU_INTEG_R2R    0x0400 // kernel GPU integration: need OpenCL kernel generation (REG2REG)
 #define AGO_KERNEL_FLAG_SUBGRAPH         0x1000 // kernel is a subgraph
 #define AGO_KERNEL_FLAG_VALID_RECT_RESET 0x2000 // kernel valid_rect_reset is true
+#define AGO_KERNEL_FLAG_OVERRIDABLE      0x4000 // built-in kernel can be replaced by a user kernel with same name and enumeration
+#define AGO_KERNEL_FLAG_REPLICATE_BATCH  0x8000 // kernel processes all replicas of a replicated node in one call
 
 // AGO default target priority
 #if (ENABLE_OPENCL||ENABLE_HIP)
@@ -125,6 +137,8 @@ THE SOFTWARE.
 #define AGO_GRAPH_OPTIMIZER_FLAG_NO_NODE_MERGE            0x00000008 // don't perform node merge
 #define AGO_GRAPH_OPTIMIZER_FLAG_NO_CONVERT_8BIT_TO_1BIT  0x00000010 // don't convert 8-bit images to 1-bit images
 #define AGO_GRAPH_OPTIMIZER_FLAG_NO_SUPERNODE_MERGE       0x00000020 // don't merge supernodes
+#define AGO_GRAPH_OPTIMIZER_FLAG_NO_BUFFER_ALIASING       0x00000040 // don't share buffers between parameters of in-place kernels
+#define AGO_GRAPH_OPTIMIZER_FLAG_NO_RECT_EXECUTION        0x00000080 // don't restrict kernels to the valid/required region of outputs
 #define AGO_GRAPH_OPTIMIZER_FLAGS_DEFAULT                 0x00000000 // default options
 
 #if ENABLE_OPENCL
@@ -316,6 +330,7 @@ struct AgoConfigImage {
     vx_bool isROI;
     vx_rectangle_t rect_roi;
     vx_rectangle_t rect_valid;
+    vx_rectangle_t rect_interest; // region used by the application (empty for whole image)
     AgoData * roiMasterImage;
     vx_bool hasMinMax;
     vx_int32 minValue;
@@ -355,6 +370,8 @@ struct AgoConfigRemap {
     vx_uint32 dst_width;
     vx_uint32 dst_height;
     vx_uint32 remap_fractional_bits;
+    vx_enum table_format;      // VX_REMAP_TABLE_FORMAT_AMD_* used by CPU kernels
+    vx_uint32 table_version;   // incremented whenever remap table is modified by the application
 };
 struct AgoConfigScalar {
     vx_enum type;
@@ -390,6 +407,9 @@ struct AgoConfigTensor {
     vx_size start[AGO_MAX_TENSOR_DIMENSIONS];
     vx_size end[AGO_MAX_TENSOR_DIMENSIONS];
 };
+struct AgoConfigUserDataObject {
+    vx_char type_name[VX_MAX_REFERENCE_NAME];
+};
 struct AgoConfigCannyStack {
     vx_uint32 count;
     vx_uint32 stackTop;
@@ -434,6 +454,7 @@ struct AgoData {
         AgoConfigCannyStack cannystack;
         AgoConfigScaleMatrix scalemat;
         AgoConfigTensor tensor;
+        AgoConfigUserDataObject udo;
     } u;
     vx_size size;
     vx_enum import_type;
@@ -474,6 +495,8 @@ struct AgoData {
     vx_uint32 device_type_unused;
     AgoData * alias_data;
     vx_size   alias_offset;
+    AgoData * buffer_alias_data; // CPU buffer is shared with this data for in-place processing
+    vx_uint64 generation;        // incremented whenever the contents are written by the application or a node
 public:
     AgoData();
     ~AgoData();
@@ -534,10 +557,41 @@ struct AgoKernel {
     vx_uint32 opencl_buffer_update_param_index;
     vx_bool opencl_buffer_access_enable;
     vx_uint32 importing_module_index_plus1;
+    vx_uint32 alias_param_index_plus1[AGO_MAX_PARAMS]; // parameter that can share the buffer with this parameter
+    vx_enum alias_processing_type[AGO_MAX_PARAMS];
 public:
     AgoKernel();
     ~AgoKernel();
 };
+// log-linear (HDR style) latency histogram: values below 2^(SUB_BUCKET_BITS+1) ticks get a bucket each,
+// larger values get 2^SUB_BUCKET_BITS buckets per power of two, i.e., within ~6% of the recorded value
+#define AGO_LATENCY_HISTOGRAM_SUB_BUCKET_BITS   4
+#define AGO_LATENCY_HISTOGRAM_BUCKET_COUNT      ((64 - AGO_LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 1) << AGO_LATENCY_HISTOGRAM_SUB_BUCKET_BITS)
+struct AgoLatencyHistogram {
+    vx_uint64 count;
+    vx_uint64 max;
+    vx_uint32 bucket[AGO_LATENCY_HISTOGRAM_BUCKET_COUNT];
+};
+struct AgoScheduleRequest {
+    int64_t scheduled;   // clock counter at vxScheduleGraph
+    int64_t deadline;    // clock counter by which the execution should complete (0 for none)
+};
+struct AgoScheduler {
+    std::mutex mutex;
+    std::condition_variable cvWork;       // signaled when a graph is queued or on termination
+    std::condition_variable cvDone;       // signaled when a worker completes a graph execution
+    std::vector<std::thread> workers;
+    std::vector<AgoGraph *> readyList;    // graphs with pending requests that aren't running
+    vx_uint32 threadCount;
+    vx_uint32 running;
+    bool terminate;
+    vx_uint64 sequence;
+    vx_uint32 queueDepthMax;
+    vx_uint64 scheduled, completed, deadlineMissed;
+    AgoLatencyHistogram wait;
+public:
+    AgoScheduler();
+};
 struct AgoSuperNodeDataInfo {
     vx_uint32 data_type_flags;
     bool needed_as_a_kernel_argument;
@@ -600,12 +654,24 @@ struct AgoNode {
     vx_uint32 valid_rect_num_outputs;
     vx_rectangle_t ** valid_rect_inputs;
     vx_rectangle_t ** valid_rect_outputs;
+    bool rect_exec_enable;                      // execute the kernel only on rect_exec of its image parameters
+    vx_rectangle_t rect_exec;                   // kernel window (output region plus neighborhood); empty to skip the node
+    AgoData * rect_exec_window[AGO_MAX_PARAMS]; // image parameters restricted to rect_exec
     vx_uint32 target_support_flags;
     vx_uint32 hierarchical_level;
     vx_status status;
     vx_perf_t perf;
+    AgoLatencyHistogram latency;
     vx_bool local_data_change_is_enabled;
     vx_bool local_data_set_by_implementation;
+    vx_uint32 replica_group;      // non-zero for nodes created by vxReplicateNode: replicas with same group execute as one batch
+    vx_uint32 replica_index;      // index of the replica (i.e., object array item or pyramid level)
+    vx_uint32 replica_param_mask; // bit[i] is set when parameter i is replicated
+    bool incremental_valid;       // parameter generations below were captured at the last execution
+    bool incremental_rerun;       // an output shares its buffer with another node's data (buffer aliasing), so execute even if unchanged
+    AgoData * incremental_param[AGO_MAX_PARAMS];
+    vx_uint64 incremental_generation[AGO_MAX_PARAMS];
+    vx_uint64 cost_perf_num;      // perf.num at the start of the last graph execution, so only nodes that ran in it are sampled
 #if ENABLE_OPENCL
     vx_uint32 opencl_type;
     char opencl_name[VX_MAX_KERNEL_NAME];
@@ -658,12 +724,21 @@ struct AgoGraph {
     CRITICAL_SECTION cs;
     HANDLE hThread, hSemToThread, hSemFromThread;
     vx_int32 threadScheduleCount, threadExecuteCount, threadWaitCount, threadThreadTerminationState, threadThreadWaitState;
+    bool schedUsePool;                                          // vxScheduleGraph uses the context worker pool
+    bool schedReady, schedRunning;                              // graph is in scheduler ready list or being executed
+    vx_int32 schedPriority;
+    vx_uint64 schedDeadline;                                    // nanoseconds from vxScheduleGraph (0 for none)
+    vx_uint64 schedSequence;                                    // FIFO order in scheduler ready list
+    vx_uint64 schedDeadlineMissed;
+    std::deque<AgoScheduleRequest> schedRequestList;            // pending vxScheduleGraph requests
+    AgoLatencyHistogram schedWait;
     AgoDataList dataList;
     AgoNodeList nodeList;
     vx_bool isReadyToExecute;
     bool detectedInvalidNode;
     vx_int32 status;
     vx_perf_t perf;
+    AgoLatencyHistogram latency;
     vx_enum state;
     bool reverify;
     struct AgoGraphPerfInternalInfo_ { // shall be identical to AgoGraphPerfInternalInfo in amd_ext_amd.h
@@ -674,10 +749,20 @@ struct AgoGraph {
     };
     AgoGraphPerfInternalInfo_ gpu_perf, gpu_perf_total;
     vx_uint32 virtualDataGenerationCount;
+    vx_uint32 replicaGroupCount;
     vx_uint32 optimizer_flags;
     bool verified;
     std::vector<vx_parameter> parameters;
     std::vector<AgoData *> autoAgeDelayList;
+    vx_uint32 batchFrameCount;                                  // number of frames processed per vxProcessGraph
+    bool batchNodeMajor;                                        // run all frames through a node before the next node
+    std::vector<AgoData *> batchParameters;                     // object array bound to each graph parameter (or NULL)
+    std::map<AgoData *, std::vector<AgoData *>> batchDataMap;   // per-frame instances of node parameters
+    AgoDataList batchDataList;                                  // per-frame copies of intermediate data owned by the graph
+    bool incrementalExecution;                                  // skip CPU nodes whose parameters are unchanged since last execution
+    vx_enum targetPartition;                                    // CPU/GPU assignment mode for nodes without user affinity
+    std::vector<AgoData *> rectExecImages;                      // non-virtual images that node exec rectangles were computed from
+    std::vector<vx_rectangle_t> rectExecImageRects;             // rect_valid and rect_interest of rectExecImages at that time
 #if (ENABLE_OPENCL||ENABLE_HIP)
     std::vector<AgoNode *> gpu_nodeListQueued;
     AgoSuperNode * supernodeList;
@@ -719,11 +804,16 @@ struct MacroData {
     char * text;
     char * text_allocated;
 };
+struct AgoNodeCost {
+    vx_uint64 count[2];    // number of samples on CPU [0] and GPU [1]
+    vx_float64 time[2];    // average execution time in nanoseconds on CPU [0] and GPU [1]
+};
 struct AgoContext {
     AgoReference ref;
     vx_uint64 perfNormFactor;
     CRITICAL_SECTION cs;
     AgoKernelList kernelList;
+    AgoKernelList overriddenKernelList; // built-in kernels replaced by user kernels while still in use
     AgoDataList dataList;
     AgoGraphList graphList;
     std::vector<AgoUserStruct> userStructList;
@@ -776,6 +866,14 @@ struct AgoContext {
     vx_size hip_mem_release_count;
 #endif
     AgoTargetAffinityInfo_ attr_affinity;
+    std::map<std::string, AgoNodeCost> costTable; // node costs indexed by agoCostTableKey()
+    std::string costTableFile;
+    bool costTableModified;
+    vx_float64 costTransferPerByte;  // nanoseconds per byte copied between CPU and GPU
+    vx_float64 costTransferFixed;    // nanoseconds per CPU/GPU copy
+    vx_float64 costMockGpuScale;     // when non-zero, GPU cost is modeled as CPU cost * scale + launch
+    vx_float64 costMockGpuLaunch;
+    AgoScheduler scheduler;          // worker pool shared by graphs for vxScheduleGraph
 public:
     AgoContext();
     ~AgoContext();
@@ -799,6 +897,7 @@ struct _vx_remap { AgoData d; };
 struct _vx_scalar { AgoData d; };
 struct _vx_threshold { AgoData d; };
 struct _vx_object_array { AgoData d; };
+struct _vx_user_data_object { AgoData d; };
 
 // framework
 void * agoAllocMemory(vx_size size);
@@ -830,6 +929,7 @@ vx_enum agoGetUserStructType(AgoContext * acontext, vx_char * name);
 const char * agoGetUserStructName(AgoContext * acontext, vx_enum id);
 AgoKernel * agoFindKernelByEnum(AgoContext * acontext, vx_enum kernel_id);
 AgoKernel * agoFindKernelByName(AgoContext * acontext, const vx_char * name);
+void agoReplaceOverridableKernel(AgoContext * acontext, vx_enum kernel_id, const vx_char * name);
 AgoData * agoFindDataByName(AgoContext * acontext, AgoGraph * agraph, vx_char * name);
 void agoMarkChildrenAsPartOfDelay(AgoData * adata);
 bool agoIsPartOfDelay(AgoData * adata);
@@ -846,9 +946,12 @@ int agoInitializeImageComponentsAndPlanes(AgoContext * acontext);
 int agoSetImageComponentsAndPlanes(AgoContext * acontext, vx_df_image format, vx_size components, vx_size planes, vx_uint32 pixelSizeInBitsNum, vx_uint32 pixelSizeInBitsDenom, vx_color_space_e colorSpace, vx_channel_range_e channelRange);
 int agoGetImageComponentsAndPlanes(AgoContext * acontext, vx_df_image format, vx_size * pComponents, vx_size * pPlanes, vx_uint32 * pPixelSizeInBitsNum, vx_uint32 * pPixelSizeInBitsDenom, vx_color_space_e * pColorSpace, vx_channel_range_e * pChannelRange);
 int agoGetImagePlaneFormat(AgoContext * acontext, vx_df_image format, vx_uint32 width, vx_uint32 height, vx_uint32 plane, vx_df_image *pFormat, vx_uint32 * pWidth, vx_uint32 * pHeight);
+bool agoGetSeparableConvolution(AgoData * conv, vx_int16 * rowCoeff, vx_int16 * colCoeff);
 void agoGetDataName(vx_char * name, AgoData * data);
 int agoAllocData(AgoData * data);
 void agoRetainData(AgoGraph * graph, AgoData * data, bool isForExternalUse);
+void agoDataMarkModified(AgoData * data);
+vx_uint64 agoDataGetGeneration(AgoData * data);
 int agoReleaseData(AgoData * data, bool isForExternalUse);
 int agoReleaseKernel(AgoKernel * kernel, bool isForExternalUse);
 AgoNode * agoCreateNode(AgoGraph * graph, AgoKernel * kernel);
@@ -877,6 +980,14 @@ int agoOptimizeDramaRemove(AgoGraph * agraph);
 int agoOptimizeDramaAnalyze(AgoGraph * agraph);
 int agoOptimizeDramaMerge(AgoGraph * agraph);
 int agoOptimizeDramaAlloc(AgoGraph * agraph);
+int agoUpdateExecRectangles(AgoGraph * agraph);
+int agoOptimizeDramaPartition(AgoGraph * agraph, std::vector<AgoNode *>& freeNodeList, vx_uint32& nextAvailGroupId);
+// cost table
+std::string agoCostTableKey(AgoNode * node);
+int agoCostTableLoad(AgoContext * acontext);
+int agoCostTableSave(AgoContext * acontext);
+void agoCostTableSampleBegin(AgoGraph * graph);
+void agoCostTableRecord(AgoGraph * graph);
 // import
 void agoImportKernelConfig(AgoKernel * kernel, vx_kernel vxkernel);
 void agoImportNodeConfig(AgoNode * node, vx_node vxnode);
@@ -888,6 +999,10 @@ void agoPerfProfileEntry(AgoGraph * graph, AgoProfileEntryType type, vx_referenc
 void agoPerfCaptureReset(vx_perf_t * perf);
 void agoPerfCaptureStart(vx_perf_t * perf);
 void agoPerfCaptureStop(vx_perf_t * perf);
+void agoPerfCaptureStop(vx_perf_t * perf, AgoLatencyHistogram * latency);
+void agoLatencyHistogramAdd(AgoLatencyHistogram * latency, vx_uint64 value);
+vx_uint64 agoLatencyHistogramPercentile(const AgoLatencyHistogram * latency, vx_float64 fraction);
+void agoLatencyHistogramGetInfo(AgoContext * context, AgoLatencyInfo * info, const AgoLatencyHistogram * latency);
 void agoPerfCopyNormalize(AgoContext * context, vx_perf_t * perfDst, vx_perf_t * perfSrc);
 // log
 void agoRegisterLogCallback(vx_context context, vx_log_callback_f callback, vx_bool reentrant);
@@ -944,6 +1059,7 @@ vx_status agoPrepareImageValidRectangleBuffers(AgoGraph * graph);
 vx_status agoComputeImageValidRectangleOutputs(AgoGraph * graph);
 int agoOptimizeGraph(AgoGraph * agraph);
 int agoInitializeGraph(AgoGraph * agraph);
+int agoPrepareGraphBatch(AgoGraph * agraph);
 int agoShutdownGraph(AgoGraph * graph);
 int agoExecuteGraph(AgoGraph * agraph);
 int agoAgeDelay(AgoData * delay);
@@ -951,6 +1067,8 @@ int agoAgeDelay(AgoData * delay);
 int agoProcessGraph(AgoGraph * agraph);
 int agoScheduleGraph(AgoGraph * agraph);
 int agoWaitGraph(AgoGraph * agraph);
+void agoSchedulerGetInfo(AgoContext * acontext, AgoSchedulerInfo * info);
+void agoSchedulerGetGraphInfo(AgoGraph * agraph, AgoGraphScheduleInfo * info);
 int agoWriteGraph(AgoGraph * agraph, AgoReference * * ref, int num_ref, FILE * fp, const char * comment);
 int agoReadGraph(AgoGraph * agraph, AgoReference * * ref, int num_ref, ago_data_registry_callback_f callback_f, void * callback_obj, FILE * fp, vx_int32 dumpToConsole);
 int agoReadGraphFromString(AgoGraph * agraph, AgoReference * * ref, int num_ref, ago_data_registry_callback_f callback_f, void * callback_obj, char * str, vx_int32 dumpToConsole);
@@ -969,6 +1087,14 @@ public:
     ~CAgoLockGlobalContext() { agoUnlockGlobalContext(); }
 };
 
+
+///////////////////////////////////////////////////////////
+// CPU worker pool shared by all contexts
+void agoCpuWorkerPoolAcquire();
+void agoCpuWorkerPoolRelease();
+vx_uint32 agoGetCpuThreadCount();
+void agoParallelFor(vx_size count, const std::function<void(vx_size)>& func);
+
 class CAgoLock {
 public:
     CAgoLock(CRITICAL_SECTION& cs) { m_cs = &cs; EnterCriticalSection(m_cs); }
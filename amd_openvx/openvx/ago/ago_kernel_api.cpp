@@ -352,7 +352,8 @@ int ovxKernel_ColorConvert(AgoNode * node, AgoKernelCommand cmd)
         vx_uint32 height = node->paramList[0]->u.img.height;
         vx_df_image srcfmt = node->paramList[0]->u.img.format;
         if (srcfmt != VX_DF_IMAGE_RGB && srcfmt != VX_DF_IMAGE_RGBX && srcfmt != VX_DF_IMAGE_NV12 && srcfmt != VX_DF_IMAGE_NV21 &&
-            srcfmt != VX_DF_IMAGE_IYUV && srcfmt != VX_DF_IMAGE_YUYV && srcfmt != VX_DF_IMAGE_UYVY)
+            srcfmt != VX_DF_IMAGE_IYUV && srcfmt != VX_DF_IMAGE_YUYV && srcfmt != VX_DF_IMAGE_UYVY &&
+            srcfmt != VX_DF_IMAGE_P010_AMD && srcfmt != VX_DF_IMAGE_P016_AMD)
             return VX_ERROR_INVALID_FORMAT;
         if (!width || !height || (width & 1) || (height & 1))
             return VX_ERROR_INVALID_DIMENSION;
@@ -917,7 +918,10 @@ int ovxKernel_IntegralImage(AgoNode * node, AgoKernelCommand cmd)
         meta = &node->metaList[1];
         meta->data.u.img.width = width;
         meta->data.u.img.height = height;
+        // U64 output (AMD extension) is for images whose sum may exceed 32 bits
         meta->data.u.img.format = VX_DF_IMAGE_U32;
+        if (node->paramList[1]->u.img.format == VX_DF_IMAGE_U64_AMD)
+            meta->data.u.img.format = VX_DF_IMAGE_U64_AMD;
         status = VX_SUCCESS;
     }
     else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
@@ -2351,6 +2355,327 @@ int ovxKernel_LaplacianReconstruct(AgoNode * node, AgoKernelCommand cmd)
     return status;
 }
 
+static bool agoIsValidTensorDataType(vx_enum data_type)
+{
+    return data_type == VX_TYPE_UINT8 || data_type == VX_TYPE_INT16 || data_type == VX_TYPE_FLOAT16 || data_type == VX_TYPE_FLOAT32;
+}
+
+static void agoSetTensorMeta(AgoNode * node, vx_uint32 index, vx_size num_dims, const vx_size * dims, vx_enum data_type, vx_uint32 fixed_point_pos)
+{
+    vx_meta_format meta = &node->metaList[index];
+    meta->data.u.tensor.num_dims = num_dims;
+    for (vx_size i = 0; i < AGO_MAX_TENSOR_DIMENSIONS; i++)
+        meta->data.u.tensor.dims[i] = (i < num_dims) ? dims[i] : 1;
+    meta->data.u.tensor.data_type = data_type;
+    meta->data.u.tensor.fixed_point_pos = fixed_point_pos;
+}
+
+static int ValidateArguments_Tensor_Elementwise(AgoNode * node, vx_uint32 outIndex, vx_uint32 in1Index, vx_uint32 in2Index)
+{
+    // input2 must have the same type as input1 and dimensions that match input1 or are 1 (broadcast)
+    AgoData * in1 = node->paramList[in1Index];
+    AgoData * in2 = node->paramList[in2Index];
+    if (!agoIsValidTensorDataType(in1->u.tensor.data_type) || in2->u.tensor.data_type != in1->u.tensor.data_type ||
+        in2->u.tensor.fixed_point_pos != in1->u.tensor.fixed_point_pos)
+        return VX_ERROR_INVALID_FORMAT;
+    else if (!in1->u.tensor.num_dims || in2->u.tensor.num_dims > in1->u.tensor.num_dims)
+        return VX_ERROR_INVALID_DIMENSION;
+    for (vx_size i = 0; i < in2->u.tensor.num_dims; i++) {
+        if (in2->u.tensor.dims[i] != in1->u.tensor.dims[i] && in2->u.tensor.dims[i] != 1)
+            return VX_ERROR_INVALID_DIMENSION;
+    }
+    // set output tensor same as input1
+    agoSetTensorMeta(node, outIndex, in1->u.tensor.num_dims, in1->u.tensor.dims, in1->u.tensor.data_type, in1->u.tensor.fixed_point_pos);
+    return VX_SUCCESS;
+}
+
+static int ValidateArguments_Tensor_Policy(AgoNode * node, vx_uint32 index)
+{
+    AgoData * policy = node->paramList[index];
+    if (policy->u.scalar.type != VX_TYPE_ENUM)
+        return VX_ERROR_INVALID_TYPE;
+    else if (policy->u.scalar.u.e != VX_CONVERT_POLICY_WRAP && policy->u.scalar.u.e != VX_CONVERT_POLICY_SATURATE)
+        return VX_ERROR_INVALID_VALUE;
+    return VX_SUCCESS;
+}
+
+static int ValidateArguments_Tensor_AddSub(AgoNode * node, vx_uint32 outIndex, vx_uint32 in1Index, vx_uint32 in2Index, vx_uint32 policyIndex)
+{
+    vx_status status = ValidateArguments_Tensor_Policy(node, policyIndex);
+    if (status == VX_SUCCESS)
+        status = ValidateArguments_Tensor_Elementwise(node, outIndex, in1Index, in2Index);
+    return status;
+}
+
+static int ValidateArguments_Tensor_Multiply(AgoNode * node, vx_uint32 outIndex, vx_uint32 in1Index, vx_uint32 in2Index, vx_uint32 scaleIndex, vx_uint32 overflowIndex, vx_uint32 roundingIndex)
+{
+    AgoData * scale = node->paramList[scaleIndex];
+    AgoData * rounding = node->paramList[roundingIndex];
+    if (scale->u.scalar.type != VX_TYPE_FLOAT32 || rounding->u.scalar.type != VX_TYPE_ENUM)
+        return VX_ERROR_INVALID_TYPE;
+    else if (scale->u.scalar.u.f < 0.0f)
+        return VX_ERROR_INVALID_VALUE;
+    else if (rounding->u.scalar.u.e != VX_ROUND_POLICY_TO_ZERO && rounding->u.scalar.u.e != VX_ROUND_POLICY_TO_NEAREST_EVEN)
+        return VX_ERROR_INVALID_VALUE;
+    return ValidateArguments_Tensor_AddSub(node, outIndex, in1Index, in2Index, overflowIndex);
+}
+
+static int ValidateArguments_Tensor_TableLookup(AgoNode * node, vx_uint32 outIndex, vx_uint32 inIndex, vx_uint32 lutIndex)
+{
+    // only U8 and S16 tensors with a LUT of the same type are supported
+    AgoData * in = node->paramList[inIndex];
+    AgoData * lut = node->paramList[lutIndex];
+    if (in->u.tensor.data_type != VX_TYPE_UINT8 && in->u.tensor.data_type != VX_TYPE_INT16)
+        return VX_ERROR_INVALID_FORMAT;
+    else if (lut->u.lut.type != in->u.tensor.data_type || !lut->u.lut.count)
+        return VX_ERROR_INVALID_TYPE;
+    else if (!in->u.tensor.num_dims)
+        return VX_ERROR_INVALID_DIMENSION;
+    agoSetTensorMeta(node, outIndex, in->u.tensor.num_dims, in->u.tensor.dims, in->u.tensor.data_type, in->u.tensor.fixed_point_pos);
+    return VX_SUCCESS;
+}
+
+static int ValidateArguments_Tensor_Transpose(AgoNode * node, vx_uint32 outIndex, vx_uint32 inIndex, vx_uint32 dim1Index, vx_uint32 dim2Index)
+{
+    AgoData * in = node->paramList[inIndex];
+    AgoData * dim1 = node->paramList[dim1Index];
+    AgoData * dim2 = node->paramList[dim2Index];
+    if (!agoIsValidTensorDataType(in->u.tensor.data_type))
+        return VX_ERROR_INVALID_FORMAT;
+    else if (dim1->u.scalar.type != VX_TYPE_SIZE || dim2->u.scalar.type != VX_TYPE_SIZE)
+        return VX_ERROR_INVALID_TYPE;
+    else if (dim1->u.scalar.u.s >= in->u.tensor.num_dims || dim2->u.scalar.u.s >= in->u.tensor.num_dims)
+        return VX_ERROR_INVALID_DIMENSION;
+    // set output dimensions with dim1 and dim2 swapped
+    vx_size dims[AGO_MAX_TENSOR_DIMENSIONS];
+    for (vx_size i = 0; i < AGO_MAX_TENSOR_DIMENSIONS; i++)
+        dims[i] = in->u.tensor.dims[i];
+    dims[dim1->u.scalar.u.s] = in->u.tensor.dims[dim2->u.scalar.u.s];
+    dims[dim2->u.scalar.u.s] = in->u.tensor.dims[dim1->u.scalar.u.s];
+    agoSetTensorMeta(node, outIndex, in->u.tensor.num_dims, dims, in->u.tensor.data_type, in->u.tensor.fixed_point_pos);
+    return VX_SUCCESS;
+}
+
+static int ValidateArguments_Tensor_ConvertDepth(AgoNode * node, vx_uint32 outIndex, vx_uint32 inIndex, vx_uint32 policyIndex, vx_uint32 normIndex, vx_uint32 offsetIndex)
+{
+    // output data type and fixed point position are picked from the output tensor
+    AgoData * out = node->paramList[outIndex];
+    AgoData * in = node->paramList[inIndex];
+    AgoData * norm = node->paramList[normIndex];
+    AgoData * offset = node->paramList[offsetIndex];
+    if (!agoIsValidTensorDataType(in->u.tensor.data_type) || !agoIsValidTensorDataType(out->u.tensor.data_type))
+        return VX_ERROR_INVALID_FORMAT;
+    else if (norm->u.scalar.type != VX_TYPE_FLOAT32 || offset->u.scalar.type != VX_TYPE_FLOAT32)
+        return VX_ERROR_INVALID_TYPE;
+    else if (norm->u.scalar.u.f == 0.0f)
+        return VX_ERROR_INVALID_VALUE;
+    else if (!in->u.tensor.num_dims)
+        return VX_ERROR_INVALID_DIMENSION;
+    vx_status status = ValidateArguments_Tensor_Policy(node, policyIndex);
+    if (status == VX_SUCCESS)
+        agoSetTensorMeta(node, outIndex, in->u.tensor.num_dims, in->u.tensor.dims, out->u.tensor.data_type, out->u.tensor.fixed_point_pos);
+    return status;
+}
+
+static void agoGetTensorMatrixMultiplyParams(AgoData * data, vx_tensor_matrix_multiply_params_t * params)
+{
+    params->transpose_input1 = vx_false_e;
+    params->transpose_input2 = vx_false_e;
+    params->transpose_input3 = vx_false_e;
+    if (data && data->buffer)
+        *params = *(vx_tensor_matrix_multiply_params_t *)data->buffer;
+}
+
+static int ValidateArguments_Tensor_MatrixMultiply(AgoNode * node, vx_uint32 outIndex, vx_uint32 in1Index, vx_uint32 in2Index, vx_uint32 in3Index, vx_uint32 paramsIndex)
+{
+    // dims[0] is the number of columns and dims[1] is the number of rows of each matrix
+    AgoData * in1 = node->paramList[in1Index];
+    AgoData * in2 = node->paramList[in2Index];
+    AgoData * in3 = node->paramList[in3Index];
+    AgoData * params = node->paramList[paramsIndex];
+    if (params->u.scalar.type != VX_TYPE_TENSOR_MATRIX_MULTIPLY_PARAMS)
+        return VX_ERROR_INVALID_TYPE;
+    vx_enum data_type = in1->u.tensor.data_type;
+    if (!agoIsValidTensorDataType(data_type) || in2->u.tensor.data_type != data_type || in2->u.tensor.fixed_point_pos != in1->u.tensor.fixed_point_pos)
+        return VX_ERROR_INVALID_FORMAT;
+    else if (in1->u.tensor.num_dims != 2 || in2->u.tensor.num_dims != 2)
+        return VX_ERROR_INVALID_DIMENSION;
+    vx_tensor_matrix_multiply_params_t mmp;
+    agoGetTensorMatrixMultiplyParams(params, &mmp);
+    vx_size M = mmp.transpose_input1 ? in1->u.tensor.dims[0] : in1->u.tensor.dims[1];
+    vx_size K = mmp.transpose_input1 ? in1->u.tensor.dims[1] : in1->u.tensor.dims[0];
+    vx_size K2 = mmp.transpose_input2 ? in2->u.tensor.dims[0] : in2->u.tensor.dims[1];
+    vx_size N = mmp.transpose_input2 ? in2->u.tensor.dims[1] : in2->u.tensor.dims[0];
+    if (!M || !N || !K || K != K2)
+        return VX_ERROR_INVALID_DIMENSION;
+    if (in3) {
+        if (in3->u.tensor.data_type != data_type || in3->u.tensor.fixed_point_pos != in1->u.tensor.fixed_point_pos)
+            return VX_ERROR_INVALID_FORMAT;
+        vx_size M3 = mmp.transpose_input3 ? in3->u.tensor.dims[0] : in3->u.tensor.dims[1];
+        vx_size N3 = mmp.transpose_input3 ? in3->u.tensor.dims[1] : in3->u.tensor.dims[0];
+        if (in3->u.tensor.num_dims != 2 || M3 != M || N3 != N)
+            return VX_ERROR_INVALID_DIMENSION;
+    }
+    // set output tensor as N columns by M rows
+    vx_size dims[2] = { N, M };
+    agoSetTensorMeta(node, outIndex, 2, dims, data_type, in1->u.tensor.fixed_point_pos);
+    return VX_SUCCESS;
+}
+
+int ovxKernel_TensorAdd(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_ADD_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_AddSub(node, 3, 0, 1, 2);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorSubtract(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_SUBTRACT_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_AddSub(node, 3, 0, 1, 2);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorMultiply(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_MULTIPLY_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_Multiply(node, 5, 0, 1, 2, 3, 4);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorTableLookup(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_TABLE_LOOKUP_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_TableLookup(node, 2, 0, 1);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorTranspose(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_TRANSPOSE_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_Transpose(node, 1, 0, 2, 3);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorConvertDepth(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_CONVERT_DEPTH_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_ConvertDepth(node, 4, 0, 1, 2, 3);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorMatrixMultiply(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_MATRIX_MULTIPLY_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_MatrixMultiply(node, 4, 0, 1, 2, 3);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
 #if ENABLE_OPENCL
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Local OpenCL Codegen Functions
@@ -15024,61 +15349,571 @@ int agoKernel_ColorConvert_UV12_RGBX(AgoNode * node, AgoKernelCommand cmd)
     return status;
 }
 
-int agoKernel_Box_U8_U8_3x3(AgoNode * node, AgoKernelCommand cmd)
+int agoKernel_ColorConvert_RGB_P016(AgoNode * node, AgoKernelCommand cmd)
 {
     vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
     if (cmd == ago_kernel_cmd_execute) {
         status = VX_SUCCESS;
         AgoData * oImg = node->paramList[0];
-        AgoData * iImg = node->paramList[1];
-        if (HafCpu_Box_U8_U8_3x3(oImg->u.img.width, oImg->u.img.height - 2, oImg->buffer + oImg->u.img.stride_in_bytes, oImg->u.img.stride_in_bytes,
-            iImg->buffer + iImg->u.img.stride_in_bytes, iImg->u.img.stride_in_bytes, node->localDataPtr)) {
+        AgoData * iImg1 = node->paramList[1];
+        AgoData * iImg2 = node->paramList[2];
+        if (HafCpu_ColorConvert_RGB_P016(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+                                         iImg1->buffer, iImg1->u.img.stride_in_bytes, iImg2->buffer, iImg2->u.img.stride_in_bytes))
+        {
             status = VX_FAILURE;
         }
     }
     else if (cmd == ago_kernel_cmd_validate) {
-        status = ValidateArguments_Img_1OUT_1IN(node, VX_DF_IMAGE_U8, VX_DF_IMAGE_U8, true, 1, 1);
-    }
-    else if (cmd == ago_kernel_cmd_initialize) {
-        int alignedWidth = (node->paramList[0]->u.img.width + 15) & ~15;		// Next highest multiple of 16, so that the buffer is aligned for all three lines
-        node->localDataSize = 3 * alignedWidth * sizeof(vx_uint16);				// Three rows (+some extra) worth of scratch memory
+        // validate parameters
+        vx_uint32 width = node->paramList[1]->u.img.width;
+        vx_uint32 height = node->paramList[1]->u.img.height;
+        if (node->paramList[1]->u.img.format != VX_DF_IMAGE_U16 || node->paramList[2]->u.img.format != VX_DF_IMAGE_U32)
+            return VX_ERROR_INVALID_FORMAT;
+        else if (!width || !height || width != (node->paramList[2]->u.img.width << 1) || (height != node->paramList[2]->u.img.height << 1))
+            return VX_ERROR_INVALID_DIMENSION;
+        // set output image sizes are same as input image size
+        vx_meta_format meta;
+        meta = &node->metaList[0];
+        meta->data.u.img.width = width;
+        meta->data.u.img.height = height;
+        meta->data.u.img.format = VX_DF_IMAGE_RGB;
         status = VX_SUCCESS;
     }
-    else if (cmd == ago_kernel_cmd_shutdown) {
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
         status = VX_SUCCESS;
     }
-#if ENABLE_OPENCL
-    else if (cmd == ago_kernel_cmd_opencl_codegen) {
-        // re-use LinearFilter_ANY_U8
-        float filterCoef[] = { 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f };
-        AgoData filter;
-        filter.ref.type = VX_TYPE_MATRIX; filter.u.mat.type = VX_TYPE_FLOAT32; filter.u.mat.columns = filter.u.mat.rows = 3; filter.buffer = (vx_uint8 *)filterCoef; filter.ref.read_only = true;
-        status = HafGpu_LinearFilter_ANY_U8(node, VX_DF_IMAGE_U8, &filter, false);
-    }
-#endif
     else if (cmd == ago_kernel_cmd_query_target_support) {
         node->target_support_flags = 0
-                    | AGO_KERNEL_FLAG_DEVICE_CPU
-#if ENABLE_OPENCL
-                    | AGO_KERNEL_FLAG_DEVICE_GPU | AGO_KERNEL_FLAG_GPU_INTEG_M2R
-#elif ENABLE_HIP
-                    | AGO_KERNEL_FLAG_DEVICE_GPU
-#endif
-                    ;
+            | AGO_KERNEL_FLAG_DEVICE_CPU
+            ;
         status = VX_SUCCESS;
     }
     else if (cmd == ago_kernel_cmd_valid_rect_callback) {
         AgoData * out = node->paramList[0];
         AgoData * inp = node->paramList[1];
-        vx_uint32 width = out->u.img.width;
-        vx_uint32 height = out->u.img.height;
-        out->u.img.rect_valid.start_x = min(inp->u.img.rect_valid.start_x + 1, width);
-        out->u.img.rect_valid.start_y = min(inp->u.img.rect_valid.start_y + 1, height);
-        out->u.img.rect_valid.end_x = max((int)inp->u.img.rect_valid.end_x - 1, 0);
-        out->u.img.rect_valid.end_y = max((int)inp->u.img.rect_valid.end_y - 1, 0);
+        out->u.img.rect_valid.start_x = inp->u.img.rect_valid.start_x;
+        out->u.img.rect_valid.start_y = inp->u.img.rect_valid.start_y;
+        out->u.img.rect_valid.end_x = inp->u.img.rect_valid.end_x;
+        out->u.img.rect_valid.end_y = inp->u.img.rect_valid.end_y;
     }
-#if ENABLE_HIP
-    else if (cmd == ago_kernel_cmd_hip_execute) {
+    return status;
+}
+
+int agoKernel_ColorConvert_RGBX_P016(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg1 = node->paramList[1];
+        AgoData * iImg2 = node->paramList[2];
+        if (HafCpu_ColorConvert_RGBX_P016(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+                                          iImg1->buffer, iImg1->u.img.stride_in_bytes, iImg2->buffer, iImg2->u.img.stride_in_bytes))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        vx_uint32 width = node->paramList[1]->u.img.width;
+        vx_uint32 height = node->paramList[1]->u.img.height;
+        if (node->paramList[1]->u.img.format != VX_DF_IMAGE_U16 || node->paramList[2]->u.img.format != VX_DF_IMAGE_U32)
+            return VX_ERROR_INVALID_FORMAT;
+        else if (!width || !height || width != (node->paramList[2]->u.img.width << 1) || (height != node->paramList[2]->u.img.height << 1))
+            return VX_ERROR_INVALID_DIMENSION;
+        // set output image sizes are same as input image size
+        vx_meta_format meta;
+        meta = &node->metaList[0];
+        meta->data.u.img.width = width;
+        meta->data.u.img.height = height;
+        meta->data.u.img.format = VX_DF_IMAGE_RGBX;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+            | AGO_KERNEL_FLAG_DEVICE_CPU
+            ;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_valid_rect_callback) {
+        AgoData * out = node->paramList[0];
+        AgoData * inp = node->paramList[1];
+        out->u.img.rect_valid.start_x = inp->u.img.rect_valid.start_x;
+        out->u.img.rect_valid.start_y = inp->u.img.rect_valid.start_y;
+        out->u.img.rect_valid.end_x = inp->u.img.rect_valid.end_x;
+        out->u.img.rect_valid.end_y = inp->u.img.rect_valid.end_y;
+    }
+    return status;
+}
+
+int agoKernel_ColorConvert_P010_RGB(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImgY = node->paramList[0];
+        AgoData * oImgC = node->paramList[1];
+        AgoData * iImg  = node->paramList[2];
+        if (HafCpu_ColorConvert_P010_RGB(oImgY->u.img.width, oImgY->u.img.height, oImgY->buffer, oImgY->u.img.stride_in_bytes,
+                                         oImgC->buffer, oImgC->u.img.stride_in_bytes, iImg->buffer, iImg->u.img.stride_in_bytes))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        vx_uint32 width = node->paramList[2]->u.img.width;
+        vx_uint32 height = node->paramList[2]->u.img.height;
+        if (node->paramList[2]->u.img.format != VX_DF_IMAGE_RGB)
+            return VX_ERROR_INVALID_FORMAT;
+        else if (!width || !height || (width & 1) || (height & 1))
+            return VX_ERROR_INVALID_DIMENSION;
+        // set output image sizes and format
+        vx_meta_format meta;
+        meta = &node->metaList[0];
+        meta->data.u.img.width = width;
+        meta->data.u.img.height = height;
+        meta->data.u.img.format = VX_DF_IMAGE_U16;
+        meta = &node->metaList[1];
+        meta->data.u.img.width = width >> 1;
+        meta->data.u.img.height = height >> 1;
+        meta->data.u.img.format = VX_DF_IMAGE_U32;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+            | AGO_KERNEL_FLAG_DEVICE_CPU
+            ;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_valid_rect_callback) {
+        AgoData * out1 = node->paramList[0];
+        AgoData * out2 = node->paramList[1];
+        AgoData * inp = node->paramList[2];
+        out1->u.img.rect_valid.start_x = inp->u.img.rect_valid.start_x;
+        out1->u.img.rect_valid.start_y = inp->u.img.rect_valid.start_y;
+        out1->u.img.rect_valid.end_x = inp->u.img.rect_valid.end_x;
+        out1->u.img.rect_valid.end_y = inp->u.img.rect_valid.end_y;
+        out2->u.img.rect_valid.start_x = (inp->u.img.rect_valid.start_x + 1) >> 1;
+        out2->u.img.rect_valid.start_y = (inp->u.img.rect_valid.start_y + 1) >> 1;
+        out2->u.img.rect_valid.end_x = (inp->u.img.rect_valid.end_x + 1) >> 1;
+        out2->u.img.rect_valid.end_y = (inp->u.img.rect_valid.end_y + 1) >> 1;
+    }
+    return status;
+}
+
+int agoKernel_ColorConvert_P010_RGBX(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImgY = node->paramList[0];
+        AgoData * oImgC = node->paramList[1];
+        AgoData * iImg  = node->paramList[2];
+        if (HafCpu_ColorConvert_P010_RGBX(oImgY->u.img.width, oImgY->u.img.height, oImgY->buffer, oImgY->u.img.stride_in_bytes,
+                                          oImgC->buffer, oImgC->u.img.stride_in_bytes, iImg->buffer, iImg->u.img.stride_in_bytes))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        vx_uint32 width = node->paramList[2]->u.img.width;
+        vx_uint32 height = node->paramList[2]->u.img.height;
+        if (node->paramList[2]->u.img.format != VX_DF_IMAGE_RGBX)
+            return VX_ERROR_INVALID_FORMAT;
+        else if (!width || !height || (width & 1) || (height & 1))
+            return VX_ERROR_INVALID_DIMENSION;
+        // set output image sizes and format
+        vx_meta_format meta;
+        meta = &node->metaList[0];
+        meta->data.u.img.width = width;
+        meta->data.u.img.height = height;
+        meta->data.u.img.format = VX_DF_IMAGE_U16;
+        meta = &node->metaList[1];
+        meta->data.u.img.width = width >> 1;
+        meta->data.u.img.height = height >> 1;
+        meta->data.u.img.format = VX_DF_IMAGE_U32;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+            | AGO_KERNEL_FLAG_DEVICE_CPU
+            ;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_valid_rect_callback) {
+        AgoData * out1 = node->paramList[0];
+        AgoData * out2 = node->paramList[1];
+        AgoData * inp = node->paramList[2];
+        out1->u.img.rect_valid.start_x = inp->u.img.rect_valid.start_x;
+        out1->u.img.rect_valid.start_y = inp->u.img.rect_valid.start_y;
+        out1->u.img.rect_valid.end_x = inp->u.img.rect_valid.end_x;
+        out1->u.img.rect_valid.end_y = inp->u.img.rect_valid.end_y;
+        out2->u.img.rect_valid.start_x = (inp->u.img.rect_valid.start_x + 1) >> 1;
+        out2->u.img.rect_valid.start_y = (inp->u.img.rect_valid.start_y + 1) >> 1;
+        out2->u.img.rect_valid.end_x = (inp->u.img.rect_valid.end_x + 1) >> 1;
+        out2->u.img.rect_valid.end_y = (inp->u.img.rect_valid.end_y + 1) >> 1;
+    }
+    return status;
+}
+
+int agoKernel_ColorConvert_P016_RGB(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImgY = node->paramList[0];
+        AgoData * oImgC = node->paramList[1];
+        AgoData * iImg  = node->paramList[2];
+        if (HafCpu_ColorConvert_P016_RGB(oImgY->u.img.width, oImgY->u.img.height, oImgY->buffer, oImgY->u.img.stride_in_bytes,
+                                         oImgC->buffer, oImgC->u.img.stride_in_bytes, iImg->buffer, iImg->u.img.stride_in_bytes))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        vx_uint32 width = node->paramList[2]->u.img.width;
+        vx_uint32 height = node->paramList[2]->u.img.height;
+        if (node->paramList[2]->u.img.format != VX_DF_IMAGE_RGB)
+            return VX_ERROR_INVALID_FORMAT;
+        else if (!width || !height || (width & 1) || (height & 1))
+            return VX_ERROR_INVALID_DIMENSION;
+        // set output image sizes and format
+        vx_meta_format meta;
+        meta = &node->metaList[0];
+        meta->data.u.img.width = width;
+        meta->data.u.img.height = height;
+        meta->data.u.img.format = VX_DF_IMAGE_U16;
+        meta = &node->metaList[1];
+        meta->data.u.img.width = width >> 1;
+        meta->data.u.img.height = height >> 1;
+        meta->data.u.img.format = VX_DF_IMAGE_U32;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+            | AGO_KERNEL_FLAG_DEVICE_CPU
+            ;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_valid_rect_callback) {
+        AgoData * out1 = node->paramList[0];
+        AgoData * out2 = node->paramList[1];
+        AgoData * inp = node->paramList[2];
+        out1->u.img.rect_valid.start_x = inp->u.img.rect_valid.start_x;
+        out1->u.img.rect_valid.start_y = inp->u.img.rect_valid.start_y;
+        out1->u.img.rect_valid.end_x = inp->u.img.rect_valid.end_x;
+        out1->u.img.rect_valid.end_y = inp->u.img.rect_valid.end_y;
+        out2->u.img.rect_valid.start_x = (inp->u.img.rect_valid.start_x + 1) >> 1;
+        out2->u.img.rect_valid.start_y = (inp->u.img.rect_valid.start_y + 1) >> 1;
+        out2->u.img.rect_valid.end_x = (inp->u.img.rect_valid.end_x + 1) >> 1;
+        out2->u.img.rect_valid.end_y = (inp->u.img.rect_valid.end_y + 1) >> 1;
+    }
+    return status;
+}
+
+int agoKernel_ColorConvert_P016_RGBX(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImgY = node->paramList[0];
+        AgoData * oImgC = node->paramList[1];
+        AgoData * iImg  = node->paramList[2];
+        if (HafCpu_ColorConvert_P016_RGBX(oImgY->u.img.width, oImgY->u.img.height, oImgY->buffer, oImgY->u.img.stride_in_bytes,
+                                          oImgC->buffer, oImgC->u.img.stride_in_bytes, iImg->buffer, iImg->u.img.stride_in_bytes))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        vx_uint32 width = node->paramList[2]->u.img.width;
+        vx_uint32 height = node->paramList[2]->u.img.height;
+        if (node->paramList[2]->u.img.format != VX_DF_IMAGE_RGBX)
+            return VX_ERROR_INVALID_FORMAT;
+        else if (!width || !height || (width & 1) || (height & 1))
+            return VX_ERROR_INVALID_DIMENSION;
+        // set output image sizes and format
+        vx_meta_format meta;
+        meta = &node->metaList[0];
+        meta->data.u.img.width = width;
+        meta->data.u.img.height = height;
+        meta->data.u.img.format = VX_DF_IMAGE_U16;
+        meta = &node->metaList[1];
+        meta->data.u.img.width = width >> 1;
+        meta->data.u.img.height = height >> 1;
+        meta->data.u.img.format = VX_DF_IMAGE_U32;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+            | AGO_KERNEL_FLAG_DEVICE_CPU
+            ;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_valid_rect_callback) {
+        AgoData * out1 = node->paramList[0];
+        AgoData * out2 = node->paramList[1];
+        AgoData * inp = node->paramList[2];
+        out1->u.img.rect_valid.start_x = inp->u.img.rect_valid.start_x;
+        out1->u.img.rect_valid.start_y = inp->u.img.rect_valid.start_y;
+        out1->u.img.rect_valid.end_x = inp->u.img.rect_valid.end_x;
+        out1->u.img.rect_valid.end_y = inp->u.img.rect_valid.end_y;
+        out2->u.img.rect_valid.start_x = (inp->u.img.rect_valid.start_x + 1) >> 1;
+        out2->u.img.rect_valid.start_y = (inp->u.img.rect_valid.start_y + 1) >> 1;
+        out2->u.img.rect_valid.end_x = (inp->u.img.rect_valid.end_x + 1) >> 1;
+        out2->u.img.rect_valid.end_y = (inp->u.img.rect_valid.end_y + 1) >> 1;
+    }
+    return status;
+}
+
+int agoKernel_FormatConvert_NV12_P016(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImgY = node->paramList[0];
+        AgoData * oImgC = node->paramList[1];
+        AgoData * iImgY = node->paramList[2];
+        AgoData * iImgC = node->paramList[3];
+        if (HafCpu_FormatConvert_NV12_P016(oImgY->u.img.width, oImgY->u.img.height, oImgY->buffer, oImgY->u.img.stride_in_bytes,
+                                           oImgC->buffer, oImgC->u.img.stride_in_bytes, iImgY->buffer, iImgY->u.img.stride_in_bytes,
+                                           iImgC->buffer, iImgC->u.img.stride_in_bytes))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        vx_uint32 width = node->paramList[2]->u.img.width;
+        vx_uint32 height = node->paramList[2]->u.img.height;
+        if (node->paramList[2]->u.img.format != VX_DF_IMAGE_U16 || node->paramList[3]->u.img.format != VX_DF_IMAGE_U32)
+            return VX_ERROR_INVALID_FORMAT;
+        else if (!width || !height || width != (node->paramList[3]->u.img.width << 1) || (height != node->paramList[3]->u.img.height << 1))
+            return VX_ERROR_INVALID_DIMENSION;
+        // set output image sizes and format
+        vx_meta_format meta;
+        meta = &node->metaList[0];
+        meta->data.u.img.width = width;
+        meta->data.u.img.height = height;
+        meta->data.u.img.format = VX_DF_IMAGE_U8;
+        meta = &node->metaList[1];
+        meta->data.u.img.width = width >> 1;
+        meta->data.u.img.height = height >> 1;
+        meta->data.u.img.format = VX_DF_IMAGE_U16;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+            | AGO_KERNEL_FLAG_DEVICE_CPU
+            ;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_valid_rect_callback) {
+        for (int i = 0; i < 2; i++) {
+            AgoData * out = node->paramList[i];
+            AgoData * inp = node->paramList[2 + i];
+            out->u.img.rect_valid.start_x = inp->u.img.rect_valid.start_x;
+            out->u.img.rect_valid.start_y = inp->u.img.rect_valid.start_y;
+            out->u.img.rect_valid.end_x = inp->u.img.rect_valid.end_x;
+            out->u.img.rect_valid.end_y = inp->u.img.rect_valid.end_y;
+        }
+    }
+    return status;
+}
+
+int agoKernel_FormatConvert_P010_NV12(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImgY = node->paramList[0];
+        AgoData * oImgC = node->paramList[1];
+        AgoData * iImgY = node->paramList[2];
+        AgoData * iImgC = node->paramList[3];
+        if (HafCpu_FormatConvert_P010_NV12(oImgY->u.img.width, oImgY->u.img.height, oImgY->buffer, oImgY->u.img.stride_in_bytes,
+                                           oImgC->buffer, oImgC->u.img.stride_in_bytes, iImgY->buffer, iImgY->u.img.stride_in_bytes,
+                                           iImgC->buffer, iImgC->u.img.stride_in_bytes))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        vx_uint32 width = node->paramList[2]->u.img.width;
+        vx_uint32 height = node->paramList[2]->u.img.height;
+        if (node->paramList[2]->u.img.format != VX_DF_IMAGE_U8 || node->paramList[3]->u.img.format != VX_DF_IMAGE_U16)
+            return VX_ERROR_INVALID_FORMAT;
+        else if (!width || !height || width != (node->paramList[3]->u.img.width << 1) || (height != node->paramList[3]->u.img.height << 1))
+            return VX_ERROR_INVALID_DIMENSION;
+        // set output image sizes and format
+        vx_meta_format meta;
+        meta = &node->metaList[0];
+        meta->data.u.img.width = width;
+        meta->data.u.img.height = height;
+        meta->data.u.img.format = VX_DF_IMAGE_U16;
+        meta = &node->metaList[1];
+        meta->data.u.img.width = width >> 1;
+        meta->data.u.img.height = height >> 1;
+        meta->data.u.img.format = VX_DF_IMAGE_U32;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+            | AGO_KERNEL_FLAG_DEVICE_CPU
+            ;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_valid_rect_callback) {
+        for (int i = 0; i < 2; i++) {
+            AgoData * out = node->paramList[i];
+            AgoData * inp = node->paramList[2 + i];
+            out->u.img.rect_valid.start_x = inp->u.img.rect_valid.start_x;
+            out->u.img.rect_valid.start_y = inp->u.img.rect_valid.start_y;
+            out->u.img.rect_valid.end_x = inp->u.img.rect_valid.end_x;
+            out->u.img.rect_valid.end_y = inp->u.img.rect_valid.end_y;
+        }
+    }
+    return status;
+}
+
+int agoKernel_FormatConvert_P016_NV12(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImgY = node->paramList[0];
+        AgoData * oImgC = node->paramList[1];
+        AgoData * iImgY = node->paramList[2];
+        AgoData * iImgC = node->paramList[3];
+        if (HafCpu_FormatConvert_P016_NV12(oImgY->u.img.width, oImgY->u.img.height, oImgY->buffer, oImgY->u.img.stride_in_bytes,
+                                           oImgC->buffer, oImgC->u.img.stride_in_bytes, iImgY->buffer, iImgY->u.img.stride_in_bytes,
+                                           iImgC->buffer, iImgC->u.img.stride_in_bytes))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        vx_uint32 width = node->paramList[2]->u.img.width;
+        vx_uint32 height = node->paramList[2]->u.img.height;
+        if (node->paramList[2]->u.img.format != VX_DF_IMAGE_U8 || node->paramList[3]->u.img.format != VX_DF_IMAGE_U16)
+            return VX_ERROR_INVALID_FORMAT;
+        else if (!width || !height || width != (node->paramList[3]->u.img.width << 1) || (height != node->paramList[3]->u.img.height << 1))
+            return VX_ERROR_INVALID_DIMENSION;
+        // set output image sizes and format
+        vx_meta_format meta;
+        meta = &node->metaList[0];
+        meta->data.u.img.width = width;
+        meta->data.u.img.height = height;
+        meta->data.u.img.format = VX_DF_IMAGE_U16;
+        meta = &node->metaList[1];
+        meta->data.u.img.width = width >> 1;
+        meta->data.u.img.height = height >> 1;
+        meta->data.u.img.format = VX_DF_IMAGE_U32;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+            | AGO_KERNEL_FLAG_DEVICE_CPU
+            ;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_valid_rect_callback) {
+        for (int i = 0; i < 2; i++) {
+            AgoData * out = node->paramList[i];
+            AgoData * inp = node->paramList[2 + i];
+            out->u.img.rect_valid.start_x = inp->u.img.rect_valid.start_x;
+            out->u.img.rect_valid.start_y = inp->u.img.rect_valid.start_y;
+            out->u.img.rect_valid.end_x = inp->u.img.rect_valid.end_x;
+            out->u.img.rect_valid.end_y = inp->u.img.rect_valid.end_y;
+        }
+    }
+    return status;
+}
+
+int agoKernel_Box_U8_U8_3x3(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        if (HafCpu_Box_U8_U8_3x3(oImg->u.img.width, oImg->u.img.height - 2, oImg->buffer + oImg->u.img.stride_in_bytes, oImg->u.img.stride_in_bytes,
+            iImg->buffer + iImg->u.img.stride_in_bytes, iImg->u.img.stride_in_bytes, node->localDataPtr)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Img_1OUT_1IN(node, VX_DF_IMAGE_U8, VX_DF_IMAGE_U8, true, 1, 1);
+    }
+    else if (cmd == ago_kernel_cmd_initialize) {
+        int alignedWidth = (node->paramList[0]->u.img.width + 15) & ~15;		// Next highest multiple of 16, so that the buffer is aligned for all three lines
+        node->localDataSize = 3 * alignedWidth * sizeof(vx_uint16);				// Three rows (+some extra) worth of scratch memory
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+#if ENABLE_OPENCL
+    else if (cmd == ago_kernel_cmd_opencl_codegen) {
+        // re-use LinearFilter_ANY_U8
+        float filterCoef[] = { 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f };
+        AgoData filter;
+        filter.ref.type = VX_TYPE_MATRIX; filter.u.mat.type = VX_TYPE_FLOAT32; filter.u.mat.columns = filter.u.mat.rows = 3; filter.buffer = (vx_uint8 *)filterCoef; filter.ref.read_only = true;
+        status = HafGpu_LinearFilter_ANY_U8(node, VX_DF_IMAGE_U8, &filter, false);
+    }
+#endif
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+#if ENABLE_OPENCL
+                    | AGO_KERNEL_FLAG_DEVICE_GPU | AGO_KERNEL_FLAG_GPU_INTEG_M2R
+#elif ENABLE_HIP
+                    | AGO_KERNEL_FLAG_DEVICE_GPU
+#endif
+                    ;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_valid_rect_callback) {
+        AgoData * out = node->paramList[0];
+        AgoData * inp = node->paramList[1];
+        vx_uint32 width = out->u.img.width;
+        vx_uint32 height = out->u.img.height;
+        out->u.img.rect_valid.start_x = min(inp->u.img.rect_valid.start_x + 1, width);
+        out->u.img.rect_valid.start_y = min(inp->u.img.rect_valid.start_y + 1, height);
+        out->u.img.rect_valid.end_x = max((int)inp->u.img.rect_valid.end_x - 1, 0);
+        out->u.img.rect_valid.end_y = max((int)inp->u.img.rect_valid.end_y - 1, 0);
+    }
+#if ENABLE_HIP
+    else if (cmd == ago_kernel_cmd_hip_execute) {
         status = VX_SUCCESS;
         AgoData * oImg = node->paramList[0];
         AgoData * iImg = node->paramList[1];
@@ -15781,6 +16616,70 @@ int agoKernel_Convolve_S16_U8(AgoNode * node, AgoKernelCommand cmd)
     return status;
 }
 
+int agoKernel_ConvolveSeparable_U8_U8(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        AgoData * iConv = node->paramList[2];
+        vx_uint32 convolutionWidth = (vx_uint32)iConv->u.conv.columns;
+        vx_uint32 convolutionHeight = (vx_uint32)iConv->u.conv.rows;
+        vx_int16 rowCoeff[AGO_MAX_CONVOLUTION_DIM], colCoeff[AGO_MAX_CONVOLUTION_DIM];
+        // coefficients can be modified after graph verification: fall back to 2D convolution when no longer separable
+        if (agoGetSeparableConvolution(iConv, rowCoeff, colCoeff)) {
+            status = HafCpu_ConvolveSeparable_U8_U8(oImg->u.img.width, oImg->u.img.height - convolutionHeight + 1,
+                oImg->buffer + oImg->u.img.stride_in_bytes * (convolutionHeight >> 1), oImg->u.img.stride_in_bytes,
+                iImg->buffer + iImg->u.img.stride_in_bytes * (convolutionHeight >> 1), iImg->u.img.stride_in_bytes,
+                rowCoeff, convolutionWidth, colCoeff, convolutionHeight, iConv->u.conv.shift, (vx_int32 *)node->localDataPtr);
+        }
+        else {
+            status = agoKernel_Convolve_U8_U8(node, cmd);
+        }
+    }
+    else if (cmd == ago_kernel_cmd_initialize) {
+        // rolling buffer of horizontal filter outputs
+        node->localDataSize = node->paramList[2]->u.conv.rows * ALIGN16(node->paramList[0]->u.img.width) * sizeof(vx_int32);
+        status = VX_SUCCESS;
+    }
+    else {
+        status = agoKernel_Convolve_U8_U8(node, cmd);
+    }
+    return status;
+}
+
+int agoKernel_ConvolveSeparable_S16_U8(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        AgoData * iConv = node->paramList[2];
+        vx_uint32 convolutionWidth = (vx_uint32)iConv->u.conv.columns;
+        vx_uint32 convolutionHeight = (vx_uint32)iConv->u.conv.rows;
+        vx_int16 rowCoeff[AGO_MAX_CONVOLUTION_DIM], colCoeff[AGO_MAX_CONVOLUTION_DIM];
+        // coefficients can be modified after graph verification: fall back to 2D convolution when no longer separable
+        if (agoGetSeparableConvolution(iConv, rowCoeff, colCoeff)) {
+            status = HafCpu_ConvolveSeparable_S16_U8(oImg->u.img.width, oImg->u.img.height - convolutionHeight + 1,
+                (vx_int16 *)(oImg->buffer + oImg->u.img.stride_in_bytes * (convolutionHeight >> 1)), oImg->u.img.stride_in_bytes,
+                iImg->buffer + iImg->u.img.stride_in_bytes * (convolutionHeight >> 1), iImg->u.img.stride_in_bytes,
+                rowCoeff, convolutionWidth, colCoeff, convolutionHeight, iConv->u.conv.shift, (vx_int32 *)node->localDataPtr);
+        }
+        else {
+            status = agoKernel_Convolve_S16_U8(node, cmd);
+        }
+    }
+    else if (cmd == ago_kernel_cmd_initialize) {
+        // rolling buffer of horizontal filter outputs
+        node->localDataSize = node->paramList[2]->u.conv.rows * ALIGN16(node->paramList[0]->u.img.width) * sizeof(vx_int32);
+        status = VX_SUCCESS;
+    }
+    else {
+        status = agoKernel_Convolve_S16_U8(node, cmd);
+    }
+    return status;
+}
+
 int agoKernel_LinearFilter_ANY_ANY(AgoNode * node, AgoKernelCommand cmd)
 {
     vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
@@ -18143,6 +19042,46 @@ int agoKernel_NonMaxSupp_XY_ANY_3x3(AgoNode * node, AgoKernelCommand cmd)
     return status;
 }
 
+// remap table in VX_REMAP_TABLE_FORMAT_AMD_FAST is kept in node local data after this header
+struct AgoRemapTableHeader {
+    vx_uint32 valid;
+    vx_uint32 table_version;
+    vx_uint32 src_stride_in_bytes;
+    vx_uint32 table_stride_in_bytes;
+};
+
+static vx_size agoRemapTableLocalDataSize(AgoData * iMap)
+{
+    vx_size tableStrideInBytes = ((iMap->u.remap.dst_width + 7) & ~7) * (sizeof(vx_int32) + sizeof(vx_uint32));
+    return ALIGN32(sizeof(AgoRemapTableHeader)) + tableStrideInBytes * iMap->u.remap.dst_height;
+}
+
+static vx_int32 * agoRemapTablePrepare(AgoNode * node, AgoData * iImg, AgoData * iMap, bool constantBorder, vx_uint32 * pTableStrideInBytes)
+{
+    if (iMap->u.remap.table_format != VX_REMAP_TABLE_FORMAT_AMD_FAST || !node->localDataPtr || node->localDataSize < agoRemapTableLocalDataSize(iMap))
+        return nullptr;
+    AgoRemapTableHeader * header = (AgoRemapTableHeader *)node->localDataPtr;
+    vx_int32 * pTable = (vx_int32 *)(node->localDataPtr + ALIGN32(sizeof(AgoRemapTableHeader)));
+    // the table needs to be prepared again when remap is updated by application or generated within the graph
+    if (!header->valid || header->table_version != iMap->u.remap.table_version || header->src_stride_in_bytes != iImg->u.img.stride_in_bytes ||
+        iMap->outputUsageCount > 0 || iMap->inoutUsageCount > 0)
+    {
+        header->table_stride_in_bytes = (vx_uint32)(((iMap->u.remap.dst_width + 7) & ~7) * (sizeof(vx_int32) + sizeof(vx_uint32)));
+        if (HafCpu_Remap_Prepare_Bilinear_Table(iMap->u.remap.dst_width, iMap->u.remap.dst_height, iImg->u.img.stride_in_bytes,
+            pTable, header->table_stride_in_bytes, (ago_coord2d_ushort_t *)iMap->buffer, iMap->u.remap.dst_width * sizeof(ago_coord2d_ushort_t),
+            iMap->u.remap.remap_fractional_bits, constantBorder))
+        {
+            header->valid = 0;
+            return nullptr;
+        }
+        header->valid = 1;
+        header->table_version = iMap->u.remap.table_version;
+        header->src_stride_in_bytes = iImg->u.img.stride_in_bytes;
+    }
+    *pTableStrideInBytes = header->table_stride_in_bytes;
+    return pTable;
+}
+
 int agoKernel_Remap_U8_U8_Nearest(AgoNode * node, AgoKernelCommand cmd)
 {
     vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
@@ -18335,7 +19274,16 @@ int agoKernel_Remap_U8_U8_Bilinear(AgoNode * node, AgoKernelCommand cmd)
         AgoData * oImg = node->paramList[0];
         AgoData * iImg = node->paramList[1];
         AgoData * iMap = node->paramList[2];
-        if (HafCpu_Remap_U8_U8_Bilinear(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+        vx_uint32 tableStrideInBytes = 0;
+        vx_int32 * pTable = agoRemapTablePrepare(node, iImg, iMap, false, &tableStrideInBytes);
+        if (pTable) {
+            if (HafCpu_Remap_U8_U8_Bilinear_Table(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+                iImg->buffer, iImg->u.img.stride_in_bytes, pTable, tableStrideInBytes))
+            {
+                status = VX_FAILURE;
+            }
+        }
+        else if (HafCpu_Remap_U8_U8_Bilinear(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
             iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes,
             (ago_coord2d_ushort_t *)iMap->buffer, iMap->u.remap.dst_width * sizeof(ago_coord2d_ushort_t)))
         {
@@ -18356,7 +19304,12 @@ int agoKernel_Remap_U8_U8_Bilinear(AgoNode * node, AgoKernelCommand cmd)
             meta->data.u.img.format = VX_DF_IMAGE_U8;
         }
     }
-    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+    else if (cmd == ago_kernel_cmd_initialize) {
+        if (node->paramList[2]->u.remap.table_format == VX_REMAP_TABLE_FORMAT_AMD_FAST)
+            node->localDataSize = agoRemapTableLocalDataSize(node->paramList[2]);
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_shutdown) {
         status = VX_SUCCESS;
     }
 #if ENABLE_OPENCL
@@ -18427,7 +19380,16 @@ int agoKernel_Remap_U8_U8_Bilinear_Constant(AgoNode * node, AgoKernelCommand cmd
         AgoData * oImg = node->paramList[0];
         AgoData * iImg = node->paramList[1];
         AgoData * iMap = node->paramList[2];
-        if (HafCpu_Remap_U8_U8_Bilinear_Constant(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+        vx_uint32 tableStrideInBytes = 0;
+        vx_int32 * pTable = agoRemapTablePrepare(node, iImg, iMap, true, &tableStrideInBytes);
+        if (pTable) {
+            if (HafCpu_Remap_U8_U8_Bilinear_Constant_Table(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+                iImg->buffer, iImg->u.img.stride_in_bytes, pTable, tableStrideInBytes, node->paramList[3]->u.scalar.u.u))
+            {
+                status = VX_FAILURE;
+            }
+        }
+        else if (HafCpu_Remap_U8_U8_Bilinear_Constant(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
             iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes,
             (ago_coord2d_ushort_t *)iMap->buffer, iMap->u.remap.dst_width * sizeof(ago_coord2d_ushort_t), node->paramList[3]->u.scalar.u.u))
         {
@@ -18450,7 +19412,12 @@ int agoKernel_Remap_U8_U8_Bilinear_Constant(AgoNode * node, AgoKernelCommand cmd
             meta->data.u.img.format = VX_DF_IMAGE_U8;
         }
     }
-    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+    else if (cmd == ago_kernel_cmd_initialize) {
+        if (node->paramList[2]->u.remap.table_format == VX_REMAP_TABLE_FORMAT_AMD_FAST)
+            node->localDataSize = agoRemapTableLocalDataSize(node->paramList[2]);
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_shutdown) {
         status = VX_SUCCESS;
     }
 #if ENABLE_OPENCL
@@ -20516,47 +21483,188 @@ int agoKernel_ScaleImage_U8_U8_Area(AgoNode * node, AgoKernelCommand cmd)
         node->opencl_code += code;
         node->opencl_type = NODE_OPENCL_TYPE_MEM2REG;
     }
-#endif
+#endif
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+#if ENABLE_OPENCL
+                    | AGO_KERNEL_FLAG_DEVICE_GPU | AGO_KERNEL_FLAG_GPU_INTEG_M2R
+#elif ENABLE_HIP
+                    | AGO_KERNEL_FLAG_DEVICE_GPU
+#endif
+                    ;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_valid_rect_callback) {
+        AgoData * inp = node->paramList[0];
+        AgoData * out = node->paramList[1];
+        vx_float32 widthOut = (vx_float32)out->u.img.width;
+        vx_float32 heightOut = (vx_float32)out->u.img.height;
+        vx_float32 widthIn = (vx_float32)inp->u.img.width;
+        vx_float32 heightIn = (vx_float32)inp->u.img.height;
+        out->u.img.rect_valid.start_x = (vx_uint32)(((inp->u.img.rect_valid.start_x + 0.5f) * widthOut / widthIn) - 0.5f);
+        out->u.img.rect_valid.start_y = (vx_uint32)(((inp->u.img.rect_valid.start_y + 0.5f) * heightOut / heightIn) - 0.5f);
+        out->u.img.rect_valid.end_x = (vx_uint32)(((inp->u.img.rect_valid.end_x + 0.5f) * widthOut / widthIn) - 0.5f);
+        out->u.img.rect_valid.end_y = (vx_uint32)(((inp->u.img.rect_valid.end_y + 0.5f) * heightOut / heightIn) - 0.5f);
+    }
+#if ENABLE_HIP
+    else if (cmd == ago_kernel_cmd_hip_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        if (HipExec_ScaleImage_U8_U8_Area(
+            node->hip_stream0, oImg->u.img.width, oImg->u.img.height,
+            oImg->hip_memory + oImg->gpu_buffer_offset,oImg->u.img.stride_in_bytes,
+            iImg->u.img.width, iImg->u.img.height,
+            iImg->hip_memory + iImg->gpu_buffer_offset, iImg->u.img.stride_in_bytes)) {
+            status = VX_FAILURE;
+        }
+    }
+#endif
+    return status;
+}
+
+// scale image kernels for fixed downscale ratios: the CPU path uses ratio specific kernels and
+// the remaining commands are handled by the generic kernel of the same interpolation type
+static int agoKernel_ScaleImage_U8_U8_Ratio(AgoNode * node, AgoKernelCommand cmd, vx_uint32 num, vx_uint32 den,
+    int(*cpuFunc)(vx_uint32, vx_uint32, vx_uint8 *, vx_uint32, vx_uint8 *, vx_uint32),
+    int(*genericKernel)(AgoNode *, AgoKernelCommand))
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        if (cpuFunc(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes, iImg->buffer, iImg->u.img.stride_in_bytes)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Img_1OUT_1IN(node, VX_DF_IMAGE_U8, VX_DF_IMAGE_U8);
+        if (!status) {
+            AgoData * oImg = node->paramList[0];
+            AgoData * iImg = node->paramList[1];
+            if (iImg->u.img.width * num != oImg->u.img.width * den || iImg->u.img.height * num != oImg->u.img.height * den)
+                return VX_ERROR_INVALID_DIMENSION;
+            vx_meta_format meta;
+            meta = &node->metaList[0];
+            meta->data.u.img.width = oImg->u.img.width;
+            meta->data.u.img.height = oImg->u.img.height;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else {
+        status = genericKernel(node, cmd);
+    }
+    return status;
+}
+
+int agoKernel_ScaleImage_U8_U8_Area_Half(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_U8_U8_Ratio(node, cmd, 1, 2, HafCpu_ScaleImage_U8_U8_Area_Half, agoKernel_ScaleImage_U8_U8_Area);
+}
+
+int agoKernel_ScaleImage_U8_U8_Area_Third(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_U8_U8_Ratio(node, cmd, 1, 3, HafCpu_ScaleImage_U8_U8_Area_Third, agoKernel_ScaleImage_U8_U8_Area);
+}
+
+int agoKernel_ScaleImage_U8_U8_Area_Quarter(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_U8_U8_Ratio(node, cmd, 1, 4, HafCpu_ScaleImage_U8_U8_Area_Quarter, agoKernel_ScaleImage_U8_U8_Area);
+}
+
+int agoKernel_ScaleImage_U8_U8_Area_TwoThirds(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_U8_U8_Ratio(node, cmd, 2, 3, HafCpu_ScaleImage_U8_U8_Area_TwoThirds, agoKernel_ScaleImage_U8_U8_Area);
+}
+
+int agoKernel_ScaleImage_U8_U8_Bilinear_Half(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_U8_U8_Ratio(node, cmd, 1, 2, HafCpu_ScaleImage_U8_U8_Bilinear_Half, agoKernel_ScaleImage_U8_U8_Bilinear);
+}
+
+int agoKernel_ScaleImage_U8_U8_Bilinear_Third(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_U8_U8_Ratio(node, cmd, 1, 3, HafCpu_ScaleImage_U8_U8_Bilinear_Third, agoKernel_ScaleImage_U8_U8_Bilinear);
+}
+
+int agoKernel_ScaleImage_U8_U8_Bilinear_Quarter(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_U8_U8_Ratio(node, cmd, 1, 4, HafCpu_ScaleImage_U8_U8_Bilinear_Quarter, agoKernel_ScaleImage_U8_U8_Bilinear);
+}
+
+int agoKernel_ScaleImage_U8_U8_Bilinear_TwoThirds(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_U8_U8_Ratio(node, cmd, 2, 3, HafCpu_ScaleImage_U8_U8_Bilinear_TwoThirds, agoKernel_ScaleImage_U8_U8_Bilinear);
+}
+
+// fused 1/2 and 1/4 downscale of the same input (CPU only)
+static int agoKernel_ScaleImage_U8U8_U8_HalfQuarter(AgoNode * node, AgoKernelCommand cmd,
+    int(*cpuFunc)(vx_uint32, vx_uint32, vx_uint8 *, vx_uint32, vx_uint8 *, vx_uint32, vx_uint8 *, vx_uint32))
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImg1 = node->paramList[0];
+        AgoData * oImg2 = node->paramList[1];
+        AgoData * iImg = node->paramList[2];
+        if (cpuFunc(oImg1->u.img.width, oImg1->u.img.height, oImg1->buffer, oImg1->u.img.stride_in_bytes,
+            oImg2->buffer, oImg2->u.img.stride_in_bytes, iImg->buffer, iImg->u.img.stride_in_bytes))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Img_2OUT_1IN(node, VX_DF_IMAGE_U8, VX_DF_IMAGE_U8, VX_DF_IMAGE_U8);
+        if (!status) {
+            AgoData * iImg = node->paramList[2];
+            if ((iImg->u.img.width & 3) || (iImg->u.img.height & 3) ||
+                node->paramList[0]->u.img.width * 2 != iImg->u.img.width || node->paramList[0]->u.img.height * 2 != iImg->u.img.height ||
+                node->paramList[1]->u.img.width * 4 != iImg->u.img.width || node->paramList[1]->u.img.height * 4 != iImg->u.img.height)
+                return VX_ERROR_INVALID_DIMENSION;
+            for (int i = 0; i < 2; i++) {
+                vx_meta_format meta;
+                meta = &node->metaList[i];
+                meta->data.u.img.width = node->paramList[i]->u.img.width;
+                meta->data.u.img.height = node->paramList[i]->u.img.height;
+            }
+        }
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
     else if (cmd == ago_kernel_cmd_query_target_support) {
         node->target_support_flags = 0
                     | AGO_KERNEL_FLAG_DEVICE_CPU
-#if ENABLE_OPENCL
-                    | AGO_KERNEL_FLAG_DEVICE_GPU | AGO_KERNEL_FLAG_GPU_INTEG_M2R
-#elif ENABLE_HIP
-                    | AGO_KERNEL_FLAG_DEVICE_GPU
-#endif
                     ;
         status = VX_SUCCESS;
     }
     else if (cmd == ago_kernel_cmd_valid_rect_callback) {
-        AgoData * inp = node->paramList[0];
-        AgoData * out = node->paramList[1];
-        vx_float32 widthOut = (vx_float32)out->u.img.width;
-        vx_float32 heightOut = (vx_float32)out->u.img.height;
-        vx_float32 widthIn = (vx_float32)inp->u.img.width;
-        vx_float32 heightIn = (vx_float32)inp->u.img.height;
-        out->u.img.rect_valid.start_x = (vx_uint32)(((inp->u.img.rect_valid.start_x + 0.5f) * widthOut / widthIn) - 0.5f);
-        out->u.img.rect_valid.start_y = (vx_uint32)(((inp->u.img.rect_valid.start_y + 0.5f) * heightOut / heightIn) - 0.5f);
-        out->u.img.rect_valid.end_x = (vx_uint32)(((inp->u.img.rect_valid.end_x + 0.5f) * widthOut / widthIn) - 0.5f);
-        out->u.img.rect_valid.end_y = (vx_uint32)(((inp->u.img.rect_valid.end_y + 0.5f) * heightOut / heightIn) - 0.5f);
-    }
-#if ENABLE_HIP
-    else if (cmd == ago_kernel_cmd_hip_execute) {
-        status = VX_SUCCESS;
-        AgoData * oImg = node->paramList[0];
-        AgoData * iImg = node->paramList[1];
-        if (HipExec_ScaleImage_U8_U8_Area(
-            node->hip_stream0, oImg->u.img.width, oImg->u.img.height,
-            oImg->hip_memory + oImg->gpu_buffer_offset,oImg->u.img.stride_in_bytes,
-            iImg->u.img.width, iImg->u.img.height,
-            iImg->hip_memory + iImg->gpu_buffer_offset, iImg->u.img.stride_in_bytes)) {
-            status = VX_FAILURE;
+        AgoData * inp = node->paramList[2];
+        for (vx_uint32 i = 0, scale = 2; i < 2; i++, scale *= 2) {
+            AgoData * out = node->paramList[i];
+            out->u.img.rect_valid.start_x = (inp->u.img.rect_valid.start_x + scale - 1) / scale;
+            out->u.img.rect_valid.start_y = (inp->u.img.rect_valid.start_y + scale - 1) / scale;
+            out->u.img.rect_valid.end_x = inp->u.img.rect_valid.end_x / scale;
+            out->u.img.rect_valid.end_y = inp->u.img.rect_valid.end_y / scale;
         }
     }
-#endif
     return status;
 }
 
+int agoKernel_ScaleImage_U8U8_U8_Area_HalfQuarter(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_U8U8_U8_HalfQuarter(node, cmd, HafCpu_ScaleImage_U8U8_U8_Area_HalfQuarter);
+}
+
+int agoKernel_ScaleImage_U8U8_U8_Bilinear_HalfQuarter(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_U8U8_U8_HalfQuarter(node, cmd, HafCpu_ScaleImage_U8U8_U8_Bilinear_HalfQuarter);
+}
+
 int agoKernel_OpticalFlowPyrLK_XY_XY(AgoNode * node, AgoKernelCommand cmd)
 {
     vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
@@ -20931,23 +22039,118 @@ int agoKernel_CannyEdgeTrace_U8_U8XY(AgoNode * node, AgoKernelCommand cmd)
     return status;
 }
 
+#define AGO_INTEGRAL_IMAGE_MIN_PIXELS_PER_STRIP  (256*1024) // smaller images are processed as a single strip
+static vx_uint32 agoIntegralImageStrips(vx_uint32 width, vx_uint32 height, vx_uint32 * stripHeight)
+{
+    vx_uint32 numStrips = std::min(agoGetCpuThreadCount(), (vx_uint32)(((vx_uint64)width * height) / AGO_INTEGRAL_IMAGE_MIN_PIXELS_PER_STRIP));
+    if (numStrips < 2)
+        return 1;
+    *stripHeight = (height + numStrips - 1) / numStrips;
+    return (height + *stripHeight - 1) / *stripHeight;
+}
+
+// integral image of large images in strips: pass 1 computes local sums of each strip in parallel,
+// pass 2 adds the carry row of the strips above to each strip in parallel
+template <typename T>
+static vx_status agoIntegralImageExecute(AgoNode * node,
+    int (*integral)(vx_uint32, vx_uint32, T *, vx_uint32, vx_uint8 *, vx_uint32),
+    int (*integralStrip)(vx_uint32, vx_uint32, T *, vx_uint32, vx_uint8 *, vx_uint32),
+    int (*integralCarry)(vx_uint32, vx_uint32, T *, vx_uint32, T *))
+{
+    AgoData * oImg = node->paramList[0];
+    AgoData * iImg = node->paramList[1];
+    vx_uint32 width = oImg->u.img.width, height = oImg->u.img.height;
+    vx_uint32 stripHeight = height, numStrips = agoIntegralImageStrips(width, height, &stripHeight);
+    vx_uint8 * carryRows = node->localDataPtr;
+    vx_uint32 carryStrideInBytes = ALIGN32(width * sizeof(T));
+    if (!carryRows || numStrips < 2 || (vx_size)(numStrips - 1) * carryStrideInBytes > node->localDataSize) {
+        if (integral(width, height, (T *)oImg->buffer, oImg->u.img.stride_in_bytes, iImg->buffer, iImg->u.img.stride_in_bytes))
+            return VX_FAILURE;
+        return VX_SUCCESS;
+    }
+    vx_uint32 oStride = oImg->u.img.stride_in_bytes, iStride = iImg->u.img.stride_in_bytes;
+    // pass 1: local integral image of each strip in parallel
+    agoParallelFor(numStrips, [&](vx_size strip) {
+        vx_uint32 y = (vx_uint32)strip * stripHeight, h = std::min(stripHeight, height - y);
+        integralStrip(width, h, (T *)(oImg->buffer + y * oStride), oStride, iImg->buffer + y * iStride, iStride);
+    });
+    // carry of each strip is the sum of last rows of all the strips above it
+    for (vx_uint32 strip = 0; strip < numStrips - 1; strip++) {
+        T * carry = (T *)(carryRows + strip * carryStrideInBytes);
+        vx_uint32 yLast = (strip + 1) * stripHeight - 1;
+        memcpy(carry, oImg->buffer + yLast * oStride, width * sizeof(T));
+        if (strip > 0) {
+            integralCarry(width, 1, carry, carryStrideInBytes, (T *)((vx_uint8 *)carry - carryStrideInBytes));
+        }
+    }
+    // pass 2: add carry to each strip below the first one in parallel
+    agoParallelFor(numStrips - 1, [&](vx_size index) {
+        vx_uint32 strip = (vx_uint32)index + 1;
+        vx_uint32 y = strip * stripHeight, h = std::min(stripHeight, height - y);
+        integralCarry(width, h, (T *)(oImg->buffer + y * oStride), oStride, (T *)(carryRows + index * carryStrideInBytes));
+    });
+    return VX_SUCCESS;
+}
+
+static void agoIntegralImageInitialize(AgoNode * node, vx_size pixelSize)
+{
+    // split large images into horizontal strips processed by multiple threads
+    vx_uint32 width = node->paramList[0]->u.img.width, height = node->paramList[0]->u.img.height;
+    vx_uint32 stripHeight = height, numStrips = agoIntegralImageStrips(width, height, &stripHeight);
+    node->localDataSize = 0;
+    if (numStrips > 1) {
+        // one carry row per strip boundary
+        node->localDataSize = (numStrips - 1) * ALIGN32(width * pixelSize);
+    }
+}
+
 int agoKernel_IntegralImage_U32_U8(AgoNode * node, AgoKernelCommand cmd)
 {
     vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
     if (cmd == ago_kernel_cmd_execute) {
-        status = VX_SUCCESS;
-        AgoData * oImg = node->paramList[0];
-        AgoData * iImg = node->paramList[1];
-        if (HafCpu_IntegralImage_U32_U8(oImg->u.img.width, oImg->u.img.height, (vx_uint32 *)oImg->buffer, oImg->u.img.stride_in_bytes,
-                                        iImg->buffer, iImg->u.img.stride_in_bytes))
-        {
-            status = VX_FAILURE;
-        }
+        status = agoIntegralImageExecute<vx_uint32>(node, HafCpu_IntegralImage_U32_U8, HafCpu_IntegralImageStrip_U32_U8, HafCpu_IntegralImageCarry_U32);
     }
     else if (cmd == ago_kernel_cmd_validate) {
         status = ValidateArguments_Img_1OUT_1IN(node, VX_DF_IMAGE_U32, VX_DF_IMAGE_U8);
     }
-    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+    else if (cmd == ago_kernel_cmd_initialize) {
+        agoIntegralImageInitialize(node, sizeof(vx_uint32));
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_valid_rect_callback) {
+        AgoData * out = node->paramList[0];
+        AgoData * inp = node->paramList[1];
+        out->u.img.rect_valid.start_x = inp->u.img.rect_valid.start_x;
+        out->u.img.rect_valid.start_y = inp->u.img.rect_valid.start_y;
+        out->u.img.rect_valid.end_x = inp->u.img.rect_valid.end_x;
+        out->u.img.rect_valid.end_y = inp->u.img.rect_valid.end_y;
+    }
+    return status;
+}
+
+int agoKernel_IntegralImage_U64_U8(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = agoIntegralImageExecute<vx_uint64>(node, HafCpu_IntegralImage_U64_U8, HafCpu_IntegralImageStrip_U64_U8, HafCpu_IntegralImageCarry_U64);
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Img_1OUT_1IN(node, VX_DF_IMAGE_U64_AMD, VX_DF_IMAGE_U8);
+    }
+    else if (cmd == ago_kernel_cmd_initialize) {
+        agoIntegralImageInitialize(node, sizeof(vx_uint64));
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_shutdown) {
         status = VX_SUCCESS;
     }
     else if (cmd == ago_kernel_cmd_query_target_support) {
@@ -22599,4 +23802,242 @@ int agoKernel_LaplacianReconstruct_DATA_DATA_DATA(AgoNode * node, AgoKernelComma
         status = VX_SUCCESS;
     }
     return status;
-}
\ No newline at end of file
+}
+static void agoGetTensorBroadcastStride(AgoData * out, AgoData * in, vx_size * stride)
+{
+    // use zero stride along the dimensions that input broadcasts to the output
+    for (vx_size i = 0; i < AGO_MAX_TENSOR_DIMENSIONS; i++)
+        stride[i] = (in->u.tensor.dims[i] == 1 && out->u.tensor.dims[i] != 1) ? 0 : in->u.tensor.stride[i];
+}
+
+int agoKernel_TensorAdd_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor1 = node->paramList[1];
+        AgoData * iTensor2 = node->paramList[2];
+        vx_size src2Stride[AGO_MAX_TENSOR_DIMENSIONS];
+        agoGetTensorBroadcastStride(oTensor, iTensor2, src2Stride);
+        if (HafCpu_TensorAdd_DATA_DATA_DATA(oTensor->u.tensor.data_type, node->paramList[3]->u.scalar.u.e, oTensor->u.tensor.dims,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor1->buffer, iTensor1->u.tensor.stride, iTensor2->buffer, src2Stride))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_AddSub(node, 0, 1, 2, 3);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorSubtract_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor1 = node->paramList[1];
+        AgoData * iTensor2 = node->paramList[2];
+        vx_size src2Stride[AGO_MAX_TENSOR_DIMENSIONS];
+        agoGetTensorBroadcastStride(oTensor, iTensor2, src2Stride);
+        if (HafCpu_TensorSubtract_DATA_DATA_DATA(oTensor->u.tensor.data_type, node->paramList[3]->u.scalar.u.e, oTensor->u.tensor.dims,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor1->buffer, iTensor1->u.tensor.stride, iTensor2->buffer, src2Stride))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_AddSub(node, 0, 1, 2, 3);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorMultiply_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor1 = node->paramList[1];
+        AgoData * iTensor2 = node->paramList[2];
+        vx_size src2Stride[AGO_MAX_TENSOR_DIMENSIONS];
+        agoGetTensorBroadcastStride(oTensor, iTensor2, src2Stride);
+        if (HafCpu_TensorMultiply_DATA_DATA_DATA(oTensor->u.tensor.data_type, oTensor->u.tensor.fixed_point_pos,
+                node->paramList[3]->u.scalar.u.f, node->paramList[4]->u.scalar.u.e, node->paramList[5]->u.scalar.u.e, oTensor->u.tensor.dims,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor1->buffer, iTensor1->u.tensor.stride, iTensor2->buffer, src2Stride))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_Multiply(node, 0, 1, 2, 3, 4, 5);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorTableLookup_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor = node->paramList[1];
+        AgoData * iLut = node->paramList[2];
+        if (HafCpu_TensorTableLookup_DATA_DATA(oTensor->u.tensor.data_type, oTensor->u.tensor.dims, oTensor->buffer, oTensor->u.tensor.stride,
+                iTensor->buffer, iTensor->u.tensor.stride, iLut->buffer, (vx_uint32)iLut->u.lut.count, iLut->u.lut.offset))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_TableLookup(node, 0, 1, 2);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorTranspose_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor = node->paramList[1];
+        if (HafCpu_TensorTranspose_DATA_DATA(agoType2Size(node->ref.context, oTensor->u.tensor.data_type), oTensor->u.tensor.dims,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor->buffer, iTensor->u.tensor.stride,
+                node->paramList[2]->u.scalar.u.s, node->paramList[3]->u.scalar.u.s))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_Transpose(node, 0, 1, 2, 3);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorConvertDepth_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor = node->paramList[1];
+        if (HafCpu_TensorConvertDepth_DATA_DATA(oTensor->u.tensor.data_type, oTensor->u.tensor.fixed_point_pos,
+                iTensor->u.tensor.data_type, iTensor->u.tensor.fixed_point_pos, node->paramList[2]->u.scalar.u.e,
+                node->paramList[3]->u.scalar.u.f, node->paramList[4]->u.scalar.u.f, oTensor->u.tensor.dims,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor->buffer, iTensor->u.tensor.stride))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_ConvertDepth(node, 0, 1, 2, 3, 4);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorMatrixMultiply_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor1 = node->paramList[1];
+        AgoData * iTensor2 = node->paramList[2];
+        AgoData * iTensor3 = node->paramList[3];
+        vx_tensor_matrix_multiply_params_t params;
+        agoGetTensorMatrixMultiplyParams(node->paramList[4], &params);
+        vx_size M = oTensor->u.tensor.dims[1], N = oTensor->u.tensor.dims[0];
+        vx_size K = params.transpose_input1 ? iTensor1->u.tensor.dims[1] : iTensor1->u.tensor.dims[0];
+        if (HafCpu_TensorMatrixMultiply_DATA_DATA_DATA(oTensor->u.tensor.data_type, oTensor->u.tensor.fixed_point_pos, M, N, K,
+                oTensor->buffer, oTensor->u.tensor.stride,
+                iTensor1->buffer, iTensor1->u.tensor.stride, params.transpose_input1 ? true : false,
+                iTensor2->buffer, iTensor2->u.tensor.stride, params.transpose_input2 ? true : false,
+                iTensor3 ? iTensor3->buffer : nullptr, iTensor3 ? iTensor3->u.tensor.stride : nullptr, params.transpose_input3 ? true : false,
+                node->localDataPtr))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Tensor_MatrixMultiply(node, 0, 1, 2, 3, 4);
+    }
+    else if (cmd == ago_kernel_cmd_initialize) {
+        // scratch memory for input1 packed as M x K and input2 packed as K x N
+        AgoData * iTensor1 = node->paramList[1];
+        vx_tensor_matrix_multiply_params_t params;
+        agoGetTensorMatrixMultiplyParams(node->paramList[4], &params);
+        vx_size M = node->paramList[0]->u.tensor.dims[1], N = node->paramList[0]->u.tensor.dims[0];
+        vx_size K = params.transpose_input1 ? iTensor1->u.tensor.dims[1] : iTensor1->u.tensor.dims[0];
+        bool isFloat = (iTensor1->u.tensor.data_type == VX_TYPE_FLOAT32 || iTensor1->u.tensor.data_type == VX_TYPE_FLOAT16);
+        vx_size packedElemSize = isFloat ? sizeof(vx_float32) : sizeof(vx_int16);
+        node->localDataSize = ALIGN32(M * K * packedElemSize) + ALIGN32(K * N * packedElemSize);
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
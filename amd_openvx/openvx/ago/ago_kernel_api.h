@@ -78,6 +78,13 @@ int ovxKernel_WeightedAverage(AgoNode * node, AgoKernelCommand cmd);
 int ovxKernel_NonLinearFilter(AgoNode * node, AgoKernelCommand cmd);
 int ovxKernel_LaplacianPyramid(AgoNode * node, AgoKernelCommand cmd);
 int ovxKernel_LaplacianReconstruct(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorAdd(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorSubtract(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorMultiply(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorTableLookup(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorTranspose(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorConvertDepth(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorMatrixMultiply(AgoNode * node, AgoKernelCommand cmd);
 // AMD low-level kernels
 int agoKernel_Set00_U8(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_SetFF_U8(AgoNode * node, AgoKernelCommand cmd);
@@ -252,6 +259,15 @@ int agoKernel_ColorConvert_IUV_RGB(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_ColorConvert_IUV_RGBX(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_ColorConvert_UV12_RGB(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_ColorConvert_UV12_RGBX(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ColorConvert_RGB_P016(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ColorConvert_RGBX_P016(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ColorConvert_P010_RGB(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ColorConvert_P010_RGBX(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ColorConvert_P016_RGB(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ColorConvert_P016_RGBX(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_FormatConvert_NV12_P016(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_FormatConvert_P010_NV12(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_FormatConvert_P016_NV12(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_Box_U8_U8_3x3(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_Dilate_U8_U8_3x3(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_Erode_U8_U8_3x3(AgoNode * node, AgoKernelCommand cmd);
@@ -262,6 +278,8 @@ int agoKernel_ScaleGaussianHalf_U8_U8_5x5(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_ScaleGaussianOrb_U8_U8_5x5(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_Convolve_U8_U8(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_Convolve_S16_U8(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ConvolveSeparable_U8_U8(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ConvolveSeparable_S16_U8(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_LinearFilter_ANY_ANY(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_LinearFilter_ANYx2_ANY(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_SobelMagnitude_S16_U8_3x3(AgoNode * node, AgoKernelCommand cmd);
@@ -326,6 +344,16 @@ int agoKernel_ScaleImage_U8_U8_Bilinear(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_ScaleImage_U8_U8_Bilinear_Replicate(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_ScaleImage_U8_U8_Bilinear_Constant(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_ScaleImage_U8_U8_Area(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U8_U8_Area_Half(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U8_U8_Area_Third(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U8_U8_Area_Quarter(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U8_U8_Area_TwoThirds(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U8_U8_Bilinear_Half(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U8_U8_Bilinear_Third(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U8_U8_Bilinear_Quarter(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U8_U8_Bilinear_TwoThirds(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U8U8_U8_Area_HalfQuarter(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U8U8_U8_Bilinear_HalfQuarter(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_OpticalFlowPyrLK_XY_XY(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_OpticalFlowPrepareLK_XY_XY(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_OpticalFlowImageLK_XY_XY(AgoNode * node, AgoKernelCommand cmd);
@@ -336,6 +364,7 @@ int agoKernel_FastCornerMerge_XY_XY(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_CannyEdgeTrace_U8_U8(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_CannyEdgeTrace_U8_U8XY(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_IntegralImage_U32_U8(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_IntegralImage_U64_U8(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_Histogram_DATA_U8(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_MeanStdDev_DATA_U8(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_MeanStdDev_DATA_U1(AgoNode * node, AgoKernelCommand cmd);
@@ -368,5 +397,12 @@ int agoKernel_WeightedAverage_U8_U8_U8(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_NonLinearFilter_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_LaplacianPyramid_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_LaplacianReconstruct_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorAdd_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorSubtract_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorMultiply_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorTableLookup_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorTranspose_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorConvertDepth_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorMatrixMultiply_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
 #endif // __ago_kernels_api_h__
 
@@ -34,6 +34,7 @@ THE SOFTWARE.
 #define AINx3_AOUT                             { AIN, AIN, AIN, AOUT }
 #define AINx4_AOUT                             { AIN, AIN, AIN, AIN, AOUT }
 #define AINx5_AOUT                             { AIN, AIN, AIN, AIN, AIN, AOUT }
+#define AINx2_AOPTIN_AIN_AOUT                  { AIN, AIN, AOPTIN, AIN, AOUT }
 #define AINx2_AOPTINx2_AOUT                    { AIN, AIN, AOPTIN, AOPTIN, AOUT }
 #define AIN_AOPTOUTx2                          { AIN, AOPTOUT, AOPTOUT }
 #define AIN_AOUT_AIN                           { AIN, AOUT, AIN }
@@ -51,6 +52,8 @@ THE SOFTWARE.
 #define AOUT_AINx2_AOPTIN                      { AOUT, AIN, AIN, AOPTIN }
 #define AOUT_AINx3                             { AOUT, AIN, AIN, AIN }
 #define AOUT_AINx4                             { AOUT, AIN, AIN, AIN, AIN }
+#define AOUT_AINx5                             { AOUT, AIN, AIN, AIN, AIN, AIN }
+#define AOUT_AINx2_AOPTIN_AIN                  { AOUT, AIN, AIN, AOPTIN, AIN }
 #define AOUT_AINx8                             { AOUT, AIN, AIN, AIN, AIN, AIN, AIN, AIN, AIN }
 #define AOUT_AINx9                             { AOUT, AIN, AIN, AIN, AIN, AIN, AIN, AIN, AIN, AIN }
 #define AOUTx2_AIN                             { AOUT, AOUT, AIN }
@@ -150,6 +153,17 @@ THE SOFTWARE.
 #define ATYPE_SRRR                             { VX_TYPE_SCALAR, VX_TYPE_REFERENCE, VX_TYPE_REFERENCE, VX_TYPE_REFERENCE }
 #define ATYPE_RSRR                             { VX_TYPE_REFERENCE, VX_TYPE_SCALAR, VX_TYPE_REFERENCE, VX_TYPE_REFERENCE }
 #define ATYPE_IMIS                             { VX_TYPE_IMAGE, VX_TYPE_MATRIX, VX_TYPE_IMAGE, VX_TYPE_SCALAR }
+#define ATYPE_NNSN                             { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_TENSOR }
+#define ATYPE_NNSSSN                           { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_TENSOR }
+#define ATYPE_NLN                              { VX_TYPE_TENSOR, VX_TYPE_LUT, VX_TYPE_TENSOR }
+#define ATYPE_NNSS                             { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR }
+#define ATYPE_NSSSN                            { VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_TENSOR }
+#define ATYPE_NNNSN                            { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_TENSOR }
+#define ATYPE_NNNS                             { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR }
+#define ATYPE_NNNSSS                           { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_SCALAR }
+#define ATYPE_NNL                              { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_LUT }
+#define ATYPE_NNSSS                            { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_SCALAR }
+#define ATYPE_NNNNS                            { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR }
 
 // for kernOpType & kernOpInfo
 #define KOP_UNKNOWN    AGO_KERNEL_OP_TYPE_UNKNOWN,         0,
@@ -173,6 +187,12 @@ static struct {
 		AGO_KERNEL_FLAG_GROUP_OVX10 | \
 		(validRectReset ? AGO_KERNEL_FLAG_VALID_RECT_RESET : 0), argCfg, argType \
 	}
+#define OVX_KERNEL_ENTRY_OVERRIDABLE(kernel_id,name,kname,argCfg,argType,validRectReset) \
+	{                                                               \
+		kernel_id, ovxKernel_ ## name, "org.khronos.openvx." kname, \
+		AGO_KERNEL_FLAG_GROUP_OVX10 | AGO_KERNEL_FLAG_OVERRIDABLE | \
+		(validRectReset ? AGO_KERNEL_FLAG_VALID_RECT_RESET : 0), argCfg, argType \
+	}
 #define AGO_KERNEL_ENTRY(kernel_id,cpu_avail,gpu_avail,name,argCfg,argType,kernOp,validRectReset) \
 	{                                                               \
 		kernel_id, agoKernel_ ## name, "com.amd.openvx." #name,     \
@@ -227,6 +247,14 @@ static struct {
 	OVX_KERNEL_ENTRY( VX_KERNEL_NON_LINEAR_FILTER     , NonLinearFilter, "non_linear_filter",      		AINx3_AOUT,	     	  ATYPE_SIMI         , false ),	
 	OVX_KERNEL_ENTRY( VX_KERNEL_LAPLACIAN_PYRAMID     , LaplacianPyramid, "laplacian_pyramid",     		AINx2_AOUT,	     	  ATYPE_IPI        	 , false ),	
 	OVX_KERNEL_ENTRY( VX_KERNEL_LAPLACIAN_RECONSTRUCT , LaplacianReconstruct, "laplacian_reconstruct",  AINx2_AOUT,	     	  ATYPE_PII        	 , false ),	
+	// OpenVX 1.2 tensor kernels: user kernels with the same name (e.g., from vx_nn) replace these
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_ADD            , TensorAdd, "tensor_add",                     		AINx3_AOUT,            ATYPE_NNSN        , false ),
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_SUBTRACT       , TensorSubtract, "tensor_subtract",           		AINx3_AOUT,            ATYPE_NNSN        , false ),
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_MULTIPLY       , TensorMultiply, "tensor_multiply",           		AINx5_AOUT,            ATYPE_NNSSSN      , false ),
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_TABLE_LOOKUP   , TensorTableLookup, "tensor_table_lookup",    		AINx2_AOUT,            ATYPE_NLN         , false ),
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_TRANSPOSE      , TensorTranspose, "tensor_transpose",         		AIN_AOUT_AINx2,        ATYPE_NNSS        , false ),
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_CONVERT_DEPTH  , TensorConvertDepth, "tensor_convert_depth",  		AINx4_AOUT,            ATYPE_NSSSN       , false ),
+	OVX_KERNEL_ENTRY_OVERRIDABLE( VX_KERNEL_TENSOR_MATRIX_MULTIPLY, TensorMatrixMultiply, "tensor_matrix_multiply", 		AINx2_AOPTIN_AIN_AOUT, ATYPE_NNNSN       , false ),
 	// AMD low-level kernel primitives
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SET_00_U8                                               , 1, 1, Set00_U8, { AOUT },                                           ATYPE_I                 , KOP_ELEMWISE  , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SET_FF_U8                                               , 1, 1, SetFF_U8, { AOUT },                                           ATYPE_I                 , KOP_ELEMWISE  , false ),
@@ -401,6 +429,15 @@ static struct {
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_COLOR_CONVERT_IUV_RGBX                                  , 1, 1, ColorConvert_IUV_RGBX, AOUTx2_AIN,                            ATYPE_III               , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_COLOR_CONVERT_UV12_RGB                                  , 1, 1, ColorConvert_UV12_RGB, AOUT_AIN,                              ATYPE_II                , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_COLOR_CONVERT_UV12_RGBX                                 , 1, 1, ColorConvert_UV12_RGBX, AOUT_AIN,                             ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_COLOR_CONVERT_RGB_P016                                  , 1, 0, ColorConvert_RGB_P016, AOUT_AINx2,                            ATYPE_III               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_COLOR_CONVERT_RGBX_P016                                 , 1, 0, ColorConvert_RGBX_P016, AOUT_AINx2,                           ATYPE_III               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_COLOR_CONVERT_P010_RGB                                  , 1, 0, ColorConvert_P010_RGB, AOUTx2_AIN,                            ATYPE_III               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_COLOR_CONVERT_P010_RGBX                                 , 1, 0, ColorConvert_P010_RGBX, AOUTx2_AIN,                           ATYPE_III               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_COLOR_CONVERT_P016_RGB                                  , 1, 0, ColorConvert_P016_RGB, AOUTx2_AIN,                            ATYPE_III               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_COLOR_CONVERT_P016_RGBX                                 , 1, 0, ColorConvert_P016_RGBX, AOUTx2_AIN,                           ATYPE_III               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_FORMAT_CONVERT_NV12_P016                                , 1, 0, FormatConvert_NV12_P016, AOUTx2_AINx2,                        ATYPE_IIII              , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_FORMAT_CONVERT_P010_NV12                                , 1, 0, FormatConvert_P010_NV12, AOUTx2_AINx2,                        ATYPE_IIII              , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_FORMAT_CONVERT_P016_NV12                                , 1, 0, FormatConvert_P016_NV12, AOUTx2_AINx2,                        ATYPE_IIII              , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_BOX_U8_U8_3x3                                           , 1, 1, Box_U8_U8_3x3, AOUT_AIN,                                      ATYPE_II                , KOP_FIXED(3)  , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_DILATE_U8_U8_3x3                                        , 1, 1, Dilate_U8_U8_3x3, AOUT_AIN,                                   ATYPE_II                , KOP_FIXED(3)  , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_ERODE_U8_U8_3x3                                         , 1, 1, Erode_U8_U8_3x3, AOUT_AIN,                                    ATYPE_II                , KOP_FIXED(3)  , false ),
@@ -410,7 +447,9 @@ static struct {
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_GAUSSIAN_HALF_U8_U8_5x5                           , 1, 1, ScaleGaussianHalf_U8_U8_5x5, AOUT_AIN,                        ATYPE_II                , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_GAUSSIAN_ORB_U8_U8_5x5                            , 1, 1, ScaleGaussianOrb_U8_U8_5x5, AOUT_AIN,                         ATYPE_II                , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_CONVOLVE_U8_U8                                          , 1, 1, Convolve_U8_U8, AOUT_AINx2,                                   ATYPE_IIC               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_CONVOLVE_SEPARABLE_U8_U8                                , 1, 1, ConvolveSeparable_U8_U8, AOUT_AINx2,                          ATYPE_IIC               , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_CONVOLVE_S16_U8                                         , 1, 1, Convolve_S16_U8, AOUT_AINx2,                                  ATYPE_IIC               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_CONVOLVE_SEPARABLE_S16_U8                               , 1, 1, ConvolveSeparable_S16_U8, AOUT_AINx2,                         ATYPE_IIC               , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_LINEAR_FILTER_ANY_ANY                                   , 1, 1, LinearFilter_ANY_ANY, AOUT_AINx2,                             ATYPE_IIM               , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_LINEAR_FILTER_ANYx2_ANY                                 , 1, 1, LinearFilter_ANYx2_ANY, AOUTx2_AINx3,                         ATYPE_IIIMM             , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SOBEL_MAGNITUDE_S16_U8_3x3                              , 1, 1, SobelMagnitude_S16_U8_3x3, AOUT_AIN,                          ATYPE_II                , KOP_FIXED(3)  , false ),
@@ -475,6 +514,16 @@ static struct {
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_REPLICATE                    , 1, 1, ScaleImage_U8_U8_Bilinear_Replicate, AOUT_AIN,                ATYPE_II                , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_CONSTANT                     , 1, 1, ScaleImage_U8_U8_Bilinear_Constant, AOUT_AINx2,               ATYPE_IIS               , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA                                  , 1, 1, ScaleImage_U8_U8_Area, AOUT_AIN,                              ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_HALF                             , 1, 1, ScaleImage_U8_U8_Area_Half, AOUT_AIN,                         ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_THIRD                            , 1, 1, ScaleImage_U8_U8_Area_Third, AOUT_AIN,                        ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_QUARTER                          , 1, 1, ScaleImage_U8_U8_Area_Quarter, AOUT_AIN,                      ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_TWO_THIRDS                       , 1, 1, ScaleImage_U8_U8_Area_TwoThirds, AOUT_AIN,                    ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_HALF                         , 1, 1, ScaleImage_U8_U8_Bilinear_Half, AOUT_AIN,                     ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_THIRD                        , 1, 1, ScaleImage_U8_U8_Bilinear_Third, AOUT_AIN,                    ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_QUARTER                      , 1, 1, ScaleImage_U8_U8_Bilinear_Quarter, AOUT_AIN,                  ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_TWO_THIRDS                   , 1, 1, ScaleImage_U8_U8_Bilinear_TwoThirds, AOUT_AIN,                ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8U8_U8_AREA_HALF_QUARTER                   , 1, 0, ScaleImage_U8U8_U8_Area_HalfQuarter, AOUTx2_AIN,              ATYPE_III               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U8U8_U8_BILINEAR_HALF_QUARTER               , 1, 0, ScaleImage_U8U8_U8_Bilinear_HalfQuarter, AOUTx2_AIN,          ATYPE_III               , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_OPTICAL_FLOW_PYR_LK_XY_XY                               , 1, 1, OpticalFlowPyrLK_XY_XY, AOUT_AINx9,                           ATYPE_APPAASSSSS        , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_OPTICAL_FLOW_PREPARE_LK_XY_XY                           , 1, 1, OpticalFlowPrepareLK_XY_XY, AOUT_AINx4,                       ATYPE_AAAAS             , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_OPTICAL_FLOW_IMAGE_LK_XY_XY                             , 1, 1, OpticalFlowImageLK_XY_XY, AOUT_AINx8,                         ATYPE_AAIISSSSS         , KOP_UNKNOWN   , false ),
@@ -485,6 +534,7 @@ static struct {
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_CANNY_EDGE_TRACE_U8_U8                                  , 1, 0, CannyEdgeTrace_U8_U8, AINOUT_AIN,                             ATYPE_Ic                , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_CANNY_EDGE_TRACE_U8_U8XY                                , 1, 0, CannyEdgeTrace_U8_U8XY, AINOUT_AIN,                           ATYPE_Ic                , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_INTEGRAL_IMAGE_U32_U8                                   , 1, 0, IntegralImage_U32_U8, AOUT_AIN,                               ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_INTEGRAL_IMAGE_U64_U8                                   , 1, 0, IntegralImage_U64_U8, AOUT_AIN,                               ATYPE_II                , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_HISTOGRAM_DATA_U8                                       , 1, 0, Histogram_DATA_U8, AOUT_AIN,                                  ATYPE_DI                , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_MEAN_STD_DEV_DATA_U8                                    , 1, 0, MeanStdDev_DATA_U8, AOUT_AIN,                                 ATYPE_sI                , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_MEAN_STD_DEV_DATA_U1                                    , 1, 0, MeanStdDev_DATA_U1, AOUT_AIN,                                 ATYPE_sI                , KOP_UNKNOWN   , false ),
@@ -517,11 +567,39 @@ static struct {
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_NON_LINEAR_FILTER_DATA_DATA_DATA                        , 1, 0, NonLinearFilter_DATA_DATA_DATA, AOUT_AINx3,                   ATYPE_IMIS              , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_LAPLACIAN_PYRAMID_DATA_DATA_DATA                        , 1, 0, LaplacianPyramid_DATA_DATA_DATA, AOUT_AINx2,                  ATYPE_IPI               , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_LAPLACIAN_RECONSTRUCT_DATA_DATA_DATA                    , 1, 0, LaplacianReconstruct_DATA_DATA_DATA, AOUT_AINx2,              ATYPE_IIP               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_ADD_DATA_DATA_DATA                               , 1, 0, TensorAdd_DATA_DATA_DATA, AOUT_AINx3,                         ATYPE_NNNS              , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_SUBTRACT_DATA_DATA_DATA                          , 1, 0, TensorSubtract_DATA_DATA_DATA, AOUT_AINx3,                    ATYPE_NNNS              , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_MULTIPLY_DATA_DATA_DATA                          , 1, 0, TensorMultiply_DATA_DATA_DATA, AOUT_AINx5,                    ATYPE_NNNSSS            , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_TABLE_LOOKUP_DATA_DATA                           , 1, 0, TensorTableLookup_DATA_DATA, AOUT_AINx2,                      ATYPE_NNL               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_TRANSPOSE_DATA_DATA                              , 1, 0, TensorTranspose_DATA_DATA, AOUT_AINx3,                        ATYPE_NNSS              , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_CONVERT_DEPTH_DATA_DATA                          , 1, 0, TensorConvertDepth_DATA_DATA, AOUT_AINx4,                     ATYPE_NNSSS             , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_MATRIX_MULTIPLY_DATA_DATA_DATA                   , 1, 0, TensorMatrixMultiply_DATA_DATA_DATA, AOUT_AINx2_AOPTIN_AIN,   ATYPE_NNNNS             , KOP_UNKNOWN   , false ),
 #undef AGO_KERNEL_ENTRY
 #undef OVX_KERNEL_ENTRY
+#undef OVX_KERNEL_ENTRY_OVERRIDABLE
 };
 size_t ago_kernel_count = sizeof(ago_kernel_list) / sizeof(ago_kernel_list[0]);
 
+// built-in pointwise kernels that can write the output in-place over the input:
+// output and input have identical format and every input pixel is read before the
+// corresponding output pixel is written
+static struct {
+	vx_enum id;
+	vx_uint32 outputIndex;
+	vx_uint32 inputIndex;
+} ago_kernel_alias_list[] = {
+	{ VX_KERNEL_AMD_NOT_U8_U8,                   0, 1 },
+	{ VX_KERNEL_AMD_LUT_U8_U8,                   0, 1 },
+	{ VX_KERNEL_AMD_THRESHOLD_U8_U8_BINARY,      0, 1 },
+	{ VX_KERNEL_AMD_THRESHOLD_U8_U8_RANGE,       0, 1 },
+	{ VX_KERNEL_AMD_THRESHOLD_NOT_U8_U8_BINARY,  0, 1 },
+	{ VX_KERNEL_AMD_THRESHOLD_NOT_U8_U8_RANGE,   0, 1 },
+	{ VX_KERNEL_AMD_ADD_U8_U8U8_WRAP,            0, 1 },
+	{ VX_KERNEL_AMD_ADD_U8_U8U8_SAT,             0, 1 },
+	{ VX_KERNEL_AMD_SUB_U8_U8U8_WRAP,            0, 1 },
+	{ VX_KERNEL_AMD_SUB_U8_U8U8_SAT,             0, 1 },
+};
+
 int agoPublishKernels(AgoContext * acontext)
 {
 	int ovxKernelCount = 0;
@@ -557,6 +635,14 @@ int agoPublishKernels(AgoContext * acontext)
 			kernel->parameters[j].state = (kernel->argConfig[j] & AGO_KERNEL_ARG_OPTIONAL_FLAG) ? VX_PARAMETER_STATE_OPTIONAL : VX_PARAMETER_STATE_REQUIRED;
 			kernel->parameters[j].scope = &kernel->ref;
 		}
+		for (vx_size k = 0; k < sizeof(ago_kernel_alias_list) / sizeof(ago_kernel_alias_list[0]); k++) {
+			if (ago_kernel_alias_list[k].id == kernel->id) {
+				vx_uint32 o = ago_kernel_alias_list[k].outputIndex, i = ago_kernel_alias_list[k].inputIndex;
+				kernel->alias_param_index_plus1[o] = i + 1;
+				kernel->alias_param_index_plus1[i] = o + 1;
+				kernel->alias_processing_type[o] = kernel->alias_processing_type[i] = VX_BUFFER_ALIASING_PROCESSING_TYPE_DENSE;
+			}
+		}
 		agoAddKernel(&acontext->kernelList, kernel);
 		int kernelGroup = kernel->flags & AGO_KERNEL_FLAG_GROUP_MASK;
 		if (kernelGroup == AGO_KERNEL_FLAG_GROUP_OVX10) ovxKernelCount++;
@@ -279,7 +279,18 @@ enum vx_kernel_amd_e {
 	VX_KERNEL_AMD_COLOR_CONVERT_UV12_RGB,  // UV plane in NV12 4:2:0
 	VX_KERNEL_AMD_COLOR_CONVERT_UV12_RGBX, // UV plane in NV12 4:2:0
 
-	// Fixed Neighbors: U8 = op U8 (16)
+	// Element-wise n-channel: 10/16-bit YUV 4:2:0 (9)
+	VX_KERNEL_AMD_COLOR_CONVERT_RGB_P016,   // also used for P010
+	VX_KERNEL_AMD_COLOR_CONVERT_RGBX_P016,  // also used for P010
+	VX_KERNEL_AMD_COLOR_CONVERT_P010_RGB,
+	VX_KERNEL_AMD_COLOR_CONVERT_P010_RGBX,
+	VX_KERNEL_AMD_COLOR_CONVERT_P016_RGB,
+	VX_KERNEL_AMD_COLOR_CONVERT_P016_RGBX,
+	VX_KERNEL_AMD_FORMAT_CONVERT_NV12_P016, // also used for P010
+	VX_KERNEL_AMD_FORMAT_CONVERT_P010_NV12,
+	VX_KERNEL_AMD_FORMAT_CONVERT_P016_NV12,
+
+	// Fixed Neighbors: U8 = op U8 (17)
 	VX_KERNEL_AMD_BOX_U8_U8_3x3,
 	VX_KERNEL_AMD_DILATE_U8_U8_3x3,
 	VX_KERNEL_AMD_ERODE_U8_U8_3x3,
@@ -296,9 +307,11 @@ enum vx_kernel_amd_e {
 	VX_KERNEL_AMD_CANNY_SOBEL_SUPP_THRESHOLD_U8_U8_7x7_L1NORM,
 	VX_KERNEL_AMD_CANNY_SOBEL_SUPP_THRESHOLD_U8_U8_7x7_L2NORM,
 	VX_KERNEL_AMD_CONVOLVE_U8_U8,
+	VX_KERNEL_AMD_CONVOLVE_SEPARABLE_U8_U8,
 
-	// Fixed Neighbors: S16 = op U8 (2)
+	// Fixed Neighbors: S16 = op U8 (3)
 	VX_KERNEL_AMD_CONVOLVE_S16_U8,
+	VX_KERNEL_AMD_CONVOLVE_SEPARABLE_S16_U8,
 	VX_KERNEL_AMD_SOBEL_MAGNITUDE_S16_U8_3x3,
 
 	// Fixed Neighbors: S16U8 = op U8 (1)
@@ -364,7 +377,7 @@ enum vx_kernel_amd_e {
 	// Fixed Neighbors: xy = ANY (1)
 	VX_KERNEL_AMD_NON_MAX_SUPP_XY_ANY_3x3,
 
-	// Arbitrary Neighbors: U8 = op U8 (20)
+	// Arbitrary Neighbors: U8 = op U8 (28)
 	VX_KERNEL_AMD_REMAP_U8_U8_NEAREST,
 	VX_KERNEL_AMD_REMAP_U8_U8_NEAREST_CONSTANT,
 	VX_KERNEL_AMD_REMAP_U8_U8_BILINEAR,
@@ -382,10 +395,22 @@ enum vx_kernel_amd_e {
 	VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_REPLICATE,
 	VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_CONSTANT,
 	VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA,
+	VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_HALF,
+	VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_THIRD,
+	VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_QUARTER,
+	VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_AREA_TWO_THIRDS,
+	VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_HALF,
+	VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_THIRD,
+	VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_QUARTER,
+	VX_KERNEL_AMD_SCALE_IMAGE_U8_U8_BILINEAR_TWO_THIRDS,
 	VX_KERNEL_AMD_REMAP_U24_U24_BILINEAR,
 	VX_KERNEL_AMD_REMAP_U24_U32_BILINEAR,
 	VX_KERNEL_AMD_REMAP_U32_U32_BILINEAR,
 
+	// Arbitrary Neighbors: U8U8 = op U8 (2)
+	VX_KERNEL_AMD_SCALE_IMAGE_U8U8_U8_AREA_HALF_QUARTER,
+	VX_KERNEL_AMD_SCALE_IMAGE_U8U8_U8_BILINEAR_HALF_QUARTER,
+
 	// Point Neighbors: XY = op XY (4)
 	VX_KERNEL_AMD_OPTICAL_FLOW_PYR_LK_XY_XY,
 	VX_KERNEL_AMD_OPTICAL_FLOW_PREPARE_LK_XY_XY,
@@ -408,6 +433,9 @@ enum vx_kernel_amd_e {
 	// Sequential: U32 = op U8 (1)
 	VX_KERNEL_AMD_INTEGRAL_IMAGE_U32_U8,
 
+	// Sequential: U64 = op U8 (1)
+	VX_KERNEL_AMD_INTEGRAL_IMAGE_U64_U8,
+
 	// Sequential: DATA = op U8 (3)
 	VX_KERNEL_AMD_HISTOGRAM_DATA_U8,
 	VX_KERNEL_AMD_MEAN_STD_DEV_DATA_U8,
@@ -454,6 +482,15 @@ enum vx_kernel_amd_e {
 	VX_KERNEL_AMD_LAPLACIAN_PYRAMID_DATA_DATA_DATA,
 	VX_KERNEL_AMD_LAPLACIAN_RECONSTRUCT_DATA_DATA_DATA,
 
+	// OpenVX 1.2 tensor kernels
+	VX_KERNEL_AMD_TENSOR_ADD_DATA_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_SUBTRACT_DATA_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_MULTIPLY_DATA_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_TABLE_LOOKUP_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_TRANSPOSE_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_CONVERT_DEPTH_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_MATRIX_MULTIPLY_DATA_DATA_DATA,
+
 	VX_KERNEL_AMD_MAX_1_0, // Used for bounds checking in the internal conformance test
 };
 
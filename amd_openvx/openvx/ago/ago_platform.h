@@ -49,6 +49,9 @@ THE SOFTWARE.
 #include <functional>
 #include <chrono>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
 using namespace std;
 
 #if _WIN32
@@ -105,6 +105,7 @@ static struct { const char * name; vx_enum value; vx_size size; } s_table_consta
         { "VX_TYPE_IMAGE", VX_TYPE_IMAGE },
         { "VX_TYPE_REMAP", VX_TYPE_REMAP },
         { "VX_TYPE_TENSOR", VX_TYPE_TENSOR },
+        { "VX_TYPE_USER_DATA_OBJECT", VX_TYPE_USER_DATA_OBJECT },
         { "VX_TYPE_STRING", VX_TYPE_STRING_AMD },
         { "AGO_TYPE_MEANSTDDEV_DATA", AGO_TYPE_MEANSTDDEV_DATA },
         { "AGO_TYPE_MINMAXLOC_DATA", AGO_TYPE_MINMAXLOC_DATA },
@@ -184,6 +185,116 @@ void agoUnlockGlobalContext()
     LeaveCriticalSection(&g_cs_context);
 }
 
+// worker pool shared by all contexts for data-parallel execution of CPU kernels: the calling thread
+// works on its own job along with the workers, and nested calls run on the calling thread only
+struct AgoCpuWorkerJob {
+    const std::function<void(vx_size)> * func;
+    vx_size count;
+    vx_size next;
+    vx_size remaining;
+};
+struct AgoCpuWorkerPool {
+    std::mutex mutex;
+    std::condition_variable cvWork;
+    std::condition_variable cvDone;
+    std::deque<AgoCpuWorkerJob *> pending;
+    std::vector<std::thread> workers;
+    bool terminate;
+};
+static AgoCpuWorkerPool * g_cpu_worker_pool = nullptr;
+static vx_uint32 g_cpu_worker_pool_users = 0;
+static vx_uint32 g_cpu_thread_count = 1;
+static thread_local bool t_cpu_worker_busy = false;
+
+static void agoCpuWorkerRun(AgoCpuWorkerPool * pool, std::unique_lock<std::mutex>& lock, AgoCpuWorkerJob * job)
+{
+    // must be called with pool->mutex locked and job->next < job->count
+    vx_size index = job->next++;
+    if (job->next >= job->count) {
+        auto it = std::find(pool->pending.begin(), pool->pending.end(), job);
+        if (it != pool->pending.end())
+            pool->pending.erase(it);
+    }
+    lock.unlock();
+    (*job->func)(index);
+    lock.lock();
+    if (--job->remaining == 0)
+        pool->cvDone.notify_all();
+}
+
+static void agoCpuWorker(AgoCpuWorkerPool * pool)
+{
+    t_cpu_worker_busy = true;
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    for (;;) {
+        pool->cvWork.wait(lock, [&] { return pool->terminate || !pool->pending.empty(); });
+        if (pool->terminate)
+            break;
+        agoCpuWorkerRun(pool, lock, pool->pending.front());
+    }
+}
+
+void agoCpuWorkerPoolAcquire()
+{
+    // must be called with global context lock
+    if (g_cpu_worker_pool_users++ == 0) {
+        char textBuffer[64];
+        g_cpu_thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+        if (agoGetEnvironmentVariable("AGO_CPU_THREADS", textBuffer, sizeof(textBuffer)) && atoi(textBuffer) > 0) {
+            g_cpu_thread_count = (vx_uint32)atoi(textBuffer);
+        }
+        if (g_cpu_thread_count > 1) {
+            g_cpu_worker_pool = new AgoCpuWorkerPool;
+            g_cpu_worker_pool->terminate = false;
+            for (vx_uint32 i = 1; i < g_cpu_thread_count; i++) {
+                g_cpu_worker_pool->workers.push_back(std::thread(agoCpuWorker, g_cpu_worker_pool));
+            }
+        }
+    }
+}
+
+void agoCpuWorkerPoolRelease()
+{
+    // must be called with global context lock
+    if (g_cpu_worker_pool_users > 0 && --g_cpu_worker_pool_users == 0 && g_cpu_worker_pool) {
+        {
+            std::lock_guard<std::mutex> lock(g_cpu_worker_pool->mutex);
+            g_cpu_worker_pool->terminate = true;
+            g_cpu_worker_pool->cvWork.notify_all();
+        }
+        for (auto& worker : g_cpu_worker_pool->workers) {
+            worker.join();
+        }
+        delete g_cpu_worker_pool;
+        g_cpu_worker_pool = nullptr;
+    }
+}
+
+vx_uint32 agoGetCpuThreadCount()
+{
+    return g_cpu_worker_pool ? g_cpu_thread_count : 1;
+}
+
+void agoParallelFor(vx_size count, const std::function<void(vx_size)>& func)
+{
+    AgoCpuWorkerPool * pool = g_cpu_worker_pool;
+    if (!pool || count < 2 || t_cpu_worker_busy) {
+        for (vx_size index = 0; index < count; index++)
+            func(index);
+        return;
+    }
+    AgoCpuWorkerJob job = { &func, count, 0, count };
+    t_cpu_worker_busy = true;
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    pool->pending.push_back(&job);
+    pool->cvWork.notify_all();
+    while (job.next < job.count) {
+        agoCpuWorkerRun(pool, lock, &job);
+    }
+    pool->cvDone.wait(lock, [&] { return job.remaining == 0; });
+    t_cpu_worker_busy = false;
+}
+
 void * agoAllocMemory(vx_size size)
 {
     // to keep track of allocations
@@ -682,6 +793,21 @@ AgoKernel * agoFindKernelByEnum(AgoContext * acontext, vx_enum kernel_id)
     return 0;
 }
 
+void agoReplaceOverridableKernel(AgoContext * acontext, vx_enum kernel_id, const vx_char * name)
+{
+    // remove the built-in kernel so that new nodes use the user kernel: nodes and references
+    // that already use the built-in kernel keep it until the context is released
+    AgoKernel * kernel = agoFindKernelByEnum(acontext, kernel_id);
+    if (kernel && (kernel->flags & AGO_KERNEL_FLAG_OVERRIDABLE) && !strcmp(kernel->name, name)) {
+        if (agoRemoveKernel(&acontext->kernelList, kernel) == kernel) {
+            if (kernel->ref.internal_count <= 1 && kernel->ref.external_count == 0)
+                delete kernel;
+            else
+                agoAddKernel(&acontext->overriddenKernelList, kernel);
+        }
+    }
+}
+
 AgoKernel * agoFindKernelByName(AgoContext * acontext, const vx_char * name)
 {
     // search context
@@ -960,6 +1086,9 @@ void agoGetDescriptionFromData(AgoContext * acontext, char * desc, AgoData * dat
             sprintf(dims + strlen(dims), "%s%u", i ? "," : "", (vx_uint32)data->u.tensor.dims[i]);
         sprintf(desc + strlen(desc), "tensor%s:%u,{%s},%s,%u", virt, (vx_uint32)data->u.tensor.num_dims, dims, agoEnum2Name(data->u.tensor.data_type), (vx_uint32)data->u.tensor.fixed_point_pos);
     }
+    else if (data->ref.type == VX_TYPE_USER_DATA_OBJECT) {
+        sprintf(desc + strlen(desc), "user-data-object%s:" VX_FMT_SIZE ",%s", virt, data->size, data->u.udo.type_name);
+    }
     else if (data->ref.type == AGO_TYPE_MEANSTDDEV_DATA) {
         sprintf(desc + strlen(desc), "ago-meanstddev-data%s:", virt);
     }
@@ -1748,6 +1877,30 @@ int agoGetDataFromDescription(AgoContext * acontext, AgoGraph * agraph, AgoData
         }
         return 0;
     }
+    else if (!strncmp(desc, "user-data-object:", 17) || !strncmp(desc, "user-data-object-virtual:", 17 + 8)) {
+        data->isVirtual = !strncmp(desc, "user-data-object-virtual:", 17 + 8) ? vx_true_e : vx_false_e;
+        desc += 17 + (data->isVirtual ? 8 : 0);
+        // get configuration: size followed by optional type name
+        data->ref.type = VX_TYPE_USER_DATA_OBJECT;
+        const char *s = strstr(desc, ","); if (!s) return -1;
+        if (sscanf(desc, "" VX_FMT_SIZE "", &data->size) != 1) return -1;
+        if (strlen(++s) >= VX_MAX_REFERENCE_NAME) {
+            agoAddLogEntry(&data->ref, VX_FAILURE, "ERROR: agoGetDataFromDescription: user data object type name too long: %s\n", s);
+            return -1;
+        }
+        strcpy(data->u.udo.type_name, s);
+        if (data->isVirtual && !data->isNotFullyConfigured && !data->size) {
+            // incomplete information needs to process this again later
+            data->isNotFullyConfigured = vx_true_e;
+            return 0;
+        }
+        // sanity check and update
+        if (agoDataSanityCheckAndUpdate(data)) {
+            agoAddLogEntry(&data->ref, VX_FAILURE, "ERROR: agoGetDataFromDescription: agoDataSanityCheckAndUpdate failed for user data object\n");
+            return -1;
+        }
+        return 0;
+    }
     else if (!strncmp(desc, "tensor:", 7) || !strncmp(desc, "tensor-virtual:", 7 + 8)) {
         data->isVirtual = !strncmp(desc, "tensor-virtual:", 7 + 8) ? vx_true_e : vx_false_e;
         desc += 7 + (data->isVirtual ? 8 : 0);
@@ -1981,6 +2134,8 @@ int agoInitializeImageComponentsAndPlanes(AgoContext * acontext)
     agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_RGB, 3, 1, 3 * 8, 1, VX_COLOR_SPACE_DEFAULT, VX_CHANNEL_RANGE_FULL);
     agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_NV12, 3, 2, 0, 1, VX_COLOR_SPACE_DEFAULT, VX_CHANNEL_RANGE_FULL);
     agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_NV21, 3, 2, 0, 1, VX_COLOR_SPACE_DEFAULT, VX_CHANNEL_RANGE_FULL);
+    agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_P010_AMD, 3, 2, 0, 1, VX_COLOR_SPACE_DEFAULT, VX_CHANNEL_RANGE_FULL);
+    agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_P016_AMD, 3, 2, 0, 1, VX_COLOR_SPACE_DEFAULT, VX_CHANNEL_RANGE_FULL);
     agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_UYVY, 3, 1, 2 * 8, 1, VX_COLOR_SPACE_DEFAULT, VX_CHANNEL_RANGE_FULL);
     agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_YUYV, 3, 1, 2 * 8, 1, VX_COLOR_SPACE_DEFAULT, VX_CHANNEL_RANGE_FULL);
     agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_IYUV, 3, 3, 0, 1, VX_COLOR_SPACE_DEFAULT, VX_CHANNEL_RANGE_FULL);
@@ -1990,6 +2145,7 @@ int agoInitializeImageComponentsAndPlanes(AgoContext * acontext)
     agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_S16, 1, 1, 16, 1, VX_COLOR_SPACE_NONE, VX_CHANNEL_RANGE_FULL);
     agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_U32, 1, 1, 32, 1, VX_COLOR_SPACE_NONE, VX_CHANNEL_RANGE_FULL);
     agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_S32, 1, 1, 32, 1, VX_COLOR_SPACE_NONE, VX_CHANNEL_RANGE_FULL);
+    agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_U64_AMD, 1, 1, 64, 1, VX_COLOR_SPACE_NONE, VX_CHANNEL_RANGE_FULL);
     agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_U1_AMD, 1, 1, 1, 1, VX_COLOR_SPACE_NONE, VX_CHANNEL_RANGE_FULL);
     agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_F32x3_AMD, 3, 1, 3 * 32, 1, VX_COLOR_SPACE_NONE, VX_CHANNEL_RANGE_FULL);
     agoSetImageComponentsAndPlanes(acontext, VX_DF_IMAGE_F32_AMD, 1, 1, 32, 1, VX_COLOR_SPACE_NONE, VX_CHANNEL_RANGE_FULL);
@@ -2087,6 +2243,20 @@ int agoGetImagePlaneFormat(AgoContext * acontext, vx_df_image format, vx_uint32
             return 0;
         }
     }
+    else if (format == VX_DF_IMAGE_P010_AMD || format == VX_DF_IMAGE_P016_AMD) {
+        if (plane == 0) {
+            *pFormat = VX_DF_IMAGE_U16;
+            *pWidth = width;
+            *pHeight = height;
+            return 0;
+        }
+        else if (plane == 1) {
+            *pFormat = VX_DF_IMAGE_U32;
+            *pWidth = (width + 1) >> 1;
+            *pHeight = (height + 1) >> 1;
+            return 0;
+        }
+    }
     else {
         if (plane == 0) {
             *pFormat = format;
@@ -2098,6 +2268,55 @@ int agoGetImagePlaneFormat(AgoContext * acontext, vx_df_image format, vx_uint32
     return -1;
 }
 
+static vx_int32 agoGcd(vx_int32 a, vx_int32 b)
+{
+    while (b) {
+        vx_int32 t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+bool agoGetSeparableConvolution(AgoData * conv, vx_int16 * rowCoeff, vx_int16 * colCoeff)
+{
+    // check whether the integer convolution matrix is exactly colCoeff x rowCoeff:
+    // the first non-zero row divided by the gcd of its elements is a primitive integer vector,
+    // so every other row must be an integer multiple of it for the matrix to be rank-1
+    vx_uint32 columns = (vx_uint32)conv->u.conv.columns, rows = (vx_uint32)conv->u.conv.rows;
+    const vx_int16 * matrix = (const vx_int16 *)conv->buffer;
+    if (!matrix || columns > AGO_MAX_CONVOLUTION_DIM || rows > AGO_MAX_CONVOLUTION_DIM)
+        return false;
+    vx_uint32 pivotRow = rows, pivotColumn = columns;
+    for (vx_uint32 y = 0; y < rows && pivotRow == rows; y++) {
+        for (vx_uint32 x = 0; x < columns; x++) {
+            if (matrix[y * columns + x]) {
+                pivotRow = y;
+                pivotColumn = x;
+                break;
+            }
+        }
+    }
+    if (pivotRow == rows)
+        return false;
+    vx_int32 gcd = 0;
+    for (vx_uint32 x = 0; x < columns; x++)
+        gcd = agoGcd(gcd, abs((vx_int32)matrix[pivotRow * columns + x]));
+    for (vx_uint32 x = 0; x < columns; x++)
+        rowCoeff[x] = (vx_int16)(matrix[pivotRow * columns + x] / gcd);
+    for (vx_uint32 y = 0; y < rows; y++) {
+        vx_int32 value = matrix[y * columns + pivotColumn];
+        if (value % rowCoeff[pivotColumn])
+            return false;
+        colCoeff[y] = (vx_int16)(value / rowCoeff[pivotColumn]);
+        for (vx_uint32 x = 0; x < columns; x++) {
+            if ((vx_int32)matrix[y * columns + x] != (vx_int32)colCoeff[y] * (vx_int32)rowCoeff[x])
+                return false;
+        }
+    }
+    return true;
+}
+
 void agoGetDataName(vx_char * name, AgoData * data)
 {
     name[0] = 0;
@@ -2386,6 +2605,11 @@ int agoDataSanityCheckAndUpdate(AgoData * data)
     else if (data->ref.type == VX_TYPE_TENSOR) {
         // nothing to check yet
     }
+    else if (data->ref.type == VX_TYPE_USER_DATA_OBJECT) {
+        // payload size is fixed at creation
+        if (!data->size)
+            return -1;
+    }
     else if (data->ref.type == VX_TYPE_DISTRIBUTION) {
         // calculate other attributes and buffer size
         data->size = data->u.dist.numbins * sizeof(vx_uint32);
@@ -2564,6 +2788,13 @@ int agoAllocData(AgoData * data)
                 data->u.img.rect_roi.start_y * data->u.img.stride_in_bytes +
                 ImageWidthInBytesFloor(data->u.img.rect_roi.start_x, data);
         }
+        else if (data->buffer_alias_data) {
+            // share the buffer of the image that is processed in-place into this image
+            if (agoAllocData(data->buffer_alias_data)) {
+                return -1;
+            }
+            data->buffer = data->buffer_alias_data->buffer;
+        }
         else {
             if (data->u.img.isUniform) {
                 // allocate buffer
@@ -2725,10 +2956,40 @@ int agoAllocData(AgoData * data)
                 return -1;
         }
     }
+    else if (data->ref.type == VX_TYPE_USER_DATA_OBJECT) {
+        // allocate buffer and get aligned buffer with 32-byte alignment
+        data->buffer = data->buffer_allocated = (vx_uint8 *)agoAllocMemory(data->size);
+        if (!data->buffer_allocated)
+            return -1;
+        memset(data->buffer, 0, data->size);
+    }
     else return -1;
     return 0;
 }
 
+void agoDataMarkModified(AgoData * data)
+{
+    // bump the parents as well, so that readers of the whole object (or of a sibling) notice the change
+    for (; data; data = data->parent) {
+        data->generation++;
+    }
+}
+
+vx_uint64 agoDataGetGeneration(AgoData * data)
+{
+    // sum of the generations of the data and everything that shares its buffer: since each of them
+    // only increases, the sum changes whenever any of them is written
+    vx_uint64 generation = 0;
+    for (; data; data = data->parent) {
+        generation += data->generation;
+        if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI && data->u.img.roiMasterImage)
+            generation += agoDataGetGeneration(data->u.img.roiMasterImage);
+        else if (data->ref.type == VX_TYPE_TENSOR && data->u.tensor.roiMaster)
+            generation += agoDataGetGeneration(data->u.tensor.roiMaster);
+    }
+    return generation;
+}
+
 void agoRetainData(AgoGraph * graph, AgoData * data, bool isForExternalUse)
 {
     if (isForExternalUse) {
@@ -3037,6 +3298,16 @@ void agoImportNodeConfig(AgoNode * childnode, AgoNode * anode)
 {
     childnode->attr_border_mode = anode->attr_border_mode;
     childnode->attr_affinity = anode->attr_affinity;
+    childnode->replica_group = anode->replica_group;
+    childnode->replica_index = anode->replica_index;
+    // match replicated parameters by data, since the child can order its parameters differently
+    childnode->replica_param_mask = 0;
+    for (vx_uint32 j = 0; j < childnode->paramCount; j++) {
+        for (vx_uint32 i = 0; childnode->paramList[j] && i < anode->paramCount; i++) {
+            if ((anode->replica_param_mask & (1u << i)) && childnode->paramList[j] == anode->paramList[i])
+                childnode->replica_param_mask |= (1u << j);
+        }
+    }
     if (anode->callback) {
         // TBD: need a mechanism to propagate callback changes later in the flow and
         // and ability to have multiple callbacks for the same node as multiple original nodes
@@ -3079,6 +3350,67 @@ void agoPerfCaptureStop(vx_perf_t * perf)
     perf->avg = perf->sum / perf->num;
 }
 
+void agoPerfCaptureStop(vx_perf_t * perf, AgoLatencyHistogram * latency)
+{
+    agoPerfCaptureStop(perf);
+    agoLatencyHistogramAdd(latency, perf->tmp);
+}
+
+void agoLatencyHistogramAdd(AgoLatencyHistogram * latency, vx_uint64 value)
+{
+    vx_uint32 index = (vx_uint32)value;
+    if (value >> (AGO_LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 1)) {
+#if _WIN32
+        unsigned long msb; _BitScanReverse64(&msb, value);
+#else
+        vx_uint32 msb = 63 - __builtin_clzll(value);
+#endif
+        vx_uint32 shift = (vx_uint32)msb - AGO_LATENCY_HISTOGRAM_SUB_BUCKET_BITS;
+        index = (shift << AGO_LATENCY_HISTOGRAM_SUB_BUCKET_BITS) + (vx_uint32)(value >> shift);
+    }
+    latency->bucket[index]++;
+    latency->count++;
+    if (value > latency->max)
+        latency->max = value;
+}
+
+vx_uint64 agoLatencyHistogramPercentile(const AgoLatencyHistogram * latency, vx_float64 fraction)
+{
+    // report the highest value equivalent to the bucket holding the requested rank
+    vx_uint64 rank = (vx_uint64)ceil(fraction * (vx_float64)latency->count), total = 0;
+    if (rank < 1) rank = 1;
+    for (vx_uint32 index = 0; index < AGO_LATENCY_HISTOGRAM_BUCKET_COUNT; index++) {
+        total += latency->bucket[index];
+        if (total >= rank) {
+            vx_uint64 value = index;
+            if (index >> (AGO_LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 1)) {
+                vx_uint32 shift = (index >> AGO_LATENCY_HISTOGRAM_SUB_BUCKET_BITS) - 1;
+                vx_uint64 sub_bucket = index - (shift << AGO_LATENCY_HISTOGRAM_SUB_BUCKET_BITS);
+                value = ((sub_bucket + 1) << shift) - 1;
+            }
+            return std::min(value, latency->max);
+        }
+    }
+    return latency->max;
+}
+
+static vx_uint64 agoClockCounterToNanoseconds(vx_uint64 value, vx_uint64 freq)
+{
+    // divide first so that large counter values don't overflow when scaled by 10^9
+    return (value / freq) * 1000000000 + (value % freq) * 1000000000 / freq;
+}
+
+void agoLatencyHistogramGetInfo(AgoContext * context, AgoLatencyInfo * info, const AgoLatencyHistogram * latency)
+{
+    // normalize all time units into nanoseconds
+    vx_uint64 freq = (vx_uint64)agoGetClockFrequency();
+    info->count = latency->count;
+    info->p50 = agoClockCounterToNanoseconds(agoLatencyHistogramPercentile(latency, 0.50), freq);
+    info->p99 = agoClockCounterToNanoseconds(agoLatencyHistogramPercentile(latency, 0.99), freq);
+    info->p999 = agoClockCounterToNanoseconds(agoLatencyHistogramPercentile(latency, 0.999), freq);
+    info->max = agoClockCounterToNanoseconds(latency->max, freq);
+}
+
 void agoPerfCopyNormalize(AgoContext * context, vx_perf_t * perfDst, vx_perf_t * perfSrc)
 {
     agoPerfCaptureReset(perfDst);
@@ -3158,11 +3490,11 @@ AgoData::AgoData()
 #elif ENABLE_HIP
       hip_memory { nullptr}, hip_memory_allocated{nullptr},
 #endif
-      gpu_buffer_offset{ 0 }, alias_data{ nullptr }, alias_offset{ 0 },
+      gpu_buffer_offset{ 0 }, alias_data{ nullptr }, alias_offset{ 0 }, buffer_alias_data{ nullptr },
       isVirtual{ vx_false_e }, isDelayed{ vx_false_e }, isNotFullyConfigured{ vx_false_e }, isInitialized{ vx_false_e }, siblingIndex{ 0 },
       numChildren{ 0 }, children{ nullptr }, parent{ nullptr }, inputUsageCount{ 0 }, outputUsageCount{ 0 }, inoutUsageCount{ 0 },
       initialization_flags{ 0 }, device_type_unused{ 0 },
-      nextMapId{ 0 }, hierarchical_level{ 0 }, hierarchical_life_start{ 0 }, hierarchical_life_end{ 0 }, ownerOfUserBufferGPU{ nullptr }
+      nextMapId{ 0 }, hierarchical_level{ 0 }, hierarchical_life_start{ 0 }, hierarchical_life_end{ 0 }, ownerOfUserBufferGPU{ nullptr }, generation{ 0 }
 {
     memset(&u, 0, sizeof(u));
 }
@@ -3204,6 +3536,8 @@ AgoKernel::AgoKernel()
     memset(&name, 0, sizeof(name));
     memset(&argConfig, 0, sizeof(argConfig));
     memset(&argType, 0, sizeof(argType));
+    memset(&alias_param_index_plus1, 0, sizeof(alias_param_index_plus1));
+    memset(&alias_processing_type, 0, sizeof(alias_processing_type));
 }
 AgoKernel::~AgoKernel()
 {
@@ -3231,7 +3565,8 @@ AgoNode::AgoNode()
     : next{ nullptr }, akernel{ nullptr }, flags{ 0 }, localDataSize{ 0 }, localDataPtr{ nullptr }, localDataPtr_allocated{ nullptr },
       valid_rect_reset{ vx_true_e }, valid_rect_num_inputs{ 0 }, valid_rect_num_outputs{ 0 }, valid_rect_inputs{ nullptr }, valid_rect_outputs{ nullptr },
       paramCount{ 0 }, callback{ nullptr }, supernode{ nullptr }, initialized{ false }, target_support_flags{ 0 }, hierarchical_level{ 0 }, status{ VX_SUCCESS }
-    , drama_divide_invoked{ false }
+    , drama_divide_invoked{ false }, rect_exec_enable{ false }, replica_group{ 0 }, replica_index{ 0 }, replica_param_mask{ 0 }
+    , incremental_valid{ false }, incremental_rerun{ false }, cost_perf_num{ 0 }
 #if ENABLE_OPENCL
     , opencl_type{ 0 }, opencl_param_mem2reg_mask{ 0 }, opencl_param_discard_mask{ 0 }, opencl_param_as_value_mask{ 0 },
       opencl_param_atomic_mask{ 0 }, opencl_local_buffer_usage_mask{ 0 }, opencl_local_buffer_size_in_bytes{ 0 }, opencl_work_dim{ 0 },
@@ -3244,7 +3579,12 @@ AgoNode::AgoNode()
     memset(&paramList, 0, sizeof(paramList));
     memset(&paramListForAgeDelay, 0, sizeof(paramListForAgeDelay));
     memset(&funcExchange, 0, sizeof(funcExchange));
+    memset(&rect_exec, 0, sizeof(rect_exec));
+    memset(&rect_exec_window, 0, sizeof(rect_exec_window));
+    memset(&incremental_param, 0, sizeof(incremental_param));
+    memset(&incremental_generation, 0, sizeof(incremental_generation));
     memset(&perf, 0, sizeof(perf));
+    memset(&latency, 0, sizeof(latency));
 #if ENABLE_OPENCL
     memset(&opencl_name, 0, sizeof(opencl_name));
     memset(&opencl_scalar_array_output_sync, 0, sizeof(opencl_scalar_array_output_sync));
@@ -3263,6 +3603,12 @@ AgoNode::~AgoNode()
         delete[] valid_rect_outputs;
         valid_rect_outputs = nullptr;
     }
+    for (vx_uint32 i = 0; i < AGO_MAX_PARAMS; i++) {
+        if (rect_exec_window[i]) {
+            delete rect_exec_window[i];
+            rect_exec_window[i] = nullptr;
+        }
+    }
 #if ENABLE_OPENCL
     if (opencl_event) {
         clReleaseEvent(opencl_event);
@@ -3281,18 +3627,24 @@ AgoNode::~AgoNode()
 AgoGraph::AgoGraph()
     : next{ nullptr }, hThread{ nullptr }, hSemToThread{ nullptr }, hSemFromThread{ nullptr },
       threadScheduleCount{ 0 }, threadExecuteCount{ 0 }, threadWaitCount{ 0 }, threadThreadTerminationState{ 0 },
+      schedUsePool{ false }, schedReady{ false }, schedRunning{ false }, schedPriority{ 0 }, schedDeadline{ 0 }, schedSequence{ 0 }, schedDeadlineMissed{ 0 },
       isReadyToExecute{ vx_false_e }, detectedInvalidNode{ false }, status{ VX_SUCCESS },
-      virtualDataGenerationCount{ 0 }, optimizer_flags{ AGO_GRAPH_OPTIMIZER_FLAGS_DEFAULT }, verified{ false }, enable_performance_profiling{ false }, execFrameCount{ 0 }
+      virtualDataGenerationCount{ 0 }, replicaGroupCount{ 0 }, optimizer_flags{ AGO_GRAPH_OPTIMIZER_FLAGS_DEFAULT }, verified{ false },
+      batchFrameCount{ 1 }, batchNodeMajor{ false }, incrementalExecution{ false }, targetPartition{ VX_TARGET_PARTITION_AMD_AFFINITY }
 #if ENABLE_OPENCL
-    , supernodeList{ nullptr }, opencl_cmdq{ nullptr }, opencl_device{ nullptr }
-    , enable_node_level_gpu_flush{ true }
+    , supernodeList{ nullptr }, enable_node_level_gpu_flush{ true }
+    , opencl_cmdq{ nullptr }, opencl_device{ nullptr }
 #elif ENABLE_HIP
     , supernodeList{ nullptr }, hip_stream0{ nullptr }
 #endif
+    , execFrameCount{ 0 }, enable_performance_profiling{ false }
 {
     memset(&dataList, 0, sizeof(dataList));
+    memset(&batchDataList, 0, sizeof(batchDataList));
     memset(&nodeList, 0, sizeof(nodeList));
     memset(&perf, 0, sizeof(perf));
+    memset(&latency, 0, sizeof(latency));
+    memset(&schedWait, 0, sizeof(schedWait));
     memset(&gpu_perf, 0, sizeof(gpu_perf));
     memset(&gpu_perf_total, 0, sizeof(gpu_perf_total));
     memset(&attr_affinity, 0, sizeof(attr_affinity));
@@ -3307,6 +3659,13 @@ AgoGraph::~AgoGraph()
             (*it)->ref.internal_count--;
     }
 
+    // release object arrays bound as batch parameters and per-frame copies of intermediate data
+    for (auto it = batchParameters.begin(); it != batchParameters.end(); it++) {
+        if (agoIsValidData(*it, VX_TYPE_OBJECT_ARRAY) && (*it)->ref.internal_count > 0)
+            (*it)->ref.internal_count--;
+    }
+    agoResetDataList(&batchDataList);
+
     // move all virtual data to garbage data list
     while (dataList.trash) {
         agoRemoveData(&dataList, dataList.trash, &ref.context->graph_garbage_data);
@@ -3329,10 +3688,17 @@ AgoGraph::~AgoGraph()
     // critical section
     DeleteCriticalSection(&cs);
 }
+AgoScheduler::AgoScheduler()
+    : threadCount{ 0 }, running{ 0 }, terminate{ false }, sequence{ 0 }, queueDepthMax{ 0 }, scheduled{ 0 }, completed{ 0 }, deadlineMissed{ 0 }
+{
+    memset(&wait, 0, sizeof(wait));
+}
+
 AgoContext::AgoContext()
     : perfNormFactor{ 0 }, dataGenerationCount{ 0 }, nextUserStructId{ VX_TYPE_USER_STRUCT_START }, nextUserKernelId{ 0 }, nextUserLibraryId{ 1 },
       num_active_modules{ 0 }, num_active_references{ 0 }, callback_log{ nullptr }, callback_reentrant{ vx_false_e },
-      thread_config{ CONFIG_THREAD_DEFAULT }, importing_module_index_plus1{ 0 }, graph_garbage_data{ nullptr }, graph_garbage_node{ nullptr }, graph_garbage_list{ nullptr }
+      thread_config{ CONFIG_THREAD_DEFAULT }, importing_module_index_plus1{ 0 }, graph_garbage_data{ nullptr }, graph_garbage_node{ nullptr }, graph_garbage_list{ nullptr },
+      costTableModified{ false }, costTransferPerByte{ 0.125 }, costTransferFixed{ 10000.0 }, costMockGpuScale{ 0.0 }, costMockGpuLaunch{ 0.0 }
 #if ENABLE_OPENCL
 #if defined(CL_VERSION_2_0)
       , opencl_svmcaps{ 0 }
@@ -3347,6 +3713,7 @@ AgoContext::AgoContext()
 #endif
 {
     memset(&kernelList, 0, sizeof(kernelList));
+    memset(&overriddenKernelList, 0, sizeof(overriddenKernelList));
     memset(&dataList, 0, sizeof(dataList));
     memset(&graphList, 0, sizeof(graphList));
     memset(&immediate_border_mode, 0, sizeof(immediate_border_mode));
@@ -3433,6 +3800,7 @@ AgoContext::~AgoContext()
 
     // remove kernel objects
     agoResetKernelList(&kernelList);
+    agoResetKernelList(&overriddenKernelList);
 
 #if ENABLE_OPENCL
     if (opencl_mem_alloc_count > 0) {
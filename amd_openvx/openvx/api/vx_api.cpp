@@ -256,6 +256,18 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryContext(vx_context context, vx_enum at
                     status = VX_SUCCESS;
                 }
                 break;
+            case VX_CONTEXT_ATTRIBUTE_AMD_SCHEDULER_THREADS:
+                if (size == sizeof(vx_uint32)) {
+                    *(vx_uint32 *)ptr = context->scheduler.threadCount;
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_CONTEXT_ATTRIBUTE_AMD_SCHEDULER_INFO:
+                if (size == sizeof(AgoSchedulerInfo)) {
+                    agoSchedulerGetInfo(context, (AgoSchedulerInfo *)ptr);
+                    status = VX_SUCCESS;
+                }
+                break;
 #if ENABLE_OPENCL
             case VX_CONTEXT_ATTRIBUTE_AMD_OPENCL_CONTEXT:
                 if (size == sizeof(cl_context)) {
@@ -388,6 +400,19 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetContextAttribute(vx_context context, vx_
                 context->attr_affinity = *(AgoTargetAffinityInfo_ *)ptr;
             }
             break;
+        case VX_CONTEXT_ATTRIBUTE_AMD_SCHEDULER_THREADS:
+            if(!ptr) return VX_ERROR_INVALID_PARAMETERS;
+            if (size == sizeof(vx_uint32)) {
+                std::lock_guard<std::mutex> lock(context->scheduler.mutex);
+                if (!context->scheduler.workers.empty()) {
+                    status = VX_ERROR_NOT_SUPPORTED;
+                }
+                else {
+                    context->scheduler.threadCount = *(vx_uint32 *)ptr;
+                    status = VX_SUCCESS;
+                }
+            }
+            break;
 #if ENABLE_OPENCL
         case VX_CONTEXT_ATTRIBUTE_AMD_OPENCL_CONTEXT:
             if(!ptr) return VX_ERROR_INVALID_PARAMETERS;
@@ -1078,6 +1103,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxSwapImageHandle(vx_image image_, void* cons
                     if (image->children[i]->buffer) {
                         image->children[i]->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                         image->children[i]->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                        agoDataMarkModified(image->children[i]);
                     }
                     // propagate to ROIs
                     for (auto roi = image->children[i]->roiDepList.begin(); roi != image->children[i]->roiDepList.end(); roi++) {
@@ -1099,6 +1125,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxSwapImageHandle(vx_image image_, void* cons
                 if (image->buffer) {
                     image->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                     image->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    agoDataMarkModified(image);
                 }
                 // propagate to ROIs
                 for (auto roi = image->roiDepList.begin(); roi != image->roiDepList.end(); roi++) {
@@ -1340,6 +1367,12 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryImage(vx_image image_, vx_enum attribu
                     }
                 }
                 break;
+            case VX_IMAGE_ATTRIBUTE_AMD_RECT_OF_INTEREST:
+                if (size == sizeof(vx_rectangle_t)) {
+                    *(vx_rectangle_t *)ptr = image->u.img.rect_interest;
+                    status = VX_SUCCESS;
+                }
+                break;
 
             default:
                 status = VX_ERROR_NOT_SUPPORTED;
@@ -1421,6 +1454,15 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetImageAttribute(vx_image image_, vx_enum
                 break;
 
 #endif
+            case VX_IMAGE_ATTRIBUTE_AMD_RECT_OF_INTEREST:
+                if (size == sizeof(vx_rectangle_t)) {
+                    const vx_rectangle_t * rect = (const vx_rectangle_t *)ptr;
+                    if (rect->start_x <= rect->end_x && rect->start_y <= rect->end_y && rect->end_x <= image->u.img.width && rect->end_y <= image->u.img.height) {
+                        image->u.img.rect_interest = *rect;
+                        status = VX_SUCCESS;
+                    }
+                }
+                break;
 
             default:
                 status = VX_ERROR_NOT_SUPPORTED;
@@ -1849,6 +1891,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxCommitImagePatch(vx_image image_,
                     auto dataToSync = img->u.img.isROI ? img->u.img.roiMasterImage : img;
                     dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                     dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    agoDataMarkModified(dataToSync);
                 }
             }
         }
@@ -2166,6 +2209,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxUnmapImagePatch(vx_image image_, vx_map_id
                     auto dataToSync = image->u.img.isROI ? image->u.img.roiMasterImage : image;
                     dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                     dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    agoDataMarkModified(dataToSync);
                     if (dataToSync->numChildren > 0 && plane < dataToSync->numChildren && dataToSync->children[plane]) {
                         dataToSync->children[plane]->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                         dataToSync->children[plane]->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
@@ -2412,6 +2456,12 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryKernel(vx_kernel kernel, vx_enum attri
                     status = VX_SUCCESS;
                 }
                 break;
+            case VX_KERNEL_ATTRIBUTE_AMD_REPLICATE_BATCH_ENABLE:
+                if (size == sizeof(vx_bool)) {
+                    *(vx_bool *)ptr = (kernel->flags & AGO_KERNEL_FLAG_REPLICATE_BATCH) ? vx_true_e : vx_false_e;
+                    status = VX_SUCCESS;
+                }
+                break;
             default:
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
@@ -2474,6 +2524,8 @@ VX_API_ENTRY vx_kernel VX_API_CALL vxAddKernel(vx_context context,
     vx_kernel kernel = NULL;
     if (agoIsValidContext(context) && numParams > 0 && numParams <= AGO_MAX_PARAMS && func_ptr && input && output) {
         CAgoLock lock(context->cs);
+        // user kernels take over overridable built-in kernels with the same name and enumeration
+        agoReplaceOverridableKernel(context, enumeration, name);
         // make sure there are no kernels with the same name
         if (!agoFindKernelByEnum(context, enumeration) && !agoFindKernelByName(context, name)) {
             kernel = new AgoKernel;
@@ -2533,6 +2585,8 @@ VX_API_ENTRY vx_kernel VX_API_CALL vxAddUserKernel(vx_context context,
     vx_kernel kernel = NULL;
     if (agoIsValidContext(context) && numParams > 0 && numParams <= AGO_MAX_PARAMS && func_ptr && validate) {
         CAgoLock lock(context->cs);
+        // user kernels take over overridable built-in kernels with the same name and enumeration
+        agoReplaceOverridableKernel(context, enumeration, name);
         // make sure there are no kernels with the same name
         if (!agoFindKernelByEnum(context, enumeration) && !agoFindKernelByName(context, name)) {
             kernel = new AgoKernel;
@@ -2706,6 +2760,20 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetKernelAttribute(vx_kernel kernel, vx_enu
                     }
                 }
                 break;
+            case VX_KERNEL_ATTRIBUTE_AMD_REPLICATE_BATCH_ENABLE:
+                if (size == sizeof(vx_bool)) {
+                    if (!kernel->finalized && kernel->kernel_f) {
+                        if (*(vx_bool *)ptr)
+                            kernel->flags |= AGO_KERNEL_FLAG_REPLICATE_BATCH;
+                        else
+                            kernel->flags &= ~AGO_KERNEL_FLAG_REPLICATE_BATCH;
+                        status = VX_SUCCESS;
+                    }
+                    else {
+                        status = VX_ERROR_NOT_SUPPORTED;
+                    }
+                }
+                break;
 #if (ENABLE_OPENCL || ENABLE_HIP)
             case VX_KERNEL_ATTRIBUTE_AMD_QUERY_TARGET_SUPPORT:
                 if (size == sizeof(void *)) {
@@ -2883,6 +2951,11 @@ VX_API_ENTRY vx_status VX_API_CALL vxVerifyGraph(vx_graph graph)
         graph->isReadyToExecute = vx_false_e;
         graph->state = VX_GRAPH_STATE_UNVERIFIED;
 
+        // latency histograms start over with the verified graph
+        memset(&graph->latency, 0, sizeof(graph->latency));
+        for (AgoNode * node = graph->nodeList.head; node; node = node->next)
+            memset(&node->latency, 0, sizeof(node->latency));
+
         // check to see if user requested for graph dump
         vx_uint32 ago_graph_dump = 0;
         char textBuffer[256];
@@ -2904,8 +2977,14 @@ VX_API_ENTRY vx_status VX_API_CALL vxVerifyGraph(vx_graph graph)
             else if (agoInitializeGraph(graph)) {
                 status = VX_FAILURE;
             }
+            // set up per-frame data for graph batching
+            else if (agoPrepareGraphBatch(graph)) {
+                status = VX_FAILURE;
+            }
             // graph is ready to execute
             else {
+                for (AgoNode * node = graph->nodeList.head; node; node = node->next)
+                    node->incremental_valid = false;
                 graph->isReadyToExecute = vx_true_e;
             }
             graph->verified = vx_true_e;
@@ -3034,6 +3113,48 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryGraph(vx_graph graph, vx_enum attribut
                     status = VX_SUCCESS;
                 }
                 break;
+            case VX_GRAPH_ATTRIBUTE_AMD_BATCH_FRAME_COUNT:
+                if (size == sizeof(vx_uint32)) {
+                    *(vx_uint32 *)ptr = graph->batchFrameCount;
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_LATENCY:
+                if (size == sizeof(AgoLatencyInfo)) {
+                    agoLatencyHistogramGetInfo(graph->ref.context, (AgoLatencyInfo *)ptr, &graph->latency);
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_INCREMENTAL_EXECUTION:
+                if (size == sizeof(vx_bool)) {
+                    *(vx_bool *)ptr = graph->incrementalExecution ? vx_true_e : vx_false_e;
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_TARGET_PARTITION:
+                if (size == sizeof(vx_enum)) {
+                    *(vx_enum *)ptr = graph->targetPartition;
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_PRIORITY:
+                if (size == sizeof(vx_int32)) {
+                    *(vx_int32 *)ptr = graph->schedPriority;
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_DEADLINE:
+                if (size == sizeof(vx_uint64)) {
+                    *(vx_uint64 *)ptr = graph->schedDeadline;
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_SCHEDULE_INFO:
+                if (size == sizeof(AgoGraphScheduleInfo)) {
+                    agoSchedulerGetGraphInfo(graph, (AgoGraphScheduleInfo *)ptr);
+                    status = VX_SUCCESS;
+                }
+                break;
             case VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_INTERNAL_LAST:
                 if (size == sizeof(AgoGraphPerfInternalInfo)) {
 #if ENABLE_OPENCL
@@ -3146,6 +3267,56 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetGraphAttribute(vx_graph graph, vx_enum a
                     graph->attr_affinity = *(AgoTargetAffinityInfo_ *)ptr;
                 }
                 break;
+            case VX_GRAPH_ATTRIBUTE_AMD_BATCH_FRAME_COUNT:
+                if (size == sizeof(vx_uint32) && *(vx_uint32 *)ptr > 0) {
+                    if (graph->verified) {
+                        status = VX_ERROR_NOT_SUPPORTED;
+                    }
+                    else {
+                        graph->batchFrameCount = *(vx_uint32 *)ptr;
+                        status = VX_SUCCESS;
+                    }
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_INCREMENTAL_EXECUTION:
+                if (size == sizeof(vx_bool)) {
+                    CAgoLock lock(graph->cs);
+                    graph->incrementalExecution = *(vx_bool *)ptr ? true : false;
+                    // force all nodes to execute once before any of them can be skipped
+                    for (AgoNode * node = graph->nodeList.head; node; node = node->next)
+                        node->incremental_valid = false;
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_TARGET_PARTITION:
+                if (size == sizeof(vx_enum)) {
+                    vx_enum mode = *(vx_enum *)ptr;
+                    if (mode == VX_TARGET_PARTITION_AMD_AFFINITY || mode == VX_TARGET_PARTITION_AMD_COST || mode == VX_TARGET_PARTITION_AMD_CALIBRATE) {
+                        // takes effect on the next graph verification
+                        graph->targetPartition = mode;
+                        status = VX_SUCCESS;
+                    }
+                    else {
+                        status = VX_ERROR_INVALID_VALUE;
+                    }
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_PRIORITY:
+                if (size == sizeof(vx_int32)) {
+                    // ready list order is evaluated by the scheduler under its lock
+                    std::lock_guard<std::mutex> lock(graph->ref.context->scheduler.mutex);
+                    graph->schedPriority = *(vx_int32 *)ptr;
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_GRAPH_ATTRIBUTE_AMD_DEADLINE:
+                if (size == sizeof(vx_uint64)) {
+                    // applies to requests scheduled afterwards
+                    std::lock_guard<std::mutex> lock(graph->ref.context->scheduler.mutex);
+                    graph->schedDeadline = *(vx_uint64 *)ptr;
+                    status = VX_SUCCESS;
+                }
+                break;
             default:
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
@@ -3197,6 +3368,24 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetGraphParameterByIndex(vx_graph graph, vx
         status = VX_ERROR_INVALID_PARAMETERS;
         if ((index < graph->parameters.size()) && graph->parameters[index] && (!value || agoIsValidReference(value))) {
             vx_parameter parameter = graph->parameters[index];
+            if (graph->batchParameters.size() < graph->parameters.size())
+                graph->batchParameters.resize(graph->parameters.size(), nullptr);
+            if (graph->batchParameters[index]) {
+                graph->batchParameters[index]->ref.internal_count--;
+                graph->batchParameters[index] = nullptr;
+            }
+            if (graph->batchFrameCount > 1 && value && value->type == VX_TYPE_OBJECT_ARRAY && parameter->type != VX_TYPE_OBJECT_ARRAY) {
+                // with graph batching, an object array supplies one item per frame: the node gets the first item
+                AgoData * objarr = (AgoData *)value;
+                if (objarr->u.objarr.numitems != graph->batchFrameCount || !objarr->children[0] ||
+                    (parameter->type != VX_TYPE_REFERENCE && objarr->u.objarr.itemtype != parameter->type))
+                {
+                    return VX_ERROR_INVALID_PARAMETERS;
+                }
+                objarr->ref.internal_count++;
+                graph->batchParameters[index] = objarr;
+                value = &objarr->children[0]->ref;
+            }
             if (((vx_node)parameter->scope)->paramList[parameter->index]) {
                 agoReleaseData(((vx_node)parameter->scope)->paramList[parameter->index], false);
             }
@@ -3316,6 +3505,17 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryNode(vx_node node, vx_enum attribute,
                     status = VX_SUCCESS;
                 }
                 break;
+            case VX_NODE_ATTRIBUTE_AMD_LATENCY:
+                if (size == sizeof(AgoLatencyInfo)) {
+                    AgoLatencyHistogram * latency = &node->latency;
+                    if (node->latency.count == 0) {
+                        // same as VX_NODE_PERFORMANCE: nodes morphed by the graph optimizer report graph latency
+                        latency = &((AgoGraph *)node->ref.scope)->latency;
+                    }
+                    agoLatencyHistogramGetInfo(node->ref.context, (AgoLatencyInfo *)ptr, latency);
+                    status = VX_SUCCESS;
+                }
+                break;
             case VX_NODE_BORDER:
                 if (size == sizeof(vx_border_mode_t) || size == sizeof(vx_border_t)) {
                     *(vx_border_mode_t *)ptr = node->attr_border_mode;
@@ -3435,6 +3635,8 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetNodeAttribute(vx_node node, vx_enum attr
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
             }
+            if (status == VX_SUCCESS)
+                node->incremental_valid = false;
         }
     }
     return status;
@@ -3627,10 +3829,24 @@ VX_API_ENTRY vx_status VX_API_CALL vxReplicateNode(vx_graph graph, vx_node first
             }
             if (num_levels < 2)
                 status = VX_ERROR_NOT_COMPATIBLE;
+            if (status == VX_SUCCESS) {
+                // all replicas share a group so that they can be executed as one batch
+                vx_uint32 replica_param_mask = 0;
+                for (vx_uint32 i = 0; i < number_of_parameters; i++) {
+                    if (replicate[i])
+                        replica_param_mask |= (1u << i);
+                }
+                first_node->replica_group = ++graph->replicaGroupCount;
+                first_node->replica_index = 0;
+                first_node->replica_param_mask = replica_param_mask;
+            }
             for (vx_uint32 level = 1; level < num_levels && status == VX_SUCCESS; level++) {
                 vx_node node = vxCreateGenericNode(graph, first_node->akernel);
                 status = vxGetStatus((vx_reference)node);
                 if (status == VX_SUCCESS) {
+                    node->replica_group = first_node->replica_group;
+                    node->replica_index = level;
+                    node->replica_param_mask = first_node->replica_param_mask;
                     for (vx_uint32 i = 0; i < number_of_parameters && status == VX_SUCCESS; i++) {
                         if (replicate[i]) {
                             AgoData * param = paramList[i]->parent->children[level];
@@ -4228,6 +4444,8 @@ VX_API_ENTRY vx_status VX_API_CALL vxWriteScalarValue(vx_scalar ref, const void
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
             }
+            if (status == VX_SUCCESS)
+                agoDataMarkModified(data);
         }
     }
     return status;
@@ -4414,6 +4632,9 @@ VX_API_ENTRY vx_status VX_API_CALL vxReleaseReference(vx_reference* ref_ptr)
             case VX_TYPE_REMAP:
                 status = vxReleaseRemap((vx_remap *)ref_ptr);
                 break;
+            case VX_TYPE_USER_DATA_OBJECT:
+                status = vxReleaseUserDataObject((vx_user_data_object *)ref_ptr);
+                break;
             default:
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
@@ -4473,7 +4694,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetReferenceName(vx_reference ref, const vx
 {
     vx_status status = VX_ERROR_INVALID_REFERENCE;
     if (agoIsValidReference(ref) && ((ref->type >= VX_TYPE_DELAY && ref->type <= VX_TYPE_REMAP) ||
-        (ref->type == VX_TYPE_TENSOR) ||
+        (ref->type == VX_TYPE_TENSOR) || (ref->type == VX_TYPE_USER_DATA_OBJECT) ||
         (ref->type >= VX_TYPE_VENDOR_OBJECT_START && ref->type <= VX_TYPE_VENDOR_OBJECT_END)))
     {
         AgoData * data = (AgoData *)ref;
@@ -5000,6 +5221,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxCommitLUT(vx_lut lut, const void *ptr)
                     // update sync flags
                     data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                     data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    agoDataMarkModified(data);
                 }
             }
         }
@@ -5185,6 +5407,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxUnmapLUT(vx_lut lut, vx_map_id map_id)
                     // update sync flags
                     data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                     data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    agoDataMarkModified(data);
                 }
                 status = VX_SUCCESS;
                 break;
@@ -5421,6 +5644,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxCommitDistribution(vx_distribution distribu
                         // copy from external buffer
                         HafCpu_BinaryCopy_U8_U8(data->size, data->buffer, (vx_uint8 *)ptr);
                     }
+                    agoDataMarkModified(data);
                 }
             }
         }
@@ -5570,6 +5794,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxUnmapDistribution(vx_distribution distribut
                     // update sync flags
                     data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                     data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    agoDataMarkModified(data);
                 }
                 status = VX_SUCCESS;
                 break;
@@ -5967,6 +6192,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxCopyThresholdValue(vx_threshold thresh, vx_
                 else if (usage == VX_WRITE_ONLY){
                     //data->u.thr.threshold_lower = *(vx_int32 *)value_ptr;
                     memcpy(&data->u.thr.threshold_value, value_ptr, sizeof(vx_pixel_value_t));
+                    agoDataMarkModified(data);
                     status = VX_SUCCESS;
                 }
             }
@@ -6036,6 +6262,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxCopyThresholdRange(vx_threshold thresh, vx_
                 else if (usage == VX_WRITE_ONLY){
                     memcpy(&data->u.thr.threshold_lower, lower_value_ptr, sizeof(vx_pixel_value_t));
                     memcpy(&data->u.thr.threshold_upper, upper_value_ptr, sizeof(vx_pixel_value_t));
+                    agoDataMarkModified(data);
                     status = VX_SUCCESS;
                 }
             }
@@ -6100,6 +6327,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxCopyThresholdOutput(vx_threshold thresh, vx
             else if (usage == VX_WRITE_ONLY){
                 memcpy(&data->u.thr.true_value, true_value_ptr, sizeof(vx_pixel_value_t));
                 memcpy(&data->u.thr.false_value, false_value_ptr, sizeof(vx_pixel_value_t));
+                agoDataMarkModified(data);
                 status = VX_SUCCESS;
             }
         }
@@ -6185,6 +6413,8 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetThresholdAttribute(vx_threshold thresh,
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
             }
+            if (status == VX_SUCCESS)
+                agoDataMarkModified(data);
         }
     }
     return status;
@@ -6509,6 +6739,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxWriteMatrix(vx_matrix mat, const void *arra
                 // update sync flags
                 data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                 data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                agoDataMarkModified(data);
             }
             status = VX_SUCCESS;
         }
@@ -6891,6 +7122,8 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetConvolutionAttribute(vx_convolution conv
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
             }
+            if (status == VX_SUCCESS)
+                agoDataMarkModified(data);
         }
     }
     return status;
@@ -6974,6 +7207,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxWriteConvolutionCoefficients(vx_convolution
                 // update sync flags
                 data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                 data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                agoDataMarkModified(data);
             }
             status = VX_SUCCESS;
         }
@@ -7442,6 +7676,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxCopyRemapPatch(vx_remap remap,
             // update sync flags
             dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
             dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+            agoDataMarkModified(dataToSync);
             status = VX_SUCCESS;
         }
     }
@@ -7636,6 +7871,8 @@ VX_API_ENTRY vx_status VX_API_CALL vxUnmapRemapPatch(vx_remap remap, vx_map_id m
                     AgoData * dataToSync = data;
                     dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                     dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    agoDataMarkModified(dataToSync);
+                    dataToSync->u.remap.table_version++;
                 }
                 status = VX_SUCCESS;
                 break;
@@ -7705,6 +7942,8 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetRemapPoint(vx_remap table,
             // update sync flags
             data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
             data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+            agoDataMarkModified(data);
+            data->u.remap.table_version++;
         }
     }
     return status;
@@ -7778,6 +8017,47 @@ VX_API_ENTRY vx_status VX_API_CALL vxQueryRemap(vx_remap r, vx_enum attribute, v
                     status = VX_SUCCESS;
                 }
                 break;
+            case VX_REMAP_ATTRIBUTE_AMD_TABLE_FORMAT:
+                if (size == sizeof(vx_enum)) {
+                    *(vx_enum *)ptr = (data->u.remap.table_format == VX_REMAP_TABLE_FORMAT_AMD_FAST) ? VX_REMAP_TABLE_FORMAT_AMD_FAST : VX_REMAP_TABLE_FORMAT_AMD_COMPACT;
+                    status = VX_SUCCESS;
+                }
+                break;
+            default:
+                status = VX_ERROR_NOT_SUPPORTED;
+                break;
+            }
+        }
+    }
+    return status;
+}
+
+/*! \brief Sets attributes of a Remap table.
+* \param [in] table The remap table.
+* \param [in] attribute The attribute to set. Use a <tt>\ref vx_remap_attribute_amd_e</tt> enumeration.
+* \param [in] ptr The location from which to read the value.
+* \param [in] size The size of the object pointed to by \a ptr.
+* \return A <tt>\ref vx_status_e</tt> enumeration.
+* \ingroup group_remap
+*/
+VX_API_ENTRY vx_status VX_API_CALL vxSetRemapAttribute(vx_remap table, vx_enum attribute, const void * ptr, vx_size size)
+{
+    vx_status status = VX_ERROR_INVALID_REFERENCE;
+    AgoData * data = (AgoData *)table;
+    if (agoIsValidData(data, VX_TYPE_REMAP)) {
+        status = VX_ERROR_INVALID_PARAMETERS;
+        if (ptr) {
+            switch (attribute)
+            {
+            case VX_REMAP_ATTRIBUTE_AMD_TABLE_FORMAT:
+                if (size == sizeof(vx_enum)) {
+                    vx_enum format = *(vx_enum *)ptr;
+                    if (format == VX_REMAP_TABLE_FORMAT_AMD_COMPACT || format == VX_REMAP_TABLE_FORMAT_AMD_FAST) {
+                        data->u.remap.table_format = format;
+                        status = VX_SUCCESS;
+                    }
+                }
+                break;
             default:
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
@@ -8037,6 +8317,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxAddArrayItems(vx_array arr, vx_size count,
                 // update sync flags
                 data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                 data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                agoDataMarkModified(data);
             }
             status = VX_SUCCESS;
         }
@@ -8065,6 +8346,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxTruncateArray(vx_array arr, vx_size new_num
         status = VX_ERROR_INVALID_PARAMETERS;
         if (new_num_items <= data->u.arr.numitems) {
             data->u.arr.numitems = new_num_items;
+            agoDataMarkModified(data);
             status = VX_SUCCESS;
         }
     }
@@ -8244,6 +8526,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxCommitArrayRange(vx_array arr, vx_size star
                     // update sync flags
                     data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                     data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    agoDataMarkModified(data);
                 }
             }
         }
@@ -8450,6 +8733,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxUnmapArrayRange(vx_array array, vx_map_id m
                     // update sync flags
                     data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                     data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    agoDataMarkModified(data);
                 }
                 status = VX_SUCCESS;
                 break;
@@ -8906,6 +9190,260 @@ VX_API_ENTRY vx_status VX_API_CALL vxReleaseObjectArray(vx_object_array *arr)
     return status;
 }
 
+/*==============================================================================
+USER DATA OBJECT
+=============================================================================*/
+
+/*! \brief Creates a reference to a User Data Object.
+* \param [in] context The reference to the overall Context.
+* \param [in] type_name Pointer to the '\0' terminated string that identifies the type of object (NULL for unnamed).
+* \param [in] size The number of bytes required to store this instance of the user data object.
+* \param [in] ptr The pointer to the initial value of the user data object. If NULL, the object is zero-initialized.
+* \returns A user data object reference <tt>\ref vx_user_data_object</tt>. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>.
+* \ingroup group_user_data_object
+*/
+VX_API_ENTRY vx_user_data_object VX_API_CALL vxCreateUserDataObject(vx_context context, const vx_char *type_name, vx_size size, const void *ptr)
+{
+    AgoData * data = NULL;
+    if (agoIsValidContext(context) && size > 0 && (!type_name || strlen(type_name) < VX_MAX_REFERENCE_NAME)) {
+        CAgoLock lock(context->cs);
+        char desc[64 + VX_MAX_REFERENCE_NAME]; sprintf(desc, "user-data-object:" VX_FMT_SIZE ",%s", size, type_name ? type_name : "");
+        data = agoCreateDataFromDescription(context, NULL, desc, true);
+        if (data) {
+            agoGenerateDataName(context, "udo", data->name);
+            agoAddData(&context->dataList, data);
+            if (ptr) {
+                if (agoAllocData(data)) {
+                    agoReleaseData(data, true);
+                    return NULL;
+                }
+                memcpy(data->buffer, ptr, size);
+                data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
+                data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+            }
+        }
+    }
+    return (vx_user_data_object)data;
+}
+
+/*! \brief Creates an opaque reference to a virtual User Data Object with no direct user access.
+* \param [in] graph The reference to the parent graph.
+* \param [in] type_name Pointer to the '\0' terminated string that identifies the type of object (NULL for unnamed).
+* \param [in] size The number of bytes required to store this instance of the user data object (0 if set by the producer node).
+* \returns A user data object reference <tt>\ref vx_user_data_object</tt>. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>.
+* \ingroup group_user_data_object
+*/
+VX_API_ENTRY vx_user_data_object VX_API_CALL vxCreateVirtualUserDataObject(vx_graph graph, const vx_char *type_name, vx_size size)
+{
+    AgoData * data = NULL;
+    if (agoIsValidGraph(graph) && (!type_name || strlen(type_name) < VX_MAX_REFERENCE_NAME)) {
+        CAgoLock lock(graph->cs);
+        char desc[64 + VX_MAX_REFERENCE_NAME]; sprintf(desc, "user-data-object-virtual:" VX_FMT_SIZE ",%s", size, type_name ? type_name : "");
+        data = agoCreateDataFromDescription(graph->ref.context, graph, desc, true);
+        if (data) {
+            agoGenerateVirtualDataName(graph, "udo", data->name);
+            agoAddData(&graph->dataList, data);
+        }
+    }
+    return (vx_user_data_object)data;
+}
+
+/*! \brief Releases a reference of a User data object.
+* \param [in] user_data_object The pointer to the User Data Object to release.
+* \post After returning from this function the reference is zeroed.
+* \return A <tt>\ref vx_status_e</tt> enumeration.
+* \retval VX_SUCCESS No errors.
+* \retval VX_ERROR_INVALID_REFERENCE If user_data_object is not a <tt>\ref vx_user_data_object</tt>.
+* \ingroup group_user_data_object
+*/
+VX_API_ENTRY vx_status VX_API_CALL vxReleaseUserDataObject(vx_user_data_object *user_data_object)
+{
+    vx_status status = VX_ERROR_INVALID_REFERENCE;
+    if (user_data_object && agoIsValidData((AgoData*)*user_data_object, VX_TYPE_USER_DATA_OBJECT)) {
+        if (!agoReleaseData((AgoData*)*user_data_object, true)) {
+            *user_data_object = NULL;
+            status = VX_SUCCESS;
+        }
+    }
+    return status;
+}
+
+/*! \brief Queries the User data object for some specific information.
+* \param [in] user_data_object The reference to the User data object.
+* \param [in] attribute The attribute to query. Use a <tt>\ref vx_user_data_object_attribute_e</tt>.
+* \param [out] ptr The location at which to store the resulting value.
+* \param [in] size The size in bytes of the container to which \a ptr points.
+* \return A <tt>\ref vx_status_e</tt> enumeration.
+* \ingroup group_user_data_object
+*/
+VX_API_ENTRY vx_status VX_API_CALL vxQueryUserDataObject(vx_user_data_object user_data_object, vx_enum attribute, void *ptr, vx_size size)
+{
+    vx_status status = VX_ERROR_INVALID_REFERENCE;
+    AgoData * data = (AgoData *)user_data_object;
+    if (agoIsValidData(data, VX_TYPE_USER_DATA_OBJECT)) {
+        status = VX_ERROR_INVALID_PARAMETERS;
+        if (ptr) {
+            switch (attribute)
+            {
+            case VX_USER_DATA_OBJECT_NAME:
+                if (size <= VX_MAX_REFERENCE_NAME && size > 0) {
+                    strncpy((vx_char *)ptr, data->u.udo.type_name, size);
+                    ((vx_char *)ptr)[size - 1] = '\0';
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_USER_DATA_OBJECT_SIZE:
+                if (size == sizeof(vx_size)) {
+                    *(vx_size *)ptr = data->size;
+                    status = VX_SUCCESS;
+                }
+                break;
+            default:
+                status = VX_ERROR_NOT_SUPPORTED;
+                break;
+            }
+        }
+    }
+    return status;
+}
+
+/*! \brief Allows the application to copy a subset from/into a user data object.
+* \param [in] user_data_object The reference to the user data object that is the source or the destination of the copy.
+* \param [in] offset The byte offset into the user data object to copy.
+* \param [in] size The number of bytes to copy. A value of 0 means the whole object beyond offset.
+* \param [in] user_ptr The address of the user memory to copy from or to.
+* \param [in] usage VX_READ_ONLY copies from the object into user memory, VX_WRITE_ONLY copies user memory into the object.
+* \param [in] user_mem_type A <tt>\ref vx_memory_type_e</tt> enumeration; only VX_MEMORY_TYPE_HOST is supported.
+* \return A <tt>\ref vx_status_e</tt> enumeration.
+* \retval VX_ERROR_OPTIMIZED_AWAY This is a reference to a virtual user data object that cannot be accessed by the application.
+* \retval VX_ERROR_INVALID_REFERENCE The user_data_object reference is not actually a user data object reference.
+* \retval VX_ERROR_INVALID_PARAMETERS An other parameter is incorrect.
+* \ingroup group_user_data_object
+*/
+VX_API_ENTRY vx_status VX_API_CALL vxCopyUserDataObject(vx_user_data_object user_data_object, vx_size offset, vx_size size, void *user_ptr, vx_enum usage, vx_enum user_mem_type)
+{
+    AgoData * data = (AgoData *)user_data_object;
+    vx_status status = VX_ERROR_INVALID_REFERENCE;
+    if (agoIsValidData(data, VX_TYPE_USER_DATA_OBJECT)) {
+        status = VX_ERROR_INVALID_PARAMETERS;
+        if (size == 0 && offset < data->size)
+            size = data->size - offset;
+        if (data->isVirtual && !data->buffer) {
+            status = VX_ERROR_OPTIMIZED_AWAY;
+        }
+        else if ((user_mem_type == VX_MEMORY_TYPE_HOST) && user_ptr && (usage == VX_READ_ONLY || usage == VX_WRITE_ONLY) &&
+                 size > 0 && offset < data->size && size <= data->size - offset)
+        {
+            if (!data->buffer) {
+                CAgoLock lock(data->ref.context->cs);
+                if (agoAllocData(data)) {
+                    return VX_FAILURE;
+                }
+            }
+            if (usage == VX_READ_ONLY) {
+                memcpy(user_ptr, data->buffer + offset, size);
+            }
+            else {
+                memcpy(data->buffer + offset, user_ptr, size);
+                // update sync flags
+                data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
+                data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                agoDataMarkModified(data);
+            }
+            status = VX_SUCCESS;
+        }
+    }
+    return status;
+}
+
+/*! \brief Allows the application to get direct access to a subset of the user data object.
+* The returned pointer addresses the object storage itself, so no copy is made in either direction.
+* \param [in] user_data_object The reference to the user data object that contains the subset to map.
+* \param [in] offset The byte offset into the user data object to map.
+* \param [in] size The number of bytes to map. A value of 0 means the whole object beyond offset.
+* \param [out] map_id The address of a vx_map_id variable where the function returns a map identifier.
+* \param [out] ptr The address of a pointer that the function sets to the address where the requested data can be accessed.
+* \param [in] usage This declares the access mode for the user data object, using the <tt>\ref vx_accessor_e</tt> enumeration.
+* \param [in] mem_type A <tt>\ref vx_memory_type_e</tt> enumeration; only VX_MEMORY_TYPE_HOST is supported.
+* \param [in] flags An integer that allows passing options to the map operation. Use 0 for this option.
+* \return A <tt>\ref vx_status_e</tt> enumeration.
+* \retval VX_ERROR_OPTIMIZED_AWAY This is a reference to a virtual user data object that cannot be accessed by the application.
+* \retval VX_ERROR_INVALID_REFERENCE The user_data_object reference is not actually a user data object reference.
+* \retval VX_ERROR_INVALID_PARAMETERS An other parameter is incorrect.
+* \ingroup group_user_data_object
+* \post <tt>\ref vxUnmapUserDataObject</tt> with same (*map_id) value.
+*/
+VX_API_ENTRY vx_status VX_API_CALL vxMapUserDataObject(vx_user_data_object user_data_object, vx_size offset, vx_size size, vx_map_id *map_id, void **ptr, vx_enum usage, vx_enum mem_type, vx_uint32 flags)
+{
+    AgoData * data = (AgoData *)user_data_object;
+    vx_status status = VX_ERROR_INVALID_REFERENCE;
+    if (agoIsValidData(data, VX_TYPE_USER_DATA_OBJECT)) {
+        status = VX_ERROR_INVALID_PARAMETERS;
+        if (size == 0 && offset < data->size)
+            size = data->size - offset;
+        if (data->isVirtual && !data->buffer) {
+            status = VX_ERROR_OPTIMIZED_AWAY;
+        }
+        else if (map_id && ptr && (mem_type == VX_MEMORY_TYPE_HOST) && size > 0 && offset < data->size && size <= data->size - offset) {
+            if (!data->buffer) {
+                CAgoLock lock(data->ref.context->cs);
+                if (agoAllocData(data)) {
+                    return VX_FAILURE;
+                }
+            }
+            vx_uint8 * ptr_returned = data->buffer + offset;
+            status = VX_SUCCESS;
+            for (auto i = data->mapped.begin(); i != data->mapped.end(); i++) {
+                if (i->ptr == ptr_returned) {
+                    // can't support mapping the same location more than once, the application
+                    // needs to call vxUnmapUserDataObject() before mapping it again
+                    status = VX_FAILURE;
+                }
+            }
+            if (status == VX_SUCCESS) {
+                MappedData item = { data->nextMapId++, ptr_returned, usage, false };
+                data->mapped.push_back(item);
+                *map_id = item.map_id;
+                *ptr = ptr_returned;
+            }
+        }
+    }
+    return status;
+}
+
+/*! \brief Unmap and commit potential changes to a user data object subset that was previously mapped.
+* \param [in] user_data_object The reference to the user data object to unmap.
+* \param [in] map_id The unique map identifier that was returned when calling <tt>\ref vxMapUserDataObject</tt>.
+* \return A <tt>\ref vx_status_e</tt> enumeration.
+* \retval VX_ERROR_INVALID_REFERENCE The user_data_object reference is not actually a user data object reference.
+* \retval VX_ERROR_INVALID_PARAMETERS An other parameter is incorrect.
+* \ingroup group_user_data_object
+* \pre <tt>\ref vxMapUserDataObject</tt> returning the same map_id value
+*/
+VX_API_ENTRY vx_status VX_API_CALL vxUnmapUserDataObject(vx_user_data_object user_data_object, vx_map_id map_id)
+{
+    AgoData * data = (AgoData *)user_data_object;
+    vx_status status = VX_ERROR_INVALID_REFERENCE;
+    if (agoIsValidData(data, VX_TYPE_USER_DATA_OBJECT)) {
+        status = VX_ERROR_INVALID_PARAMETERS;
+        for (auto i = data->mapped.begin(); i != data->mapped.end(); i++) {
+            if (i->map_id == map_id) {
+                vx_enum usage = i->usage;
+                data->mapped.erase(i);
+                if (usage == VX_WRITE_ONLY || usage == VX_READ_AND_WRITE) {
+                    // update sync flags
+                    data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
+                    data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    agoDataMarkModified(data);
+                }
+                status = VX_SUCCESS;
+                break;
+            }
+        }
+    }
+    return status;
+}
+
 /*==============================================================================
 META FORMAT
 =============================================================================*/
@@ -9161,6 +9699,20 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetMetaFormatAttribute(vx_meta_format meta,
                 }
                 break;
             /**********************************************************************/
+            case VX_USER_DATA_OBJECT_NAME:
+                if (size <= VX_MAX_REFERENCE_NAME && meta->data.ref.type == VX_TYPE_USER_DATA_OBJECT) {
+                    strncpy(meta->data.u.udo.type_name, (const vx_char *)ptr, size);
+                    meta->data.u.udo.type_name[VX_MAX_REFERENCE_NAME - 1] = '\0';
+                    status = VX_SUCCESS;
+                }
+                break;
+            case VX_USER_DATA_OBJECT_SIZE:
+                if (size == sizeof(vx_size) && meta->data.ref.type == VX_TYPE_USER_DATA_OBJECT) {
+                    meta->data.size = *(vx_size *)ptr;
+                    status = VX_SUCCESS;
+                }
+                break;
+            /**********************************************************************/
             default:
                 status = VX_ERROR_NOT_SUPPORTED;
                 break;
@@ -9240,6 +9792,10 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetMetaFormatFromReference(vx_meta_format m
             meta->data.u.mat.pattern = ref->u.mat.pattern;
             meta->data.u.mat.origin = ref->u.mat.origin;
             break;
+        case VX_TYPE_USER_DATA_OBJECT:
+            meta->data.size = ref->size;
+            strncpy(meta->data.u.udo.type_name, ref->u.udo.type_name, VX_MAX_REFERENCE_NAME);
+            break;
         default:
             status = VX_ERROR_INVALID_REFERENCE;
             break;
@@ -9256,7 +9812,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxGetReferenceName(vx_reference ref, vx_char
 {
     vx_status status = VX_ERROR_INVALID_REFERENCE;
     if (agoIsValidReference(ref)) {
-        if ((ref->type >= VX_TYPE_DELAY && ref->type <= VX_TYPE_REMAP) || ref->type == VX_TYPE_TENSOR || (ref->type >= VX_TYPE_VENDOR_OBJECT_START && ref->type <= VX_TYPE_VENDOR_OBJECT_END)) {
+        if ((ref->type >= VX_TYPE_DELAY && ref->type <= VX_TYPE_REMAP) || ref->type == VX_TYPE_TENSOR || ref->type == VX_TYPE_USER_DATA_OBJECT || (ref->type >= VX_TYPE_VENDOR_OBJECT_START && ref->type <= VX_TYPE_VENDOR_OBJECT_END)) {
             strncpy(name, ((AgoData *)ref)->name.c_str(), size);
             status = VX_SUCCESS;
         }
@@ -9735,6 +10291,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxCopyTensorPatch(vx_tensor tensor, vx_size n
                 // update sync flags
                 dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                 dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                agoDataMarkModified(dataToSync);
             }
             status = VX_SUCCESS;
         }
@@ -9898,6 +10455,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxUnmapTensorPatch(vx_tensor tensor, vx_map_i
                     AgoData * dataToSync = data->u.tensor.roiMaster ? data->u.tensor.roiMaster : data;
                     dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                     dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    agoDataMarkModified(dataToSync);
                 }
                 status = VX_SUCCESS;
                 break;
@@ -9999,6 +10557,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxSwapTensorHandle(vx_tensor tensor, void * n
             if (data->buffer) {
                 data->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
                 data->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                agoDataMarkModified(data);
             }
             // propagate to ROIs
             for (auto roi = data->roiDepList.begin(); roi != data->roiDepList.end(); roi++) {
@@ -10067,4 +10626,58 @@ VX_API_ENTRY vx_bool VX_API_CALL vxIsTensorAliased(vx_tensor tensorMaster, vx_si
         status = vx_true_e;
     }
     return status;
-}
\ No newline at end of file
+}
+/*! \brief Notifies framework that the kernel supports buffer aliasing of specified parameters
+* \param [in] kernel Kernel reference
+* \param [in] parameter_index_a Index of a kernel parameter to request for aliasing
+* \param [in] parameter_index_b Index of another kernel paramter to request to alias with parameter_index_a
+* \param [in] processing_type Indicate the type of processing on this buffer from the kernel
+* \return A <tt>\ref vx_status_e</tt> enumeration.
+* \ingroup group_buffer_aliasing
+*/
+VX_API_ENTRY vx_status VX_API_CALL vxAliasParameterIndexHint(vx_kernel kernel, vx_uint32 parameter_index_a, vx_uint32 parameter_index_b, vx_enum processing_type)
+{
+    vx_status status = VX_ERROR_INVALID_REFERENCE;
+    if (agoIsValidKernel(kernel)) {
+        CAgoLock lock(kernel->ref.context->cs);
+        status = VX_ERROR_INVALID_PARAMETERS;
+        if (!kernel->finalized && parameter_index_a < kernel->argCount && parameter_index_b < kernel->argCount &&
+            parameter_index_a != parameter_index_b)
+        {
+            status = VX_FAILURE;
+            if (processing_type == VX_BUFFER_ALIASING_PROCESSING_TYPE_DENSE || processing_type == VX_BUFFER_ALIASING_PROCESSING_TYPE_SPARSE) {
+                // the optimizer shares the buffers only when one is an output and other is an input of the node
+                kernel->alias_param_index_plus1[parameter_index_a] = parameter_index_b + 1;
+                kernel->alias_param_index_plus1[parameter_index_b] = parameter_index_a + 1;
+                kernel->alias_processing_type[parameter_index_a] = processing_type;
+                kernel->alias_processing_type[parameter_index_b] = processing_type;
+                status = VX_SUCCESS;
+            }
+        }
+    }
+    return status;
+}
+
+/*! \brief Query framework if the specified parameters are aliased
+* \param [in] node Node reference
+* \param [in] parameter_index_a Index of a kernel parameter to query for aliasing
+* \param [in] parameter_index_b Index of another kernel paramter to query to alias with parameter_index_a
+* \return A <tt>\ref vx_bool</tt> value.
+* \ingroup group_buffer_aliasing
+*/
+VX_API_ENTRY vx_bool VX_API_CALL vxIsParameterAliased(vx_node node, vx_uint32 parameter_index_a, vx_uint32 parameter_index_b)
+{
+    vx_bool aliased = vx_false_e;
+    if (agoIsValidNode(node) && parameter_index_a < node->paramCount && parameter_index_b < node->paramCount &&
+        parameter_index_a != parameter_index_b)
+    {
+        AgoData * dataA = node->paramList[parameter_index_a];
+        AgoData * dataB = node->paramList[parameter_index_b];
+        if (dataA && dataB && dataA->buffer && dataA->buffer == dataB->buffer &&
+            (dataA->buffer_alias_data == dataB || dataB->buffer_alias_data == dataA))
+        {
+            aliased = vx_true_e;
+        }
+    }
+    return aliased;
+}
@@ -788,4 +788,45 @@ VX_API_ENTRY vx_node VX_API_CALL vxLaplacianReconstructNode(vx_graph graph, vx_p
                                            params,
                                            dimof(params));
     return node;
-}
\ No newline at end of file
+}
+
+// vxTensorAddNode, vxTensorSubtractNode, vxTensorMultiplyNode, vxTensorTableLookupNode and vxTensorMatrixMultiplyNode
+// are exported by the vx_nn module; without it those built-in kernels are available through vxCreateGenericNode
+VX_API_ENTRY vx_node VX_API_CALL vxTensorTransposeNode(vx_graph graph, vx_tensor input, vx_tensor output, vx_size dimension1, vx_size dimension2)
+{
+    vx_context context = vxGetContext((vx_reference)graph);
+    vx_scalar sdim1 = vxCreateScalarWithSize(context, VX_TYPE_SIZE, &dimension1, sizeof(dimension1));
+    vx_scalar sdim2 = vxCreateScalarWithSize(context, VX_TYPE_SIZE, &dimension2, sizeof(dimension2));
+    vx_reference params[] = {
+       (vx_reference)input,
+       (vx_reference)output,
+       (vx_reference)sdim1,
+       (vx_reference)sdim2,
+    };
+    vx_node node = vxCreateNodeByStructure(graph,
+                                           VX_KERNEL_TENSOR_TRANSPOSE,
+                                           params,
+                                           dimof(params));
+    vxReleaseScalar(&sdim1);
+    vxReleaseScalar(&sdim2);
+    return node;
+}
+
+VX_API_ENTRY vx_node VX_API_CALL vxTensorConvertDepthNode(vx_graph graph, vx_tensor input, vx_enum policy, vx_scalar norm, vx_scalar offset, vx_tensor output)
+{
+    vx_context context = vxGetContext((vx_reference)graph);
+    vx_scalar spolicy = vxCreateScalar(context, VX_TYPE_ENUM, &policy);
+    vx_reference params[] = {
+       (vx_reference)input,
+       (vx_reference)spolicy,
+       (vx_reference)norm,
+       (vx_reference)offset,
+       (vx_reference)output,
+    };
+    vx_node node = vxCreateNodeByStructure(graph,
+                                           VX_KERNEL_TENSOR_CONVERT_DEPTH,
+                                           params,
+                                           dimof(params));
+    vxReleaseScalar(&spolicy);
+    return node;
+}
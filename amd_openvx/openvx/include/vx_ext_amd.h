@@ -58,6 +58,11 @@ THE SOFTWARE.
  */
 #define VX_NN_ACTIVATION_LEAKY_RELU  (VX_ENUM_BASE(VX_ID_AMD, VX_ENUM_NN_ACTIVATION_FUNCTION_TYPE) + 0x9)
 
+/*! \brief The AMD enumeration types.
+ */
+#define VX_ENUM_REMAP_TABLE_FORMAT_AMD  0x80 // remap table format
+#define VX_ENUM_TARGET_PARTITION_AMD    0x81 // graph node target partitioning
+
 /*! \brief The attributes for vx_context
  */
 #define VX_CONTEXT_ATTRIBUTE_NONLINEAR_MAX_DIMENSION            VX_CONTEXT_NONLINEAR_MAX_DIMENSION
@@ -109,6 +114,13 @@ enum vx_context_attribute_amd_e {
     VX_CONTEXT_CL_QUEUE_PROPERTIES = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_CONTEXT) + 0x06,
     /*! \brief HIP context. Use a <tt>\ref cl_context</tt> parameter.*/
     VX_CONTEXT_ATTRIBUTE_AMD_HIP_DEVICE = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_CONTEXT) + 0x07,
+    /*! \brief number of worker threads shared by all graphs for vxScheduleGraph (default 0). Use a <tt>\ref vx_uint32</tt> parameter.
+    *   When non-zero, graphs created afterwards don't get their own thread: scheduled graphs are queued by priority
+    *   and deadline and executed by a fixed pool of worker threads. The default comes from the AGO_SCHEDULER_THREADS
+    *   environment variable. Can't be changed once the workers are started.*/
+    VX_CONTEXT_ATTRIBUTE_AMD_SCHEDULER_THREADS = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_CONTEXT) + 0x08,
+    /*! \brief graph scheduler queue statistics. Use a <tt>\ref AgoSchedulerInfo</tt> parameter. Read-only.*/
+    VX_CONTEXT_ATTRIBUTE_AMD_SCHEDULER_INFO    = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_CONTEXT) + 0x09,
 };
 
 /*! \brief The AMD kernel attributes list.
@@ -126,6 +138,12 @@ enum vx_kernel_attribute_amd_e {
     VX_KERNEL_ATTRIBUTE_AMD_OPENCL_BUFFER_ACCESS_ENABLE        = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_KERNEL) + 0x05,
     /*! \brief kernel callback for OpenCL buffer update. Use a <tt>\ref AgoKernelOpenclBufferUpdateInfo</tt> parameter.*/
     VX_KERNEL_ATTRIBUTE_AMD_OPENCL_BUFFER_UPDATE_CALLBACK      = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_KERNEL) + 0x06,
+    /*! \brief kernel flag to process all replicas of a node replicated with vxReplicateNode in one call (default OFF). Use a <tt>\ref vx_bool</tt> parameter.
+    * When enabled, the kernel function is invoked once per graph execution with the parent object array or pyramid
+    * in place of each replicated parameter. Validation is still done per replica.
+    * The performance of each replica covers the execution of all replicas.
+    */
+    VX_KERNEL_ATTRIBUTE_AMD_REPLICATE_BATCH_ENABLE             = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_KERNEL) + 0x07,
 };
 
 /*! \brief The AMD graph attributes list.
@@ -147,6 +165,38 @@ enum vx_graph_attribute_amd_e {
     VX_GRAPH_ATTRIBUTE_AMD_PERFORMANCE_INTERNAL_PROFILE = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x07,
     /*! \brief OpenCL command queue. Use a <tt>\ref cl_command_queue</tt> parameter.*/
     VX_GRAPH_ATTRIBUTE_AMD_OPENCL_COMMAND_QUEUE         = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x08,
+    /*! \brief number of frames processed by each vxProcessGraph call (default 1). Use a <tt>\ref vx_uint32</tt> parameter.
+    *   Must be set before the graph is verified. Graph parameters are then bound with <tt>\ref vxSetGraphParameterByIndex</tt>
+    *   to object arrays holding one item per frame. Frames go through one node at a time only when all nodes run on CPU
+    *   and the graph has no delays or ROI images/tensors; otherwise the whole graph is run once per frame and a warning
+    *   is logged. Node outputs get one copy per frame, so intermediate data takes K times the memory.*/
+    VX_GRAPH_ATTRIBUTE_AMD_BATCH_FRAME_COUNT            = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x09,
+    /*! \brief graph latency percentiles since graph verification, one sample per frame (with graph batching, the time of a batch is split evenly across its frames). Use a <tt>\ref AgoLatencyInfo</tt> parameter.*/
+    VX_GRAPH_ATTRIBUTE_AMD_LATENCY                      = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x0A,
+    /*! \brief incremental execution (default vx_false_e). Use a <tt>\ref vx_bool</tt> parameter.
+    *   When enabled, a CPU node is skipped if none of its parameters were written since its last execution and
+    *   its outputs from that execution are reused. Writes are tracked through the OpenVX copy/map/commit/swap APIs,
+    *   so data imported from handle must be updated with <tt>\ref vxSwapImageHandle</tt> or a map for write.
+    *   Nodes with bidirectional parameters or a completion callback always execute, and user kernels must not keep
+    *   state across frames.*/
+    VX_GRAPH_ATTRIBUTE_AMD_INCREMENTAL_EXECUTION        = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x0B,
+    /*! \brief how nodes without user affinity are assigned to CPU/GPU when the graph is verified. Use a <tt>\ref vx_target_partition_amd_e</tt> parameter.
+    *   The default comes from the AGO_TARGET_PARTITION environment variable (AFFINITY, COST, or CALIBRATE).
+    *   Node execution times are kept in a per-context cost table, which is loaded from and saved to the
+    *   file named by the AGO_COST_TABLE environment variable.
+    *   For testing without a GPU, AGO_COST_MOCK_GPU=scale[,launch_ns] models the GPU time of each node as its
+    *   CPU time * scale + launch_ns. The mock does not model CPU/GPU copies: they are estimated only from the
+    *   "transfer" parameters of the cost table, which are never measured, so its partitions are not representative
+    *   of a real GPU.*/
+    VX_GRAPH_ATTRIBUTE_AMD_TARGET_PARTITION             = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x0C,
+    /*! \brief scheduling priority (default 0). Use a <tt>\ref vx_int32</tt> parameter.
+    *   With <tt>\ref VX_CONTEXT_ATTRIBUTE_AMD_SCHEDULER_THREADS</tt>, queued graphs with higher priority run first.*/
+    VX_GRAPH_ATTRIBUTE_AMD_PRIORITY                     = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x0D,
+    /*! \brief deadline in nanoseconds from each vxScheduleGraph call (default 0: none). Use a <tt>\ref vx_uint64</tt> parameter.
+    *   Among queued graphs of the same priority, the earliest deadline runs first.*/
+    VX_GRAPH_ATTRIBUTE_AMD_DEADLINE                     = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x0E,
+    /*! \brief scheduler statistics of the graph. Use a <tt>\ref AgoGraphScheduleInfo</tt> parameter. Read-only.*/
+    VX_GRAPH_ATTRIBUTE_AMD_SCHEDULE_INFO                = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_GRAPH) + 0x0F,
 };
 
 /*! \brief The AMD node attributes list.
@@ -156,6 +206,8 @@ enum vx_node_attribute_amd_e {
     VX_NODE_ATTRIBUTE_AMD_AFFINITY                      = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_NODE) + 0x01,
     /*! \brief OpenCL command queue. Use a <tt>\ref cl_command_queue</tt> parameter.*/
     VX_NODE_ATTRIBUTE_AMD_OPENCL_COMMAND_QUEUE          = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_NODE) + 0x02,
+    /*! \brief node latency percentiles since graph verification, one sample per frame. Use a <tt>\ref AgoLatencyInfo</tt> parameter.*/
+    VX_NODE_ATTRIBUTE_AMD_LATENCY                       = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_NODE) + 0x03,
 };
 
 /*! \brief The AMD image attributes list.
@@ -175,6 +227,11 @@ enum vx_image_attribute_amd_e {
     VX_IMAGE_ATTRIBUTE_AMD_HOST_BUFFER               = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_IMAGE) + 0x05,
     /*! \brief sync with user specified hip memory. */
     VX_IMAGE_ATTRIBUTE_AMD_HIP_BUFFER               = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_IMAGE) + 0x06,
+    /*! \brief region of the image used by the application. Use a <tt>\ref vx_rectangle_t</tt> parameter.
+    * Graphs only compute the pixels needed for this region (back-propagated through element-wise and
+    * fixed-neighborhood kernels); the rest of the image is undefined after execution. Changes of this region or
+    * of image valid rectangles take effect at the next graph execution. An empty rectangle (default) selects the whole image.*/
+    VX_IMAGE_ATTRIBUTE_AMD_RECT_OF_INTEREST         = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_IMAGE) + 0x07,
 };
 
 /*! \brief tensor Data attributes.
@@ -203,6 +260,35 @@ enum vx_array_attribute_amd_e {
         VX_ARRAY_BUFFER    = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_ARRAY ) + 0x11
 };
 
+/*! \brief The AMD remap attributes list.
+*/
+enum vx_remap_attribute_amd_e {
+    /*! \brief table format used by CPU bilinear remap kernels. Use a <tt>\ref vx_remap_table_format_amd_e</tt> parameter.
+    * The format is picked up by nodes when the graph is verified.*/
+    VX_REMAP_ATTRIBUTE_AMD_TABLE_FORMAT = VX_ATTRIBUTE_BASE(VX_ID_AMD, VX_TYPE_REMAP) + 0x01,
+};
+
+/*! \brief The remap table formats used by the <tt>\ref VX_REMAP_ATTRIBUTE_AMD_TABLE_FORMAT</tt> attribute of a <tt>\ref vx_remap</tt>.
+*/
+enum vx_remap_table_format_amd_e {
+    /*! \brief kernels read the 16-bit fixed-point coordinate table directly (default). */
+    VX_REMAP_TABLE_FORMAT_AMD_COMPACT = VX_ENUM_BASE(VX_ID_AMD, VX_ENUM_REMAP_TABLE_FORMAT_AMD) + 0x0,
+    /*! \brief nodes keep a prepared table of source offsets and bilinear weights (twice the memory of compact table). */
+    VX_REMAP_TABLE_FORMAT_AMD_FAST    = VX_ENUM_BASE(VX_ID_AMD, VX_ENUM_REMAP_TABLE_FORMAT_AMD) + 0x1,
+};
+
+/*! \brief The partitioning modes used by the <tt>\ref VX_GRAPH_ATTRIBUTE_AMD_TARGET_PARTITION</tt> attribute of a <tt>\ref vx_graph</tt>.
+*/
+enum vx_target_partition_amd_e {
+    /*! \brief targets come from node/graph affinity and AGO_DEFAULT_TARGET (default). */
+    VX_TARGET_PARTITION_AMD_AFFINITY  = VX_ENUM_BASE(VX_ID_AMD, VX_ENUM_TARGET_PARTITION_AMD) + 0x0,
+    /*! \brief targets minimize the estimated graph latency, including CPU/GPU transfers, using measured node costs. */
+    VX_TARGET_PARTITION_AMD_COST      = VX_ENUM_BASE(VX_ID_AMD, VX_ENUM_TARGET_PARTITION_AMD) + 0x1,
+    /*! \brief each node runs on the supported target with fewest cost samples, so that repeated
+    *   verify/process cycles measure every node on every target. */
+    VX_TARGET_PARTITION_AMD_CALIBRATE = VX_ENUM_BASE(VX_ID_AMD, VX_ENUM_TARGET_PARTITION_AMD) + 0x2,
+};
+
 /*! \brief These enumerations are given to the \c vxDirective API to enable/disable
 * platform optimizations and/or features. Directives are not optional and
 * usually are vendor-specific, by defining a vendor range of directives and
@@ -249,7 +335,10 @@ enum vx_df_image_amd_e {
     VX_DF_IMAGE_F16_AMD   = VX_DF_IMAGE('F', '0', '1', '6'),  // AGO image with 16-bit floating-point (half)
     VX_DF_IMAGE_F32_AMD   = VX_DF_IMAGE('F', '0', '3', '2'),  // AGO image with 32-bit floating-point (float)
     VX_DF_IMAGE_F64_AMD   = VX_DF_IMAGE('F', '0', '6', '4'),  // AGO image with 64-bit floating-point (double)
+    VX_DF_IMAGE_U64_AMD   = VX_DF_IMAGE('U', '0', '6', '4'),  // AGO image with 64-bit unsigned integer data (integral image output, CPU only)
     VX_DF_IMAGE_F32x3_AMD = VX_DF_IMAGE('F', '3', '3', '2'),  // AGO image with THREE 32-bit floating-point channels in one buffer
+    VX_DF_IMAGE_P010_AMD  = VX_DF_IMAGE('P', '0', '1', '0'),  // AGO image with 10-bit YUV 4:2:0: 16-bit Y plane and interleaved 16-bit UV plane (data in upper 10 bits, CPU only)
+    VX_DF_IMAGE_P016_AMD  = VX_DF_IMAGE('P', '0', '1', '6'),  // AGO image with 16-bit YUV 4:2:0: 16-bit Y plane and interleaved 16-bit UV plane (CPU only)
 };
 
 /*! \brief The multidimensional data object (Tensor).
@@ -318,6 +407,39 @@ typedef struct {
     vx_uint64 buffer_write;
 } AgoGraphPerfInternalInfo;
 
+/*! \brief AMD data structure to get latency percentiles of a graph or node (time in nanoseconds).
+* Percentiles come from a log-linear histogram and are within ~6% of the actual value.
+*/
+typedef struct {
+    vx_uint64 count;    // number of executions
+    vx_uint64 p50;      // median latency
+    vx_uint64 p99;      // 99th percentile latency
+    vx_uint64 p999;     // 99.9th percentile latency
+    vx_uint64 max;      // maximum latency
+} AgoLatencyInfo;
+
+/*! \brief AMD data structure to get graph scheduler statistics of a context.
+* Wait time is measured from vxScheduleGraph until a worker thread starts executing the graph.
+*/
+typedef struct {
+    vx_uint32 num_threads;        // number of worker threads
+    vx_uint32 queue_depth;        // graphs waiting for a worker thread
+    vx_uint32 queue_depth_max;    // highest queue depth seen
+    vx_uint32 running;            // graphs being executed by worker threads
+    vx_uint64 scheduled;          // number of vxScheduleGraph requests
+    vx_uint64 completed;          // number of executions completed by worker threads
+    vx_uint64 deadline_missed;    // executions completed after their deadline
+    AgoLatencyInfo wait;          // queue wait time percentiles
+} AgoSchedulerInfo;
+
+/*! \brief AMD data structure to get graph scheduler statistics of a graph.
+*/
+typedef struct {
+    vx_uint32 pending;            // requests waiting to be executed
+    vx_uint64 deadline_missed;    // executions completed after their deadline
+    AgoLatencyInfo wait;          // queue wait time percentiles
+} AgoGraphScheduleInfo;
+
 /*! \brief AMD data structure to specify node merge rule.
 */
 typedef struct AgoNodeMergeRule_t {
@@ -578,6 +700,20 @@ VX_API_ENTRY vx_status VX_API_CALL vxSetContextImageFormatDescription(vx_context
 */
 VX_API_ENTRY vx_status VX_API_CALL vxGetContextImageFormatDescription(vx_context context, vx_df_image format, AgoImageFormatDescription * desc);
 
+/**
+* \brief Set attributes of a remap table.
+* \ingroup group_remap
+* \param [in] table The remap table.
+* \param [in] attribute The attribute to set. Use a <tt>\ref vx_remap_attribute_amd_e</tt> enumeration.
+* \param [in] ptr The pointer to the value of the attribute.
+* \param [in] size The size of the value pointed by \a ptr.
+* \return A \ref vx_status_e enumeration.
+* \retval VX_SUCCESS No errors.
+* \retval VX_ERROR_INVALID_REFERENCE if reference is not valid.
+* \retval VX_ERROR_NOT_SUPPORTED if attribute is not supported.
+*/
+VX_API_ENTRY vx_status VX_API_CALL vxSetRemapAttribute(vx_remap table, vx_enum attribute, const void * ptr, vx_size size);
+
 /* Tensor */
 VX_API_ENTRY vx_tensor VX_API_CALL vxCreateTensorFromHandle(vx_context context, vx_size number_of_dims, const vx_size * dims, vx_enum data_type, vx_int8 fixed_point_position, const vx_size * stride, void * ptr, vx_enum memory_type);
 VX_API_ENTRY vx_status VX_API_CALL vxSwapTensorHandle(vx_tensor tensor, void * new_ptr, void** prev_ptr);
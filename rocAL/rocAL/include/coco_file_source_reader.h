@@ -29,6 +29,9 @@ public:
     */
     size_t open() override;
 
+    //! Advances to the next file in the folder and returns its path without opening it
+    bool next_file_path(std::string& file_path) override;
+
     //! Resets the object's state to read from the first file in the folder
     void reset() override;
 
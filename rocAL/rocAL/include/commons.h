@@ -85,4 +85,9 @@ struct Timing
     long long unsigned bb_load_time= 0;
     long long unsigned mask_load_time = 0;
     long long unsigned shuffle_time = 0;
+    // The following are averages over the files read since the last query
+    long long unsigned image_read_latency = 0; //!< Average latency of a single file read in microseconds
+    long long unsigned image_read_queue_depth = 0; //!< Average number of file reads in flight when a read is issued
+    long long unsigned process_cycle_time = 0; //!< Average time of processing a single internal batch in microseconds
+    long long unsigned process_parallelism = 0; //!< Number of images the augmentation graph processes at once (internal batch size)
 };
\ No newline at end of file
@@ -48,6 +48,7 @@ public:
     LoaderModuleStatus set_cpu_sched_policy(struct sched_param sched_policy);
     std::vector<std::string> get_id() override;
     decoded_image_info get_decode_image_info() override;
+    void set_thread_pool(std::shared_ptr<ThreadPool> thread_pool) override;
 private:
     bool is_out_of_data();
     void de_init();
@@ -76,5 +77,6 @@ private:
     size_t _remaining_image_count;//!< How many images are there yet to be loaded
     bool _decoder_keep_original = false;
     std::shared_ptr<RandomBBoxCrop_MetaDataReader> _randombboxcrop_meta_data_reader = nullptr; 
+    std::shared_ptr<ThreadPool> _thread_pool = nullptr;
 };
 
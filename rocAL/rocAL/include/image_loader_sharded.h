@@ -42,6 +42,7 @@ public:
     std::vector<std::string> get_id() override;
     decoded_image_info get_decode_image_info() override;
     Timing timing() override;
+    void set_thread_pool(std::shared_ptr<ThreadPool> thread_pool) override;
 private:
     void increment_loader_idx();
     const DeviceResources _dev_resources;
@@ -53,4 +54,5 @@ private:
 
     Image *_output_image;
     std::shared_ptr<RandomBBoxCrop_MetaDataReader> _randombboxcrop_meta_data_reader = nullptr;
+    std::shared_ptr<ThreadPool> _thread_pool = nullptr;//!< Shared by all the loaders, so that the shards don't oversubscribe the host
 };
\ No newline at end of file
@@ -24,11 +24,15 @@ THE SOFTWARE.
 #include <dirent.h>
 #include <vector>
 #include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include "commons.h"
 #include "turbo_jpeg_decoder.h"
 #include "reader_factory.h"
 #include "timing_debug.h"
 #include "loader_module.h"
+#include "thread_pool.h"
 
 /**
  * Compute the scaled value of <tt>dimension</tt> using the given scaling
@@ -49,6 +53,8 @@ public:
     void create(ReaderConfig reader_config, DecoderConfig decoder_config, int batch_size);
     void set_bbox_vector(std::vector<std::vector <float>> bbox_coords) { _bbox_coords = bbox_coords;};
     void set_random_bbox_data_reader(std::shared_ptr<RandomBBoxCrop_MetaDataReader> randombboxcrop_meta_data_reader);
+    //! Sets the threads the images are decoded on, if not set before create() a private pool with a thread per core is created
+    void set_thread_pool(std::shared_ptr<ThreadPool> thread_pool) { _thread_pool = thread_pool; }
 
     //! Loads a decompressed batch of images into the buffer indicated by buff
     /// \param buff User's buffer provided to be filled with decoded image samples
@@ -74,6 +80,30 @@ public:
     Timing timing();
 
 private:
+    //! A single file read handed to the read threads
+    struct FileRead
+    {
+        std::string file_path;
+        std::string name;
+        std::vector<unsigned char>* buff = nullptr; //!< Grown to the file size if set, otherwise the file is read into dst
+        unsigned char* dst = nullptr;
+        size_t max_size = 0;
+        size_t file_size = 0;
+        size_t read_size = 0; //!< Set once the file is read, 0 if the file couldn't be accessed
+    };
+    //! Takes the next files from the reader and queues them for the read threads, returns false if the reader can't provide file paths
+    bool issue_file_reads(std::vector<FileRead>& reads, size_t count);
+    //! Blocks until all the file reads issued last are done
+    void wait_for_file_reads();
+    //! Replaces the files that couldn't be read with the next files from the reader, read on the caller's thread
+    //! returns false if the reader ran out of files before every failed read was replaced
+    bool replace_failed_reads(std::vector<FileRead>& reads, size_t count);
+    //! Reads a single file on the caller's thread and returns the latency of the read in microseconds
+    long long unsigned read_file(FileRead& file_read);
+    //! Starts reading the files of the next batch into the prefetch buffers, these reads run while the current batch is decoded
+    void prefetch_next_batch();
+    void read_routine();
+    void stop_read_threads();
     std::vector<std::shared_ptr<Decoder>> _decoder;
     std::vector<std::shared_ptr<Decoder>> _decoder_cv;
     std::shared_ptr<Reader> _reader;
@@ -94,5 +124,21 @@ private:
     std::vector<std::vector <float>> _bbox_coords;
     std::shared_ptr<RandomBBoxCrop_MetaDataReader> _randombboxcrop_meta_data_reader = nullptr;
     pCropCord _CropCord;
+    std::vector<std::thread> _read_threads;
+    std::mutex _read_mutex;
+    std::condition_variable _read_cv, _read_done_cv;
+    std::vector<FileRead>* _read_queue = nullptr; //!< File reads currently being processed by the read threads
+    size_t _read_count = 0; //!< Number of entries of _read_queue to be read
+    size_t _read_next = 0; //!< Index of the next entry of _read_queue to be read
+    size_t _read_pending = 0; //!< Number of entries of _read_queue not read yet
+    size_t _read_in_flight = 0;
+    bool _read_threads_running = false;
+    long long unsigned _read_latency_sum = 0, _read_queue_depth_sum = 0, _read_file_count = 0;
+    std::vector<FileRead> _file_reads, _prefetch_reads;
+    std::vector<std::vector<unsigned char>> _prefetch_compressed_buff;
+    bool _prefetch_pending = false; //!< True if the next batch is already taken from the reader and being read into the prefetch buffers
+    bool _loop = false;
+    std::shared_ptr<ThreadPool> _thread_pool = nullptr;
+    static const size_t MAX_READ_THREADS = 16; //!< Upper bound of the file reads in flight per loader
 };
 
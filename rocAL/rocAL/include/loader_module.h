@@ -29,6 +29,7 @@ THE SOFTWARE.
 #include "circular_buffer.h"
 #include "meta_data_reader.h"
 #include "meta_data_graph.h"
+#include "thread_pool.h"
 
 enum class LoaderModuleStatus
 {
@@ -57,6 +58,8 @@ public:
     virtual decoded_image_info get_decode_image_info() = 0;
     // introduce meta data reader
     virtual void set_random_bbox_data_reader(std::shared_ptr<RandomBBoxCrop_MetaDataReader> randombboxcrop_meta_data_reader) = 0;
+    // Sets the host threads shared by the pipeline, should be called before initialize(), used by loaders that decode on the host
+    virtual void set_thread_pool(std::shared_ptr<ThreadPool> thread_pool) {}
 };
 
 using pLoaderModule = std::shared_ptr<LoaderModule>;
\ No newline at end of file
@@ -37,6 +37,7 @@ THE SOFTWARE.
 #include "meta_data_reader.h"
 #include "meta_data_graph.h"
 #include "randombboxcrop_meta_data_reader.h"
+#include "thread_pool.h"
 
 class MasterGraph
 {
@@ -51,8 +52,10 @@ public:
     copy_out_tensor(void *out_ptr, RaliTensorFormat format, float multiplier0, float multiplier1, float multiplier2,
                     float offset0, float offset1, float offset2, bool reverse_channels, RaliTensorDataType output_data_type);
     Status copy_output(cl_mem out_ptr, size_t out_size);
-    Status copy_out_tensor_planar(void *out_ptr, RaliTensorFormat format, float multiplier0, float multiplier1, float multiplier2,
-                    float offset0, float offset1, float offset2, bool reverse_channels, RaliTensorDataType output_data_type);
+    Status set_output_tensor_pool(const std::vector<void*>& buffers, RaliTensorFormat format, RaliTensorDataType output_data_type,
+                                  const float *multiplier, const float *offset, bool reverse_channels);
+    size_t output_tensor_pool_size() { return OUTPUT_RING_BUFFER_DEPTH; }
+    int output_tensor_index();
     size_t output_width();
     size_t output_height();
     size_t output_byte_size();
@@ -93,6 +96,10 @@ private:
     void stop_processing();
     void output_routine();
     void decrease_image_count();
+    void copy_out_tensor_host(const std::vector<void*>& output_buffers, void *out_ptr, RaliTensorFormat format, const float *multiplier,
+                              const float *offset, bool reverse_channels, RaliTensorDataType output_data_type);
+    /// fill_output_tensor() converts the batch just processed into the ring buffer slot to the user's tensor registered for that slot
+    void fill_output_tensor(size_t ring_index, const std::vector<void*>& output_buffers);
     bool processing_on_device() { return _output_image_info.mem_type() == RaliMemType::OCL; };
     /// notify_user_thread() is called when the internal processing thread is done with processing all available images
     void notify_user_thread();
@@ -111,13 +118,27 @@ private:
     std::list<std::shared_ptr<Node>> _meta_data_nodes;//!< List of nodes where meta data has to be updated after augmentation
     std::map<Image*, std::shared_ptr<Node>> _image_map;//!< key: image, value : Parent node
     cl_mem _output_tensor;//!< In the GPU processing case , is used to convert the U8 samples to float32 before they are being transfered back to host
+    struct OutputTensorPool
+    {
+        std::vector<void*> buffers;//!< One user provided tensor per ring buffer slot
+        RaliTensorFormat format;
+        RaliTensorDataType data_type;
+        float multiplier[3];
+        float offset[3];
+        bool reverse_channels;
+    };
+    OutputTensorPool _output_tensor_pool;//!< Tensors the augmented output is written to directly, set by the user through set_output_tensor_pool()
+    std::vector<bool> _output_tensor_filled;//!< Tells for each ring buffer slot if its batch has already been converted to the user's tensor
+    unsigned _output_tensor_pool_generation = 0;//!< Changes every time the pool is set or the filled flags are cleared, tells a copy done outside the lock if it's still valid
+    std::mutex _output_tensor_pool_lock;//!< Guards the pool and the filled flags, it's never held while a batch is copied
     std::shared_ptr<Graph> _graph = nullptr;
     const RaliAffinity _affinity;
     const int _gpu_id;//!< Defines the device id used for processing
     pLoaderModule _loader_module; //!< Keeps the loader module used to feed the input the images of the graph
     TimingDBG _convert_time;
     const size_t _user_batch_size;//!< Batch size provided by the user
-    const size_t _cpu_threads;//!< Not in use
+    const size_t _cpu_threads;//!< Number of host threads used for decoding and augmentation, 0 or 1 uses one thread per core
+    std::shared_ptr<ThreadPool> _thread_pool;//!< Shared by the loader modules, sized by _cpu_threads
     vx_context _context;
     const RaliMemType _mem_type;//!< Is set according to the _affinity, if GPU, is set to CL, otherwise host
     TimingDBG _process_time;
@@ -130,7 +151,8 @@ private:
     const static unsigned SAMPLE_SIZE = sizeof(unsigned char);
     int _remaining_images_count;//!< Keeps the count of remaining images yet to be processed for the user,
     bool _loop;//!< Indicates if user wants to indefinitely loops through images or not
-    static size_t compute_optimum_internal_batch_size(size_t user_batch_size, RaliAffinity affinity);
+    static size_t compute_optimum_internal_batch_size(size_t user_batch_size, RaliAffinity affinity, size_t cpu_threads);
+    static size_t compute_host_thread_count(size_t cpu_threads);
     const size_t _internal_batch_size;//!< In the host processing case , internal batch size can be different than _user_batch_size. This batch size used internally throughout.
     const size_t _user_to_internal_batch_ratio;
     bool _output_routine_finished_processing = false;
@@ -179,6 +201,7 @@ template<> inline std::shared_ptr<ImageLoaderNode> MasterGraph::add_node(const s
         THROW("A loader already exists, cannot have more than one loader")
     auto node = std::make_shared<ImageLoaderNode>(outputs[0], _device.resources());
     _loader_module = node->get_loader_module();
+    _loader_module->set_thread_pool(_thread_pool);
     _root_nodes.push_back(node);
     for(auto& output: outputs)
         _image_map.insert(make_pair(output, node));
@@ -191,6 +214,7 @@ template<> inline std::shared_ptr<ImageLoaderSingleShardNode> MasterGraph::add_n
         THROW("A loader already exists, cannot have more than one loader")
     auto node = std::make_shared<ImageLoaderSingleShardNode>(outputs[0], _device.resources());
     _loader_module = node->get_loader_module();
+    _loader_module->set_thread_pool(_thread_pool);
     _root_nodes.push_back(node);
     for(auto& output: outputs)
         _image_map.insert(make_pair(output, node));
@@ -203,6 +227,7 @@ template<> inline std::shared_ptr<FusedJpegCropNode> MasterGraph::add_node(const
         THROW("A loader already exists, cannot have more than one loader")
     auto node = std::make_shared<FusedJpegCropNode>(outputs[0], _device.resources());
     _loader_module = node->get_loader_module();
+    _loader_module->set_thread_pool(_thread_pool);
     _loader_module->set_random_bbox_data_reader(_randombboxcrop_meta_data_reader);
     _root_nodes.push_back(node);
     for(auto& output: outputs)
@@ -217,6 +242,7 @@ template<> inline std::shared_ptr<FusedJpegCropSingleShardNode> MasterGraph::add
         THROW("A loader already exists, cannot have more than one loader")
     auto node = std::make_shared<FusedJpegCropSingleShardNode>(outputs[0], _device.resources());
     _loader_module = node->get_loader_module();
+    _loader_module->set_thread_pool(_thread_pool);
     _loader_module->set_random_bbox_data_reader(_randombboxcrop_meta_data_reader);
     _root_nodes.push_back(node);
     for(auto& output: outputs)
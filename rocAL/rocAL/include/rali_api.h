@@ -36,7 +36,8 @@ THE SOFTWARE.
 /// \param batch_size
 /// \param affinity
 /// \param gpu_id
-/// \param cpu_thread_count
+/// \param cpu_thread_count Number of host threads used for decoding and augmentation, 0 or 1 uses one thread per core.
+/// On the host the augmentation runs in internal batches of up to cpu_thread_count images that are processed concurrently.
 /// \return
 extern "C"  RaliContext  RALI_API_CALL raliCreate(size_t batch_size, RaliProcessMode affinity, int gpu_id = 0, size_t cpu_thread_count = 1);
 
@@ -43,4 +43,24 @@ extern "C"  RaliStatus   RALI_API_CALL raliCopyToOutputTensor16(RaliContext rali
                                                               float multiplier1, float multiplier2, float offset0,
                                                               float offset1, float offset2,
                                                               bool reverse_channels);
+/*! \brief Registers a pool of user allocated tensors that RALI writes the augmented output to directly, instead of the user
+ * copying every batch out using raliCopyToOutputTensor32/16. Each buffer must hold the whole output of a batch in the given
+ * layout and type, and the pool must have raliGetOutputTensorPoolSize() buffers. On the host affinity the internal thread converts
+ * each batch to its tensor as soon as it's processed. Passing a buffer_count of 0 removes the pool.
+*/
+extern "C"  RaliStatus   RALI_API_CALL raliSetOutputTensorPool(RaliContext rali_context, void **buffers, unsigned buffer_count,
+                                                             RaliTensorLayout tensor_format, RaliTensorOutputType tensor_output_type,
+                                                             float multiplier0, float multiplier1, float multiplier2, float offset0,
+                                                             float offset1, float offset2,
+                                                             bool reverse_channels);
+
+///
+/// \param rali_context
+/// \return The number of buffers raliSetOutputTensorPool() needs, one per batch RALI can keep processed ahead of the user
+extern "C"  unsigned   RALI_API_CALL raliGetOutputTensorPoolSize(RaliContext rali_context);
+
+///
+/// \param rali_context
+/// \return Index of the buffer in the output tensor pool that holds the current batch, valid until the next raliRun() call, -1 on failure
+extern "C"  int   RALI_API_CALL raliGetOutputTensorIndex(RaliContext rali_context);
 #endif //MIVISIONX_RALI_API_DATA_TRANSFER_H
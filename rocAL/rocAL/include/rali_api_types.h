@@ -48,6 +48,10 @@ struct TimingInfo
     long long unsigned decode_time;
     long long unsigned process_time;
     long long unsigned transfer_time;
+    long long unsigned read_latency;
+    long long unsigned read_queue_depth;
+    long long unsigned process_cycle_time;
+    long long unsigned process_parallelism;
 };
 enum RaliStatus
 {
@@ -106,6 +106,14 @@ public:
     //! Closes the opened item 
     virtual int close() = 0;
 
+    //! Advances to the next item and returns the path of the file holding it, without opening the file
+    /*!
+     Lets the caller read the items of file based readers concurrently on its own threads, id() returns the name of this item afterwards
+     \param file_path is set to the full path of the next item
+     \return false if the items are not stored as separate files, the state of the reader is left unchanged in that case
+    */
+    virtual bool next_file_path(std::string& file_path) { return false; }
+
     //! Starts reading from the first item in the resource
     virtual void reset() = 0;
 
@@ -55,6 +55,8 @@ public:
     void unblock_writer();
     void release_all_blocked_calls();
     RaliMemType mem_type() { return _mem_type; }
+    size_t read_index() { return _read_ptr; }
+    size_t write_index() { return _write_ptr; }
     void block_if_empty();
     void block_if_full();
     void release_if_empty();
@@ -0,0 +1,67 @@
+/*
+Copyright (c) 2019 - 2020 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+#include <vector>
+#include <list>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+/*! \class ThreadPool A fixed set of host worker threads shared by the rocAL modules of a pipeline
+ *
+ *  Work is submitted as a range of independent tasks through parallel_for(). Several threads can submit at the same time
+ *  (e.g. the load threads of all the loader shards), idle workers take the next task of the pending submissions in a
+ *  round robin fashion so that the workers are shared between them instead of each submitter spawning its own threads.
+ */
+class ThreadPool
+{
+public:
+    //! Creates the pool
+    /*!
+     \param thread_count Number of worker threads, if 0 one thread per available core is created
+    */
+    explicit ThreadPool(size_t thread_count);
+    ~ThreadPool();
+    //! Runs job(0) to job(count - 1) on the worker threads and returns when all of them are done
+    /*! An exception thrown by any of the tasks is rethrown to the caller once the rest of the tasks are done */
+    void parallel_for(size_t count, const std::function<void(size_t)>& job);
+    size_t thread_count() const { return _threads.size(); }
+private:
+    struct Submission
+    {
+        const std::function<void(size_t)>* job;
+        size_t count;
+        size_t next;//!< Index of the next task to be taken by a worker
+        size_t remaining;//!< Number of tasks not finished yet
+        std::exception_ptr error;
+    };
+    void worker_routine();
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _work_cv, _done_cv;
+    std::list<Submission*> _pending;//!< Submissions that still have tasks not taken by any worker
+    bool _running = true;
+};
@@ -77,9 +77,9 @@ void COCOFileSourceReader::incremenet_read_ptr()
     _read_counter++;
     _curr_file_idx = (_curr_file_idx + 1) % _file_names.size();
 }
-size_t COCOFileSourceReader::open()
+bool COCOFileSourceReader::next_file_path(std::string& file_path)
 {
-    auto file_path = _file_names[_curr_file_idx]; // Get next file name
+    file_path = _file_names[_curr_file_idx]; // Get next file name
     incremenet_read_ptr();
     _last_id = file_path;
     auto last_slash_idx = _last_id.find_last_of("\\/");
@@ -87,6 +87,13 @@ size_t COCOFileSourceReader::open()
     {
         _last_id.erase(0, last_slash_idx + 1);
     }
+    return true;
+}
+
+size_t COCOFileSourceReader::open()
+{
+    std::string file_path;
+    next_file_path(file_path);
 
     _current_fPtr = fopen(file_path.c_str(), "rb"); // Open the file,
 
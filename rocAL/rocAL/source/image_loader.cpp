@@ -95,6 +95,11 @@ void ImageLoader::set_random_bbox_data_reader(std::shared_ptr<RandomBBoxCrop_Met
     _randombboxcrop_meta_data_reader = randombboxcrop_meta_data_reader;
 }
 
+void ImageLoader::set_thread_pool(std::shared_ptr<ThreadPool> thread_pool)
+{
+    _thread_pool = thread_pool;
+}
+
 void ImageLoader::stop_internal_thread()
 {
     _internal_thread_running = false;
@@ -119,6 +124,7 @@ void ImageLoader::initialize(ReaderConfig reader_cfg, DecoderConfig decoder_cfg,
     _loop = reader_cfg.loop();
     _decoder_keep_original = decoder_keep_original;
     _image_loader = std::make_shared<ImageReadAndDecode>();
+    _image_loader->set_thread_pool(_thread_pool);
     try
     {
         _image_loader->create(reader_cfg, decoder_cfg, _batch_size);
@@ -87,6 +87,7 @@ ImageLoaderSharded::initialize(ReaderConfig reader_cfg, DecoderConfig decoder_cf
     {
         _loaders[idx]->set_output_image(_output_image);
         _loaders[idx]->set_random_bbox_data_reader(_randombboxcrop_meta_data_reader);
+        _loaders[idx]->set_thread_pool(_thread_pool);
         reader_cfg.set_shard_count(_shard_count);
         reader_cfg.set_shard_id(idx);
         _loaders[idx]->initialize(reader_cfg, decoder_cfg, mem_type, batch_size, keep_orig_size);
@@ -127,6 +128,11 @@ void ImageLoaderSharded::set_random_bbox_data_reader(std::shared_ptr<RandomBBoxC
     _randombboxcrop_meta_data_reader = randombboxcrop_meta_data_reader;
 }
 
+void ImageLoaderSharded::set_thread_pool(std::shared_ptr<ThreadPool> thread_pool)
+{
+    _thread_pool = thread_pool;
+}
+
 size_t ImageLoaderSharded::remaining_count()
 {
     int sum = 0;
@@ -150,6 +156,8 @@ Timing ImageLoaderSharded::timing()
     long long unsigned  max_decode_time = 0;
     long long unsigned  max_read_time = 0;
     long long unsigned  swap_handle_time = 0;
+    long long unsigned  read_latency = 0;
+    long long unsigned  read_queue_depth = 0;
 
     // image read and decode runs in parallel using multiple loaders, and the observable latency that the ImageLoaderSharded user
     // is experiences on the load_next() call due to read and decode time is the maximum of all
@@ -159,9 +167,14 @@ Timing ImageLoaderSharded::timing()
         max_read_time = (info.image_read_time > max_read_time) ?  info.image_read_time : max_read_time;
         max_decode_time = (info.image_decode_time > max_decode_time) ? info.image_decode_time : max_decode_time;
         swap_handle_time += info.image_process_time;
+        read_latency += info.image_read_latency;
+        read_queue_depth += info.image_read_queue_depth;
     }
     t.image_decode_time = max_decode_time;
     t.image_read_time = max_read_time;
     t.image_process_time = swap_handle_time;
+    // All the shards read at the same time, the reads in flight add up while the latency is averaged
+    t.image_read_latency = _loaders.empty() ? 0 : read_latency / _loaders.size();
+    t.image_read_queue_depth = read_queue_depth;
     return t;
 }
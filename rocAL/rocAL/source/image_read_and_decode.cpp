@@ -23,6 +23,7 @@ THE SOFTWARE.
 
 #include <iterator>
 #include <cstring>
+#include <chrono>
 #include "decoder_factory.h"
 #include "image_read_and_decode.h"
 
@@ -52,6 +53,14 @@ ImageReadAndDecode::timing()
     t.image_decode_time = _decode_time.get_timing();
     t.image_read_time = _file_load_time.get_timing();
     t.shuffle_time = _reader->get_shuffle_time();
+    {
+        std::unique_lock<std::mutex> lock(_read_mutex);
+        if (_read_file_count > 0) {
+            t.image_read_latency = _read_latency_sum / _read_file_count;
+            t.image_read_queue_depth = _read_queue_depth_sum / _read_file_count;
+        }
+        _read_latency_sum = _read_queue_depth_sum = _read_file_count = 0;
+    }
     return t;
 }
 
@@ -63,6 +72,7 @@ ImageReadAndDecode::ImageReadAndDecode():
 
 ImageReadAndDecode::~ImageReadAndDecode()
 {
+    stop_read_threads();
     _reader = nullptr;
     _decoder.clear();
 }   
@@ -83,6 +93,9 @@ ImageReadAndDecode::create(ReaderConfig reader_config, DecoderConfig decoder_con
     _original_height.resize(_batch_size);
     _original_width.resize(_batch_size);
     _decoder_cv.resize(batch_size);
+    _file_reads.resize(batch_size);
+    _prefetch_reads.resize(batch_size);
+    _prefetch_compressed_buff.resize(batch_size);
     _decoder_config = decoder_config;
     _decoder_config_cv =  decoder_config;
     _decoder_config_cv._type = DecoderType::OPENCV_DEC;
@@ -90,6 +103,7 @@ ImageReadAndDecode::create(ReaderConfig reader_config, DecoderConfig decoder_con
         for (int i = 0; i < batch_size; i++) {
             _compressed_buff[i].resize(
                     MAX_COMPRESSED_SIZE); // If we don't need MAX_COMPRESSED_SIZE we can remove this & resize in load module
+            _prefetch_compressed_buff[i].resize(MAX_COMPRESSED_SIZE);
             _decoder[i] = create_decoder(decoder_config);
             _decoder_cv[i] = nullptr;
 #if ENABLE_OPENCV
@@ -100,19 +114,159 @@ ImageReadAndDecode::create(ReaderConfig reader_config, DecoderConfig decoder_con
         }
     }
     _reader = create_reader(reader_config);
+    _loop = reader_config.loop();
+    if (!_thread_pool)
+        _thread_pool = std::make_shared<ThreadPool>(0);
 }
 
 void 
 ImageReadAndDecode::reset()
 {
     // TODO: Reload images from the folder if needed
+    // The prefetched batch is taken from the reader's previous pass, drop it
+    if (_prefetch_pending) {
+        wait_for_file_reads();
+        _prefetch_pending = false;
+    }
     _reader->reset();
 }
 
 size_t
 ImageReadAndDecode::count()
 {
-    return _reader->count();
+    // Files of the prefetched batch are already taken out of the reader but not loaded yet
+    return _reader->count() + ((_prefetch_pending && !_loop) ? _batch_size : 0);
+}
+
+bool
+ImageReadAndDecode::issue_file_reads(std::vector<FileRead>& reads, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (!_reader->next_file_path(reads[i].file_path))
+            return false;// Not a file based reader, the caller has to go through open()/read()
+        reads[i].name = _reader->id();
+        reads[i].file_size = 0;
+        reads[i].read_size = 0;
+    }
+
+    if (_read_threads.empty()) {
+        size_t thread_count = _batch_size;
+        if (thread_count > MAX_READ_THREADS)
+            thread_count = MAX_READ_THREADS;
+        _read_threads_running = true;
+        for (size_t i = 0; i < thread_count; i++)
+            _read_threads.emplace_back(&ImageReadAndDecode::read_routine, this);
+    }
+    {
+        std::unique_lock<std::mutex> lock(_read_mutex);
+        _read_queue = &reads;
+        _read_count = count;
+        _read_next = 0;
+        _read_pending = count;
+    }
+    _read_cv.notify_all();
+    return true;
+}
+
+void
+ImageReadAndDecode::wait_for_file_reads()
+{
+    std::unique_lock<std::mutex> lock(_read_mutex);
+    _read_done_cv.wait(lock, [this] { return _read_pending == 0; });
+    _read_queue = nullptr;
+    _read_count = 0;
+}
+
+void
+ImageReadAndDecode::read_routine()
+{
+    std::unique_lock<std::mutex> lock(_read_mutex);
+    while (true) {
+        _read_cv.wait(lock, [this] { return !_read_threads_running || _read_next < _read_count; });
+        if (!_read_threads_running)
+            break;
+        auto& file_read = (*_read_queue)[_read_next++];
+        _read_queue_depth_sum += ++_read_in_flight;
+        lock.unlock();
+        auto latency = read_file(file_read);
+        lock.lock();
+        _read_in_flight--;
+        _read_latency_sum += latency;
+        _read_file_count++;
+        if (--_read_pending == 0)
+            _read_done_cv.notify_all();
+    }
+}
+
+void
+ImageReadAndDecode::stop_read_threads()
+{
+    {
+        std::unique_lock<std::mutex> lock(_read_mutex);
+        _read_threads_running = false;
+    }
+    _read_cv.notify_all();
+    for (auto& read_thread : _read_threads)
+        if (read_thread.joinable())
+            read_thread.join();
+    _read_threads.clear();
+}
+
+long long unsigned
+ImageReadAndDecode::read_file(FileRead& file_read)
+{
+    auto t_start = std::chrono::high_resolution_clock::now();
+    FILE* fp = fopen(file_read.file_path.c_str(), "rb");
+    file_read.file_size = 0;
+    file_read.read_size = 0;
+    if (fp) {
+        fseek(fp, 0 , SEEK_END);
+        long file_size = ftell(fp);
+        fseek(fp, 0 , SEEK_SET);
+        file_read.file_size = (file_size > 0) ? file_size : 0;
+        size_t read_size = file_read.file_size;
+        unsigned char* dst = file_read.dst;
+        if (file_read.buff) {
+            if (file_read.buff->size() < read_size)
+                file_read.buff->resize(read_size);
+            dst = file_read.buff->data();
+        } else if (read_size > file_read.max_size) {
+            read_size = file_read.max_size;
+        }
+        if (read_size > 0)
+            file_read.read_size = fread(dst, sizeof(unsigned char), read_size, fp);
+        fclose(fp);
+    }
+    auto t_end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(t_end - t_start).count();
+}
+
+bool
+ImageReadAndDecode::replace_failed_reads(std::vector<FileRead>& reads, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        while (reads[i].read_size == 0) {
+            WRN("Opened file " + reads[i].name + " of size 0");
+            if (_reader->count() == 0 || !_reader->next_file_path(reads[i].file_path))
+                return false;
+            reads[i].name = _reader->id();
+            read_file(reads[i]);
+        }
+        if (reads[i].read_size < reads[i].file_size)
+            LOG("Reader read less than requested bytes of size: " + TOSTR(reads[i].read_size));
+    }
+    return true;
+}
+
+void
+ImageReadAndDecode::prefetch_next_batch()
+{
+    _prefetch_pending = false;
+    if (_reader->count() < _batch_size)
+        return;
+    for (size_t i = 0; i < _batch_size; i++)
+        _prefetch_reads[i].buff = &_prefetch_compressed_buff[i];
+    _prefetch_pending = issue_file_reads(_prefetch_reads, _batch_size);
 }
 
 void ImageReadAndDecode::set_random_bbox_data_reader(std::shared_ptr<RandomBBoxCrop_MetaDataReader> randombboxcrop_meta_data_reader)
@@ -137,7 +291,7 @@ ImageReadAndDecode::load(unsigned char* buff,
         THROW("Zero image dimension is not valid")
     if(!buff)
         THROW("Null pointer passed as output buffer")
-    if(_reader->count() < _batch_size)
+    if(!_prefetch_pending && _reader->count() < _batch_size)
         return LoaderModuleStatus::NO_MORE_DATA_TO_READ;
     // load images/frames from the disk and push them as a large image onto the buff
     unsigned file_counter = 0;
@@ -148,72 +302,132 @@ ImageReadAndDecode::load(unsigned char* buff,
     const size_t image_size = max_decoded_width * max_decoded_height * output_planes * sizeof(unsigned char);
 
     // Decode with the height and size equal to a single image  
-    // File read is done serially since I/O parallelization does not work very well.
+    // File based readers hand out file paths and the files are read concurrently by the read threads, other readers
+    // are read serially through open()/read()/close(). _file_load_time is the time load() waits for the files.
     _file_load_time.start();// Debug timing
     if (_decoder_config._type == DecoderType::SKIP_DECODE) {
-        while ((file_counter != _batch_size) && _reader->count() > 0)
-        {
-            auto read_ptr = buff + image_size * file_counter;
-            size_t fsize = _reader->open();
-            if (fsize == 0) {
-                WRN("Opened file " + _reader->id() + " of size 0");
-                continue;
+        for (size_t i = 0; i < _batch_size; i++) {
+            _file_reads[i].buff = nullptr;
+            _file_reads[i].dst = buff + image_size * i;
+            _file_reads[i].max_size = image_size;
+        }
+        if (issue_file_reads(_file_reads, _batch_size)) {
+            wait_for_file_reads();
+            if (!replace_failed_reads(_file_reads, _batch_size)) {
+                _file_load_time.end();// Debug timing
+                WRN("Not enough readable files left to fill the batch, dropping it");
+                return LoaderModuleStatus::NO_MORE_DATA_TO_READ;
+            }
+            for (file_counter = 0; file_counter < _batch_size; file_counter++) {
+                _actual_read_size[file_counter] = _file_reads[file_counter].read_size;
+                _image_names[file_counter] = _file_reads[file_counter].name;
+                names[file_counter] = _image_names[file_counter];
+                roi_width[file_counter] = max_decoded_width;
+                roi_height[file_counter] = max_decoded_height;
+                actual_width[file_counter] = max_decoded_width;
+                actual_height[file_counter] = max_decoded_height;
             }
+        } else {
+            while ((file_counter != _batch_size) && _reader->count() > 0)
+            {
+                auto read_ptr = buff + image_size * file_counter;
+                size_t fsize = _reader->open();
+                if (fsize == 0) {
+                    WRN("Opened file " + _reader->id() + " of size 0");
+                    continue;
+                }
 
-            _actual_read_size[file_counter] = _reader->read(read_ptr, fsize);
-            if(_actual_read_size[file_counter] < fsize)
-                LOG("Reader read less than requested bytes of size: " + _actual_read_size[file_counter]);
-
-            _image_names[file_counter] = _reader->id();
-            _reader->close();
-           // _compressed_image_size[file_counter] = fsize;
-            names[file_counter] = _image_names[file_counter];
-            roi_width[file_counter] = max_decoded_width;
-            roi_height[file_counter] = max_decoded_height;
-            actual_width[file_counter] = max_decoded_width;
-            actual_height[file_counter] = max_decoded_height;
-            file_counter++;
+                _actual_read_size[file_counter] = _reader->read(read_ptr, fsize);
+                if(_actual_read_size[file_counter] < fsize)
+                    LOG("Reader read less than requested bytes of size: " + _actual_read_size[file_counter]);
+
+                _image_names[file_counter] = _reader->id();
+                _reader->close();
+               // _compressed_image_size[file_counter] = fsize;
+                names[file_counter] = _image_names[file_counter];
+                roi_width[file_counter] = max_decoded_width;
+                roi_height[file_counter] = max_decoded_height;
+                actual_width[file_counter] = max_decoded_width;
+                actual_height[file_counter] = max_decoded_height;
+                file_counter++;
+            }
         }
-        //_file_load_time.end();// Debug timing
-        //return LoaderModuleStatus::OK;
     }else {
-        while ((file_counter != _batch_size) && _reader->count() > 0) {
-            size_t fsize = _reader->open();
-            if (fsize == 0) {
-                WRN("Opened file " + _reader->id() + " of size 0");
-                continue;
+        if (!_prefetch_pending)
+            prefetch_next_batch();
+        if (_prefetch_pending) {
+            wait_for_file_reads();
+            if (!replace_failed_reads(_prefetch_reads, _batch_size)) {
+                // the reader is exhausted, so no batch gets prefetched after this one
+                _prefetch_pending = false;
+                _file_load_time.end();// Debug timing
+                WRN("Not enough readable files left to fill the batch, dropping it");
+                return LoaderModuleStatus::NO_MORE_DATA_TO_READ;
             }
+            std::swap(_compressed_buff, _prefetch_compressed_buff);
+            for (file_counter = 0; file_counter < _batch_size; file_counter++) {
+                _actual_read_size[file_counter] = _prefetch_reads[file_counter].read_size;
+                _compressed_image_size[file_counter] = _prefetch_reads[file_counter].read_size;
+                _image_names[file_counter] = _prefetch_reads[file_counter].name;
+                if(_randombboxcrop_meta_data_reader)
+                {
+                    _CropCord = _randombboxcrop_meta_data_reader->get_crop_cord(_image_names[file_counter]);
+                    std::vector<float> coords_buf(4);
+                    coords_buf[0] = _CropCord->crop_left ;
+                    coords_buf[1] = _CropCord->crop_top;
+                    coords_buf[2] = _CropCord->crop_right- _CropCord->crop_left ;
+                    coords_buf[3] = _CropCord->crop_bottom- _CropCord->crop_top;
+                    _bbox_coords.push_back(coords_buf);
+                    coords_buf.clear();
+                }
+            }
+            // Read the next batch while this one is being decoded
+            prefetch_next_batch();
+        } else {
+            while ((file_counter != _batch_size) && _reader->count() > 0) {
+                size_t fsize = _reader->open();
+                if (fsize == 0) {
+                    WRN("Opened file " + _reader->id() + " of size 0");
+                    continue;
+                }
 
-            _compressed_buff[file_counter].reserve(fsize);
-
-            _actual_read_size[file_counter] = _reader->read(_compressed_buff[file_counter].data(), fsize);
-            _image_names[file_counter] = _reader->id();
-            if(_randombboxcrop_meta_data_reader)
-            {
-                _CropCord = _randombboxcrop_meta_data_reader->get_crop_cord(_image_names[file_counter]);
-                std::vector<float> coords_buf(4);
-                coords_buf[0] = _CropCord->crop_left ;
-                coords_buf[1] = _CropCord->crop_top;
-                coords_buf[2] = _CropCord->crop_right- _CropCord->crop_left ;
-                coords_buf[3] = _CropCord->crop_bottom- _CropCord->crop_top;
-                _bbox_coords.push_back(coords_buf);
-                coords_buf.clear();
+                _compressed_buff[file_counter].reserve(fsize);
+
+                _actual_read_size[file_counter] = _reader->read(_compressed_buff[file_counter].data(), fsize);
+                _image_names[file_counter] = _reader->id();
+                if(_randombboxcrop_meta_data_reader)
+                {
+                    _CropCord = _randombboxcrop_meta_data_reader->get_crop_cord(_image_names[file_counter]);
+                    std::vector<float> coords_buf(4);
+                    coords_buf[0] = _CropCord->crop_left ;
+                    coords_buf[1] = _CropCord->crop_top;
+                    coords_buf[2] = _CropCord->crop_right- _CropCord->crop_left ;
+                    coords_buf[3] = _CropCord->crop_bottom- _CropCord->crop_top;
+                    _bbox_coords.push_back(coords_buf);
+                    coords_buf.clear();
+                }
+                _reader->close();
+                _compressed_image_size[file_counter] = fsize;
+                file_counter++;
             }
-            _reader->close();
-            _compressed_image_size[file_counter] = fsize;
-            file_counter++;
         }
     }
 
     _file_load_time.end();// Debug timing
+    if (file_counter != _batch_size) {
+        // don't hand out (or decode) slots that kept data of the previous batch
+        WRN("Not enough readable files left to fill the batch, dropping it");
+        _bbox_coords.clear();
+        return LoaderModuleStatus::NO_MORE_DATA_TO_READ;
+    }
 
     _decode_time.start();// Debug timing
     if (_decoder_config._type != DecoderType::SKIP_DECODE) {
         for (size_t i = 0; i < _batch_size; i++)
             _decompressed_buff_ptrs[i] = buff + image_size * i;
 
-#pragma omp parallel for num_threads(_batch_size)  // default(none) TBD: option disabled in Ubuntu 20.04
-        for (size_t i = 0; i < _batch_size; i++)
+        // Every image is a separate task on the thread pool, the workers are shared with the other loader shards
+        _thread_pool->parallel_for(_batch_size, [&](size_t i)
         {
             // initialize the actual decoded height and width with the maximum
             _actual_decoded_width[i] = max_decoded_width;
@@ -228,7 +442,7 @@ ImageReadAndDecode::load(unsigned char* buff,
                 if (_decoder_cv[i] && _decoder_cv[i]->decode_info(_compressed_buff[i].data(), _actual_read_size[i], &original_width, &original_height,
                                          &jpeg_sub_samp) != Decoder::Status::OK) {
 #endif
-                    continue;
+                    return;
 #if 0//ENABLE_OPENCV
                 }
 #endif
@@ -263,7 +477,7 @@ ImageReadAndDecode::load(unsigned char* buff,
                                         scaledw, scaledh,
                                         decoder_color_format, _decoder_config, keep_original) != Decoder::Status::OK) {
 
-                    continue;
+                    return;
 
                 }
 #endif
@@ -271,7 +485,7 @@ ImageReadAndDecode::load(unsigned char* buff,
             }
             _actual_decoded_width[i] = scaledw;
             _actual_decoded_height[i] = scaledh;
-        }
+        });
         for (size_t i = 0; i < _batch_size; i++) {
             names[i] = _image_names[i];
            
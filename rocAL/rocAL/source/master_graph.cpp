@@ -74,17 +74,19 @@ MasterGraph::~MasterGraph()
 MasterGraph::MasterGraph(size_t batch_size, RaliAffinity affinity, int gpu_id, size_t cpu_threads):
         _ring_buffer(OUTPUT_RING_BUFFER_DEPTH),
         _output_tensor(nullptr),
+        _output_tensor_filled(OUTPUT_RING_BUFFER_DEPTH, false),
         _graph(nullptr),
         _affinity(affinity),
         _gpu_id(gpu_id),
         _convert_time("Conversion Time", DBG_TIMING),
         _user_batch_size(batch_size),
         _cpu_threads(cpu_threads),
+        _thread_pool(std::make_shared<ThreadPool>(compute_host_thread_count(cpu_threads))),
         _mem_type ((_affinity == RaliAffinity::GPU) ? RaliMemType::OCL : RaliMemType::HOST),
         _process_time("Process Time", DBG_TIMING),
         _first_run(true),
         _processing(false),
-        _internal_batch_size(compute_optimum_internal_batch_size(batch_size, affinity)),
+        _internal_batch_size(compute_optimum_internal_batch_size(batch_size, affinity, cpu_threads)),
         _user_to_internal_batch_ratio (_user_batch_size/_internal_batch_size)
 {
     try {
@@ -347,6 +349,11 @@ MasterGraph::reset()
     if(_output_thread.joinable())
         _output_thread.join();
     _ring_buffer.reset();
+    {
+        std::unique_lock<std::mutex> lock(_output_tensor_pool_lock);
+        _output_tensor_pool_generation++;
+        std::fill(_output_tensor_filled.begin(), _output_tensor_filled.end(), false);
+    }
     // clearing meta ring buffer
     // if random_bbox meta reader is used: read again to get different crops
     if (_randombboxcrop_meta_data_reader != nullptr)
@@ -377,8 +384,12 @@ Timing
 MasterGraph::timing()
 {
     Timing t = _loader_module->timing();
-    t.image_process_time += _process_time.get_timing();
+    auto process_cycles = _process_time.count();
+    auto process_time = _process_time.get_timing();
+    t.image_process_time += process_time;
     t.copy_to_output += _convert_time.get_timing();
+    t.process_cycle_time = (process_cycles > 0) ? process_time / process_cycles : 0;
+    t.process_parallelism = _internal_batch_size;
     return t;
 }
 
@@ -397,6 +408,93 @@ MasterGraph::copy_output(
     return Status::OK;
 }
 
+// Converts a single U8 image to a float tensor, out = in * multiplier[channel] + offset[channel], which also covers the
+// mean/std normalization. in_planar is set for images stored plane by plane (RGB_PLANAR), otherwise pixels are interleaved.
+static void
+convert_image_to_tensor(const unsigned char *in, bool in_planar, void *out, RaliTensorFormat format, RaliTensorDataType data_type,
+                        size_t pixel_count, size_t c, const float *multiplier, const float *offset, bool reverse_channels)
+{
+    const bool out_planar = (format == RaliTensorFormat::NCHW);
+    const bool fp16 = (data_type == RaliTensorDataType::FP16);
+    size_t p = 0;
+#if (ENABLE_SIMD && __AVX2__)
+    if(c == 1 || c == 3)
+    {
+        // Each block of 8 pixels is loaded into two registers and produces c groups of 8 output values. Every group is
+        // gathered from the two registers with byte shuffles, so any input/output layout and channel order takes the same path.
+        alignas(16) unsigned char shuffle[3][2][16];
+        alignas(32) float mul[3][8], add[3][8];
+        memset(shuffle, 0x80, sizeof(shuffle));
+        for(size_t g = 0; g < c; g++)
+            for(size_t e = 0; e < 8; e++)
+            {
+                size_t pixel = out_planar ? e : (g * 8 + e) / c;
+                size_t channel = out_planar ? g : (g * 8 + e) % c;
+                size_t src_channel = reverse_channels ? c - 1 - channel : channel;
+                size_t pos = in_planar ? src_channel * 8 + pixel : pixel * c + src_channel;
+                shuffle[g][pos / 16][e] = pos % 16;
+                mul[g][e] = multiplier[channel];
+                add[g][e] = offset[channel];
+            }
+        __m128i pshuf[3][2];
+        __m256 pmul[3], padd[3];
+        for(size_t g = 0; g < c; g++)
+        {
+            pshuf[g][0] = _mm_load_si128((const __m128i *) shuffle[g][0]);
+            pshuf[g][1] = _mm_load_si128((const __m128i *) shuffle[g][1]);
+            pmul[g] = _mm256_load_ps(mul[g]);
+            padd[g] = _mm256_load_ps(add[g]);
+        }
+        for(; p + 8 <= pixel_count; p += 8)
+        {
+            __m128i src0, src1 = _mm_setzero_si128();
+            if(c == 1)
+                src0 = _mm_loadl_epi64((const __m128i *) (in + p));
+            else if(in_planar)
+            {
+                src0 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *) (in + p)), _mm_loadl_epi64((const __m128i *) (in + pixel_count + p)));
+                src1 = _mm_loadl_epi64((const __m128i *) (in + 2 * pixel_count + p));
+            }
+            else
+            {
+                src0 = _mm_loadu_si128((const __m128i *) (in + p * 3));
+                src1 = _mm_loadl_epi64((const __m128i *) (in + p * 3 + 16));
+            }
+            for(size_t g = 0; g < c; g++)
+            {
+                __m128i pix = _mm_or_si128(_mm_shuffle_epi8(src0, pshuf[g][0]), _mm_shuffle_epi8(src1, pshuf[g][1]));
+                __m256 f = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(pix)), pmul[g]), padd[g]);
+                size_t dst_idx = out_planar ? g * pixel_count + p : p * c + g * 8;
+                if(fp16)
+                {
+#if __F16C__
+                    _mm_storeu_si128((__m128i *) ((half *) out + dst_idx), _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+#else
+                    alignas(32) float value[8];
+                    _mm256_store_ps(value, f);
+                    for(size_t e = 0; e < 8; e++)
+                        ((half *) out)[dst_idx + e] = (half) value[e];
+#endif
+                }
+                else
+                    _mm256_storeu_ps((float *) out + dst_idx, f);
+            }
+        }
+    }
+#endif
+    for(; p < pixel_count; p++)
+        for(size_t channel = 0; channel < c; channel++)
+        {
+            size_t src_channel = reverse_channels ? c - 1 - channel : channel;
+            float value = offset[channel] + multiplier[channel] * (float) in[in_planar ? src_channel * pixel_count + p : p * c + src_channel];
+            size_t dst_idx = out_planar ? channel * pixel_count + p : p * c + channel;
+            if(fp16)
+                ((half *) out)[dst_idx] = (half) value;
+            else
+                ((float *) out)[dst_idx] = value;
+        }
+}
+
 #define CHECK_CL_CALL_RET(x) { cl_int ret; ret = x; if( ret != CL_SUCCESS) THROW("ocl call failed "+STR(#x)+" error "+TOSTR(ret)) }
 
 MasterGraph::Status
@@ -406,12 +504,8 @@ MasterGraph::copy_out_tensor(void *out_ptr, RaliTensorFormat format, float multi
     if(no_more_processed_data())
         return MasterGraph::Status::NO_MORE_DATA;
 
-    if (output_color_format() == RaliColorFormat::RGB_PLANAR)
-        return MasterGraph::copy_out_tensor_planar(out_ptr,format,multiplier0, multiplier1, multiplier2, offset0, offset1, offset2, reverse_channels, output_data_type);
-
     _convert_time.start();
     // Copies to the output context given by the user
-    unsigned int n = _user_batch_size;
     const size_t c = output_depth();
     const size_t h = _output_image_info.height_single();
     const size_t w = output_width();
@@ -419,6 +513,8 @@ MasterGraph::copy_out_tensor(void *out_ptr, RaliTensorFormat format, float multi
 
     if(_output_image_info.mem_type() == RaliMemType::OCL)
     {
+        if(output_color_format() == RaliColorFormat::RGB_PLANAR)
+            THROW("copy_out_tensor for planar images on GPU affinity is not implemented")
         if(output_data_type == RaliTensorDataType::FP16)
             THROW("FP16 tensor output for GPU affinity is not implemented")
         // OCL device memory
@@ -480,163 +576,107 @@ MasterGraph::copy_out_tensor(void *out_ptr, RaliTensorFormat format, float multi
     {
         float multiplier[3] = {multiplier0, multiplier1, multiplier2 };
         float offset[3] = {offset0, offset1, offset2 };
-        size_t dest_buf_offset = 0;
-
-        auto output_buffers =_ring_buffer.get_read_buffers();
-        for( auto&& out_image: output_buffers)
-        {
-            auto in_buffer = (unsigned char*)out_image;
-            if(format == RaliTensorFormat::NHWC)
-            {
-                if(output_data_type == RaliTensorDataType::FP32)
-                {
-                    for (unsigned int nCount = 0; nCount < n; nCount++) {
-                        float *output_tensor_32 = static_cast<float *>(out_ptr);
-                        auto channel_size = w * h;
-                        for (unsigned channel_idx = 0; channel_idx < c; channel_idx++) {
-                            for (unsigned i = 0; i < channel_size; i++)
-                                output_tensor_32[dest_buf_offset + channel_idx + i * c] =
-                                        offset[channel_idx] + multiplier[channel_idx] *
-                                                              (reverse_channels ? (float) (in_buffer[i * c + c - channel_idx - 1])
-                                                                                : (float) (in_buffer[i * c + channel_idx]));
-                        }
-                        in_buffer += (w * c * h);
-                        dest_buf_offset += (w * c * h);
-                    }
-                }
-                else if(output_data_type == RaliTensorDataType::FP16)
-                {
-                    for (unsigned int nCount = 0; nCount < n; nCount++) {
-                        half *output_tensor_16 = static_cast<half *>(out_ptr);
-                        auto channel_size = w * h;
-                        for (unsigned channel_idx = 0; channel_idx < c; channel_idx++) {
-                            for (unsigned i = 0; i < channel_size; i++)
-                                output_tensor_16[dest_buf_offset + channel_idx + i * c] =
-                                        offset[channel_idx] + multiplier[channel_idx] *
-                                                              (reverse_channels ? (half) (in_buffer[i * c + c - channel_idx - 1])
-                                                                                : (half) (in_buffer[i * c + channel_idx]));
-                        }
-                        dest_buf_offset += (w * c * h);
-                        in_buffer += (w * c * h);
-                    }
-                }
-            }
-            if(format == RaliTensorFormat::NCHW)
-            {
-                if(output_data_type == RaliTensorDataType::FP32)
-                {
-                    float *output_tensor_32 = static_cast<float *>(out_ptr);
-                    auto channel_size  = w * h;
-                    if(c != 3)
-                    {
-                        for (unsigned int nCount = 0; nCount < n; nCount++)
-                        {
-                            for(unsigned channel_idx = 0; channel_idx < c; channel_idx++)
-                                for(unsigned i = 0; i < channel_size; i++)
-                                    output_tensor_32[dest_buf_offset+channel_idx*channel_size + i] =
-                                            offset[channel_idx] + multiplier[channel_idx]*(reverse_channels ? (float)(in_buffer[dest_buf_offset + (c*i+c-channel_idx-1)]) : (float)(in_buffer[dest_buf_offset + (c*i+channel_idx)]));
+        copy_out_tensor_host(_ring_buffer.get_read_buffers(), out_ptr, format, multiplier, offset, reverse_channels, output_data_type);
+    }
+    _convert_time.end();
+    return Status::OK;
+}
 
-                            dest_buf_offset += (w * c * h);
-                        }
-                    }
-                    else {
-#if (ENABLE_SIMD && __AVX2__)
-                        for (unsigned int nCount = 0; nCount < n; nCount++) {
-                            float *B_buf = output_tensor_32 + dest_buf_offset;
-                            float *G_buf = B_buf + channel_size;
-                            float *R_buf = G_buf + channel_size;
-
-                            __m256i mask_B, mask_G, mask_R;
-                            if (reverse_channels) {
-                                mask_B = _mm256_setr_epi32(0x80808000, 0x80808003, 0x80808006, 0x80808009, 0x80808000,
-                                                           0x80808003, 0x80808006, 0x80808009);
-                                mask_G = _mm256_setr_epi32(0x80808001, 0x80808004, 0x80808007, 0x8080800A, 0x80808001,
-                                                           0x80808004, 0x80808007, 0x8080800A);
-                                mask_R = _mm256_setr_epi32(0x80808002, 0x80808005, 0x80808008, 0x8080800B, 0x80808002,
-                                                           0x80808005, 0x80808008, 0x8080800B);
-                            } else {
-                                mask_R = _mm256_setr_epi32(0x80808000, 0x80808003, 0x80808006, 0x80808009, 0x80808000,
-                                                           0x80808003, 0x80808006, 0x80808009);
-                                mask_G = _mm256_setr_epi32(0x80808001, 0x80808004, 0x80808007, 0x8080800A, 0x80808001,
-                                                           0x80808004, 0x80808007, 0x8080800A);
-                                mask_B = _mm256_setr_epi32(0x80808002, 0x80808005, 0x80808008, 0x8080800B, 0x80808002,
-                                                           0x80808005, 0x80808008, 0x8080800B);
-                            }
-                            __m256 pmul0 = _mm256_set1_ps(multiplier0);
-                            __m256 pmul1 = _mm256_set1_ps(multiplier1);
-                            __m256 pmul2 = _mm256_set1_ps(multiplier2);
-                            __m256 padd0 = _mm256_set1_ps(offset0);
-                            __m256 padd1 = _mm256_set1_ps(offset1);
-                            __m256 padd2 = _mm256_set1_ps(offset2);
-                            unsigned int alignedLength = (channel_size & ~7);    // multiple of 8
-                            unsigned int i = 0;
-
-                            __m256 fR, fG, fB;
-                            for (; i < alignedLength; i += 8) {
-                                __m256i pix0 = _mm256_loadu_si256((const __m256i *) in_buffer);
-                                pix0 = _mm256_permutevar8x32_epi32(pix0, _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6));
-                                fB = _mm256_cvtepi32_ps(_mm256_shuffle_epi8(pix0, mask_R));
-                                fG = _mm256_cvtepi32_ps(_mm256_shuffle_epi8(pix0, mask_G));
-                                fR = _mm256_cvtepi32_ps(_mm256_shuffle_epi8(pix0, mask_B));
-                                fB = _mm256_mul_ps(fB, pmul0);
-                                fG = _mm256_mul_ps(fG, pmul1);
-                                fR = _mm256_mul_ps(fR, pmul2);
-                                fB = _mm256_add_ps(fB, padd0);
-                                fG = _mm256_add_ps(fG, padd1);
-                                fR = _mm256_add_ps(fR, padd2);
-                                _mm256_storeu_ps(B_buf, fB);
-                                _mm256_storeu_ps(G_buf, fG);
-                                _mm256_storeu_ps(R_buf, fR);
-                                B_buf += 8;
-                                G_buf += 8;
-                                R_buf += 8;
-                                in_buffer += 24;
-                            }
-                            for (; i < channel_size; i++, in_buffer += 3) {
-                                *B_buf++ = (in_buffer[0] * multiplier0) + offset0;
-                                *G_buf++ = (in_buffer[1] * multiplier1) + offset1;
-                                *R_buf++ = (in_buffer[2] * multiplier2) + offset1;
-                            }
-                            dest_buf_offset += (w * c * h);
-                        }
-#else
-                        for (unsigned int nCount = 0; nCount < n; nCount++)
-                        {
-                            for(unsigned channel_idx = 0; channel_idx < c; channel_idx++)
-                                for(unsigned i = 0; i < channel_size; i++)
-                                    output_tensor_32[dest_buf_offset+channel_idx*channel_size + i] =
-                                            offset[channel_idx] + multiplier[channel_idx]*(reverse_channels ? (float)(in_buffer[dest_buf_offset + (c*i+c-channel_idx-1)]) : (float)(in_buffer[dest_buf_offset + (c*i+channel_idx)]));
+void
+MasterGraph::copy_out_tensor_host(const std::vector<void*>& output_buffers, void *out_ptr, RaliTensorFormat format, const float *multiplier,
+                                  const float *offset, bool reverse_channels, RaliTensorDataType output_data_type)
+{
+    const size_t n = _user_batch_size;
+    const size_t c = output_depth();
+    const size_t image_size = output_width() * _output_image_info.height_single() * c;
+    const size_t sample_size = (output_data_type == RaliTensorDataType::FP16) ? sizeof(half) : sizeof(float);
+    const bool planar = (output_color_format() == RaliColorFormat::RGB_PLANAR);
 
-                            dest_buf_offset += (w * c * h);
-                        }
-#endif
-                    }
-                }
-                else if(output_data_type == RaliTensorDataType::FP16)
-                {
-                    for (unsigned int nCount = 0; nCount < n; nCount++) {
-                        half *output_tensor_16 = static_cast<half *>(out_ptr);
-                        auto channel_size = w * h;
-                        for (unsigned channel_idx = 0; channel_idx < c; channel_idx++) {
-                            for (unsigned i = 0; i < channel_size; i++)
-                                output_tensor_16[dest_buf_offset + channel_idx * channel_size + i] =
-                                        offset[channel_idx] + multiplier[channel_idx] *
-                                                              (reverse_channels ? (half) (in_buffer[dest_buf_offset + (c*i+c-channel_idx-1)])
-                                                                                : (half) (in_buffer[dest_buf_offset + (c * i + channel_idx)]));
-                        }
-                        dest_buf_offset += (w * c * h);
-                        in_buffer += (w * c * h);
-                    }
-                }
+    // Output images are placed one after the other in the tensor, and every image is converted as a separate task
+    _thread_pool->parallel_for(output_buffers.size() * n, [&](size_t idx)
+    {
+        auto in_buffer = (unsigned char *) output_buffers[idx / n] + (idx % n) * image_size;
+        auto out_buffer = (unsigned char *) out_ptr + idx * image_size * sample_size;
+        convert_image_to_tensor(in_buffer, planar, out_buffer, format, output_data_type, image_size / c, c, multiplier, offset, reverse_channels);
+    });
+}
 
-            }
-            dest_buf_offset += single_output_image_size;
-        }
+MasterGraph::Status
+MasterGraph::set_output_tensor_pool(const std::vector<void*>& buffers, RaliTensorFormat format, RaliTensorDataType output_data_type,
+                                    const float *multiplier, const float *offset, bool reverse_channels)
+{
+    if(!buffers.empty() && buffers.size() != OUTPUT_RING_BUFFER_DEPTH)
+        THROW("Output tensor pool needs "+TOSTR(OUTPUT_RING_BUFFER_DEPTH)+" buffers, "+TOSTR(buffers.size())+" given")
+    for(auto&& buffer: buffers)
+        if(buffer == nullptr)
+            THROW("Null buffer passed in the output tensor pool")
+
+    std::unique_lock<std::mutex> lock(_output_tensor_pool_lock);
+    _output_tensor_pool.buffers = buffers;
+    _output_tensor_pool.format = format;
+    _output_tensor_pool.data_type = output_data_type;
+    for(unsigned i = 0; i < 3; i++)
+    {
+        _output_tensor_pool.multiplier[i] = multiplier[i];
+        _output_tensor_pool.offset[i] = offset[i];
     }
-    _convert_time.end();
+    _output_tensor_pool.reverse_channels = reverse_channels;
+    // Batches already waiting in the ring buffer are converted to the new pool when the user asks for them
+    _output_tensor_pool_generation++;
+    std::fill(_output_tensor_filled.begin(), _output_tensor_filled.end(), false);
     return Status::OK;
 }
 
+void
+MasterGraph::fill_output_tensor(size_t ring_index, const std::vector<void*>& output_buffers)
+{
+    OutputTensorPool pool;
+    unsigned generation;
+    {
+        std::unique_lock<std::mutex> lock(_output_tensor_pool_lock);
+        _output_tensor_filled[ring_index] = false;
+        if(_output_tensor_pool.buffers.empty())
+            return;
+        pool = _output_tensor_pool;
+        generation = _output_tensor_pool_generation;
+    }
+    // The copy is done outside the lock so that the user's thread is not held by the conversion
+    copy_out_tensor_host(output_buffers, pool.buffers[ring_index], pool.format, pool.multiplier, pool.offset, pool.reverse_channels, pool.data_type);
+    std::unique_lock<std::mutex> lock(_output_tensor_pool_lock);
+    // A pool set or cleared while copying makes this copy stale, the batch is then converted when the user asks for it
+    if(generation == _output_tensor_pool_generation)
+        _output_tensor_filled[ring_index] = true;
+}
+
+int
+MasterGraph::output_tensor_index()
+{
+    if(no_more_processed_data())
+        return -1;
+
+    OutputTensorPool pool;
+    unsigned generation;
+    auto ring_index = _ring_buffer.read_index();
+    {
+        std::unique_lock<std::mutex> lock(_output_tensor_pool_lock);
+        if(_output_tensor_pool.buffers.empty())
+            THROW("No output tensor pool is set, set_output_tensor_pool() should be called first")
+        // The internal thread fills the tensor on the host as part of processing the batch, while batches processed on the device,
+        // or processed before the pool was set, are converted here
+        if(_output_tensor_filled[ring_index])
+            return ring_index;
+        pool = _output_tensor_pool;
+        generation = _output_tensor_pool_generation;
+    }
+    // copy_out_tensor() may wait for the ring buffer, so the lock the internal thread needs in fill_output_tensor() is not held
+    copy_out_tensor(pool.buffers[ring_index], pool.format, pool.multiplier[0], pool.multiplier[1], pool.multiplier[2],
+                    pool.offset[0], pool.offset[1], pool.offset[2], pool.reverse_channels, pool.data_type);
+    std::unique_lock<std::mutex> lock(_output_tensor_pool_lock);
+    if(generation == _output_tensor_pool_generation)
+        _output_tensor_filled[ring_index] = true;
+    return ring_index;
+}
+
 MasterGraph::Status
 MasterGraph::copy_output(unsigned char *out_ptr)
 {
@@ -792,6 +832,9 @@ void MasterGraph::output_routine()
                 _process_time.end();
             }
 
+            if(_processing && !processing_on_device())
+                fill_output_tensor(_ring_buffer.write_index(), write_buffers);
+
             _ring_buffer.set_meta_data(full_batch_image_names, full_batch_meta_data);
             _ring_buffer.push(); // Image data and metadata is now stored in output the ring_buffer, increases it's level by 1
 
@@ -955,7 +998,15 @@ const std::pair<ImageNameBatch,pMetaDataBatch>& MasterGraph::meta_data()
     return _ring_buffer.get_meta_data();
 }
 
-size_t MasterGraph::compute_optimum_internal_batch_size(size_t user_batch_size, RaliAffinity affinity)
+size_t MasterGraph::compute_host_thread_count(size_t cpu_threads)
+{
+    // 0 and 1 (the default of raliCreate) leave it to the host's core count, so do the values that the host can't run at once
+    if(cpu_threads > 1 && cpu_threads <= std::thread::hardware_concurrency())
+        return cpu_threads;
+    return 0;
+}
+
+size_t MasterGraph::compute_optimum_internal_batch_size(size_t user_batch_size, RaliAffinity affinity, size_t cpu_threads)
 {
     const unsigned MINIMUM_CPU_THREAD_COUNT = 2;
     const unsigned DEFAULT_SMT_COUNT = 2;
@@ -963,7 +1014,23 @@ size_t MasterGraph::compute_optimum_internal_batch_size(size_t user_batch_size,
 
     if(affinity == RaliAffinity::GPU)
         return user_batch_size;
-    
+
+    // The host batchPD kernels process the images of a batch concurrently, one thread per image, so the internal batch size
+    // sets how many threads the augmentation runs on. If the user asked for a thread count use the largest batch that fits in it.
+    size_t host_thread_count = compute_host_thread_count(cpu_threads);
+    if(host_thread_count > 0)
+    {
+        size_t ret = 1;
+        for(size_t i = std::min(host_thread_count, user_batch_size); i > 1; i--)
+            if(user_batch_size % i == 0)
+            {
+                ret = i;
+                break;
+            }
+        INFO("User batch size "+ TOSTR(user_batch_size)+" Internal batch size set to "+ TOSTR(ret) + " for " + TOSTR(host_thread_count) + " cpu threads")
+        return ret;
+    }
+
     unsigned THREAD_COUNT = std::thread::hardware_concurrency();
     if(THREAD_COUNT >= MINIMUM_CPU_THREAD_COUNT)
         INFO("Can run " + TOSTR(THREAD_COUNT) + " threads simultaneously on this machine")
@@ -1023,160 +1090,3 @@ bool MasterGraph::no_more_processed_data()
     return (_output_routine_finished_processing && _ring_buffer.empty());
 }
 
-MasterGraph::Status
-MasterGraph::copy_out_tensor_planar(void *out_ptr, RaliTensorFormat format, float multiplier0, float multiplier1,
-                             float multiplier2, float offset0, float offset1, float offset2, bool reverse_channels, RaliTensorDataType output_data_type)
-{
-    if(no_more_processed_data())
-        return MasterGraph::Status::NO_MORE_DATA;
-
-    _convert_time.start();
-    // Copies to the output context given by the user, each image is copied separate for planar
-    const size_t w = output_width();
-    const size_t h = _output_image_info.height_single();
-    const size_t c = output_depth();
-    const size_t n = _output_image_info.batch_size();
-
-    const size_t single_output_image_size = output_byte_size();
-
-
-    if(_output_image_info.mem_type() == RaliMemType::OCL)
-    {
-        THROW("copy_out_tensor_planar for GPU affinity is not implemented")
-    }
-    if(_output_image_info.mem_type() == RaliMemType::HOST)
-    {
-        float multiplier[3] = {multiplier0, multiplier1, multiplier2 };
-        float offset[3] = {offset0, offset1, offset2 };
-        size_t dest_buf_offset = 0;
-
-        auto output_buffers =_ring_buffer.get_read_buffers();
-
-        for( auto&& out_image: output_buffers)
-        {
-            for (unsigned batch = 0; batch < n ; batch++) {
-                const size_t batch_offset = w*h*c*batch;
-                auto in_buffer = (unsigned char *) out_image + batch_offset;
-                if (format == RaliTensorFormat::NHWC) {
-                    if (output_data_type == RaliTensorDataType::FP32) {
-                        float *output_tensor_32 = static_cast<float *>(out_ptr) + batch_offset;
-                        auto channel_size = w * h;
-                        for (unsigned channel_idx = 0; channel_idx < c; channel_idx++)
-                            for (unsigned i = 0; i < channel_size; i++)
-                                output_tensor_32[dest_buf_offset + channel_idx + i * c] =
-                                        offset[channel_idx] + multiplier[channel_idx] *
-                                                              (reverse_channels ? (float) (in_buffer[i +
-                                                                                                     (c - channel_idx -
-                                                                                                      1) *
-                                                                                                     channel_size])
-                                                                                : (float) (in_buffer[i + channel_idx *
-                                                                                                         channel_size]));
-                    } else if (output_data_type == RaliTensorDataType::FP16) {
-                        half *output_tensor_16 = static_cast<half *>(out_ptr) + batch_offset;
-                        auto channel_size = w * h;
-                        for (unsigned channel_idx = 0; channel_idx < c; channel_idx++)
-                            for (unsigned i = 0; i < channel_size; i++)
-                                output_tensor_16[dest_buf_offset + channel_idx + i * c] =
-                                        offset[channel_idx] + multiplier[channel_idx] *
-                                                              (reverse_channels ? (half) (in_buffer[
-                                                                      (c - channel_idx - 1) * channel_size + i])
-                                                                                : (half) (in_buffer[
-                                                                              channel_idx * channel_size + i]));
-                    }
-                }
-                if (format == RaliTensorFormat::NCHW) {
-                    if (output_data_type == RaliTensorDataType::FP32) {
-                        float *output_tensor_32 = static_cast<float *>(out_ptr) + batch_offset;
-                        //output_tensor_32 += batch_offset;
-                        auto channel_size = w * h;
-                        if (c != 3) {
-                            for (unsigned channel_idx = 0; channel_idx < c; channel_idx++)
-                                for (unsigned i = 0; i < channel_size; i++)
-                                    output_tensor_32[dest_buf_offset + channel_idx * channel_size + i] =
-                                            offset[channel_idx] + multiplier[channel_idx] *
-                                                                  (reverse_channels ? (float) (in_buffer[
-                                                                          (c - channel_idx - 1) * channel_size + i])
-                                                                                    : (float) (in_buffer[
-                                                                                  channel_idx * channel_size + i]));
-                        } else {
-#if (ENABLE_SIMD && __AVX2__)
-
-                            float *B_buf = output_tensor_32 + dest_buf_offset;
-                            float *G_buf = B_buf + channel_size;
-                            float *R_buf = G_buf + channel_size;
-                            unsigned char *in_buffer_R = in_buffer;
-                            unsigned char *in_buffer_G = in_buffer + channel_size;
-                            unsigned char *in_buffer_B = in_buffer_G + channel_size;
-
-                            __m256 pmul0 = _mm256_set1_ps(multiplier0);
-                            __m256 pmul1 = _mm256_set1_ps(multiplier1);
-                            __m256 pmul2 = _mm256_set1_ps(multiplier2);
-                            __m256 padd0 = _mm256_set1_ps(offset0);
-                            __m256 padd1 = _mm256_set1_ps(offset1);
-                            __m256 padd2 = _mm256_set1_ps(offset2);
-                            unsigned int alignedLength = (channel_size & ~7);    // multiple of 8
-                            unsigned int i = 0;
-
-                            __m256 fR, fG, fB;
-                            for (; i < alignedLength; i += 8) {
-                                __m128i pixR, pixG, pixB;
-                                if (reverse_channels) {
-                                    pixB = _mm_loadl_epi64((const __m128i *) in_buffer_R);
-                                    pixG = _mm_loadl_epi64((const __m128i *) in_buffer_G);
-                                    pixR = _mm_loadl_epi64((const __m128i *) in_buffer_B);
-                                } else {
-                                    pixR = _mm_loadl_epi64((const __m128i *) in_buffer_R);
-                                    pixG = _mm_loadl_epi64((const __m128i *) in_buffer_G);
-                                    pixB = _mm_loadl_epi64((const __m128i *) in_buffer_B);
-                                }
-                                fB = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(pixR));
-                                fG = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(pixG));
-                                fR = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(pixB));
-                                fB = _mm256_mul_ps(fB, pmul0);
-                                fG = _mm256_mul_ps(fG, pmul1);
-                                fR = _mm256_mul_ps(fR, pmul2);
-                                fB = _mm256_add_ps(fB, padd0);
-                                fG = _mm256_add_ps(fG, padd1);
-                                fR = _mm256_add_ps(fR, padd2);
-                                _mm256_storeu_ps(B_buf, fB);
-                                _mm256_storeu_ps(G_buf, fG);
-                                _mm256_storeu_ps(R_buf, fR);
-                                B_buf += 8;
-                                G_buf += 8;
-                                R_buf += 8;
-                                in_buffer_R += 8, in_buffer_G += 8, in_buffer_B += 8;
-                            }
-                            for (; i < channel_size; i++) {
-                                *B_buf++ = (*in_buffer_R++ * multiplier0) + offset0;
-                                *G_buf++ = (*in_buffer_G++ * multiplier1) + offset1;
-                                *R_buf++ = (*in_buffer_B++ * multiplier2) + offset1;
-                            }
-
-#else
-                            for(unsigned channel_idx = 0; channel_idx < c; channel_idx++)
-                                for(unsigned i = 0; i < channel_size; i++)
-                                    output_tensor_32[dest_buf_offset+channel_idx*channel_size + i] =
-                                            offset[channel_idx] + multiplier[channel_idx]*(reverse_channels ? (float)(in_buffer[i+(c-channel_idx-1)*channel_size]) : (float)(in_buffer[i+channel_idx*channel_size]));
-#endif
-                        }
-                    } else if (output_data_type == RaliTensorDataType::FP16) {
-                        half *output_tensor_16 = static_cast<half *>(out_ptr) + batch_offset;
-                        auto channel_size = w * h;
-                        for (unsigned channel_idx = 0; channel_idx < c; channel_idx++)
-                            for (unsigned i = 0; i < channel_size; i++)
-                                output_tensor_16[dest_buf_offset + channel_idx * channel_size + i] =
-                                        offset[channel_idx] + multiplier[channel_idx] *
-                                                              (reverse_channels ? (half) (in_buffer[i +
-                                                                                                    (c - channel_idx -
-                                                                                                     1) * channel_size])
-                                                                                : (half) (in_buffer[i + channel_idx *
-                                                                                                        channel_size]));
-                    }
-                }
-            }
-            dest_buf_offset += single_output_image_size;
-        }
-    }
-    _convert_time.end();
-    return Status::OK;
-}
@@ -109,3 +109,49 @@ raliCopyToOutput(
     return RALI_OK;
 }
 
+RaliStatus RALI_API_CALL
+raliSetOutputTensorPool(RaliContext p_context, void **buffers, unsigned buffer_count, RaliTensorLayout tensor_format,
+                        RaliTensorOutputType tensor_output_type, float multiplier0, float multiplier1, float multiplier2,
+                        float offset0, float offset1, float offset2, bool reverse_channels)
+{
+    auto context = static_cast<Context*>(p_context);
+    try
+    {
+        auto tensor_layout = (tensor_format == RALI_NHWC) ?  RaliTensorFormat::NHWC : RaliTensorFormat::NCHW;
+        auto tensor_output_data_type = (tensor_output_type == RALI_FP32) ? RaliTensorDataType::FP32 : RaliTensorDataType::FP16;
+        float multiplier[3] = {multiplier0, multiplier1, multiplier2};
+        float offset[3] = {offset0, offset1, offset2};
+        std::vector<void*> pool(buffers, buffers + buffer_count);
+        context->master_graph->set_output_tensor_pool(pool, tensor_layout, tensor_output_data_type, multiplier, offset, reverse_channels);
+    }
+    catch(const std::exception& e)
+    {
+        context->capture_error(e.what());
+        ERR(e.what())
+        return RALI_RUNTIME_ERROR;
+    }
+    return RALI_OK;
+}
+
+unsigned RALI_API_CALL
+raliGetOutputTensorPoolSize(RaliContext p_context)
+{
+    auto context = static_cast<Context*>(p_context);
+    return context->master_graph->output_tensor_pool_size();
+}
+
+int RALI_API_CALL
+raliGetOutputTensorIndex(RaliContext p_context)
+{
+    auto context = static_cast<Context*>(p_context);
+    try
+    {
+        return context->master_graph->output_tensor_index();
+    }
+    catch(const std::exception& e)
+    {
+        context->capture_error(e.what());
+        ERR(e.what())
+    }
+    return -1;
+}
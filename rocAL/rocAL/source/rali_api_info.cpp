@@ -119,7 +119,8 @@ RALI_API_CALL raliGetTimingInfo(RaliContext p_context)
     auto context = static_cast<Context*>(p_context);
     auto info = context->timing();
     //INFO("shuffle time "+ TOSTR(info.shuffle_time)); to display time taken for shuffling dataset
-    return {info.image_read_time, info.image_decode_time, info.image_process_time, info.copy_to_output};
+    return {info.image_read_time, info.image_decode_time, info.image_process_time, info.copy_to_output, info.image_read_latency, info.image_read_queue_depth,
+            info.process_cycle_time, info.process_parallelism};
 }
 
 RaliMetaData
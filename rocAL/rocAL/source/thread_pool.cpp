@@ -0,0 +1,91 @@
+/*
+Copyright (c) 2019 - 2020 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "thread_pool.h"
+
+ThreadPool::ThreadPool(size_t thread_count)
+{
+    if(thread_count == 0)
+        thread_count = std::thread::hardware_concurrency();
+    if(thread_count == 0)
+        thread_count = 1;
+    for(size_t i = 0; i < thread_count; i++)
+        _threads.emplace_back(&ThreadPool::worker_routine, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _running = false;
+    }
+    _work_cv.notify_all();
+    for(auto& thread: _threads)
+        if(thread.joinable())
+            thread.join();
+}
+
+void ThreadPool::parallel_for(size_t count, const std::function<void(size_t)>& job)
+{
+    if(count == 0)
+        return;
+    Submission submission {&job, count, 0, count, nullptr};
+    std::unique_lock<std::mutex> lock(_mutex);
+    _pending.push_back(&submission);
+    _work_cv.notify_all();
+    _done_cv.wait(lock, [&submission] { return submission.remaining == 0; });
+    if(submission.error)
+        std::rethrow_exception(submission.error);
+}
+
+void ThreadPool::worker_routine()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(true)
+    {
+        _work_cv.wait(lock, [this] { return !_running || !_pending.empty(); });
+        if(!_running)
+            break;
+        // Take a task from the submission at the front and move it to the back, so that concurrent submissions progress evenly
+        auto submission = _pending.front();
+        _pending.pop_front();
+        size_t idx = submission->next++;
+        if(submission->next < submission->count)
+            _pending.push_back(submission);
+        lock.unlock();
+        std::exception_ptr error = nullptr;
+        try
+        {
+            (*submission->job)(idx);
+        }
+        catch(...)
+        {
+            error = std::current_exception();
+        }
+        lock.lock();
+        if(error && !submission->error)
+            submission->error = error;
+        if(--submission->remaining == 0)
+            _done_cv.notify_all();
+    }
+}
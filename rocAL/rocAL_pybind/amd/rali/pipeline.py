@@ -256,6 +256,18 @@ class Pipeline(object):
             b.raliCopyToOutputTensor16(self._handle, np.ascontiguousarray(out, dtype=array.dtype), types.NCHW,
                                        multiplier[0], multiplier[1], multiplier[2], offset[0], offset[1], offset[2], (1 if reverse_channels else 0))
 
+    def setOutputTensorPool(self, arrays, tensor_layout, multiplier, offset, reverse_channels, tensor_dtype):
+        # RALI writes the batches straight into these arrays, they are kept alive as long as the pipeline
+        self._output_tensor_pool = arrays
+        return b.raliSetOutputTensorPool(self._handle, arrays, tensor_layout, tensor_dtype,
+                                         multiplier[0], multiplier[1], multiplier[2], offset[0], offset[1], offset[2], bool(reverse_channels))
+
+    def getOutputTensorPoolSize(self):
+        return b.raliGetOutputTensorPoolSize(self._handle)
+
+    def getOutputTensorIndex(self):
+        return b.raliGetOutputTensorIndex(self._handle)
+
     def encode(self, bboxes_in, labels_in):
         bboxes_tensor = torch.tensor(bboxes_in).float()
         labels_tensor=  torch.tensor(labels_in).long()
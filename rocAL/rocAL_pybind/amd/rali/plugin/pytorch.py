@@ -65,10 +65,13 @@ class RALIGenericIterator(object):
         self.bs = pipeline._batch_size
         color_format = b.getOutputColorFormat(self.loader._handle)
         self.p = (1 if (color_format == int(types.GRAY)) else 3)
+        # RALI converts every batch directly into one of the pool's tensors, so no copy is needed when a batch is returned
         if self.tensor_dtype == types.FLOAT:
-            self.out = np.zeros(( self.bs*self.n, self.p, int(self.h/self.bs), self.w,), dtype = "float32")
+            self.out_pool = [np.zeros(( self.bs*self.n, self.p, int(self.h/self.bs), self.w,), dtype = "float32") for i in range(self.loader.getOutputTensorPoolSize())]
         elif self.tensor_dtype == types.FLOAT16:
-            self.out = np.zeros(( self.bs*self.n, self.p, int(self.h/self.bs), self.w,), dtype = "float16")
+            self.out_pool = [np.zeros(( self.bs*self.n, self.p, int(self.h/self.bs), self.w,), dtype = "float16") for i in range(self.loader.getOutputTensorPoolSize())]
+        self.loader.setOutputTensorPool(self.out_pool, self.tensor_format, self.multiplier, self.offset, self.reverse_channels, self.tensor_dtype)
+        self.out = self.out_pool[0]
         # self.labels = np.zeros((self.bs),dtype = "int32")
         if(self.loader._oneHotEncoding == True):
             self.labels = np.zeros((self.bs)*(self.loader._numOfClasses),dtype = "int32")
@@ -94,11 +97,14 @@ class RALIGenericIterator(object):
         if self.loader.run() != 0:
             raise StopIteration
 
-        if(types.NCHW == self.tensor_format):
-            self.loader.copyToTensorNCHW(self.out, self.multiplier, self.offset, self.reverse_channels, int(self.tensor_dtype))
-        else:
-            self.loader.copyToTensorNHWC(self.out, self.multiplier, self.offset, self.reverse_channels, int(self.tensor_dtype))
-        
+        out_index = self.loader.getOutputTensorIndex()
+        if out_index < 0:
+            # -1 is returned both when all the batches are consumed and on failure, only the former ends the iteration
+            if(b.isEmpty(self.loader._handle)):
+                raise StopIteration
+            raise RuntimeError("Failed getting the output tensor: " + b.getErrorMessage(self.loader._handle))
+        self.out = self.out_pool[out_index]
+
         if((self.loader._name == "Caffe2ReaderDetection") or (self.loader._name == "CaffeReaderDetection")):
             self.lis = []  # Empty list for bboxes
             self.lis_lab = []  # Empty list of labels
@@ -145,10 +151,7 @@ class RALIGenericIterator(object):
             self.labels_padded = torch.LongTensor([row + [0] * (max_cols1 - len(row)) for batch in self.labels_padded for row in batch])
             self.labels_padded = self.labels_padded.view(-1, max_rows1, max_cols1)
 
-            if self.tensor_dtype == types.FLOAT:
-                return torch.from_numpy(self.out),self.bb_padded, self.labels_padded
-            elif self.tensor_dtype == types.FLOAT16:
-                return torch.from_numpy(self.out.astype(np.float16)),self.bb_padded, self.labels_padded
+            return torch.from_numpy(self.out),self.bb_padded, self.labels_padded
 
         else:
             if(self.loader._oneHotEncoding == True):
@@ -159,10 +162,7 @@ class RALIGenericIterator(object):
                 self.loader.getImageLabels(self.labels)
                 self.labels_tensor = torch.from_numpy(self.labels).type(torch.LongTensor)
 
-            if self.tensor_dtype == types.FLOAT:
-                return torch.from_numpy(self.out), self.labels_tensor
-            elif self.tensor_dtype == types.FLOAT16:
-                return torch.from_numpy(self.out.astype(np.float16)), self.labels_tensor
+            return torch.from_numpy(self.out), self.labels_tensor
 
     def reset(self):
         b.raliResetLoaders(self.loader._handle)
@@ -0,0 +1,94 @@
+import numpy as np
+import cv2
+import os
+import sys
+import shutil
+import tempfile
+from amd.rali.plugin.pytorch import RALIGenericIterator
+from amd.rali.pipeline import Pipeline
+import amd.rali.ops as ops
+import amd.rali.types as types
+
+# Checks that the batches written to the output tensor pool hold the decoded images, that the iterator stops once all
+# the batches are consumed, and that a failure getting the output tensor is raised instead of ending the iteration.
+
+class DecodePipe(Pipeline):
+	def __init__(self, batch_size, num_threads, device_id, data_dir, size, rali_cpu = True):
+		super(DecodePipe, self).__init__(batch_size, num_threads, device_id, seed=12 + device_id,rali_cpu=rali_cpu)
+		rali_device = 'cpu' if rali_cpu else 'gpu'
+		decoder_device = 'cpu' if rali_cpu else 'mixed'
+		self.input = ops.FileReader(file_root=data_dir, shard_id=0, num_shards=1, random_shuffle=False)
+		self.decode = ops.ImageDecoder(device=decoder_device, output_type=types.RGB)
+		self.res = ops.Resize(device=rali_device, resize_x=size, resize_y=size)
+
+	def define_graph(self):
+		self.jpegs, self.labels = self.input(name="Reader")
+		images = self.decode(self.jpegs)
+		output = self.res(images)
+		return [output, self.labels]
+
+def make_dataset(data_dir, count, value):
+	image = np.full((64, 64, 3), value, dtype = np.uint8)
+	folder_path = os.path.join(data_dir, 'class_0')
+	os.makedirs(folder_path)
+	for i in range(count):
+		cv2.imwrite(os.path.join(folder_path, 'image_%d.jpg' % i), image)
+
+def make_iterator(data_dir, bs, rali_cpu, size):
+	pipe = DecodePipe(batch_size=bs, num_threads=1, device_id=0, data_dir=data_dir, size=size, rali_cpu=rali_cpu)
+	pipe.build()
+	return pipe, RALIGenericIterator(pipe, multiplier=[1.0, 1.0, 1.0], offset=[0.0, 0.0, 0.0])
+
+def test_all_batches(data_dir, bs, rali_cpu, size, expected):
+	pipe, iterator = make_iterator(data_dir, bs, rali_cpu, size)
+	batches = 0
+	for i, (image_tensor, label_tensor) in enumerate(iterator, 0):
+		# more batches than ring buffer slots are read, so the pool entries are reused while the next batches are processed
+		mean = image_tensor.numpy().mean()
+		if abs(mean - 200) > 10:
+			print('FAILED: batch %d written to the output tensor with mean %f, expected 200' % (i, mean))
+			return False
+		batches += 1
+	if batches != expected:
+		print('FAILED: %d batch(es) read, expected %d' % (batches, expected))
+		return False
+	print('OK: %d batch(es) read through the output tensor pool' % batches)
+	return True
+
+def test_failure_raised(data_dir, bs, rali_cpu, size):
+	pipe, iterator = make_iterator(data_dir, bs, rali_cpu, size)
+	# without a pool getOutputTensorIndex() fails while batches are still available
+	pipe.setOutputTensorPool([], types.NCHW, [1.0, 1.0, 1.0], [0.0, 0.0, 0.0], False, types.FLOAT)
+	try:
+		next(iter(iterator))
+	except StopIteration:
+		print('FAILED: a failure getting the output tensor ended the iteration')
+		return False
+	except RuntimeError as e:
+		print('OK: failure raised: %s' % e)
+		return True
+	print('FAILED: no error raised without an output tensor pool')
+	return False
+
+def main():
+	if  len(sys.argv) < 3:
+		print ('Please pass cpu/gpu batch_size')
+		exit(0)
+	_rali_cpu = (sys.argv[1] == "cpu")
+	bs = int(sys.argv[2])
+	size = 32
+	batch_count = 6
+	failed = 0
+	data_dir = tempfile.mkdtemp()
+	try:
+		make_dataset(data_dir, batch_count * bs, 200)
+		if not test_all_batches(data_dir, bs, _rali_cpu, size, batch_count):
+			failed += 1
+		if not test_failure_raised(data_dir, bs, _rali_cpu, size):
+			failed += 1
+	finally:
+		shutil.rmtree(data_dir)
+	exit(1 if failed else 0)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,82 @@
+import numpy as np
+import cv2
+import os
+import sys
+import shutil
+import tempfile
+from amd.rali.plugin.pytorch import RALI_iterator
+from amd.rali.pipeline import Pipeline
+import amd.rali.ops as ops
+import amd.rali.types as types
+
+# Checks that a file that can't be read near the end of the dataset is replaced by the next file when there is one,
+# and that a batch which can't be filled any more is dropped instead of being decoded with stale data.
+
+class DecodePipe(Pipeline):
+	def __init__(self, batch_size, num_threads, device_id, data_dir, size, rali_cpu = True):
+		super(DecodePipe, self).__init__(batch_size, num_threads, device_id, seed=12 + device_id,rali_cpu=rali_cpu)
+		rali_device = 'cpu' if rali_cpu else 'gpu'
+		decoder_device = 'cpu' if rali_cpu else 'mixed'
+		self.input = ops.FileReader(file_root=data_dir, shard_id=0, num_shards=1, random_shuffle=False)
+		self.decode = ops.ImageDecoder(device=decoder_device, output_type=types.RGB)
+		self.res = ops.Resize(device=rali_device, resize_x=size, resize_y=size)
+
+	def define_graph(self):
+		self.jpegs, self.labels = self.input(name="Reader")
+		images = self.decode(self.jpegs)
+		output = self.res(images)
+		return [output, self.labels]
+
+def make_dataset(data_dir, counts, value):
+	# FileReader sorts the class folders, so files of the last folder are read last; the order of files within a
+	# folder isn't defined, so the last folder holds the empty (unreadable) file
+	image = np.full((64, 64, 3), value, dtype = np.uint8)
+	for folder, count in enumerate(counts):
+		folder_path = os.path.join(data_dir, 'class_%d' % folder)
+		os.makedirs(folder_path)
+		for i in range(count):
+			cv2.imwrite(os.path.join(folder_path, 'image_%d.jpg' % i), image)
+	open(os.path.join(data_dir, 'class_%d' % (len(counts) - 1), 'image_empty.jpg'), 'wb').close()
+
+def count_batches(data_dir, bs, rali_cpu, size):
+	pipe = DecodePipe(batch_size=bs, num_threads=1, device_id=0, data_dir=data_dir, size=size, rali_cpu=rali_cpu)
+	pipe.build()
+	batches = 0
+	for i, (image_batch, image_tensor) in enumerate(RALI_iterator(pipe), 0):
+		# every image of a batch must come from a decoded file
+		for n in range(bs):
+			if image_batch[n*size:(n+1)*size].mean() < 100:
+				print('FAILED: image %d of batch %d was not decoded' % (n, i))
+				return -1
+		batches += 1
+	return batches
+
+def main():
+	if  len(sys.argv) < 3:
+		print ('Please pass cpu/gpu batch_size')
+		exit(0)
+	_rali_cpu = (sys.argv[1] == "cpu")
+	bs = int(sys.argv[2])
+	size = 32
+	failed = 0
+	# (files per folder with the empty file added to the last folder, expected batch count)
+	tests = [
+		([bs, bs - 1], 1),      # the empty file can't be replaced: the second batch is dropped
+		([bs, 2 * bs - 1], 2),  # the empty file is replaced by a file of the last batch, which is then dropped
+	]
+	for counts, expected in tests:
+		data_dir = tempfile.mkdtemp()
+		try:
+			make_dataset(data_dir, counts, 200)
+			batches = count_batches(data_dir, bs, _rali_cpu, size)
+		finally:
+			shutil.rmtree(data_dir)
+		if batches != expected:
+			print('FAILED: %s files read as %d batch(es), expected %d' % (counts, batches, expected))
+			failed += 1
+		else:
+			print('OK: %s files read as %d batch(es)' % (counts, batches))
+	exit(1 if failed else 0)
+
+if __name__ == '__main__':
+    main()
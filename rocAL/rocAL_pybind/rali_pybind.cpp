@@ -99,6 +99,22 @@ namespace rali{
         return py::cast<py::none>(Py_None);
     }
 
+    py::object wrapper_set_output_tensor_pool(RaliContext context, std::vector<py::array> arrays,
+                                              RaliTensorLayout tensor_format, RaliTensorOutputType tensor_output_type,
+                                              float multiplier0, float multiplier1, float multiplier2, float offset0,
+                                              float offset1, float offset2,
+                                              bool reverse_channels)
+    {
+        std::vector<void*> buffers;
+        for(auto& array: arrays)
+            buffers.push_back(array.mutable_data());
+        // call pure C++ function
+        int status = raliSetOutputTensorPool(context, buffers.data(), buffers.size(), tensor_format, tensor_output_type,
+                                             multiplier0, multiplier1, multiplier2, offset0,
+                                             offset1, offset2, reverse_channels);
+        return py::cast(status);
+    }
+
     py::object wrapper_label_copy(RaliContext context, py::array_t<int> array)
     {
         auto buf = array.request();
@@ -183,7 +199,11 @@ namespace rali{
             .def_readwrite("load_time",&TimingInfo::load_time)
             .def_readwrite("decode_time",&TimingInfo::decode_time)
             .def_readwrite("process_time",&TimingInfo::process_time)
-            .def_readwrite("transfer_time",&TimingInfo::transfer_time);
+            .def_readwrite("transfer_time",&TimingInfo::transfer_time)
+            .def_readwrite("read_latency",&TimingInfo::read_latency)
+            .def_readwrite("read_queue_depth",&TimingInfo::read_queue_depth)
+            .def_readwrite("process_cycle_time",&TimingInfo::process_cycle_time)
+            .def_readwrite("process_parallelism",&TimingInfo::process_parallelism);
         py::module types_m = m.def_submodule("types");
         types_m.doc() = "Datatypes and options used by RALI";
         py::enum_<RaliStatus>(types_m, "RaliStatus", "Status info")
@@ -230,6 +250,7 @@ namespace rali{
         m.def("getImageName",&wrapper_image_name);
         m.def("getImageNameLen",&wrapper_image_name_length);
         m.def("getStatus",&raliGetStatus);
+        m.def("getErrorMessage",&raliGetErrorMessage);
         m.def("labelReader",&raliCreateLabelReader);
         m.def("TFReader",&raliCreateTFReader);
         m.def("TFReaderDetection",&raliCreateTFReaderDetection);
@@ -267,6 +288,9 @@ namespace rali{
         m.def("raliCopyToOutput",&wrapper);
         m.def("raliCopyToOutputTensor32",&wrapper_tensor32);
         m.def("raliCopyToOutputTensor16",&wrapper_tensor16);
+        m.def("raliSetOutputTensorPool",&wrapper_set_output_tensor_pool);
+        m.def("raliGetOutputTensorPoolSize",&raliGetOutputTensorPoolSize);
+        m.def("raliGetOutputTensorIndex",&raliGetOutputTensorIndex);
         // rali_api_data_loaders.h
          m.def("COCO_ImageDecoderSlice",&raliJpegCOCOFileSourcePartial,"Reads file from the source given and decodes it according to the policy",
             py::return_value_policy::reference,
@@ -0,0 +1,81 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "test_utils.h"
+
+// v1 = NOT(in), v2 = v1 - in, out1 = NOT(v2) lets v2 share the buffer of v1, since v1 isn't used after
+// the subtraction; a node added later that reads v1 and v2 must not see that alias after re-verify
+static int testBufferAliasReverify(vx_context context, vx_uint32 width, vx_uint32 height)
+{
+    std::vector<vx_uint8> input((vx_size)width * height), out1(input.size()), out2(input.size());
+    testFillRandom(input.data(), input.size(), width + height);
+
+    vx_graph graph = vxCreateGraph(context);
+    TEST_VX(vxGetStatus((vx_reference)graph));
+    vx_image iImg = testCreateImageU8(context, width, height, input.data());
+    vx_image o1Img = testCreateImageU8(context, width, height, out1.data());
+    vx_image o2Img = testCreateImageU8(context, width, height, out2.data());
+    vx_image v1Img = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    vx_image v2Img = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    TEST_VX(vxGetStatus((vx_reference)vxNotNode(graph, iImg, v1Img)));
+    TEST_VX(vxGetStatus((vx_reference)vxSubtractNode(graph, v1Img, iImg, VX_CONVERT_POLICY_WRAP, v2Img)));
+    TEST_VX(vxGetStatus((vx_reference)vxNotNode(graph, v2Img, o1Img)));
+    TEST_VX(vxVerifyGraph(graph));
+    TEST_VX(vxProcessGraph(graph));
+    for (vx_size i = 0; i < input.size(); i++) {
+        TEST_CHECK(out1[i] == (vx_uint8)~(vx_uint8)(~input[i] - input[i]));
+    }
+
+    // v1 is now used after v2 is written
+    TEST_VX(vxGetStatus((vx_reference)vxAddNode(graph, v1Img, v2Img, VX_CONVERT_POLICY_WRAP, o2Img)));
+    TEST_VX(vxVerifyGraph(graph));
+    TEST_VX(vxProcessGraph(graph));
+    for (vx_size i = 0; i < input.size(); i++) {
+        vx_uint8 v1 = (vx_uint8)~input[i], v2 = (vx_uint8)(v1 - input[i]);
+        if (out1[i] != (vx_uint8)~v2 || out2[i] != (vx_uint8)(v1 + v2)) {
+            printf("ERROR: %dx%d mismatch at %d: %d,%d instead of %d,%d\n", width, height, (int)i, out1[i], out2[i], (vx_uint8)~v2, (vx_uint8)(v1 + v2));
+            return 1;
+        }
+    }
+
+    TEST_VX(vxReleaseImage(&iImg));
+    TEST_VX(vxReleaseImage(&o1Img));
+    TEST_VX(vxReleaseImage(&o2Img));
+    TEST_VX(vxReleaseImage(&v1Img));
+    TEST_VX(vxReleaseImage(&v2Img));
+    TEST_VX(vxReleaseGraph(&graph));
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    TEST_RUN(testBufferAliasReverify(context, 640, 480));
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
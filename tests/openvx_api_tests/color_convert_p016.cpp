@@ -0,0 +1,139 @@
+/*
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "test_utils.h"
+#include <math.h>
+
+// saturated primaries: chroma of red and blue reaches the top of the range
+static const vx_uint8 colors[][3] = {
+    { 255, 0, 0 },      // red
+    { 0, 0, 255 },      // blue
+    { 255, 255, 255 },  // white
+    { 0, 0, 0 },        // black
+    { 0, 255, 0 },      // green
+};
+static const int colorCount = sizeof(colors) / sizeof(colors[0]);
+
+// BT.709 reference of a sample scaled to the format, before shifting into the most significant bits
+static vx_uint32 referenceSample(float value, bool p010)
+{
+    float scale = p010 ? (1023.0f / 255.0f) : 257.0f;
+    float maxValue = p010 ? 1023.0f : 65535.0f;
+    return (vx_uint32)fminf(fmaxf(roundf(value * scale), 0.0f), maxValue);
+}
+
+static int checkSample(const char * name, int x, vx_uint16 sample, float value, bool p010)
+{
+    vx_uint32 expected = referenceSample(value, p010);
+    vx_uint32 actual = p010 ? (sample >> 6) : sample;
+    if ((p010 && (sample & 63)) || actual + 1 < expected || actual > expected + 1) {
+        printf("ERROR: %s %s at %d is 0x%04x, expected %u\n", p010 ? "P010" : "P016", name, x, sample, expected);
+        return 1;
+    }
+    return 0;
+}
+
+// converts 2 rows of RGB/RGBX with a color per 2x2 block to P010/P016: widths that are not a multiple
+// of 4 cover the per-pixel tail after the SIMD loop
+static int testColorConvertP016(vx_context context, vx_df_image srcFormat, vx_df_image dstFormat, vx_uint32 width)
+{
+    const vx_uint32 height = 2;
+    bool p010 = (dstFormat == VX_DF_IMAGE_P010_AMD);
+    int bytesPerPixel = (srcFormat == VX_DF_IMAGE_RGBX) ? 4 : 3;
+    std::vector<vx_uint8> input((vx_size)width * height * bytesPerPixel, 255);
+    for (vx_uint32 y = 0; y < height; y++) {
+        for (vx_uint32 x = 0; x < width; x++) {
+            memcpy(&input[((vx_size)y * width + x) * bytesPerPixel], colors[(x / 2) % colorCount], 3);
+        }
+    }
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = bytesPerPixel;
+    addr.stride_y = (vx_int32)(width * bytesPerPixel);
+    void * ptrs[] = { input.data() };
+    vx_image iImg = vxCreateImageFromHandle(context, srcFormat, &addr, ptrs, VX_MEMORY_TYPE_HOST);
+    vx_image oImg = vxCreateImage(context, width, height, dstFormat);
+    TEST_VX(vxGetStatus((vx_reference)iImg));
+    TEST_VX(vxGetStatus((vx_reference)oImg));
+    vx_graph graph = vxCreateGraph(context);
+    TEST_VX(vxGetStatus((vx_reference)graph));
+    vx_node node = vxColorConvertNode(graph, iImg, oImg);
+    TEST_VX(vxGetStatus((vx_reference)node));
+    TEST_VX(vxVerifyGraph(graph));
+    TEST_VX(vxProcessGraph(graph));
+
+    vx_rectangle_t rect = { 0, 0, width, height };
+    int errors = 0;
+    for (vx_uint32 plane = 0; plane < 2; plane++) {
+        vx_map_id map_id;
+        vx_imagepatch_addressing_t maddr;
+        void * ptr = nullptr;
+        TEST_VX(vxMapImagePatch(oImg, &rect, plane, &map_id, &maddr, &ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+        for (vx_uint32 y = 0; y < (plane ? 1 : height); y++) {
+            const vx_uint16 * row = (const vx_uint16 *)((vx_uint8 *)ptr + y * maddr.stride_y);
+            for (vx_uint32 x = 0; x < width; x += 2) {
+                const vx_uint8 * c = colors[(x / 2) % colorCount];
+                float R = c[0], G = c[1], B = c[2];
+                if (plane == 0) {
+                    float Y = R * 0.2126f + G * 0.7152f + B * 0.0722f;
+                    errors += checkSample("Y", x, row[x], Y, p010);
+                    errors += checkSample("Y", x + 1, row[x + 1], Y, p010);
+                }
+                else {
+                    float U = R * -0.1146f + G * -0.3854f + B * 0.5f + 128.0f;
+                    float V = R * 0.5f + G * -0.4542f + B * -0.0458f + 128.0f;
+                    errors += checkSample("U", x, row[x], U, p010);
+                    errors += checkSample("V", x, row[x + 1], V, p010);
+                }
+            }
+        }
+        TEST_VX(vxUnmapImagePatch(oImg, map_id));
+    }
+
+    TEST_VX(vxReleaseNode(&node));
+    TEST_VX(vxReleaseGraph(&graph));
+    TEST_VX(vxReleaseImage(&iImg));
+    TEST_VX(vxReleaseImage(&oImg));
+    return errors ? 1 : 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    vx_df_image srcFormats[] = { VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX };
+    vx_df_image dstFormats[] = { VX_DF_IMAGE_P010_AMD, VX_DF_IMAGE_P016_AMD };
+    for (auto srcFormat : srcFormats) {
+        for (auto dstFormat : dstFormats) {
+            TEST_RUN(testColorConvertP016(context, srcFormat, dstFormat, 20));
+            TEST_RUN(testColorConvertP016(context, srcFormat, dstFormat, 14));
+            TEST_RUN(testColorConvertP016(context, srcFormat, dstFormat, 2));
+        }
+    }
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
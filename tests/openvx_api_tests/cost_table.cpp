@@ -0,0 +1,151 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "test_utils.h"
+#include <stdlib.h>
+#include <unistd.h>
+#include <string>
+
+static bool userKernelFail = false;
+
+// user kernel that fails on request, so that samples of failed executions can be checked
+static vx_status VX_CALLBACK testFailKernelExec(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+    return userKernelFail ? VX_FAILURE : VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK testFailKernelValidate(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
+{
+    return vxSetMetaFormatFromReference(metas[1], parameters[0]);
+}
+
+// sums the CPU sample counts of the table entries whose key starts (or doesn't start) with prefix
+static int testCostTableCount(const char * fileName, const char * prefix, bool match, unsigned long long& count)
+{
+    FILE * fp = fopen(fileName, "r");
+    TEST_CHECK(fp != nullptr);
+    char line[1024], key[512];
+    count = 0;
+    while (fgets(line, sizeof(line), fp)) {
+        unsigned long long cpuCount, gpuCount;
+        double cpuTime, gpuTime;
+        if (sscanf(line, "cost %511s %llu %lf %llu %lf", key, &cpuCount, &cpuTime, &gpuCount, &gpuTime) == 5) {
+            if ((strncmp(key, prefix, strlen(prefix)) == 0) == match)
+                count += cpuCount;
+        }
+    }
+    fclose(fp);
+    return 0;
+}
+
+// in -> NOT -> v -> user kernel -> out with cost partitioning and incremental execution:
+// frame 0 succeeds, frame 1 changes in and the user kernel fails after NOT ran, frame 2 skips NOT and reruns the
+// user kernel. Only the successful frames are sampled, so NOT has one sample and the user kernel two, and the
+// cost table file keeps the transfer parameters it was loaded with
+static int testCostTable(const char * fileName)
+{
+    FILE * fp = fopen(fileName, "w");
+    TEST_CHECK(fp != nullptr);
+    fprintf(fp, "transfer 0.500000 2000.0\n");
+    fclose(fp);
+    setenv("AGO_COST_TABLE", fileName, 1);
+    vx_context context = vxCreateContext();
+    unsetenv("AGO_COST_TABLE");
+    TEST_VX(vxGetStatus((vx_reference)context));
+
+    vx_enum kernelId;
+    TEST_VX(vxAllocateUserKernelId(context, &kernelId));
+    vx_kernel kernel = vxAddUserKernel(context, "test.cost.fail", kernelId, testFailKernelExec, 2, testFailKernelValidate, nullptr, nullptr);
+    TEST_VX(vxGetStatus((vx_reference)kernel));
+    TEST_VX(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+    TEST_VX(vxAddParameterToKernel(kernel, 1, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+    TEST_VX(vxFinalizeKernel(kernel));
+
+    vx_uint32 width = 64, height = 16;
+    std::vector<vx_uint8> in((vx_size)width * height);
+    testFillRandom(in.data(), in.size(), 1);
+    vx_graph graph = vxCreateGraph(context);
+    TEST_VX(vxGetStatus((vx_reference)graph));
+    vx_enum partition = VX_TARGET_PARTITION_AMD_COST;
+    TEST_VX(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_TARGET_PARTITION, &partition, sizeof(partition)));
+    vx_bool enable = vx_true_e;
+    TEST_VX(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_INCREMENTAL_EXECUTION, &enable, sizeof(enable)));
+    vx_image iImg = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image vImg = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    vx_image oImg = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_node notNode = vxNotNode(graph, iImg, vImg);
+    TEST_VX(vxGetStatus((vx_reference)notNode));
+    vx_node failNode = vxCreateGenericNode(graph, kernel);
+    TEST_VX(vxSetParameterByIndex(failNode, 0, (vx_reference)vImg));
+    TEST_VX(vxSetParameterByIndex(failNode, 1, (vx_reference)oImg));
+    TEST_VX(vxVerifyGraph(graph));
+
+    vx_rectangle_t rect = { 0, 0, width, height };
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.stride_x = 1;
+    addr.stride_y = (vx_int32)width;
+    TEST_VX(vxCopyImagePatch(iImg, &rect, 0, &addr, in.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    TEST_VX(vxProcessGraph(graph));
+    in[0] ^= 0xff;
+    TEST_VX(vxCopyImagePatch(iImg, &rect, 0, &addr, in.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    userKernelFail = true;
+    TEST_CHECK(vxProcessGraph(graph) != VX_SUCCESS);
+    userKernelFail = false;
+    TEST_VX(vxProcessGraph(graph));
+
+    TEST_VX(vxReleaseNode(&notNode));
+    TEST_VX(vxReleaseNode(&failNode));
+    TEST_VX(vxReleaseImage(&iImg));
+    TEST_VX(vxReleaseImage(&vImg));
+    TEST_VX(vxReleaseImage(&oImg));
+    TEST_VX(vxReleaseGraph(&graph));
+    TEST_VX(vxReleaseKernel(&kernel));
+    TEST_VX(vxReleaseContext(&context));
+
+    // the table is saved when the context is released
+    unsigned long long count = 0;
+    TEST_CHECK(!testCostTableCount(fileName, "test.cost.fail:", true, count));
+    TEST_CHECK(count == 2);
+    TEST_CHECK(!testCostTableCount(fileName, "test.cost.fail:", false, count));
+    TEST_CHECK(count == 1);
+    fp = fopen(fileName, "r");
+    TEST_CHECK(fp != nullptr);
+    char line[1024];
+    bool transferFound = false;
+    while (fgets(line, sizeof(line), fp))
+        if (strcmp(line, "transfer 0.500000 2000.0\n") == 0)
+            transferFound = true;
+    fclose(fp);
+    TEST_CHECK(transferFound);
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    int failed = 0;
+    // tests with and without AGO_CPU_THREADS can run concurrently, so each process uses its own table
+    std::string fileName = "test_cost_table_" + std::to_string(getpid()) + ".txt";
+    TEST_RUN(testCostTable(fileName.c_str()));
+    remove(fileName.c_str());
+    return failed ? 1 : 0;
+}
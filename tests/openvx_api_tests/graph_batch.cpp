@@ -0,0 +1,146 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "test_utils.h"
+#include <string>
+
+#define TEST_BATCH_FRAMES 4
+
+static std::string logText;
+static void VX_CALLBACK testLogCallback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    logText += string;
+}
+
+// copies packed U8 pixels to or from an image
+static vx_status testCopyImageU8(vx_image image, vx_uint32 width, vx_uint32 height, vx_uint8 * buf, vx_enum usage)
+{
+    vx_rectangle_t rect = { 0, 0, width, height };
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = (vx_int32)width;
+    return vxCopyImagePatch(image, &rect, 0, &addr, buf, usage, VX_MEMORY_TYPE_HOST);
+}
+
+// out = NOT(in) + NOT(in) for each frame, with the intermediate image either virtual (all frames taken through
+// one node at a time) or an ROI (whole graph run once per frame): both must give per-frame results
+static int testGraphBatch(vx_context context, vx_uint32 width, vx_uint32 height, bool useROI)
+{
+    vx_size frameSize = (vx_size)width * height;
+    std::vector<vx_uint8> input(frameSize * TEST_BATCH_FRAMES), output(input.size());
+    testFillRandom(input.data(), input.size(), width + height);
+
+    vx_graph graph = vxCreateGraph(context);
+    TEST_VX(vxGetStatus((vx_reference)graph));
+    vx_uint32 frameCount = TEST_BATCH_FRAMES;
+    TEST_VX(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_BATCH_FRAME_COUNT, &frameCount, sizeof(frameCount)));
+    vx_image iImg = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image oImg = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image parentImg = nullptr, vImg;
+    if (useROI) {
+        vx_rectangle_t rect = { 1, 1, width + 1, height + 1 };
+        parentImg = vxCreateImage(context, width + 2, height + 2, VX_DF_IMAGE_U8);
+        vImg = vxCreateImageFromROI(parentImg, &rect);
+    }
+    else {
+        vImg = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    }
+    TEST_VX(vxGetStatus((vx_reference)vImg));
+    vx_node notNode = vxNotNode(graph, iImg, vImg);
+    vx_node addNode = vxAddNode(graph, vImg, vImg, VX_CONVERT_POLICY_WRAP, oImg);
+    TEST_VX(vxGetStatus((vx_reference)notNode));
+    TEST_VX(vxGetStatus((vx_reference)addNode));
+    vx_parameter param = vxGetParameterByIndex(notNode, 0);
+    TEST_VX(vxAddParameterToGraph(graph, param));
+    TEST_VX(vxReleaseParameter(&param));
+    param = vxGetParameterByIndex(addNode, 3);
+    TEST_VX(vxAddParameterToGraph(graph, param));
+    TEST_VX(vxReleaseParameter(&param));
+
+    // one object array item per frame for each graph parameter
+    vx_object_array iArr = vxCreateObjectArray(context, (vx_reference)iImg, TEST_BATCH_FRAMES);
+    vx_object_array oArr = vxCreateObjectArray(context, (vx_reference)oImg, TEST_BATCH_FRAMES);
+    TEST_VX(vxGetStatus((vx_reference)iArr));
+    TEST_VX(vxGetStatus((vx_reference)oArr));
+    for (vx_uint32 frame = 0; frame < TEST_BATCH_FRAMES; frame++) {
+        vx_image item = (vx_image)vxGetObjectArrayItem(iArr, frame);
+        TEST_VX(testCopyImageU8(item, width, height, &input[frame * frameSize], VX_WRITE_ONLY));
+        TEST_VX(vxReleaseImage(&item));
+    }
+    TEST_VX(vxSetGraphParameterByIndex(graph, 0, (vx_reference)iArr));
+    TEST_VX(vxSetGraphParameterByIndex(graph, 1, (vx_reference)oArr));
+
+    logText.clear();
+    TEST_VX(vxVerifyGraph(graph));
+    bool fallbackLogged = logText.find("WARNING: agoPrepareGraphBatch") != std::string::npos;
+    TEST_CHECK(fallbackLogged == useROI);
+    // the frame count can't change once verified
+    TEST_CHECK(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_BATCH_FRAME_COUNT, &frameCount, sizeof(frameCount)) == VX_ERROR_NOT_SUPPORTED);
+
+    TEST_VX(vxProcessGraph(graph));
+    for (vx_uint32 frame = 0; frame < TEST_BATCH_FRAMES; frame++) {
+        vx_image item = (vx_image)vxGetObjectArrayItem(oArr, frame);
+        TEST_VX(testCopyImageU8(item, width, height, &output[frame * frameSize], VX_READ_ONLY));
+        TEST_VX(vxReleaseImage(&item));
+    }
+    for (vx_size i = 0; i < input.size(); i++) {
+        vx_uint8 expected = (vx_uint8)(2 * (vx_uint8)~input[i]);
+        if (output[i] != expected) {
+            printf("ERROR: %s frame %d mismatch at %d: %d instead of %d\n", useROI ? "ROI" : "virtual",
+                (int)(i / frameSize), (int)(i % frameSize), output[i], expected);
+            return 1;
+        }
+    }
+    vx_uint32 queryCount = 0;
+    TEST_VX(vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_BATCH_FRAME_COUNT, &queryCount, sizeof(queryCount)));
+    TEST_CHECK(queryCount == TEST_BATCH_FRAMES);
+
+    TEST_VX(vxReleaseObjectArray(&iArr));
+    TEST_VX(vxReleaseObjectArray(&oArr));
+    TEST_VX(vxReleaseNode(&notNode));
+    TEST_VX(vxReleaseNode(&addNode));
+    TEST_VX(vxReleaseImage(&iImg));
+    TEST_VX(vxReleaseImage(&oImg));
+    TEST_VX(vxReleaseImage(&vImg));
+    if (parentImg)
+        TEST_VX(vxReleaseImage(&parentImg));
+    TEST_VX(vxReleaseGraph(&graph));
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    vxRegisterLogCallback(context, testLogCallback, vx_false_e);
+    int failed = 0;
+    TEST_RUN(testGraphBatch(context, 640, 480, false));
+    TEST_RUN(testGraphBatch(context, 640, 480, true));
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
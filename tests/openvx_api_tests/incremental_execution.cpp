@@ -0,0 +1,128 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "test_utils.h"
+#include <VX/vx_khr_buffer_aliasing.h>
+
+static int userKernelCalls = 0;
+
+// user kernel that counts its executions, so that skipped executions can be checked
+static vx_status VX_CALLBACK testCountKernelExec(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+    userKernelCalls++;
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK testCountKernelValidate(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
+{
+    return vxSetMetaFormatFromReference(metas[1], parameters[0]);
+}
+
+// v1 = NOT(in1), v2 = v1 - in2 (shares the buffer of v1), out1 = NOT(v2), and a user kernel reading in1:
+// with incremental execution, changing only in2 between two vxProcessGraph calls must recompute v1,
+// which v2 overwrote, while the user kernel that only depends on in1 is skipped
+static int testIncrementalExecution(vx_context context, vx_uint32 width, vx_uint32 height)
+{
+    vx_enum kernelId;
+    TEST_VX(vxAllocateUserKernelId(context, &kernelId));
+    vx_kernel kernel = vxAddUserKernel(context, "test.incremental.count", kernelId, testCountKernelExec, 2, testCountKernelValidate, nullptr, nullptr);
+    TEST_VX(vxGetStatus((vx_reference)kernel));
+    TEST_VX(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+    TEST_VX(vxAddParameterToKernel(kernel, 1, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+    TEST_VX(vxFinalizeKernel(kernel));
+
+    std::vector<vx_uint8> in1((vx_size)width * height), in2(in1.size()), out1(in1.size()), out2(in1.size());
+    testFillRandom(in1.data(), in1.size(), 1);
+    testFillRandom(in2.data(), in2.size(), 2);
+
+    vx_graph graph = vxCreateGraph(context);
+    TEST_VX(vxGetStatus((vx_reference)graph));
+    vx_bool enable = vx_true_e;
+    TEST_VX(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_INCREMENTAL_EXECUTION, &enable, sizeof(enable)));
+    vx_image i1Img = testCreateImageU8(context, width, height, in1.data());
+    vx_image i2Img = testCreateImageU8(context, width, height, in2.data());
+    vx_image o1Img = testCreateImageU8(context, width, height, out1.data());
+    vx_image o2Img = testCreateImageU8(context, width, height, out2.data());
+    vx_image v1Img = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    vx_image v2Img = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    vx_node nodes[] = {
+        vxNotNode(graph, i1Img, v1Img),
+        vxSubtractNode(graph, v1Img, i2Img, VX_CONVERT_POLICY_WRAP, v2Img),
+        vxNotNode(graph, v2Img, o1Img),
+        vxCreateGenericNode(graph, kernel),
+    };
+    for (auto node : nodes)
+        TEST_VX(vxGetStatus((vx_reference)node));
+    TEST_VX(vxSetParameterByIndex(nodes[3], 0, (vx_reference)i1Img));
+    TEST_VX(vxSetParameterByIndex(nodes[3], 1, (vx_reference)o2Img));
+    TEST_VX(vxVerifyGraph(graph));
+    TEST_CHECK(vxIsParameterAliased(nodes[1], 0, 3) == vx_true_e);
+
+    for (int frame = 0; frame < 4; frame++) {
+        if (frame == 1 || frame == 3) {
+            // new contents of in2, or of in1 in the last frame, written through the OpenVX API
+            std::vector<vx_uint8>& in = (frame == 1) ? in2 : in1;
+            std::vector<vx_uint8> data(in.size());
+            testFillRandom(data.data(), data.size(), 10 + frame);
+            vx_rectangle_t rect = { 0, 0, width, height };
+            vx_imagepatch_addressing_t addr = { width, height, 1, (vx_int32)width };
+            TEST_VX(vxCopyImagePatch((frame == 1) ? i2Img : i1Img, &rect, 0, &addr, data.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+            TEST_CHECK(in == data);
+        }
+        TEST_VX(vxProcessGraph(graph));
+        for (vx_size i = 0; i < in1.size(); i++) {
+            vx_uint8 v1 = (vx_uint8)~in1[i], v2 = (vx_uint8)(v1 - in2[i]);
+            if (out1[i] != (vx_uint8)~v2) {
+                printf("ERROR: frame %d mismatch at %d: %d instead of %d\n", frame, (int)i, out1[i], (vx_uint8)~v2);
+                return 1;
+            }
+        }
+        // the user kernel only runs for the first frame and after in1 changed
+        TEST_CHECK(userKernelCalls == ((frame < 3) ? 1 : 2));
+    }
+
+    for (auto node : nodes)
+        TEST_VX(vxReleaseNode(&node));
+    TEST_VX(vxReleaseImage(&i1Img));
+    TEST_VX(vxReleaseImage(&i2Img));
+    TEST_VX(vxReleaseImage(&o1Img));
+    TEST_VX(vxReleaseImage(&o2Img));
+    TEST_VX(vxReleaseImage(&v1Img));
+    TEST_VX(vxReleaseImage(&v2Img));
+    TEST_VX(vxReleaseGraph(&graph));
+    TEST_VX(vxReleaseKernel(&kernel));
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    TEST_RUN(testIncrementalExecution(context, 640, 480));
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
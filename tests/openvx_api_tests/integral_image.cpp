@@ -0,0 +1,129 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "test_utils.h"
+
+// integral image of odd-height images, which are split into strips of different heights
+// when AGO_CPU_THREADS > 1, must match a plain reference and stay within the output buffer
+static int testIntegralImage(vx_context context, vx_uint32 width, vx_uint32 height)
+{
+    const vx_uint32 guard = 0xa5a5a5a5;
+    std::vector<vx_uint8> input((vx_size)width * height);
+    std::vector<vx_uint32> output((vx_size)width * (height + 1), guard);
+    testFillRandom(input.data(), input.size(), width * 31 + height);
+
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = sizeof(vx_uint32);
+    addr.stride_y = (vx_int32)(width * sizeof(vx_uint32));
+    void * ptrs[] = { output.data() };
+    vx_image iImg = testCreateImageU8(context, width, height, input.data());
+    vx_image oImg = vxCreateImageFromHandle(context, VX_DF_IMAGE_U32, &addr, ptrs, VX_MEMORY_TYPE_HOST);
+    TEST_VX(vxGetStatus((vx_reference)iImg));
+    TEST_VX(vxGetStatus((vx_reference)oImg));
+    TEST_VX(vxuIntegralImage(context, iImg, oImg));
+    TEST_VX(vxReleaseImage(&iImg));
+    TEST_VX(vxReleaseImage(&oImg));
+
+    std::vector<vx_uint32> prev(width, 0);
+    for (vx_uint32 y = 0; y < height; y++) {
+        vx_uint32 rowsum = 0;
+        for (vx_uint32 x = 0; x < width; x++) {
+            rowsum += input[(vx_size)y * width + x];
+            prev[x] += rowsum;
+            if (output[(vx_size)y * width + x] != prev[x]) {
+                printf("ERROR: %dx%d mismatch at (%d,%d): %u instead of %u\n", width, height, x, y, output[(vx_size)y * width + x], prev[x]);
+                return 1;
+            }
+        }
+    }
+    for (vx_uint32 x = 0; x < width; x++) {
+        TEST_CHECK(output[(vx_size)height * width + x] == guard);
+    }
+    return 0;
+}
+
+// integral image with U64 output must match a 64-bit reference; values from 200 to 255 make the
+// sum of large images exceed 32 bits
+static int testIntegralImageU64(vx_context context, vx_uint32 width, vx_uint32 height, bool expectOverflow)
+{
+    const vx_uint64 guard = 0xa5a5a5a5a5a5a5a5ull;
+    std::vector<vx_uint8> input((vx_size)width * height);
+    std::vector<vx_uint64> output((vx_size)width * (height + 1), guard);
+    testFillRandom(input.data(), input.size(), width * 17 + height);
+    for (auto& v : input)
+        v = 200 + v % 56;
+
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = sizeof(vx_uint64);
+    addr.stride_y = (vx_int32)(width * sizeof(vx_uint64));
+    void * ptrs[] = { output.data() };
+    vx_image iImg = testCreateImageU8(context, width, height, input.data());
+    vx_image oImg = vxCreateImageFromHandle(context, VX_DF_IMAGE_U64_AMD, &addr, ptrs, VX_MEMORY_TYPE_HOST);
+    TEST_VX(vxGetStatus((vx_reference)iImg));
+    TEST_VX(vxGetStatus((vx_reference)oImg));
+    TEST_VX(vxuIntegralImage(context, iImg, oImg));
+    TEST_VX(vxReleaseImage(&iImg));
+    TEST_VX(vxReleaseImage(&oImg));
+
+    std::vector<vx_uint64> prev(width, 0);
+    for (vx_uint32 y = 0; y < height; y++) {
+        vx_uint64 rowsum = 0;
+        for (vx_uint32 x = 0; x < width; x++) {
+            rowsum += input[(vx_size)y * width + x];
+            prev[x] += rowsum;
+            if (output[(vx_size)y * width + x] != prev[x]) {
+                printf("ERROR: %dx%d U64 mismatch at (%d,%d): %llu instead of %llu\n", width, height, x, y,
+                    (unsigned long long)output[(vx_size)y * width + x], (unsigned long long)prev[x]);
+                return 1;
+            }
+        }
+    }
+    TEST_CHECK(!expectOverflow || prev[width - 1] > 0xffffffffull);
+    for (vx_uint32 x = 0; x < width; x++) {
+        TEST_CHECK(output[(vx_size)height * width + x] == guard);
+    }
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    TEST_RUN(testIntegralImage(context, 1280, 513));
+    TEST_RUN(testIntegralImage(context, 1001, 719));
+    TEST_RUN(testIntegralImage(context, 640, 1025));
+    TEST_RUN(testIntegralImage(context, 2048, 1031));
+    TEST_RUN(testIntegralImage(context, 37, 11));
+    TEST_RUN(testIntegralImageU64(context, 37, 11, false));
+    TEST_RUN(testIntegralImageU64(context, 1001, 719, false));
+    TEST_RUN(testIntegralImageU64(context, 4405, 4397, true));
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,161 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "test_utils.h"
+#include <chrono>
+
+#define TEST_ITERATIONS 3
+#define TEST_KERNEL_NS  2000000
+
+// user kernel that keeps busy for 2 ms
+static vx_status VX_CALLBACK testBusyKernelExec(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+    auto end = std::chrono::steady_clock::now() + std::chrono::nanoseconds(TEST_KERNEL_NS);
+    while (std::chrono::steady_clock::now() < end)
+        ;
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK testBusyKernelValidate(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
+{
+    return vxSetMetaFormatFromReference(metas[1], parameters[0]);
+}
+
+static vx_kernel testAddBusyKernel(vx_context context)
+{
+    vx_enum kernelId;
+    if (vxAllocateUserKernelId(context, &kernelId) != VX_SUCCESS)
+        return nullptr;
+    vx_kernel kernel = vxAddUserKernel(context, "test.latency.busy", kernelId, testBusyKernelExec, 2, testBusyKernelValidate, nullptr, nullptr);
+    vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED);
+    vxAddParameterToKernel(kernel, 1, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED);
+    vxFinalizeKernel(kernel);
+    return kernel;
+}
+
+static int testCheckLatency(const AgoLatencyInfo& info, vx_uint64 count, vx_uint64 minLatency)
+{
+    if (info.count != count || info.p50 < minLatency || info.p50 > info.p99 || info.p99 > info.p999 || info.p999 > info.max) {
+        printf("ERROR: latency count=%d p50=%d p99=%d p999=%d max=%d ns, expected count=%d and p50 >= %d ns\n",
+            (int)info.count, (int)info.p50, (int)info.p99, (int)info.p999, (int)info.max, (int)count, (int)minLatency);
+        return 1;
+    }
+    return 0;
+}
+
+// in -> busy -> v -> NOT -> out processed TEST_ITERATIONS times with frameCount frames per vxProcessGraph: the graph
+// and each node get one latency sample per frame, whether frames go node by node (v is virtual) or the whole graph
+// runs once per frame (v is an ROI), and a re-verify starts the histograms over
+static int testLatencyHistogram(vx_context context, vx_kernel kernel, vx_uint32 frameCount, bool useROI)
+{
+    vx_uint32 width = 64, height = 16;
+    vx_graph graph = vxCreateGraph(context);
+    TEST_VX(vxGetStatus((vx_reference)graph));
+    if (frameCount > 1)
+        TEST_VX(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_BATCH_FRAME_COUNT, &frameCount, sizeof(frameCount)));
+    vx_image iImg = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image oImg = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image parentImg = nullptr, vImg;
+    if (useROI) {
+        vx_rectangle_t rect = { 0, 0, width, height };
+        parentImg = vxCreateImage(context, width, height * 2, VX_DF_IMAGE_U8);
+        vImg = vxCreateImageFromROI(parentImg, &rect);
+    }
+    else {
+        vImg = vxCreateVirtualImage(graph, width, height, VX_DF_IMAGE_U8);
+    }
+    vx_node busyNode = vxCreateGenericNode(graph, kernel);
+    TEST_VX(vxSetParameterByIndex(busyNode, 0, (vx_reference)iImg));
+    TEST_VX(vxSetParameterByIndex(busyNode, 1, (vx_reference)vImg));
+    vx_node notNode = vxNotNode(graph, vImg, oImg);
+    TEST_VX(vxGetStatus((vx_reference)notNode));
+    vx_object_array iArr = nullptr, oArr = nullptr;
+    if (frameCount > 1) {
+        vx_parameter param = vxGetParameterByIndex(busyNode, 0);
+        TEST_VX(vxAddParameterToGraph(graph, param));
+        TEST_VX(vxReleaseParameter(&param));
+        param = vxGetParameterByIndex(notNode, 1);
+        TEST_VX(vxAddParameterToGraph(graph, param));
+        TEST_VX(vxReleaseParameter(&param));
+        iArr = vxCreateObjectArray(context, (vx_reference)iImg, frameCount);
+        oArr = vxCreateObjectArray(context, (vx_reference)oImg, frameCount);
+        TEST_VX(vxSetGraphParameterByIndex(graph, 0, (vx_reference)iArr));
+        TEST_VX(vxSetGraphParameterByIndex(graph, 1, (vx_reference)oArr));
+    }
+
+    TEST_VX(vxVerifyGraph(graph));
+    for (int iter = 0; iter < TEST_ITERATIONS; iter++)
+        TEST_VX(vxProcessGraph(graph));
+    AgoLatencyInfo info;
+    vx_uint64 count = (vx_uint64)TEST_ITERATIONS * frameCount;
+    TEST_VX(vxQueryNode(busyNode, VX_NODE_ATTRIBUTE_AMD_LATENCY, &info, sizeof(info)));
+    TEST_CHECK(!testCheckLatency(info, count, TEST_KERNEL_NS));
+    TEST_VX(vxQueryNode(notNode, VX_NODE_ATTRIBUTE_AMD_LATENCY, &info, sizeof(info)));
+    TEST_CHECK(!testCheckLatency(info, count, 0));
+    TEST_VX(vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_LATENCY, &info, sizeof(info)));
+    TEST_CHECK(!testCheckLatency(info, count, TEST_KERNEL_NS));
+
+    TEST_VX(vxVerifyGraph(graph));
+    TEST_VX(vxQueryNode(busyNode, VX_NODE_ATTRIBUTE_AMD_LATENCY, &info, sizeof(info)));
+    TEST_CHECK(info.count == 0);
+    TEST_VX(vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_LATENCY, &info, sizeof(info)));
+    TEST_CHECK(info.count == 0);
+    TEST_VX(vxProcessGraph(graph));
+    TEST_VX(vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_LATENCY, &info, sizeof(info)));
+    TEST_CHECK(!testCheckLatency(info, frameCount, TEST_KERNEL_NS));
+
+    if (iArr)
+        TEST_VX(vxReleaseObjectArray(&iArr));
+    if (oArr)
+        TEST_VX(vxReleaseObjectArray(&oArr));
+    TEST_VX(vxReleaseNode(&busyNode));
+    TEST_VX(vxReleaseNode(&notNode));
+    TEST_VX(vxReleaseImage(&iImg));
+    TEST_VX(vxReleaseImage(&oImg));
+    TEST_VX(vxReleaseImage(&vImg));
+    if (parentImg)
+        TEST_VX(vxReleaseImage(&parentImg));
+    TEST_VX(vxReleaseGraph(&graph));
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    vx_kernel kernel = testAddBusyKernel(context);
+    if (vxGetStatus((vx_reference)kernel) != VX_SUCCESS) {
+        printf("ERROR: testAddBusyKernel failed\n");
+        return 1;
+    }
+    TEST_RUN(testLatencyHistogram(context, kernel, 1, false));
+    TEST_RUN(testLatencyHistogram(context, kernel, 4, false));
+    TEST_RUN(testLatencyHistogram(context, kernel, 4, true));
+    vxReleaseKernel(&kernel);
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
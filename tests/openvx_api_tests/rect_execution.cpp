@@ -0,0 +1,79 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "test_utils.h"
+
+// out = NOT(in) computed only in the valid rectangle of in: when the application changes that valid
+// rectangle between two vxProcessGraph calls, the next execution must cover the new rectangle
+static int testRectExecutionValidRectChange(vx_context context, vx_uint32 width, vx_uint32 height)
+{
+    std::vector<vx_uint8> input((vx_size)width * height), output(input.size());
+    testFillRandom(input.data(), input.size(), width + height);
+
+    vx_graph graph = vxCreateGraph(context);
+    TEST_VX(vxGetStatus((vx_reference)graph));
+    vx_image iImg = testCreateImageU8(context, width, height, input.data());
+    vx_image oImg = testCreateImageU8(context, width, height, output.data());
+    TEST_VX(vxGetStatus((vx_reference)vxNotNode(graph, iImg, oImg)));
+    vx_rectangle_t rect = { 0, 0, width, height / 4 };
+    TEST_VX(vxSetImageValidRectangle(iImg, &rect));
+    TEST_VX(vxVerifyGraph(graph));
+
+    for (int iter = 0; iter < 2; iter++) {
+        std::fill(output.begin(), output.end(), 0);
+        TEST_VX(vxProcessGraph(graph));
+        vx_rectangle_t valid;
+        TEST_VX(vxGetValidRegionImage(oImg, &valid));
+        TEST_CHECK(valid.start_x == rect.start_x && valid.start_y == rect.start_y && valid.end_x == rect.end_x && valid.end_y == rect.end_y);
+        for (vx_uint32 y = rect.start_y; y < rect.end_y; y++) {
+            for (vx_uint32 x = rect.start_x; x < rect.end_x; x++) {
+                vx_size i = (vx_size)y * width + x;
+                if (output[i] != (vx_uint8)~input[i]) {
+                    printf("ERROR: iteration %d mismatch at (%d,%d): %d instead of %d\n", iter, x, y, output[i], (vx_uint8)~input[i]);
+                    return 1;
+                }
+            }
+        }
+        // the whole image becomes valid for the next execution
+        rect = { 0, 0, width, height };
+        TEST_VX(vxSetImageValidRectangle(iImg, nullptr));
+    }
+
+    TEST_VX(vxReleaseImage(&iImg));
+    TEST_VX(vxReleaseImage(&oImg));
+    TEST_VX(vxReleaseGraph(&graph));
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    TEST_RUN(testRectExecutionValidRectChange(context, 640, 480));
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,122 @@
+/*
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "test_utils.h"
+
+// coordinates spread over the source image and up to 8 pixels beyond each edge
+static void fillRemapCoordinates(std::vector<vx_coordinates2df_t>& coords, vx_uint32 srcWidth, vx_uint32 srcHeight, vx_uint32 seed)
+{
+    for (auto& c : coords) {
+        seed = seed * 1664525u + 1013904223u;
+        c.x = (vx_float32)((seed >> 8) % ((srcWidth + 16) * 8)) * 0.125f - 8.0f;
+        seed = seed * 1664525u + 1013904223u;
+        c.y = (vx_float32)((seed >> 8) % ((srcHeight + 16) * 8)) * 0.125f - 8.0f;
+    }
+}
+
+// runs a bilinear remap graph with the given table format and border mode twice, updating the
+// remap between the runs, and returns the output of both runs one after the other
+static int runRemap(vx_context context, vx_enum tableFormat, vx_enum borderMode, vx_uint32 srcWidth, vx_uint32 srcHeight,
+    vx_uint32 dstWidth, vx_uint32 dstHeight, std::vector<vx_uint8>& output)
+{
+    std::vector<vx_uint8> input((vx_size)srcWidth * srcHeight);
+    testFillRandom(input.data(), input.size(), srcWidth * 7 + srcHeight);
+    std::vector<vx_coordinates2df_t> coords((vx_size)dstWidth * dstHeight);
+    vx_rectangle_t rect = { 0, 0, dstWidth, dstHeight };
+    vx_image iImg = testCreateImageU8(context, srcWidth, srcHeight, input.data());
+    vx_image oImg = vxCreateImage(context, dstWidth, dstHeight, VX_DF_IMAGE_U8);
+    vx_remap table = vxCreateRemap(context, srcWidth, srcHeight, dstWidth, dstHeight);
+    TEST_VX(vxGetStatus((vx_reference)iImg));
+    TEST_VX(vxGetStatus((vx_reference)oImg));
+    TEST_VX(vxGetStatus((vx_reference)table));
+    TEST_VX(vxSetRemapAttribute(table, VX_REMAP_ATTRIBUTE_AMD_TABLE_FORMAT, &tableFormat, sizeof(tableFormat)));
+    fillRemapCoordinates(coords, srcWidth, srcHeight, 1);
+    TEST_VX(vxCopyRemapPatch(table, &rect, dstWidth * sizeof(vx_coordinates2df_t), coords.data(), VX_TYPE_COORDINATES2DF, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+
+    vx_graph graph = vxCreateGraph(context);
+    TEST_VX(vxGetStatus((vx_reference)graph));
+    vx_node node = vxRemapNode(graph, iImg, table, VX_INTERPOLATION_BILINEAR, oImg);
+    TEST_VX(vxGetStatus((vx_reference)node));
+    vx_border_t border = { 0 };
+    border.mode = borderMode;
+    border.constant_value.U8 = 77;
+    TEST_VX(vxSetNodeAttribute(node, VX_NODE_BORDER, &border, sizeof(border)));
+    TEST_VX(vxVerifyGraph(graph));
+
+    output.resize((vx_size)dstWidth * dstHeight * 2);
+    for (int run = 0; run < 2; run++) {
+        if (run > 0) {
+            // the fast table is prepared again when the application modifies the remap
+            fillRemapCoordinates(coords, srcWidth, srcHeight, 2);
+            TEST_VX(vxCopyRemapPatch(table, &rect, dstWidth * sizeof(vx_coordinates2df_t), coords.data(), VX_TYPE_COORDINATES2DF, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+        }
+        TEST_VX(vxProcessGraph(graph));
+        vx_imagepatch_addressing_t addr = { 0 };
+        addr.stride_x = 1;
+        addr.stride_y = (vx_int32)dstWidth;
+        TEST_VX(vxCopyImagePatch(oImg, &rect, 0, &addr, &output[(vx_size)run * dstWidth * dstHeight], VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    }
+
+    TEST_VX(vxReleaseNode(&node));
+    TEST_VX(vxReleaseGraph(&graph));
+    TEST_VX(vxReleaseRemap(&table));
+    TEST_VX(vxReleaseImage(&iImg));
+    TEST_VX(vxReleaseImage(&oImg));
+    return 0;
+}
+
+// bilinear remap with a fast table must match the compact table bit-exactly, including coordinates outside the
+// source image; odd output widths cover both the SIMD loop and the per-pixel tail
+static int testRemapTableFormats(vx_context context, vx_enum borderMode, vx_uint32 srcWidth, vx_uint32 srcHeight, vx_uint32 dstWidth, vx_uint32 dstHeight)
+{
+    std::vector<vx_uint8> compact, fast;
+    if (runRemap(context, VX_REMAP_TABLE_FORMAT_AMD_COMPACT, borderMode, srcWidth, srcHeight, dstWidth, dstHeight, compact))
+        return 1;
+    if (runRemap(context, VX_REMAP_TABLE_FORMAT_AMD_FAST, borderMode, srcWidth, srcHeight, dstWidth, dstHeight, fast))
+        return 1;
+    for (vx_size i = 0; i < compact.size(); i++) {
+        if (compact[i] != fast[i]) {
+            vx_size pixel = i % ((vx_size)dstWidth * dstHeight);
+            printf("ERROR: %dx%d run %d mismatch at (%d,%d): fast %d compact %d\n", dstWidth, dstHeight, (int)(i / ((vx_size)dstWidth * dstHeight)),
+                (int)(pixel % dstWidth), (int)(pixel / dstWidth), fast[i], compact[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    TEST_RUN(testRemapTableFormats(context, VX_BORDER_UNDEFINED, 64, 48, 77, 23));
+    TEST_RUN(testRemapTableFormats(context, VX_BORDER_CONSTANT, 64, 48, 77, 23));
+    TEST_RUN(testRemapTableFormats(context, VX_BORDER_UNDEFINED, 301, 199, 640, 11));
+    TEST_RUN(testRemapTableFormats(context, VX_BORDER_CONSTANT, 301, 199, 640, 11));
+    TEST_RUN(testRemapTableFormats(context, VX_BORDER_CONSTANT, 13, 9, 5, 3));
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
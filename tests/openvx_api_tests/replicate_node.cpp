@@ -0,0 +1,180 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "test_utils.h"
+#include <chrono>
+
+#define TEST_REPLICAS 6
+
+// creates an object array of U8 images, filled with pseudo-random values when fill is set
+static vx_object_array testCreateImageArray(vx_context context, vx_uint32 width, vx_uint32 height, bool fill, std::vector<std::vector<vx_uint8>>& data)
+{
+    vx_image exemplar = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_object_array arr = vxCreateObjectArray(context, (vx_reference)exemplar, TEST_REPLICAS);
+    vxReleaseImage(&exemplar);
+    data.assign(TEST_REPLICAS, std::vector<vx_uint8>((vx_size)width * height, 0));
+    for (vx_uint32 i = 0; fill && i < TEST_REPLICAS; i++) {
+        testFillRandom(data[i].data(), data[i].size(), i + 1);
+        vx_image img = (vx_image)vxGetObjectArrayItem(arr, i);
+        vx_rectangle_t rect = { 0, 0, width, height };
+        vx_imagepatch_addressing_t addr = { width, height, 1, (vx_int32)width };
+        vxCopyImagePatch(img, &rect, 0, &addr, data[i].data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
+        vxReleaseImage(&img);
+    }
+    return arr;
+}
+
+static int testReadImageArray(vx_object_array arr, vx_uint32 width, vx_uint32 height, std::vector<std::vector<vx_uint8>>& data)
+{
+    for (vx_uint32 i = 0; i < TEST_REPLICAS; i++) {
+        vx_image img = (vx_image)vxGetObjectArrayItem(arr, i);
+        vx_rectangle_t rect = { 0, 0, width, height };
+        vx_imagepatch_addressing_t addr = { width, height, 1, (vx_int32)width };
+        TEST_VX(vxCopyImagePatch(img, &rect, 0, &addr, data[i].data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+        vxReleaseImage(&img);
+    }
+    return 0;
+}
+
+// replicas of a built-in kernel run as one batch on the CPU worker pool
+static int testReplicateBuiltin(vx_context context, vx_uint32 width, vx_uint32 height)
+{
+    std::vector<std::vector<vx_uint8>> input, output;
+    vx_object_array iArr = testCreateImageArray(context, width, height, true, input);
+    vx_object_array oArr = testCreateImageArray(context, width, height, false, output);
+    vx_graph graph = vxCreateGraph(context);
+    vx_image iImg = (vx_image)vxGetObjectArrayItem(iArr, 0);
+    vx_image oImg = (vx_image)vxGetObjectArrayItem(oArr, 0);
+    vx_node node = vxNotNode(graph, iImg, oImg);
+    vx_bool replicate[] = { vx_true_e, vx_true_e };
+    TEST_VX(vxReplicateNode(graph, node, replicate, 2));
+    TEST_VX(vxVerifyGraph(graph));
+    for (int iter = 0; iter < 2; iter++) {
+        TEST_VX(vxProcessGraph(graph));
+        if (testReadImageArray(oArr, width, height, output))
+            return 1;
+        for (vx_uint32 i = 0; i < TEST_REPLICAS; i++) {
+            for (vx_size j = 0; j < output[i].size(); j++) {
+                if (output[i][j] != (vx_uint8)~input[i][j]) {
+                    printf("ERROR: replica %d mismatch at %d: %d instead of %d\n", i, (int)j, output[i][j], (vx_uint8)~input[i][j]);
+                    return 1;
+                }
+            }
+        }
+    }
+    vxReleaseImage(&iImg);
+    vxReleaseImage(&oImg);
+    vxReleaseNode(&node);
+    vxReleaseObjectArray(&iArr);
+    vxReleaseObjectArray(&oArr);
+    TEST_VX(vxReleaseGraph(&graph));
+    return 0;
+}
+
+static int userKernelCalls = 0;
+static int userKernelArrayCalls = 0;
+
+static vx_status VX_CALLBACK testUserKernelExec(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+    vx_enum type = VX_TYPE_INVALID;
+    vxQueryReference(parameters[0], VX_REFERENCE_TYPE, &type, sizeof(type));
+    userKernelCalls++;
+    if (type == VX_TYPE_OBJECT_ARRAY)
+        userKernelArrayCalls++;
+    // keep each call busy for 2 ms per image
+    int images = (type == VX_TYPE_OBJECT_ARRAY) ? TEST_REPLICAS : 1;
+    auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(2 * images);
+    while (std::chrono::steady_clock::now() < end)
+        ;
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK testUserKernelValidate(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
+{
+    return vxSetMetaFormatFromReference(metas[1], parameters[0]);
+}
+
+// replicas of a user kernel run one after the other, or in a single call with VX_KERNEL_ATTRIBUTE_AMD_REPLICATE_BATCH_ENABLE;
+// the performance of the replicated node covers all replicas either way
+static int testReplicateUserKernel(vx_context context, bool batchEnable)
+{
+    vx_enum kernelId;
+    TEST_VX(vxAllocateUserKernelId(context, &kernelId));
+    vx_kernel kernel = vxAddUserKernel(context, batchEnable ? "test.replicate.batch" : "test.replicate", kernelId,
+        testUserKernelExec, 2, testUserKernelValidate, nullptr, nullptr);
+    TEST_VX(vxGetStatus((vx_reference)kernel));
+    TEST_VX(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+    TEST_VX(vxAddParameterToKernel(kernel, 1, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+    vx_bool enable = batchEnable ? vx_true_e : vx_false_e;
+    TEST_VX(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_REPLICATE_BATCH_ENABLE, &enable, sizeof(enable)));
+    TEST_VX(vxFinalizeKernel(kernel));
+
+    std::vector<std::vector<vx_uint8>> input, output;
+    vx_object_array iArr = testCreateImageArray(context, 64, 16, true, input);
+    vx_object_array oArr = testCreateImageArray(context, 64, 16, false, output);
+    vx_graph graph = vxCreateGraph(context);
+    vx_image iImg = (vx_image)vxGetObjectArrayItem(iArr, 0);
+    vx_image oImg = (vx_image)vxGetObjectArrayItem(oArr, 0);
+    vx_node node = vxCreateGenericNode(graph, kernel);
+    TEST_VX(vxSetParameterByIndex(node, 0, (vx_reference)iImg));
+    TEST_VX(vxSetParameterByIndex(node, 1, (vx_reference)oImg));
+    vx_bool replicate[] = { vx_true_e, vx_true_e };
+    TEST_VX(vxReplicateNode(graph, node, replicate, 2));
+    TEST_VX(vxVerifyGraph(graph));
+    userKernelCalls = userKernelArrayCalls = 0;
+    TEST_VX(vxProcessGraph(graph));
+    TEST_CHECK(userKernelCalls == (batchEnable ? 1 : TEST_REPLICAS));
+    TEST_CHECK(userKernelArrayCalls == (batchEnable ? 1 : 0));
+    vx_perf_t perf = { 0 };
+    TEST_VX(vxQueryNode(node, VX_NODE_PERFORMANCE, &perf, sizeof(perf)));
+    TEST_CHECK(perf.num == 1);
+    if (perf.tmp < (vx_uint64)2000000 * TEST_REPLICAS) {
+        printf("ERROR: replicated node time %.3f ms doesn't cover %d replicas\n", perf.tmp * 1e-6, TEST_REPLICAS);
+        return 1;
+    }
+
+    vxReleaseImage(&iImg);
+    vxReleaseImage(&oImg);
+    vxReleaseNode(&node);
+    vxReleaseObjectArray(&iArr);
+    vxReleaseObjectArray(&oArr);
+    TEST_VX(vxReleaseGraph(&graph));
+    TEST_VX(vxRemoveKernel(kernel));
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    TEST_RUN(testReplicateBuiltin(context, 640, 480));
+    TEST_RUN(testReplicateBuiltin(context, 33, 7));
+    TEST_RUN(testReplicateUserKernel(context, false));
+    TEST_RUN(testReplicateUserKernel(context, true));
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
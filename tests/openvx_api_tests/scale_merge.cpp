@@ -0,0 +1,94 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "test_utils.h"
+
+// same value as AGO_GRAPH_OPTIMIZER_FLAG_NO_NODE_MERGE in ago_internal.h
+#define TEST_OPTIMIZER_FLAG_NO_NODE_MERGE 0x00000008
+
+// runs a 1/2 and a 1/4 scale of the same input in one graph, which the node merge pass fuses
+// into a single kernel unless merging is disabled with optimizer_flags
+static int runScaleHalfQuarter(vx_context context, vx_enum interpolation, vx_uint32 optimizer_flags,
+    vx_uint32 width, vx_uint32 height, std::vector<vx_uint8>& input, std::vector<vx_uint8>& half, std::vector<vx_uint8>& quarter)
+{
+    half.assign((vx_size)(width / 2) * (height / 2), 0);
+    quarter.assign((vx_size)(width / 4) * (height / 4), 0);
+    vx_graph graph = vxCreateGraph(context);
+    TEST_VX(vxGetStatus((vx_reference)graph));
+    TEST_VX(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_OPTIMIZER_FLAGS, &optimizer_flags, sizeof(optimizer_flags)));
+    vx_image iImg = testCreateImageU8(context, width, height, input.data());
+    vx_image hImg = testCreateImageU8(context, width / 2, height / 2, half.data());
+    vx_image qImg = testCreateImageU8(context, width / 4, height / 4, quarter.data());
+    TEST_VX(vxGetStatus((vx_reference)vxScaleImageNode(graph, iImg, hImg, interpolation)));
+    TEST_VX(vxGetStatus((vx_reference)vxScaleImageNode(graph, iImg, qImg, interpolation)));
+    TEST_VX(vxVerifyGraph(graph));
+    TEST_VX(vxProcessGraph(graph));
+    TEST_VX(vxReleaseImage(&iImg));
+    TEST_VX(vxReleaseImage(&hImg));
+    TEST_VX(vxReleaseImage(&qImg));
+    TEST_VX(vxReleaseGraph(&graph));
+    return 0;
+}
+
+// the fused half+quarter kernel must produce the same outputs as the two separate scale kernels
+static int testScaleMerge(vx_context context, vx_enum interpolation, vx_uint32 width, vx_uint32 height)
+{
+    std::vector<vx_uint8> input((vx_size)width * height);
+    testFillRandom(input.data(), input.size(), width * 7 + height);
+    std::vector<vx_uint8> halfRef, quarterRef, half, quarter;
+    if (runScaleHalfQuarter(context, interpolation, TEST_OPTIMIZER_FLAG_NO_NODE_MERGE, width, height, input, halfRef, quarterRef))
+        return 1;
+    if (runScaleHalfQuarter(context, interpolation, 0, width, height, input, half, quarter))
+        return 1;
+    for (vx_size i = 0; i < half.size(); i++) {
+        if (half[i] != halfRef[i]) {
+            printf("ERROR: %dx%d 1/2 scale mismatch at %d: %d instead of %d\n", width, height, (int)i, half[i], halfRef[i]);
+            return 1;
+        }
+    }
+    for (vx_size i = 0; i < quarter.size(); i++) {
+        if (quarter[i] != quarterRef[i]) {
+            printf("ERROR: %dx%d 1/4 scale mismatch at %d: %d instead of %d\n", width, height, (int)i, quarter[i], quarterRef[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    TEST_RUN(testScaleMerge(context, VX_INTERPOLATION_AREA, 1920, 1080));
+    TEST_RUN(testScaleMerge(context, VX_INTERPOLATION_AREA, 1000, 36));
+    TEST_RUN(testScaleMerge(context, VX_INTERPOLATION_AREA, 68, 20));
+    TEST_RUN(testScaleMerge(context, VX_INTERPOLATION_BILINEAR, 1920, 1080));
+    TEST_RUN(testScaleMerge(context, VX_INTERPOLATION_BILINEAR, 1000, 36));
+    TEST_RUN(testScaleMerge(context, VX_INTERPOLATION_BILINEAR, 68, 20));
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
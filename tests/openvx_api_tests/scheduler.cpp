@@ -0,0 +1,120 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "test_utils.h"
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#define TEST_KERNEL_MS 20
+
+static std::atomic<int> userKernelCalls(0);
+
+// user kernel that takes 20 ms, so that requests stay queued in the scheduler
+static vx_status VX_CALLBACK testSleepKernelExec(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(TEST_KERNEL_MS));
+    userKernelCalls++;
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK testSleepKernelValidate(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
+{
+    return vxSetMetaFormatFromReference(metas[1], parameters[0]);
+}
+
+// with a scheduler worker pool, vxWaitGraph returns once all vxScheduleGraph requests executed, and releasing
+// the graph with pending requests drops them: a thread waiting on the graph then returns instead of hanging
+static int testScheduleWaitRelease(vx_context context, vx_uint32 requestCount)
+{
+    vx_enum kernelId;
+    TEST_VX(vxAllocateUserKernelId(context, &kernelId));
+    vx_kernel kernel = vxAddUserKernel(context, "test.scheduler.sleep", kernelId, testSleepKernelExec, 2, testSleepKernelValidate, nullptr, nullptr);
+    TEST_VX(vxGetStatus((vx_reference)kernel));
+    TEST_VX(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+    TEST_VX(vxAddParameterToKernel(kernel, 1, VX_OUTPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));
+    TEST_VX(vxFinalizeKernel(kernel));
+
+    vx_graph graph = vxCreateGraph(context);
+    TEST_VX(vxGetStatus((vx_reference)graph));
+    vx_image iImg = vxCreateImage(context, 64, 16, VX_DF_IMAGE_U8);
+    vx_image oImg = vxCreateImage(context, 64, 16, VX_DF_IMAGE_U8);
+    vx_node node = vxCreateGenericNode(graph, kernel);
+    TEST_VX(vxSetParameterByIndex(node, 0, (vx_reference)iImg));
+    TEST_VX(vxSetParameterByIndex(node, 1, (vx_reference)oImg));
+    TEST_VX(vxVerifyGraph(graph));
+
+    // schedule and wait
+    for (vx_uint32 i = 0; i < requestCount; i++)
+        TEST_VX(vxScheduleGraph(graph));
+    TEST_VX(vxWaitGraph(graph));
+    TEST_CHECK(userKernelCalls == (int)requestCount);
+    AgoGraphScheduleInfo graphInfo;
+    TEST_VX(vxQueryGraph(graph, VX_GRAPH_ATTRIBUTE_AMD_SCHEDULE_INFO, &graphInfo, sizeof(graphInfo)));
+    TEST_CHECK(graphInfo.pending == 0);
+    TEST_CHECK(graphInfo.wait.count == requestCount);
+    AgoSchedulerInfo info;
+    TEST_VX(vxQueryContext(context, VX_CONTEXT_ATTRIBUTE_AMD_SCHEDULER_INFO, &info, sizeof(info)));
+    TEST_CHECK(info.scheduled == requestCount && info.completed == requestCount && info.running == 0);
+
+    // release with pending requests while another thread waits on the graph
+    for (vx_uint32 i = 0; i < requestCount; i++)
+        TEST_VX(vxScheduleGraph(graph));
+    std::atomic<bool> waiting(false);
+    auto waiter = std::async(std::launch::async, [&] { waiting = true; return vxWaitGraph(graph); });
+    while (!waiting)
+        std::this_thread::yield();
+    std::this_thread::sleep_for(std::chrono::milliseconds(TEST_KERNEL_MS / 2));
+    TEST_VX(vxReleaseGraph(&graph));
+    TEST_CHECK(waiter.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    TEST_CHECK(waiter.get() != VX_SUCCESS);
+    TEST_CHECK(userKernelCalls < 2 * (int)requestCount);
+    TEST_VX(vxQueryContext(context, VX_CONTEXT_ATTRIBUTE_AMD_SCHEDULER_INFO, &info, sizeof(info)));
+    TEST_CHECK(info.completed == (vx_uint64)userKernelCalls && info.running == 0 && info.queue_depth == 0);
+
+    TEST_VX(vxReleaseNode(&node));
+    TEST_VX(vxReleaseImage(&iImg));
+    TEST_VX(vxReleaseImage(&oImg));
+    TEST_VX(vxReleaseKernel(&kernel));
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    // graphs created after this use the context worker pool
+    vx_uint32 threadCount = 2;
+    if (vxSetContextAttribute(context, VX_CONTEXT_ATTRIBUTE_AMD_SCHEDULER_THREADS, &threadCount, sizeof(threadCount)) != VX_SUCCESS) {
+        printf("ERROR: vxSetContextAttribute(VX_CONTEXT_ATTRIBUTE_AMD_SCHEDULER_THREADS) failed\n");
+        return 1;
+    }
+    TEST_RUN(testScheduleWaitRelease(context, 5));
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
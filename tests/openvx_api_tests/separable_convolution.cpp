@@ -0,0 +1,154 @@
+/*
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "test_utils.h"
+#include <algorithm>
+
+// convolution matrix colCoeff x rowCoeff in row major order
+static std::vector<vx_int16> outerProduct(const std::vector<vx_int16>& colCoeff, const std::vector<vx_int16>& rowCoeff)
+{
+    std::vector<vx_int16> matrix;
+    for (auto c : colCoeff)
+        for (auto r : rowCoeff)
+            matrix.push_back((vx_int16)(c * r));
+    return matrix;
+}
+
+// checks the output against the 2D convolution with the matrix applied to the pixels in reverse,
+// an arithmetic shift by log2(scale) and saturation; only pixels with the full neighborhood inside the
+// image are checked since the border mode is undefined
+static int checkConvolution(const char * name, vx_df_image format, vx_uint32 width, vx_uint32 height, const vx_uint8 * input,
+    const void * output, vx_uint32 columns, vx_uint32 rows, const std::vector<vx_int16>& matrix, vx_uint32 scale)
+{
+    int shift = 0;
+    while ((1u << shift) < scale)
+        shift++;
+    int rx = (int)columns / 2, ry = (int)rows / 2;
+    for (int y = ry; y < (int)height - ry; y++) {
+        for (int x = rx; x < (int)width - rx; x++) {
+            vx_int32 sum = 0;
+            for (int dy = -ry; dy <= ry; dy++)
+                for (int dx = -rx; dx <= rx; dx++)
+                    sum += (vx_int32)input[(y + dy) * width + x + dx] * matrix[(ry - dy) * columns + (rx - dx)];
+            sum >>= shift;
+            vx_int32 expected, actual;
+            if (format == VX_DF_IMAGE_U8) {
+                expected = std::min(std::max(sum, 0), 255);
+                actual = ((const vx_uint8 *)output)[y * width + x];
+            }
+            else {
+                expected = std::min(std::max(sum, -32768), 32767);
+                actual = ((const vx_int16 *)output)[y * width + x];
+            }
+            if (actual != expected) {
+                printf("ERROR: %s %dx%d %s mismatch at (%d,%d): %d instead of %d\n", name, columns, rows,
+                    format == VX_DF_IMAGE_U8 ? "U8" : "S16", x, y, actual, expected);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+// runs a custom convolution graph verified with a separable matrix; when fallback is given, the
+// coefficients are replaced by that (non-separable) matrix after verification
+static int testConvolution(vx_context context, vx_df_image format, vx_uint32 width, vx_uint32 height,
+    const std::vector<vx_int16>& colCoeff, const std::vector<vx_int16>& rowCoeff, vx_uint32 scale,
+    const std::vector<vx_int16> * fallback = nullptr)
+{
+    vx_uint32 columns = (vx_uint32)rowCoeff.size(), rows = (vx_uint32)colCoeff.size();
+    std::vector<vx_int16> matrix = outerProduct(colCoeff, rowCoeff);
+    std::vector<vx_uint8> input((vx_size)width * height);
+    testFillRandom(input.data(), input.size(), columns * 131 + rows);
+    vx_size pixelSize = (format == VX_DF_IMAGE_U8) ? 1 : 2;
+    std::vector<vx_uint8> output((vx_size)width * height * pixelSize);
+
+    vx_image iImg = testCreateImageU8(context, width, height, input.data());
+    vx_image oImg = vxCreateImage(context, width, height, format);
+    vx_convolution conv = vxCreateConvolution(context, columns, rows);
+    TEST_VX(vxGetStatus((vx_reference)iImg));
+    TEST_VX(vxGetStatus((vx_reference)oImg));
+    TEST_VX(vxGetStatus((vx_reference)conv));
+    TEST_VX(vxCopyConvolutionCoefficients(conv, matrix.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    TEST_VX(vxSetConvolutionAttribute(conv, VX_CONVOLUTION_SCALE, &scale, sizeof(scale)));
+    vx_graph graph = vxCreateGraph(context);
+    TEST_VX(vxGetStatus((vx_reference)graph));
+    vx_node node = vxConvolveNode(graph, iImg, conv, oImg);
+    TEST_VX(vxGetStatus((vx_reference)node));
+    TEST_VX(vxVerifyGraph(graph));
+    if (fallback) {
+        // coefficients modified after verification are no longer separable: the node uses the 2D convolution
+        matrix = *fallback;
+        TEST_VX(vxCopyConvolutionCoefficients(conv, matrix.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    }
+    TEST_VX(vxProcessGraph(graph));
+    vx_rectangle_t rect = { 0, 0, width, height };
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.stride_x = (vx_int32)pixelSize;
+    addr.stride_y = (vx_int32)(width * pixelSize);
+    TEST_VX(vxCopyImagePatch(oImg, &rect, 0, &addr, output.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    int status = checkConvolution(fallback ? "fallback" : "separable", format, width, height, input.data(), output.data(), columns, rows, matrix, scale);
+
+    TEST_VX(vxReleaseNode(&node));
+    TEST_VX(vxReleaseGraph(&graph));
+    TEST_VX(vxReleaseConvolution(&conv));
+    TEST_VX(vxReleaseImage(&iImg));
+    TEST_VX(vxReleaseImage(&oImg));
+    return status;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    const std::vector<vx_int16> binomial5 = { 1, 4, 6, 4, 1 };
+    const std::vector<vx_int16> derivative7 = { -1, -2, 0, 5, 0, -2, -1 };
+    const std::vector<vx_int16> smooth3 = { 1, 2, 1 };
+    const std::vector<vx_int16> difference3 = { 1, 0, -1 };
+    const std::vector<vx_int16> triangle7 = { 1, 2, 3, 4, 3, 2, 1 };
+    const std::vector<vx_int16> triangle9 = { 1, 2, 3, 4, 5, 4, 3, 2, 1 };
+    const std::vector<vx_int16> alternating9 = { 1, -2, 3, -4, 5, -4, 3, -2, 1 };
+    vx_df_image formats[] = { VX_DF_IMAGE_U8, VX_DF_IMAGE_S16 };
+    for (auto format : formats) {
+        TEST_RUN(testConvolution(context, format, 67, 41, binomial5, binomial5, 256));
+        TEST_RUN(testConvolution(context, format, 67, 41, smooth3, derivative7, 4));
+        TEST_RUN(testConvolution(context, format, 67, 41, triangle7, difference3, 1));
+        TEST_RUN(testConvolution(context, format, 67, 41, alternating9, triangle9, 32));
+        TEST_RUN(testConvolution(context, format, 640, 19, alternating9, derivative7, 2));
+    }
+    // non-separable matrices set after verification run through the 2D convolution, which must give the
+    // same results including the shift of the pixels around the SIMD loop and of negative sums
+    std::vector<vx_int16> nonSeparable = outerProduct(binomial5, binomial5);
+    nonSeparable[0] = 9;
+    std::vector<vx_int16> nonSeparableDerivative = outerProduct(smooth3, derivative7);
+    nonSeparableDerivative[3] = -7;
+    for (auto format : formats) {
+        TEST_RUN(testConvolution(context, format, 67, 41, binomial5, binomial5, 256, &nonSeparable));
+        TEST_RUN(testConvolution(context, format, 67, 41, smooth3, derivative7, 4, &nonSeparableDerivative));
+    }
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
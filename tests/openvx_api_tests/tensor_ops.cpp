@@ -0,0 +1,319 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "test_utils.h"
+#include <math.h>
+
+#define TEST_MAX_TENSOR_DIMS 4
+
+// creates a node of a built-in kernel: vxTensorAddNode and similar functions are exported by vx_nn
+static vx_node testCreateNode(vx_graph graph, vx_enum kernel_id, std::vector<vx_reference> params)
+{
+    vx_kernel kernel = vxGetKernelByEnum(vxGetContext((vx_reference)graph), kernel_id);
+    vx_node node = vxCreateGenericNode(graph, kernel);
+    for (vx_uint32 i = 0; i < (vx_uint32)params.size(); i++) {
+        if (params[i] && vxSetParameterByIndex(node, i, params[i]) != VX_SUCCESS) {
+            vxReleaseNode(&node);
+            break;
+        }
+    }
+    vxReleaseKernel(&kernel);
+    return node;
+}
+
+// creates a tensor with packed strides, optionally initialized from data
+static vx_tensor testCreateTensor(vx_context context, std::vector<vx_size> dims, vx_enum data_type, vx_int8 fixed_point_pos, const void * data)
+{
+    vx_tensor tensor = vxCreateTensor(context, dims.size(), dims.data(), data_type, fixed_point_pos);
+    if (data && vxGetStatus((vx_reference)tensor) == VX_SUCCESS) {
+        vx_size start[TEST_MAX_TENSOR_DIMS] = { 0 }, stride[TEST_MAX_TENSOR_DIMS];
+        stride[0] = (data_type == VX_TYPE_FLOAT32) ? 4 : (data_type == VX_TYPE_UINT8) ? 1 : 2;
+        for (vx_size i = 1; i < dims.size(); i++)
+            stride[i] = stride[i - 1] * dims[i - 1];
+        vxCopyTensorPatch(tensor, dims.size(), start, dims.data(), stride, (void *)data, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
+    }
+    return tensor;
+}
+
+static int testReadTensor(vx_tensor tensor, std::vector<vx_size> dims, vx_size elem_size, void * data)
+{
+    vx_size start[TEST_MAX_TENSOR_DIMS] = { 0 }, stride[TEST_MAX_TENSOR_DIMS];
+    stride[0] = elem_size;
+    for (vx_size i = 1; i < dims.size(); i++)
+        stride[i] = stride[i - 1] * dims[i - 1];
+    TEST_VX(vxCopyTensorPatch(tensor, dims.size(), start, dims.data(), stride, data, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    return 0;
+}
+
+static void testFillFloat(std::vector<vx_float32>& buf, vx_uint32 seed)
+{
+    for (auto& v : buf) {
+        seed = seed * 1664525u + 1013904223u;
+        v = (vx_float32)((vx_int32)(seed >> 16) - 32768) / 1024.0f;
+    }
+}
+
+static bool testNear(vx_float32 a, vx_float32 b)
+{
+    return fabsf(a - b) <= 1e-3f * (1.0f + fabsf(b));
+}
+
+// F32 add and multiply with input2 broadcast along dims[1], large enough to be split across CPU workers
+static int testTensorAddMultiplyF32(vx_context context)
+{
+    std::vector<vx_size> dims = { 1000, 300, 2 }, dims2 = { 1000, 1, 2 };
+    std::vector<vx_float32> a(1000 * 300 * 2), b(1000 * 2), sum(a.size()), prod(a.size());
+    testFillFloat(a, 1);
+    testFillFloat(b, 2);
+    vx_float32 scale = 0.5f;
+    vx_enum wrap = VX_CONVERT_POLICY_WRAP, rounding = VX_ROUND_POLICY_TO_NEAREST_EVEN;
+    vx_graph graph = vxCreateGraph(context);
+    vx_tensor in1 = testCreateTensor(context, dims, VX_TYPE_FLOAT32, 0, a.data());
+    vx_tensor in2 = testCreateTensor(context, dims2, VX_TYPE_FLOAT32, 0, b.data());
+    vx_tensor out1 = testCreateTensor(context, dims, VX_TYPE_FLOAT32, 0, nullptr);
+    vx_tensor out2 = testCreateTensor(context, dims, VX_TYPE_FLOAT32, 0, nullptr);
+    vx_scalar sPolicy = vxCreateScalar(context, VX_TYPE_ENUM, &wrap);
+    vx_scalar sRounding = vxCreateScalar(context, VX_TYPE_ENUM, &rounding);
+    vx_scalar sScale = vxCreateScalar(context, VX_TYPE_FLOAT32, &scale);
+    TEST_VX(vxGetStatus((vx_reference)testCreateNode(graph, VX_KERNEL_TENSOR_ADD,
+        { (vx_reference)in1, (vx_reference)in2, (vx_reference)sPolicy, (vx_reference)out1 })));
+    TEST_VX(vxGetStatus((vx_reference)testCreateNode(graph, VX_KERNEL_TENSOR_MULTIPLY,
+        { (vx_reference)in1, (vx_reference)in2, (vx_reference)sScale, (vx_reference)sPolicy, (vx_reference)sRounding, (vx_reference)out2 })));
+    TEST_VX(vxVerifyGraph(graph));
+    TEST_VX(vxProcessGraph(graph));
+    if (testReadTensor(out1, dims, 4, sum.data()) || testReadTensor(out2, dims, 4, prod.data()))
+        return 1;
+    for (vx_size z = 0; z < 2; z++) for (vx_size y = 0; y < 300; y++) for (vx_size x = 0; x < 1000; x++) {
+        vx_size i = (z * 300 + y) * 1000 + x;
+        vx_float32 bv = b[z * 1000 + x];
+        if (!testNear(sum[i], a[i] + bv) || !testNear(prod[i], a[i] * bv * scale)) {
+            printf("ERROR: mismatch at (%d,%d,%d): %g,%g instead of %g,%g\n", (int)x, (int)y, (int)z, sum[i], prod[i], a[i] + bv, a[i] * bv * scale);
+            return 1;
+        }
+    }
+    vxReleaseScalar(&sPolicy);
+    vxReleaseScalar(&sRounding);
+    vxReleaseScalar(&sScale);
+    vxReleaseTensor(&in1);
+    vxReleaseTensor(&in2);
+    vxReleaseTensor(&out1);
+    vxReleaseTensor(&out2);
+    TEST_VX(vxReleaseGraph(&graph));
+    return 0;
+}
+
+// S16 Q7.8 subtract with saturation
+static int testTensorSubtractS16(vx_context context)
+{
+    std::vector<vx_size> dims = { 67, 31, 5 };
+    vx_size count = 67 * 31 * 5;
+    std::vector<vx_int16> a(count), b(count), diff(count);
+    testFillRandom((vx_uint8 *)a.data(), count * 2, 3);
+    testFillRandom((vx_uint8 *)b.data(), count * 2, 4);
+    vx_enum saturate = VX_CONVERT_POLICY_SATURATE;
+    vx_graph graph = vxCreateGraph(context);
+    vx_tensor in1 = testCreateTensor(context, dims, VX_TYPE_INT16, 8, a.data());
+    vx_tensor in2 = testCreateTensor(context, dims, VX_TYPE_INT16, 8, b.data());
+    vx_tensor out = testCreateTensor(context, dims, VX_TYPE_INT16, 8, nullptr);
+    vx_scalar sPolicy = vxCreateScalar(context, VX_TYPE_ENUM, &saturate);
+    TEST_VX(vxGetStatus((vx_reference)testCreateNode(graph, VX_KERNEL_TENSOR_SUBTRACT,
+        { (vx_reference)in1, (vx_reference)in2, (vx_reference)sPolicy, (vx_reference)out })));
+    TEST_VX(vxVerifyGraph(graph));
+    TEST_VX(vxProcessGraph(graph));
+    if (testReadTensor(out, dims, 2, diff.data()))
+        return 1;
+    for (vx_size i = 0; i < count; i++) {
+        vx_int32 v = (vx_int32)a[i] - (vx_int32)b[i];
+        v = v < -32768 ? -32768 : (v > 32767 ? 32767 : v);
+        if (diff[i] != v) {
+            printf("ERROR: mismatch at %d: %d instead of %d\n", (int)i, diff[i], v);
+            return 1;
+        }
+    }
+    vxReleaseScalar(&sPolicy);
+    vxReleaseTensor(&in1);
+    vxReleaseTensor(&in2);
+    vxReleaseTensor(&out);
+    TEST_VX(vxReleaseGraph(&graph));
+    return 0;
+}
+
+// U8 table lookup, transpose of dims 0 and 2, and U8 to F32 convert depth
+static int testTensorLutTransposeConvert(vx_context context)
+{
+    std::vector<vx_size> dims = { 45, 7, 33 }, tdims = { 33, 7, 45 };
+    vx_size count = 45 * 7 * 33;
+    std::vector<vx_uint8> a(count), lut(256), looked(count), transposed(count);
+    std::vector<vx_float32> converted(count);
+    testFillRandom(a.data(), count, 5);
+    testFillRandom(lut.data(), lut.size(), 6);
+    vx_size dim1 = 0, dim2 = 2;
+    vx_enum saturate = VX_CONVERT_POLICY_SATURATE;
+    vx_float32 norm = 4.0f, offset = 16.0f;
+    vx_graph graph = vxCreateGraph(context);
+    vx_tensor in = testCreateTensor(context, dims, VX_TYPE_UINT8, 0, a.data());
+    vx_tensor outLut = testCreateTensor(context, dims, VX_TYPE_UINT8, 0, nullptr);
+    vx_tensor outTranspose = testCreateTensor(context, tdims, VX_TYPE_UINT8, 0, nullptr);
+    vx_tensor outConvert = testCreateTensor(context, dims, VX_TYPE_FLOAT32, 0, nullptr);
+    vx_lut vlut = vxCreateLUT(context, VX_TYPE_UINT8, 256);
+    TEST_VX(vxCopyLUT(vlut, lut.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_scalar sDim1 = vxCreateScalar(context, VX_TYPE_SIZE, &dim1);
+    vx_scalar sDim2 = vxCreateScalar(context, VX_TYPE_SIZE, &dim2);
+    vx_scalar sPolicy = vxCreateScalar(context, VX_TYPE_ENUM, &saturate);
+    vx_scalar sNorm = vxCreateScalar(context, VX_TYPE_FLOAT32, &norm);
+    vx_scalar sOffset = vxCreateScalar(context, VX_TYPE_FLOAT32, &offset);
+    TEST_VX(vxGetStatus((vx_reference)testCreateNode(graph, VX_KERNEL_TENSOR_TABLE_LOOKUP,
+        { (vx_reference)in, (vx_reference)vlut, (vx_reference)outLut })));
+    TEST_VX(vxGetStatus((vx_reference)vxTensorTransposeNode(graph, in, outTranspose, dim1, dim2)));
+    TEST_VX(vxGetStatus((vx_reference)vxTensorConvertDepthNode(graph, in, saturate, sNorm, sOffset, outConvert)));
+    TEST_VX(vxVerifyGraph(graph));
+    TEST_VX(vxProcessGraph(graph));
+    if (testReadTensor(outLut, dims, 1, looked.data()) || testReadTensor(outTranspose, tdims, 1, transposed.data()) ||
+        testReadTensor(outConvert, dims, 4, converted.data()))
+        return 1;
+    for (vx_size z = 0; z < 33; z++) for (vx_size y = 0; y < 7; y++) for (vx_size x = 0; x < 45; x++) {
+        vx_size i = (z * 7 + y) * 45 + x, t = (x * 7 + y) * 33 + z;
+        TEST_CHECK(looked[i] == lut[a[i]]);
+        TEST_CHECK(transposed[t] == a[i]);
+        TEST_CHECK(testNear(converted[i], (a[i] - offset) / norm));
+    }
+    vxReleaseScalar(&sDim1);
+    vxReleaseScalar(&sDim2);
+    vxReleaseScalar(&sPolicy);
+    vxReleaseScalar(&sNorm);
+    vxReleaseScalar(&sOffset);
+    vxReleaseLUT(&vlut);
+    vxReleaseTensor(&in);
+    vxReleaseTensor(&outLut);
+    vxReleaseTensor(&outTranspose);
+    vxReleaseTensor(&outConvert);
+    TEST_VX(vxReleaseGraph(&graph));
+    return 0;
+}
+
+// F32 matrix multiply with bias: output[M][N] = op(input1)[M][K] * input2[K][N] + input3[M][N]
+static int testTensorMatrixMultiplyF32(vx_context context, vx_size M, vx_size N, vx_size K, bool transpose1)
+{
+    std::vector<vx_float32> a(M * K), b(K * N), c(M * N), out(M * N);
+    testFillFloat(a, 7);
+    testFillFloat(b, 8);
+    testFillFloat(c, 9);
+    vx_tensor_matrix_multiply_params_t params = { transpose1 ? vx_true_e : vx_false_e, vx_false_e, vx_false_e };
+    std::vector<vx_size> dimsA = transpose1 ? std::vector<vx_size>{ M, K } : std::vector<vx_size>{ K, M };
+    vx_graph graph = vxCreateGraph(context);
+    vx_tensor in1 = testCreateTensor(context, dimsA, VX_TYPE_FLOAT32, 0, a.data());
+    vx_tensor in2 = testCreateTensor(context, { N, K }, VX_TYPE_FLOAT32, 0, b.data());
+    vx_tensor in3 = testCreateTensor(context, { N, M }, VX_TYPE_FLOAT32, 0, c.data());
+    vx_tensor output = testCreateTensor(context, { N, M }, VX_TYPE_FLOAT32, 0, nullptr);
+    vx_scalar sParams = vxCreateScalarWithSize(context, VX_TYPE_TENSOR_MATRIX_MULTIPLY_PARAMS, &params, sizeof(params));
+    TEST_VX(vxGetStatus((vx_reference)testCreateNode(graph, VX_KERNEL_TENSOR_MATRIX_MULTIPLY,
+        { (vx_reference)in1, (vx_reference)in2, (vx_reference)in3, (vx_reference)sParams, (vx_reference)output })));
+    TEST_VX(vxVerifyGraph(graph));
+    TEST_VX(vxProcessGraph(graph));
+    if (testReadTensor(output, { N, M }, 4, out.data()))
+        return 1;
+    for (vx_size m = 0; m < M; m++) for (vx_size n = 0; n < N; n++) {
+        vx_float32 sum = c[m * N + n];
+        for (vx_size k = 0; k < K; k++)
+            sum += (transpose1 ? a[k * M + m] : a[m * K + k]) * b[k * N + n];
+        if (!testNear(out[m * N + n], sum)) {
+            printf("ERROR: %dx%dx%d mismatch at (%d,%d): %g instead of %g\n", (int)M, (int)N, (int)K, (int)m, (int)n, out[m * N + n], sum);
+            return 1;
+        }
+    }
+    vxReleaseScalar(&sParams);
+    vxReleaseTensor(&in1);
+    vxReleaseTensor(&in2);
+    vxReleaseTensor(&in3);
+    vxReleaseTensor(&output);
+    TEST_VX(vxReleaseGraph(&graph));
+    return 0;
+}
+
+static vx_status VX_CALLBACK testUserTensorAdd(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK testUserTensorAddValidate(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
+{
+    return VX_SUCCESS;
+}
+
+// a user kernel with the same name and enumeration replaces the built-in tensor add kernel,
+// even when a node already uses the built-in kernel; that node keeps working
+static int testTensorAddOverride()
+{
+    vx_context context = vxCreateContext();
+    TEST_VX(vxGetStatus((vx_reference)context));
+    std::vector<vx_size> dims = { 16, 4 };
+    std::vector<vx_float32> a(64, 1.0f), b(64, 2.0f), sum(64, 0.0f);
+    vx_enum wrap = VX_CONVERT_POLICY_WRAP;
+    vx_graph graph = vxCreateGraph(context);
+    vx_tensor in1 = testCreateTensor(context, dims, VX_TYPE_FLOAT32, 0, a.data());
+    vx_tensor in2 = testCreateTensor(context, dims, VX_TYPE_FLOAT32, 0, b.data());
+    vx_tensor out = testCreateTensor(context, dims, VX_TYPE_FLOAT32, 0, nullptr);
+    vx_scalar sPolicy = vxCreateScalar(context, VX_TYPE_ENUM, &wrap);
+    TEST_VX(vxGetStatus((vx_reference)testCreateNode(graph, VX_KERNEL_TENSOR_ADD,
+        { (vx_reference)in1, (vx_reference)in2, (vx_reference)sPolicy, (vx_reference)out })));
+
+    vx_kernel kernel = vxAddUserKernel(context, "org.khronos.openvx.tensor_add", VX_KERNEL_TENSOR_ADD,
+        testUserTensorAdd, 4, testUserTensorAddValidate, nullptr, nullptr);
+    TEST_VX(vxGetStatus((vx_reference)kernel));
+    vx_kernel found = vxGetKernelByEnum(context, VX_KERNEL_TENSOR_ADD);
+    TEST_CHECK(found == kernel);
+    vxReleaseKernel(&found);
+
+    TEST_VX(vxVerifyGraph(graph));
+    TEST_VX(vxProcessGraph(graph));
+    if (testReadTensor(out, dims, 4, sum.data()))
+        return 1;
+    for (vx_size i = 0; i < sum.size(); i++) {
+        TEST_CHECK(sum[i] == 3.0f);
+    }
+    vxReleaseScalar(&sPolicy);
+    vxReleaseTensor(&in1);
+    vxReleaseTensor(&in2);
+    vxReleaseTensor(&out);
+    TEST_VX(vxReleaseGraph(&graph));
+    TEST_VX(vxReleaseContext(&context));
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    TEST_RUN(testTensorAddMultiplyF32(context));
+    TEST_RUN(testTensorSubtractS16(context));
+    TEST_RUN(testTensorLutTransposeConvert(context));
+    TEST_RUN(testTensorMatrixMultiplyF32(context, 33, 17, 29, false));
+    TEST_RUN(testTensorMatrixMultiplyF32(context, 64, 96, 130, true));
+    TEST_RUN(testTensorAddOverride());
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,64 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef __TEST_UTILS_H__
+#define __TEST_UTILS_H__
+
+#include <VX/vx.h>
+#include <VX/vxu.h>
+#include <vx_ext_amd.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+// each test is a function returning 0 on success, the macros below report the failing line and return 1
+#define TEST_CHECK(cond) \
+    if (!(cond)) { printf("FAILED: %s:%d: %s\n", __FILE__, __LINE__, #cond); return 1; }
+#define TEST_VX(call) { \
+    vx_status status_ = (call); \
+    if (status_ != VX_SUCCESS) { printf("FAILED: %s:%d: %s returned %d\n", __FILE__, __LINE__, #call, status_); return 1; } \
+}
+#define TEST_RUN(test) \
+    if (test) { printf("FAILED: %s\n", #test); failed++; } else { printf("OK: %s\n", #test); }
+
+// deterministic pseudo-random pixel values
+inline void testFillRandom(vx_uint8 * buf, vx_size size, vx_uint32 seed)
+{
+    for (vx_size i = 0; i < size; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        buf[i] = (vx_uint8)(seed >> 24);
+    }
+}
+
+// creates a U8 image with packed rows from user memory
+inline vx_image testCreateImageU8(vx_context context, vx_uint32 width, vx_uint32 height, vx_uint8 * buf)
+{
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = (vx_int32)width;
+    void * ptrs[] = { buf };
+    return vxCreateImageFromHandle(context, VX_DF_IMAGE_U8, &addr, ptrs, VX_MEMORY_TYPE_HOST);
+}
+
+#endif
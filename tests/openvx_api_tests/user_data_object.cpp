@@ -0,0 +1,96 @@
+/* 
+Copyright (c) 2021 Advanced Micro Devices, Inc. All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "test_utils.h"
+#include <VX/vx_khr_user_data_object.h>
+#include <stdint.h>
+
+// a user data object is allocated on first access with zeroed contents and 32-byte alignment
+static int testUserDataObjectAlloc(vx_context context, vx_size size)
+{
+    vx_user_data_object udo = vxCreateUserDataObject(context, "test_udo", size, NULL);
+    TEST_VX(vxGetStatus((vx_reference)udo));
+    vx_size querySize = 0;
+    TEST_VX(vxQueryUserDataObject(udo, VX_USER_DATA_OBJECT_SIZE, &querySize, sizeof(querySize)));
+    TEST_CHECK(querySize == size);
+
+    vx_map_id mapId;
+    vx_uint8 * ptr = NULL;
+    TEST_VX(vxMapUserDataObject(udo, 0, 0, &mapId, (void **)&ptr, VX_READ_AND_WRITE, VX_MEMORY_TYPE_HOST, 0));
+    TEST_CHECK(((uintptr_t)ptr & 31) == 0);
+    for (vx_size i = 0; i < size; i++) {
+        TEST_CHECK(ptr[i] == 0);
+    }
+    testFillRandom(ptr, size, (vx_uint32)size);
+    TEST_VX(vxUnmapUserDataObject(udo, mapId));
+
+    // read back through copy, at an offset and in full
+    std::vector<vx_uint8> expected(size), data(size);
+    testFillRandom(expected.data(), size, (vx_uint32)size);
+    TEST_VX(vxCopyUserDataObject(udo, 0, 0, data.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    TEST_CHECK(data == expected);
+    TEST_VX(vxCopyUserDataObject(udo, size / 2, size - size / 2, data.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    TEST_CHECK(!memcmp(data.data(), expected.data() + size / 2, size - size / 2));
+    TEST_CHECK(vxCopyUserDataObject(udo, size, 1, data.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST) == VX_ERROR_INVALID_PARAMETERS);
+    TEST_CHECK(vxCopyUserDataObject(udo, 0, size + 1, data.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST) == VX_ERROR_INVALID_PARAMETERS);
+    TEST_VX(vxReleaseUserDataObject(&udo));
+
+    // initial contents given at creation
+    udo = vxCreateUserDataObject(context, NULL, size, expected.data());
+    TEST_VX(vxGetStatus((vx_reference)udo));
+    std::fill(data.begin(), data.end(), 0);
+    TEST_VX(vxCopyUserDataObject(udo, 0, size, data.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    TEST_CHECK(data == expected);
+    TEST_VX(vxReleaseUserDataObject(&udo));
+    return 0;
+}
+
+// virtual objects are not accessible before a graph allocates them
+static int testUserDataObjectVirtual(vx_context context)
+{
+    vx_graph graph = vxCreateGraph(context);
+    TEST_VX(vxGetStatus((vx_reference)graph));
+    vx_user_data_object udo = vxCreateVirtualUserDataObject(graph, "test_udo", 64);
+    TEST_VX(vxGetStatus((vx_reference)udo));
+    vx_uint8 data[64];
+    TEST_CHECK(vxCopyUserDataObject(udo, 0, 64, data, VX_READ_ONLY, VX_MEMORY_TYPE_HOST) == VX_ERROR_OPTIMIZED_AWAY);
+    TEST_VX(vxReleaseUserDataObject(&udo));
+    TEST_VX(vxReleaseGraph(&graph));
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    vx_context context = vxCreateContext();
+    if (vxGetStatus((vx_reference)context) != VX_SUCCESS) {
+        printf("ERROR: vxCreateContext failed\n");
+        return 1;
+    }
+    int failed = 0;
+    TEST_RUN(testUserDataObjectAlloc(context, 1));
+    TEST_RUN(testUserDataObjectAlloc(context, 100));
+    TEST_RUN(testUserDataObjectAlloc(context, 4099));
+    TEST_RUN(testUserDataObjectVirtual(context));
+    vxReleaseContext(&context);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,294 @@
+#!/bin/bash
+
+############# Help and Syntax #############
+
+# Help
+
+# The runvxBenchmarkAllScript.sh bash script benchmarks the AMD OpenVX CPU (HOST) kernels with runvx.
+# - It runs every kernel GDF under kernelGDFs/ (one agoKernel_* node per GDF) or a single kernel separately.
+# - It runs each kernel across representative resolutions (VGA, 1080P, 4K by default) using runvx -benchmark.
+# - It reports median latency, pixels/cycle and GB/s of image data touched by the node.
+# - It runs on CPU only (-affinity:CPU), so it works on CPU-only CI machines, and saves results in a JSON file.
+
+# Syntax
+
+# Syntax: `./runvxBenchmarkAllScript.sh <P> [<N>] [<R>] [<I>] [<F>]` where:
+# ```
+# - P     RunVX path (folder with runvx executable)
+# - N     NAME of kernel to run ('ALL' = run all available kernels (DEFAULT), '<kernel name>' = run specific kernel, e.g. Box_U8_U8_3x3)
+# - R     RESOLUTIONS as comma separated list of VGA, 720P, 1080P, 4K or <width>x<height> (DEFAULT: VGA,1080P,4K)
+# - I     ITERATIONS measured per kernel and resolution (DEFAULT: 100, with 10 warmup iterations)
+# - F     JSON output FILE name (DEFAULT: agoKernelBenchmark.json)
+# ```
+# The nominal CPU clock used for pixels/cycle is read from sysfs or the /proc/cpuinfo model name; set CPU_GHZ environment variable to override.
+# Kernels that read input files (e.g., remap tables) run only at the resolution of those files, e.g. 720P, and only when the files exist.
+
+############# Help and Syntax #############
+
+
+
+
+
+############# Need not edit - Utility functions #############
+
+GDF_PATH="kernelGDFs"
+GENERATED_GDF_PATH="generatedGDFsBenchmark"
+WARMUP=10
+
+# generator function to generate a GDF for the given resolution
+#   returns 1 with SKIP_REASON set when the GDF reads input files (e.g., remap tables or camera frames),
+#   which can't be scaled, and the resolution doesn't match their size or the files are missing
+
+generator() {
+
+    CATEGORY=$1
+
+    FIXED_SIZE=$(grep ":READ," "$GDF_PATH/$CATEGORY/$GDF.gdf" | grep -o "[0-9]*,[0-9]*" | head -1)
+    if [ "$FIXED_SIZE" != "" ] && [ "$FIXED_SIZE" != "$WIDTH,$HEIGHT" ]; then
+        SKIP_REASON="input files are ${FIXED_SIZE/,/x}"
+        return 1
+    fi
+    for INPUT_FILE in $(grep -o ":READ,[^ ]*" "$GDF_PATH/$CATEGORY/$GDF.gdf" | sed -e "s|:READ,\.\./\.\./$GDF_PATH/|$GDF_PATH/|");
+    do
+        if [[ ! -f "$INPUT_FILE" ]]; then
+            SKIP_REASON="missing $INPUT_FILE"
+            return 1
+        fi
+    done
+    HALF_WIDTH=$(( "$WIDTH" / 2))
+    HALF_HEIGHT=$(( "$HEIGHT" / 2))
+    DOUBLE_WIDTH=$(( "$WIDTH" * 2))
+    sed -e "s/1920,1080/$WIDTH,$HEIGHT/" \
+        -e "s/960,1080/$HALF_WIDTH,$HEIGHT/" \
+        -e "s/960,540/$HALF_WIDTH,$HALF_HEIGHT/" \
+        -e "s/3840,1080/$DOUBLE_WIDTH,$HEIGHT/" \
+        -e "s|\.\./\.\./$GDF_PATH/|$PWD/$GDF_PATH/|g" \
+        "$GDF_PATH/$CATEGORY/$GDF.gdf" > "$GENERATED_GDF_PATH/$CATEGORY/$GDF.gdf"
+}
+
+# image_stats function prints "<pixels> <bytes>" for a GDF:
+#   pixels -- pixel count of the last image declared in GDF (i.e., node output)
+#   bytes  -- total size of all images declared in GDF (i.e., data read and written by the node)
+
+image_stats() {
+
+    grep -o "image:[0-9]*,[0-9]*,[A-Z0-9]*" "$1" | awk -F'[:,]' '
+    BEGIN {
+        bpp["U001"] = 0.125; bpp["U008"] = 1; bpp["S016"] = 2; bpp["U016"] = 2; bpp["U032"] = 4; bpp["S032"] = 4; bpp["F032"] = 4;
+        bpp["RGB2"] = 3; bpp["RGBA"] = 4; bpp["RGBX"] = 4; bpp["UYVY"] = 2; bpp["YUYV"] = 2;
+        bpp["IYUV"] = 1.5; bpp["NV12"] = 1.5; bpp["NV21"] = 1.5; bpp["YUV4"] = 3;
+        pixels = 0; bytes = 0;
+    }
+    {
+        pixels = $2 * $3;
+        bytes += $2 * $3 * (($4 in bpp) ? bpp[$4] : 1);
+    }
+    END { printf "%d %d\n", pixels, bytes; }'
+}
+
+# benchmark function runs one kernel at one resolution and appends results to JSON
+
+benchmark() {
+
+    CATEGORY=$1
+
+    if ! generator "$CATEGORY"; then
+        printf "%-48s %-12s SKIPPED (%s)\n" "$GDF" "$RESOLUTION" "$SKIP_REASON"
+        SKIPPED_LIST="$SKIPPED_LIST $GDF@$RESOLUTION"
+        return
+    fi
+    GENERATED_GDF="$GENERATED_GDF_PATH/$CATEGORY/$GDF.gdf"
+    RESULT_JSON="$PWD/$GENERATED_GDF_PATH/$CATEGORY/$GDF.json"
+    rm -f "$RESULT_JSON"
+    "$RUNVX_PATH"runvx -affinity:CPU -benchmark:"$WARMUP","$ITERATIONS" -benchmark-json:"$RESULT_JSON" "$GENERATED_GDF" > "$GENERATED_GDF_PATH/$CATEGORY/$GDF.log" 2>&1
+    if [[ ! -f "$RESULT_JSON" ]]; then
+        printf "%-48s %-12s FAILED (see %s)\n" "$GDF" "$RESOLUTION" "$GENERATED_GDF_PATH/$CATEGORY/$GDF.log"
+        FAILED_LIST="$FAILED_LIST $GDF@$RESOLUTION"
+        return
+    fi
+
+    read -r PIXELS BYTES <<< "$(image_stats "$GENERATED_GDF")"
+    LATENCY=$(grep '"latency_ms"' "$RESULT_JSON" | sed -e 's/.*"p50": \([0-9.]*\).*/\1/')
+    AVG_LATENCY=$(grep '"latency_ms"' "$RESULT_JSON" | sed -e 's/.*"avg": \([0-9.]*\).*/\1/')
+    P99_LATENCY=$(grep '"latency_ms"' "$RESULT_JSON" | sed -e 's/.*"p99": \([0-9.]*\).*/\1/')
+    read -r PIXELS_PER_CYCLE GBPS <<< "$(awk -v p="$PIXELS" -v b="$BYTES" -v ms="$LATENCY" -v ghz="$CPU_GHZ" \
+        'BEGIN { if (ms <= 0) ms = 1e-6; printf "%.4f %.3f\n", (ghz > 0) ? p / (ms * 1e6 * ghz) : 0, b / (ms * 1e6); }')"
+
+    printf "%-48s %-12s %10.3f %10.3f %12s %10s\n" "$GDF" "$RESOLUTION" "$LATENCY" "$P99_LATENCY" "$PIXELS_PER_CYCLE" "$GBPS"
+    if [ "$RESULT_COUNT" -gt 0 ]; then
+        echo "    }," >> "$JSON_FILE"
+    fi
+    {
+        echo "    {"
+        echo "      \"kernel\": \"agoKernel_$GDF\","
+        echo "      \"category\": \"$CATEGORY\","
+        echo "      \"resolution\": \"$RESOLUTION\","
+        echo "      \"width\": $WIDTH,"
+        echo "      \"height\": $HEIGHT,"
+        echo "      \"pixels\": $PIXELS,"
+        echo "      \"bytes\": $BYTES,"
+        echo "      \"iterations\": $ITERATIONS,"
+        echo "      \"p50_ms\": $LATENCY,"
+        echo "      \"avg_ms\": $AVG_LATENCY,"
+        echo "      \"p99_ms\": $P99_LATENCY,"
+        echo "      \"pixels_per_cycle\": $PIXELS_PER_CYCLE,"
+        echo "      \"gb_per_sec\": $GBPS"
+    } >> "$JSON_FILE"
+    RESULT_COUNT=$(( RESULT_COUNT + 1 ))
+}
+
+############# Need not edit - Utility functions #############
+
+
+
+
+
+
+
+
+
+
+############# Need not edit - Main script #############
+
+# Input parameters
+
+if (( "$#" < 1 )); then
+    echo
+    echo "The runvxBenchmarkAllScript.sh bash script benchmarks the AMD OpenVX CPU (HOST) kernels with runvx."
+    echo "    - It runs every kernel GDF under kernelGDFs/ (one agoKernel_* node per GDF) or a single kernel separately."
+    echo "    - It runs each kernel across representative resolutions (VGA, 1080P, 4K by default) using runvx -benchmark."
+    echo "    - It reports median latency, pixels/cycle and GB/s of image data touched by the node."
+    echo "    - It runs on CPU only (-affinity:CPU), so it works on CPU-only CI machines, and saves results in a JSON file."
+    echo
+    echo "Syntax: ./runvxBenchmarkAllScript.sh <P> [<N>] [<R>] [<I>] [<F>]"
+    echo "P     RunVX path (folder with runvx executable)"
+    echo "N     NAME of kernel to run ('ALL' = run all available kernels (DEFAULT), '<kernel name>' = run specific kernel, e.g. Box_U8_U8_3x3)"
+    echo "R     RESOLUTIONS as comma separated list of VGA, 720P, 1080P, 4K or <width>x<height> (DEFAULT: VGA,1080P,4K)"
+    echo "I     ITERATIONS measured per kernel and resolution (DEFAULT: 100, with 10 warmup iterations)"
+    echo "F     JSON output FILE name (DEFAULT: agoKernelBenchmark.json)"
+    echo "The nominal CPU clock used for pixels/cycle is read from sysfs or the /proc/cpuinfo model name; set CPU_GHZ environment variable to override."
+    echo "Kernels that read input files (e.g., remap tables) run only at the resolution of those files, e.g. 720P, and only when the files exist."
+    exit 1
+fi
+
+if [[ ! -f "$1/runvx" ]]; then
+    printf "\n$1/runvx does not exist!\n"
+    exit 1
+fi
+RUNVX_PATH="$1/"
+export LD_LIBRARY_PATH="$1/../lib:$LD_LIBRARY_PATH"
+
+KERNEL_NAME="${2:-ALL}"
+RESOLUTION_LIST="${3:-VGA,1080P,4K}"
+ITERATIONS="${4:-100}"
+JSON_FILE="${5:-agoKernelBenchmark.json}"
+
+if ! [[ "$ITERATIONS" =~ ^[0-9]+$ ]] || [ "$ITERATIONS" -lt 1 ]; then
+    echo "The iterations must be a positive integer!"
+    exit 1
+fi
+
+# pixels/cycle uses the nominal CPU clock: "cpu MHz" in /proc/cpuinfo is the current, scaled frequency
+if [ "$CPU_GHZ" = "" ] && [ -f /sys/devices/system/cpu/cpu0/cpufreq/base_frequency ]; then
+    CPU_GHZ=$(awk '{ printf "%.3f", $1 / 1000000 }' /sys/devices/system/cpu/cpu0/cpufreq/base_frequency)
+fi
+if [ "$CPU_GHZ" = "" ]; then
+    CPU_GHZ=$(grep -m1 "model name" /proc/cpuinfo 2>/dev/null | sed -n -e 's/.*@ *\([0-9.]*\) *GHz.*/\1/p')
+fi
+if [ "$CPU_GHZ" = "" ]; then
+    echo "WARNING: unable to find the nominal CPU clock, set CPU_GHZ environment variable to report pixels/cycle"
+    CPU_GHZ=0
+fi
+
+# list of kernel GDFs as <category>/<name>
+
+GDF_LIST=""
+for FILE in "$GDF_PATH"/*/*.gdf;
+do
+    CATEGORY=$(basename "$(dirname "$FILE")")
+    NAME=$(basename "$FILE" .gdf)
+    if [ "$KERNEL_NAME" = "ALL" ] || [ "$KERNEL_NAME" = "$NAME" ]; then
+        GDF_LIST="$GDF_LIST $CATEGORY/$NAME"
+    fi
+done
+if [ "$GDF_LIST" = "" ]; then
+    echo "The kernel name $KERNEL_NAME is not a valid name from $GDF_PATH!"
+    exit 1
+fi
+
+# Running benchmarks
+
+rm -rf "$GENERATED_GDF_PATH"
+for CATEGORY in $(ls "$GDF_PATH");
+do
+    mkdir -p "$GENERATED_GDF_PATH/$CATEGORY"
+done
+
+{
+    echo "{"
+    echo "  \"runvx\": \"$RUNVX_PATH\","
+    echo "  \"affinity\": \"CPU\","
+    echo "  \"cpu_ghz\": $CPU_GHZ,"
+    echo "  \"warmup\": $WARMUP,"
+    echo "  \"iterations\": $ITERATIONS,"
+    echo "  \"results\": ["
+} > "$JSON_FILE"
+
+RESULT_COUNT=0
+FAILED_LIST=""
+SKIPPED_LIST=""
+printf "\n%-48s %-12s %10s %10s %12s %10s\n" "KERNEL" "RESOLUTION" "p50-ms" "p99-ms" "pixels/cycle" "GB/s"
+for RESOLUTION in ${RESOLUTION_LIST//,/ };
+do
+    case "${RESOLUTION^^}" in
+        VGA)   WIDTH=640;  HEIGHT=480 ;;
+        720P)  WIDTH=1280; HEIGHT=720 ;;
+        1080P) WIDTH=1920; HEIGHT=1080 ;;
+        4K)    WIDTH=3840; HEIGHT=2160 ;;
+        *X*)   WIDTH="${RESOLUTION%[xX]*}"; HEIGHT="${RESOLUTION#*[xX]}" ;;
+        *)     echo "The resolution $RESOLUTION is not valid!"; exit 1 ;;
+    esac
+    for ITEM in $GDF_LIST;
+    do
+        GDF=$(basename "$ITEM")
+        benchmark "$(dirname "$ITEM")"
+    done
+done
+
+if [ "$RESULT_COUNT" -gt 0 ]; then
+    echo "    }" >> "$JSON_FILE"
+fi
+FAILED_COUNT=0
+SKIPPED_COUNT=0
+{
+    echo "  ],"
+    echo -n "  \"failed\": ["
+    for ITEM in $FAILED_LIST;
+    do
+        if [ "$FAILED_COUNT" -gt 0 ]; then
+            echo -n ","
+        fi
+        echo -n " { \"kernel\": \"agoKernel_${ITEM%@*}\", \"resolution\": \"${ITEM#*@}\" }"
+        FAILED_COUNT=$(( FAILED_COUNT + 1 ))
+    done
+    echo " ],"
+    echo -n "  \"skipped\": ["
+    for ITEM in $SKIPPED_LIST;
+    do
+        if [ "$SKIPPED_COUNT" -gt 0 ]; then
+            echo -n ","
+        fi
+        echo -n " { \"kernel\": \"agoKernel_${ITEM%@*}\", \"resolution\": \"${ITEM#*@}\" }"
+        SKIPPED_COUNT=$(( SKIPPED_COUNT + 1 ))
+    done
+    echo " ]"
+    echo "}"
+} >> "$JSON_FILE"
+
+# kernels that fail to run are reported, but correctness is checked by runvxTestAllScript.sh
+printf "\nBenchmarked $RESULT_COUNT kernel/resolution combination(s), $FAILED_COUNT failed to run, $SKIPPED_COUNT skipped. Results saved in $JSON_FILE\n"
+if [ "$RESULT_COUNT" -eq 0 ]; then
+    exit 1
+fi
+
+############# Need not edit - Main script #############
@@ -149,6 +149,15 @@ FormatConvert_IUV_UV12
 FormatConvert_UV12_IUV
 FormatConvert_UV_UV12
 ScaleUp2x2_U8_U8
+ColorConvert_RGB_P016
+ColorConvert_RGBX_P016
+ColorConvert_P010_RGB
+ColorConvert_P010_RGBX
+ColorConvert_P016_RGB
+ColorConvert_P016_RGBX
+FormatConvert_NV12_P016
+FormatConvert_P010_NV12
+FormatConvert_P016_NV12
 "
 
 GDF_FILTER_LIST="Box_U8_U8_3x3
@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "vxEngineUtil.h"
 #include "vxEngine.h"
 #include <iostream>
+#include <memory>
 
 char buf[4096];
 // program and version
@@ -41,6 +42,128 @@ char buf[4096];
 #define RUNVX_PROGRAM "runvx"
 #endif
 
+// benchmark configuration (-benchmark option)
+struct BenchmarkConfig {
+	bool enabled;
+	int warmupCount;
+	int iterationCount;
+	int instanceCount;
+	std::string jsonFileName;
+	std::string gdfName;
+};
+
+// get latency percentile from sorted list (nearest-rank)
+static float GetPercentile(const std::vector<float>& sortedList, float percentile)
+{
+	if (sortedList.empty()) return 0.0f;
+	size_t rank = (size_t)ceil(percentile / 100.0f * sortedList.size());
+	return sortedList[rank > 0 ? rank - 1 : 0];
+}
+
+// run warmup and measured iterations concurrently on all engines and report results
+static int RunBenchmark(std::vector<CVxEngine *>& engineList, const BenchmarkConfig& config)
+{
+	size_t instanceCount = engineList.size();
+	std::vector<std::vector<float>> latencyList(instanceCount);
+	std::vector<float> elapsedList(instanceCount);
+	std::vector<int> statusList(instanceCount, 0);
+	auto runPhase = [&](bool measure) {
+		std::vector<std::thread> threadList;
+		for (size_t i = 0; i < instanceCount; i++) {
+			threadList.push_back(std::thread([&, i, measure]() {
+				try {
+					int64_t start_time = utilGetClockCounter();
+					if (measure) {
+						latencyList[i].reserve(config.iterationCount);
+						statusList[i] = engineList[i]->RunBenchmark(config.iterationCount, &latencyList[i]);
+					}
+					else {
+						statusList[i] = engineList[i]->RunBenchmark(config.warmupCount, nullptr);
+					}
+					elapsedList[i] = (float)(utilGetClockCounter() - start_time) / utilGetClockFrequency();
+				}
+				catch (int errorCode) {
+					statusList[i] = errorCode ? errorCode : -1;
+				}
+			}));
+		}
+		for (auto& t : threadList)
+			t.join();
+		for (size_t i = 0; i < instanceCount; i++)
+			if (statusList[i] < 0) return statusList[i];
+		return 0;
+	};
+
+	// warmup all instances, then run the measured iterations with all instances starting together
+	printf("> benchmark: %d warmup + %d iterations on %d instance(s)\n", config.warmupCount, config.iterationCount, (int)instanceCount);
+	fflush(stdout);
+	if (runPhase(false) < 0) return -1;
+	int64_t start_time = utilGetClockCounter();
+	if (runPhase(true) < 0) return -1;
+	float elapsed = (float)(utilGetClockCounter() - start_time) / utilGetClockFrequency();
+
+	// aggregate statistics
+	std::vector<float> allLatency;
+	for (size_t i = 0; i < instanceCount; i++)
+		allLatency.insert(allLatency.end(), latencyList[i].begin(), latencyList[i].end());
+	sort(allLatency.begin(), allLatency.end());
+	double sum = 0;
+	for (float v : allLatency) sum += v;
+	size_t frames = allLatency.size();
+	float fps = elapsed > 0 ? (float)frames / elapsed : 0.0f;
+	float avg = frames > 0 ? (float)(sum / frames) : 0.0f;
+	float minLatency = frames > 0 ? allLatency.front() : 0.0f;
+	float maxLatency = frames > 0 ? allLatency.back() : 0.0f;
+	float p50 = GetPercentile(allLatency, 50), p95 = GetPercentile(allLatency, 95), p99 = GetPercentile(allLatency, 99);
+	printf("csv,BENCHMARK,INSTANCES,WARMUP,ITERATIONS,FRAMES,elapsed-sec,fps,avg-ms,min-ms,p50-ms,p95-ms,p99-ms,max-ms\n");
+	printf("csv,BENCHMARK,%9d,%6d,%10d,%6d,%11.3f,%8.2f,%6.3f,%6.3f,%6.3f,%6.3f,%6.3f,%6.3f\n",
+		(int)instanceCount, config.warmupCount, config.iterationCount, (int)frames, elapsed, fps, avg, minLatency, p50, p95, p99, maxLatency);
+	for (size_t i = 0; i < instanceCount && instanceCount > 1; i++) {
+		printf("csv,INSTANCE ,%9d,%6d,%10d,%6d,%11.3f,%8.2f\n", (int)i, config.warmupCount, config.iterationCount,
+			(int)latencyList[i].size(), elapsedList[i], elapsedList[i] > 0 ? latencyList[i].size() / elapsedList[i] : 0.0f);
+	}
+	fflush(stdout);
+
+	// save machine-readable results
+	if (config.jsonFileName.length() > 0) {
+		FILE * fp = fopen(config.jsonFileName.c_str(), "w");
+		if (!fp) {
+			printf("ERROR: unable to create: %s\n", config.jsonFileName.c_str());
+			return -1;
+		}
+		fprintf(fp, "{\n");
+		fprintf(fp, "  \"program\": \"%s\",\n", RUNVX_PROGRAM);
+		fprintf(fp, "  \"version\": \"%s\",\n", RUNVX_VERSION);
+		fprintf(fp, "  \"gdf\": \"");
+		for (const char * s = config.gdfName.c_str(); *s; s++) {
+			if (*s == '"' || *s == '\\') fputc('\\', fp);
+			fputc(*s, fp);
+		}
+		fprintf(fp, "\",\n");
+		fprintf(fp, "  \"instances\": %d,\n", (int)instanceCount);
+		fprintf(fp, "  \"warmup\": %d,\n", config.warmupCount);
+		fprintf(fp, "  \"iterations\": %d,\n", config.iterationCount);
+		fprintf(fp, "  \"frames\": %d,\n", (int)frames);
+		fprintf(fp, "  \"elapsed_sec\": %.6f,\n", elapsed);
+		fprintf(fp, "  \"fps\": %.3f,\n", fps);
+		fprintf(fp, "  \"latency_ms\": { \"avg\": %.6f, \"min\": %.6f, \"p50\": %.6f, \"p95\": %.6f, \"p99\": %.6f, \"max\": %.6f },\n",
+			avg, minLatency, p50, p95, p99, maxLatency);
+		fprintf(fp, "  \"per_instance\": [\n");
+		for (size_t i = 0; i < instanceCount; i++) {
+			std::vector<float> sortedList = latencyList[i];
+			sort(sortedList.begin(), sortedList.end());
+			fprintf(fp, "    { \"fps\": %.3f, \"p50_ms\": %.6f, \"p99_ms\": %.6f }%s\n",
+				elapsedList[i] > 0 ? sortedList.size() / elapsedList[i] : 0.0f,
+				GetPercentile(sortedList, 50), GetPercentile(sortedList, 99), (i + 1 < instanceCount) ? "," : "");
+		}
+		fprintf(fp, "  ]\n");
+		fprintf(fp, "}\n");
+		fclose(fp);
+		printf("OK: saved benchmark results into %s\n", config.jsonFileName.c_str());
+	}
+	return 0;
+}
+
 void show_usage(const char * program, bool detail)
 {
 	printf("\n");
@@ -79,6 +202,17 @@ void show_usage(const char * program, bool detail)
 	printf("      into files '<dumpFilePrefix>dumpdata_####_<object-type>_<object-name>.raw'.\n");
 	printf("  -discard-commands:<cmd>[,cmd[...]]\n");
 	printf("      Discard the listed commands.\n");
+	printf("  -benchmark[:<warmup>,<iterations>[,<instances>]]\n");
+	printf("      Load the first input frame and then run the graph(s) <warmup> times\n");
+	printf("      followed by <iterations> measured runs without any frame I/O. The GDF is\n");
+	printf("      replicated into <instances> contexts that run concurrently on separate\n");
+	printf("      threads. Reports aggregate FPS and latency percentiles. Default: 10,100,1.\n");
+	printf("  -benchmark-json:<file.json>\n");
+	printf("      Save benchmark results into a JSON file for regression tracking.\n");
+	printf("  -async-io\n");
+	printf("      Read, write, and compare data files on background threads so that file I/O\n");
+	printf("      overlaps graph execution. Input frames are prefetched one frame ahead and\n");
+	printf("      compare mismatches are reported one frame late.\n");
 	printf("\n");
 
 	if (!detail) return;
@@ -98,6 +232,8 @@ int main(int argc, char * argv[])
 	bool enableDumpProfile = false;
 	bool disableVirtual = false;
 	bool discardCompareErrors = false;
+	bool enableAsyncFrameIO = false;
+	BenchmarkConfig benchmark = { false, 10, 100, 1 };
 	vx_uint32 defaultTargetAffinity = 0;
 	vx_uint32 defaultTargetInfo = 0;
 	bool doSetGraphOptimizerFlags = false;
@@ -175,6 +311,22 @@ int main(int argc, char * argv[])
 			else if (!_stricmp(argv[arg], "-use-schedule-graph")) {
 				enableScheduleGraph = true;
 			}
+			else if (!_strnicmp(argv[arg], "-benchmark-json:", 16)) {
+				benchmark.jsonFileName = &argv[arg][16];
+			}
+			else if (!_strnicmp(argv[arg], "-benchmark", 10) && (argv[arg][10] == '\0' || argv[arg][10] == ':')) {
+				benchmark.enabled = true;
+				if (argv[arg][10] == ':') {
+					if (sscanf(&argv[arg][11], "%d,%d,%d", &benchmark.warmupCount, &benchmark.iterationCount, &benchmark.instanceCount) < 2 ||
+						benchmark.warmupCount < 0 || benchmark.iterationCount < 1 || benchmark.instanceCount < 1)
+					{
+						printf("ERROR: invalid -benchmark option: %s\n", argv[arg]); return -1;
+					}
+				}
+			}
+			else if (!_stricmp(argv[arg], "-async-io")) {
+				enableAsyncFrameIO = true;
+			}
 			else if (!_stricmp(argv[arg], "-disable-virtual")) {
 				disableVirtual = true;
 			}
@@ -215,24 +367,29 @@ int main(int argc, char * argv[])
 	CVxEngine engine;
 	int errorCode = 0;
 	try {
-		// initialize engine
-		if (engine.Initialize(argCount, defaultTargetAffinity, defaultTargetInfo, enableScheduleGraph, disableVirtual, enableFullProfile, disableNodeFlushForCL, discardCommandList) < 0) throw - 1;
-		if (doSetGraphOptimizerFlags) {
-			engine.SetGraphOptimizerFlags(graphOptimizerFlags);
-		}
-		if (dumpDataConfig.find(",") != std::string::npos) {
-			engine.SetDumpDataConfig(dumpDataConfig);
-		}
-		engine.SetConfigOptions(verbose, discardCompareErrors, enableDumpProfile, enableDumpGDF, waitKeyDelayInMilliSeconds);
-		engine.SetFrameCountOptions(enableMultiFrameProcessing, framesEofRequested, frameCountSpecified, frameStart, frameEnd);
-		fflush(stdout);
-		// pass parameters to the engine: note that shell takes no extra parameters whereas node and file take extra parameter
-		for (int i = 0, j = 0; i < argCount; i++) {
-			char * param = argv[arg + argParamOffset + i];
-			if (engine.SetParameter(j++, param) < 0)
-				throw -1;
-		}
-		fflush(stdout);
+		// initialize engine (also used for additional benchmark instances)
+		int paramArgIndex = arg + argParamOffset;
+		auto initializeEngine = [&](CVxEngine& instance) {
+			if (instance.Initialize(argCount, defaultTargetAffinity, defaultTargetInfo, enableScheduleGraph, disableVirtual, enableFullProfile, disableNodeFlushForCL, discardCommandList) < 0) throw - 1;
+			if (doSetGraphOptimizerFlags) {
+				instance.SetGraphOptimizerFlags(graphOptimizerFlags);
+			}
+			if (dumpDataConfig.find(",") != std::string::npos) {
+				instance.SetDumpDataConfig(dumpDataConfig);
+			}
+			instance.SetConfigOptions(verbose, discardCompareErrors, enableDumpProfile, enableDumpGDF, waitKeyDelayInMilliSeconds, enableAsyncFrameIO);
+			instance.SetFrameCountOptions(enableMultiFrameProcessing, framesEofRequested, frameCountSpecified, frameStart, frameEnd);
+			instance.SetBenchmarkMode(benchmark.enabled);
+			fflush(stdout);
+			// pass parameters to the engine: note that shell takes no extra parameters whereas node and file take extra parameter
+			for (int i = 0, j = 0; i < argCount; i++) {
+				char * param = argv[paramArgIndex + i];
+				if (instance.SetParameter(j++, param) < 0)
+					throw -1;
+			}
+			fflush(stdout);
+		};
+		initializeEngine(engine);
 		// get full GDF text
 		char * fullText = nullptr;
 		if (!_stricmp(argv[arg], "node")) {
@@ -283,10 +440,36 @@ int main(int argc, char * argv[])
 		}
 
 		if (fullText) {
+			// keep a copy of GDF text for benchmark instances since BuildAndProcessGraph modifies it
+			std::string gdfText = fullText;
 			// process the GDF
 			if (engine.BuildAndProcessGraph(0, fullText, false) < 0)
 				throw - 1;
 			delete[] fullText;
+			if (benchmark.enabled) {
+				// replicate the GDF into separate contexts and run all instances concurrently
+				std::vector<std::unique_ptr<CVxEngine>> instanceList;
+				std::vector<CVxEngine *> engineList = { &engine };
+				for (int i = 1; i < benchmark.instanceCount; i++) {
+					instanceList.emplace_back(new CVxEngine());
+					CVxEngine * instance = instanceList.back().get();
+					initializeEngine(*instance);
+					std::vector<char> text(gdfText.begin(), gdfText.end());
+					text.push_back('\0');
+					if (instance->BuildAndProcessGraph(0, text.data(), false) < 0)
+						throw - 1;
+					engineList.push_back(instance);
+				}
+				benchmark.gdfName = argv[arg];
+				if (RunBenchmark(engineList, benchmark) < 0)
+					throw - 1;
+				for (auto& instance : instanceList) {
+					if (instance->Shutdown() < 0) throw -1;
+				}
+			}
+		}
+		else if (benchmark.enabled) {
+			ReportError("ERROR: -benchmark requires a GDF file or a node on command-line\n");
 		}
 		else {
 			// run shell
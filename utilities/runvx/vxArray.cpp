@@ -516,10 +516,13 @@ bool CVxParamArray::CompareFrameBitwiseExact(size_t numItems, size_t numItemsRef
 		void * ptr = nullptr;
 		vx_size stride = 0;
 		ERROR_CHECK(vxAccessArrayRange(m_array, 0, numItems, &stride, &ptr, VX_READ_ONLY));
-		for (size_t i = 0; i < numItems; i++) {
-			vx_uint8 * item = vxFormatArrayPointer(ptr, i, stride);
-			if (memcmp(item, bufItems + i * m_itemSize, m_itemSize) != 0) {
-				numMismatches++;
+		// compare whole range at once when items are packed, and count mismatching items only when it differs
+		if (stride != m_itemSize || memcmp(ptr, bufItems, numItemsMin * m_itemSize) != 0) {
+			for (size_t i = 0; i < numItemsMin; i++) {
+				vx_uint8 * item = vxFormatArrayPointer(ptr, i, stride);
+				if (memcmp(item, bufItems + i * m_itemSize, m_itemSize) != 0) {
+					numMismatches++;
+				}
 			}
 		}
 		ERROR_CHECK(vxCommitArrayRange(m_array, 0, numItems, ptr));
@@ -75,6 +75,8 @@ CVxEngine::CVxEngine()
 	m_frameEnd = 0;
 	m_waitKeyDelayInMilliSeconds = 1; // default is 1ms
 	m_disableCompare = false;
+	m_enableAsyncFrameIO = false;
+	m_benchmarkMode = false;
 	m_numGraphProcessed = 0;
 	m_graphVerified = false;
 	m_dumpDataEnabled = false;
@@ -326,6 +328,7 @@ int CVxEngine::ProcessGraph(std::vector<const char *> * graphNameList, size_t be
 		m_usingMultiFrameCapture |= it->second->IsUsingMultiFrameCapture();
 		it->second->SetVerbose(m_verbose);
 		it->second->SetDiscardCompareErrors(m_discardCompareErrors);
+		it->second->SetAsyncFrameIO(m_enableAsyncFrameIO);
 		it->second->Finalize();
 	}
 	if (m_frameCountSpecified) {
@@ -373,6 +376,16 @@ int CVxEngine::ProcessGraph(std::vector<const char *> * graphNameList, size_t be
 		}
 	}
 
+	if (m_benchmarkMode) {
+		// load the first input frame and leave graph execution to RunBenchmark
+		m_benchmarkGraphList = graphObjList;
+		m_benchmarkDelayList = delayObjList;
+		if (SyncFrame(m_frameStart) < 0) throw - 1;
+		if (ReadFrame(m_frameStart) < 0) throw - 1;
+		if (FlushFrame() < 0) throw - 1;
+		return 0;
+	}
+
 	if (graphObjList.size() < 2) {
 		printf("csv,HEADER ,STATUS, COUNT,cur-ms,avg-ms,min-ms,clenqueue-ms,clwait-ms,clwrite-ms,clread-ms\n");
 	}
@@ -457,6 +470,8 @@ int CVxEngine::ProcessGraph(std::vector<const char *> * graphNameList, size_t be
 			break;
 		}
 	}
+	// complete pending async writes and compares
+	if (FlushFrame() < 0) throw - 1;
 	// print the execution time statistics
 	int64_t end_time = utilGetClockCounter();
 	int64_t frequency = utilGetClockFrequency();
@@ -659,6 +674,17 @@ int CVxEngine::BuildAndProcessGraphFromLine(int level, char * line)
 				printf("> current settings for use-schedule-graph: %s\n", m_enableScheduleGraph ? "on" : "off");
 			}
 		}
+		else if (!_stricmp(wordList[1], "async-io"))
+		{ // syntax: set async-io [on|off]
+			if (wordList.size() > 2) {
+				m_enableAsyncFrameIO = true;
+				if (!_stricmp(wordList[2], "off"))
+					m_enableAsyncFrameIO = false;
+			}
+			if (wordList.size() == 2 || m_verbose) {
+				printf("> current settings for async-io: %s\n", m_enableAsyncFrameIO ? "on" : "off");
+			}
+		}
 		else if (!_stricmp(wordList[1], "dump-gdf"))
 		{ // syntax: set dump-gdf [on|off]
 			if (wordList.size() > 2) {
@@ -1204,6 +1230,53 @@ int CVxEngine::CompareFrame(int frameNumber)
 	return 0;
 }
 
+int CVxEngine::FlushFrame()
+{
+	int status = 0;
+	for (auto it = m_paramMap.begin(); it != m_paramMap.end(); ++it){
+		int flushStatus = it->second->FlushFrame();
+		if (flushStatus && !status)
+			status = flushStatus;
+	}
+	return status;
+}
+
+int CVxEngine::RunBenchmark(int iterationCount, std::vector<float> * latencyList)
+{
+	if (m_benchmarkGraphList.empty())
+		ReportError("ERROR: benchmark: no graph has been processed\n");
+	int64_t frequency = utilGetClockFrequency();
+	for (int iteration = 0; iteration < iterationCount; iteration++) {
+		// execute graphs without any frame I/O and measure the latency
+		int64_t start_time = utilGetClockCounter();
+		if (m_benchmarkGraphList.size() < 2 && !m_enableScheduleGraph) {
+			vx_status status = vxProcessGraph(m_benchmarkGraphList[0]);
+			if (status != VX_SUCCESS)
+				ReportError("ERROR: vxProcessGraph() failed (%d:%s)\n", status, ovxEnum2Name(status));
+		}
+		else {
+			for (size_t i = 0; i < m_benchmarkGraphList.size(); i++) {
+				vx_status status = vxScheduleGraph(m_benchmarkGraphList[i]);
+				if (status)
+					ReportError("ERROR: vxScheduleGraph() failed (%d:%s)\n", status, ovxEnum2Name(status));
+			}
+			for (size_t i = 0; i < m_benchmarkGraphList.size(); i++) {
+				vx_status status = vxWaitGraph(m_benchmarkGraphList[i]);
+				if (status)
+					ReportError("ERROR: vxWaitGraph() failed (%d:%s)\n", status, ovxEnum2Name(status));
+			}
+		}
+		int64_t end_time = utilGetClockCounter();
+		if (latencyList)
+			latencyList->push_back((float)(end_time - start_time) * 1000.0f / frequency);
+		// auto-age delays associated with graphs
+		for (size_t i = 0; i < m_benchmarkDelayList.size(); i++) {
+			ERROR_CHECK(vxAgeDelay(m_benchmarkDelayList[i]));
+		}
+	}
+	return 0;
+}
+
 void CVxEngine::SetFrameCountOptions(bool enableMultiFrameProcessing, bool framesEofRequested, bool frameCountSpecified, int frameStart, int frameEnd)
 {
 	m_enableMultiFrameProcessing = enableMultiFrameProcessing;
@@ -1213,8 +1286,9 @@ void CVxEngine::SetFrameCountOptions(bool enableMultiFrameProcessing, bool frame
 	m_frameEnd = frameEnd;
 }
 
-void CVxEngine::SetConfigOptions(bool verbose, bool discardCompareErrors, bool enableDumpProfile, bool enableDumpGDF, int waitKeyDelayInMilliSeconds)
+void CVxEngine::SetConfigOptions(bool verbose, bool discardCompareErrors, bool enableDumpProfile, bool enableDumpGDF, int waitKeyDelayInMilliSeconds, bool enableAsyncFrameIO)
 {
+	m_enableAsyncFrameIO = enableAsyncFrameIO;
 	m_verbose = verbose;
 	m_discardCompareErrors = discardCompareErrors;
 	m_enableDumpProfile = enableDumpProfile;
@@ -1427,6 +1501,8 @@ void PrintHelpGDF(const char * command)
 		"              Turn on/off data compares or just discard data compare errors.\n"
 		"          set use-schedule-graph [on|off]\n"
 		"              Turn on/off use of vxScheduleGraph instead of vxProcessGraph.\n"
+		"          set async-io [on|off]\n"
+		"              Turn on/off file reads, writes, and compares on background threads.\n"
 		"          set dump-data-config [<dumpFilePrefix>,<obj-type>[,<obj-type>[...]]]\n"
 		"              Specify dump data config for portion of the graph. To disable\n"
 		"              don't specify any config.\n"
@@ -1501,6 +1577,10 @@ void PrintHelpGDF(const char * command)
 		"        pyramid objects expect all frames of each level in separate files.\n"
 		"      - convolution objects support the option: scale\n"
 		"        This will read scale value as the first 32-bit integer in file(s).\n"
+		"      - image (raw frames) and tensor objects support the option: mmap\n"
+		"        This will map the input file into memory instead of reading it.\n"
+		"        Images and tensors created from a host handle with packed rows\n"
+		"        will point directly at the data in the mapped file (no copies).\n"
 		"\n"
 		);
 	if (strstr("write", command)) printf(
@@ -1539,8 +1619,9 @@ void PrintHelpGDF(const char * command)
 		"      - image and pyramid objects support the options:\n"
 		"          specify compare region: rect{<start-x>;<start-y>;<end-x>;<end-y>}\n"
 		"          specify valid pixel difference: err{<min>;<max>}\n"
-		"          specify pixel checksum to compare: checksum\n"
+		"          specify pixel checksum (MD5 or 64-bit) to compare: checksum\n"
 		"          specify generate checksum: checksum-save-instead-of-test\n"
+		"          specify generate 64-bit checksum (faster): checksum64-save-instead-of-test\n"
 		"      - matrix objects support the options:\n"
 		"          specify tolerance: err{<tolerance>}\n"
 		"      - remap objects support the options:\n"
@@ -31,10 +31,12 @@ public:
 	CVxEngine();
 	virtual ~CVxEngine();
 	int Initialize(int paramCount, int defaultTargetAffinity, int defaultTargetInfo, bool enableScheduleGraph, bool disableVirtual, bool enableFullProfile, bool disableNodeFlushForCL, std::string discardCommandList);
-	void SetConfigOptions(bool verbose, bool discardCompareErrors, bool enableDumpProfile, bool enableDumpGDF, int waitKeyDelayInMilliSeconds);
+	void SetConfigOptions(bool verbose, bool discardCompareErrors, bool enableDumpProfile, bool enableDumpGDF, int waitKeyDelayInMilliSeconds, bool enableAsyncFrameIO = false);
 	void SetFrameCountOptions(bool enableMultiFrameProcessing, bool framesEofRequested, bool frameCountSpecified, int frameStart, int frameEnd);
 	int SetGraphOptimizerFlags(vx_uint32 graph_optimizer_flags);
 	void SetDumpDataConfig(std::string dumpDataConfig);
+	void SetBenchmarkMode(bool enable) { m_benchmarkMode = enable; }
+	int RunBenchmark(int iterationCount, std::vector<float> * latencyList);
 	int SetParameter(int index, const char * param);
 	int Shell(int level, FILE * fp = nullptr);
 	int BuildAndProcessGraph(int level, char * graphScript, bool importMode);
@@ -53,6 +55,7 @@ protected:
 	int ReadFrame(int frameNumber);
 	int WriteFrame(int frameNumber);
 	int CompareFrame(int frameNumber);
+	int FlushFrame();
 	void MeasureFrame(int frameNumber, int status, std::vector<vx_graph>& graphList);
 	float GetMedianRunTime();
 	void PerformanceStatistics(int status, std::vector<vx_graph>& graphList);
@@ -88,6 +91,11 @@ private:
 	int m_frameEnd;
 	int m_waitKeyDelayInMilliSeconds;
 	bool m_disableCompare;
+	bool m_enableAsyncFrameIO;
+	// benchmark mode: ProcessGraph only loads the first frame and RunBenchmark executes the graphs
+	bool m_benchmarkMode;
+	std::vector<vx_graph> m_benchmarkGraphList;
+	std::vector<vx_delay> m_benchmarkDelayList;
 	int m_numGraphProcessed;
 	bool m_graphVerified;
 	bool m_dumpDataEnabled;
@@ -43,6 +43,7 @@ CVxParamImage::CVxParamImage()
 	m_countFrames = 0;
 	m_useCheckSumForCompare = false;
 	m_generateCheckSumForCompare = false;
+	m_generateCheckSum64ForCompare = false;
 	m_usingDisplay = false;
 	m_usingWriter = false;
 	m_countInitializeIO = 0;
@@ -78,6 +79,24 @@ CVxParamImage::CVxParamImage()
 	m_captureHeight = 0;
 	m_colorIndexDefault = 0;
 	m_radiusDefault = 2.0;
+
+	// async frame I/O
+	m_asyncReadFrameNumber = -1;
+	m_asyncReadHandle = -1;
+	m_asyncReadCountFrames = 0;
+	m_asyncReadIntoHandle = false;
+	memset(m_asyncPlaneAddr, 0, sizeof(m_asyncPlaneAddr));
+	memset(m_asyncPlaneWidthInBytes, 0, sizeof(m_asyncPlaneWidthInBytes));
+	m_asyncReadBuf = nullptr;
+	m_asyncWriteBuf = nullptr;
+	m_asyncCompareImage = nullptr;
+
+	// memory-mapped frame input
+	m_mmapRead = false;
+	m_mmapReadIntoHandle = false;
+	m_mappedFileActive = 0;
+	m_mappedFrameIndex = 0;
+	memset(m_mappedPlaneOffset, 0, sizeof(m_mappedPlaneOffset));
 }
 
 CVxParamImage::~CVxParamImage()
@@ -87,9 +106,29 @@ CVxParamImage::~CVxParamImage()
 
 int CVxParamImage::Shutdown(void)
 {
+	// complete pending async frame I/O before releasing buffers and files
+	FlushFrame();
+	if (m_asyncReadBuf) {
+		delete[] m_asyncReadBuf;
+		m_asyncReadBuf = nullptr;
+	}
+	if (m_asyncWriteBuf) {
+		delete[] m_asyncWriteBuf;
+		m_asyncWriteBuf = nullptr;
+	}
+	if (m_asyncCompareImage) {
+		vxReleaseImage(&m_asyncCompareImage);
+		m_asyncCompareImage = nullptr;
+	}
 	if (m_compareCountMatches > 0 && m_compareCountMismatches == 0) {
 		printf("OK: image %s MATCHED for %d frame(s) of %s\n", m_useCheckSumForCompare ? "CHECKSUM" : "COMPARE", m_compareCountMatches, GetVxObjectName());
 	}
+	if (m_image && m_mmapReadIntoHandle && m_mappedFile[m_mappedFileActive].IsOpen()) {
+		// point the image back to its own buffers before unmapping the input file
+		vxSwapImageHandle(m_image, m_memory_handle[m_active_handle], nullptr, m_planes);
+	}
+	m_mappedFile[0].Close();
+	m_mappedFile[1].Close();
 	if (m_image) {
 		vxReleaseImage(&m_image);
 		m_image = nullptr;
@@ -392,15 +431,16 @@ int CVxParamImage::InitializeIO(vx_context context, vx_graph graph, vx_reference
 		while (extpos > 0 && fileName[extpos] != '.')
 			extpos--;
 		if (!_stricmp(ioType, "read") || !_stricmp(ioType, "camera"))
-		{ // read request syntax: read,<fileNameOrURL>[,frames{<start>[;<count>;repeat]}|no-resize] or camera,<deviceNumber>
+		{ // read request syntax: read,<fileNameOrURL>[,frames{<start>[;<count>;repeat]}|no-resize|mmap] or camera,<deviceNumber>
 			int cameraDevice = -1;
 			if (!_stricmp(ioType, "camera"))
 				cameraDevice = atoi(fileName);
 			// get optional repeat frame count and starting frame
 			m_repeatFrames = 0;
+			m_mmapRead = false;
 			while (*io_params == ',') {
 				char option[64];
-				io_params = ScanParameters(io_params, ",frames{<start>[;<count>;repeat]}|no-resize", ",s", option);
+				io_params = ScanParameters(io_params, ",frames{<start>[;<count>;repeat]}|no-resize|mmap", ",s", option);
 				if (!_strnicmp(option, "frames{", 7)) {
 					int startFrame = 0, count = 0; char repeat[64] = { 0 };
 					if (sscanf(&option[7], "%d;%d;%s", &startFrame, &count, repeat) >= 1) {
@@ -414,6 +454,9 @@ int CVxParamImage::InitializeIO(vx_context context, vx_graph graph, vx_reference
 				else if (!_stricmp(option, "no-resize")) {
 					m_doNotResizeCapturedImages = true;
 				}
+				else if (!_stricmp(option, "mmap")) {
+					m_mmapRead = true;
+				}
 				else ReportError("ERROR: invalid image read/camera option: %s\n", option);
 			}
 			// check if openCV video capture need to be used
@@ -426,6 +469,8 @@ int CVxParamImage::InitializeIO(vx_context context, vx_graph graph, vx_reference
 				!_strnicmp(fileName, "file://", 7) || !_strnicmp(fileName, "http://", 7) || !_strnicmp(fileName, "https://", 8) ||
 				cameraDevice >= 0)
 			{ // need OpenCV to process these read I/O requests ////////////////////
+				if (m_mmapRead)
+					ReportError("ERROR: mmap option is only supported for raw frame files: %s\n", fileName);
 #if ENABLE_OPENCV
 				if (m_format == VX_DF_IMAGE_RGB || m_format == VX_DF_IMAGE_U8) {
 					// pen video capture device and mark multi-frame capture
@@ -592,7 +637,7 @@ int CVxParamImage::InitializeIO(vx_context context, vx_graph graph, vx_reference
 			}
 		}
 		else if (!_stricmp(ioType, "compare"))
-		{ // compare syntax: compare,fileName[,rect{<start-x>;<start-y>;<end-x>;<end-y>}][,err{<min>;<max>}][,checksum|checksum-save-instead-of-test]
+		{ // compare syntax: compare,fileName[,rect{<start-x>;<start-y>;<end-x>;<end-y>}][,err{<min>;<max>}][,checksum|checksum-save-instead-of-test|checksum64-save-instead-of-test]
 			if (m_fpCompare) {
 				fclose(m_fpCompare);
 				m_fpCompare = nullptr;
@@ -610,7 +655,7 @@ int CVxParamImage::InitializeIO(vx_context context, vx_graph graph, vx_reference
 			m_rectCompare.end_y = m_height;
 			while (*io_params == ',') {
 				char option[64];
-				io_params = ScanParameters(io_params, ",rect{<start-x>;<start-y>;<end-x>;<end-y>}|err{<min>;<max>}|checksum|checksum-save-instead-of-test", ",s", option);
+				io_params = ScanParameters(io_params, ",rect{<start-x>;<start-y>;<end-x>;<end-y>}|err{<min>;<max>}|checksum|checksum-save-instead-of-test|checksum64-save-instead-of-test", ",s", option);
 				if (!_strnicmp(option, "rect", 4)) {
 					ScanParameters(option + 4, "{<start-x>;<start-y>;<end-x>;<end-y>}", "{d;d;d;d}", &m_rectCompare.start_x, &m_rectCompare.start_y, &m_rectCompare.end_x, &m_rectCompare.end_y);
 				}
@@ -625,6 +670,10 @@ int CVxParamImage::InitializeIO(vx_context context, vx_graph graph, vx_reference
 				else if (!_stricmp(option, "checksum-save-instead-of-test")) {
 					m_generateCheckSumForCompare = true;
 				}
+				else if (!_stricmp(option, "checksum64-save-instead-of-test")) {
+					m_generateCheckSumForCompare = true;
+					m_generateCheckSum64ForCompare = true;
+				}
 				else ReportError("ERROR: invalid image compare option: %s\n", option);
 			}
 		}
@@ -661,7 +710,11 @@ int CVxParamImage::Finalize()
 	vx_size width_in_bytes = (m_planes == 1) ? CalculateImageWidthInBytes(m_image) : 0;
 
 	// compute frame size in bytes
+	// and check if async reads can prefetch directly into the inactive handle set of host images created from handle
 	m_frameSize = 0;
+	m_asyncReadIntoHandle = m_asyncFrameIO && !m_swap_handles && m_memory_type == VX_MEMORY_TYPE_HOST && m_memory_handle[!m_active_handle][0];
+	// and check if memory-mapped frames can be used directly as handles: needs packed rows and 16-byte aligned planes
+	m_mmapReadIntoHandle = m_mmapRead && !m_swap_handles && m_memory_type == VX_MEMORY_TYPE_HOST && m_memory_handle[m_active_handle][0];
 	for (vx_uint32 plane = 0; plane < (vx_uint32)m_planes; plane++) {
 		vx_rectangle_t rect = { 0, 0, m_width, m_height };
 		vx_imagepatch_addressing_t addr = { 0 };
@@ -671,10 +724,20 @@ int CVxParamImage::Finalize()
 			vx_size height = (addr.dim_y * addr.scale_y) / VX_SCALE_UNITY;
 			if (addr.stride_x != 0)
 				width_in_bytes = (width * addr.stride_x);
+			m_mappedPlaneOffset[plane] = m_frameSize;
+			if ((vx_size)addr.stride_y != width_in_bytes || (m_frameSize & 15) != 0 || dst != m_memory_handle[m_active_handle][plane])
+				m_mmapReadIntoHandle = false;
 			m_frameSize += width_in_bytes * height;
+			m_asyncPlaneAddr[plane] = addr;
+			m_asyncPlaneWidthInBytes[plane] = width_in_bytes;
+			if (dst != m_memory_handle[m_active_handle][plane])
+				m_asyncReadIntoHandle = false;
 			ERROR_CHECK(vxCommitImagePatch(m_image, &m_rectFull, plane, &addr, (void *)dst));
 		}
+		else m_asyncReadIntoHandle = m_mmapReadIntoHandle = false;
 	}
+	if ((m_frameSize & 15) != 0)
+		m_mmapReadIntoHandle = false;
 
 	if (m_useSyncOpenCLWriteDirective) {
 		// process user requested directives (required for uniform images)
@@ -785,6 +848,74 @@ int CVxParamImage::ReadFrame(int frameNumber)
 	}
 #endif
 
+	// use frames from memory-mapped input file when requested
+#if ENABLE_OPENCV
+	if (!m_cvImage && !m_cvCapDev)
+#endif
+	if (m_mmapRead && m_fileNameRead.length() > 0) {
+		int status = ReadFrameMapped(frameNumber);
+		// process user requested directives
+		if (status == 0 && m_useSyncOpenCLWriteDirective) {
+			ERROR_CHECK_AND_WARN(vxDirective((vx_reference)m_image, VX_DIRECTIVE_AMD_COPY_TO_OPENCL), VX_ERROR_NOT_ALLOCATED);
+		}
+		return status;
+	}
+
+	// read input file on m_asyncReader thread when async frame I/O is enabled
+#if ENABLE_OPENCV
+	if (!m_cvImage && !m_cvCapDev)
+#endif
+	if (m_asyncFrameIO && m_fileNameRead.length() > 0) {
+		if (!m_asyncReadBuf) {
+			NULLPTR_CHECK(m_asyncReadBuf = new vx_uint8[m_frameSize]);
+		}
+		if (m_asyncReadFrameNumber != frameNumber) {
+			// requested frame hasn't been prefetched: read it now
+			DiscardPrefetchedFrame();
+			m_asyncReader.Submit([=]() { return ReadFrameAsync(frameNumber, -1); });
+			m_asyncReadFrameNumber = frameNumber;
+			m_asyncReadHandle = -1;
+		}
+		int status = m_asyncReader.Wait();
+		int handle = m_asyncReadHandle;
+		m_asyncReadFrameNumber = -1;
+		m_asyncReadHandle = -1;
+		if (status < 0) {
+			char fileName[MAX_FILE_NAME_LENGTH];
+			sprintf(fileName, m_fileNameRead.c_str(), frameNumber, m_width, m_height);
+			ReportError("ERROR: unable to open: %s\n", fileName);
+		}
+		else if (status > 0) {
+			// report the caller that end of file has been detected -- no frames available in input
+			return 1;
+		}
+
+		// make the frame available in vx_image
+		if (handle >= 0) {
+			m_active_handle = handle;
+			vx_status status = vxSwapImageHandle(m_image, m_memory_handle[m_active_handle], m_memory_handle[!m_active_handle], m_planes);
+			if (status)
+				ReportError("ERROR: vxSwapImageHandle(%s,*,*,%d) failed (%d)\n", m_vxObjName, (int)m_planes, status);
+		}
+		else {
+			ReadImageFromBuffer(m_image, &m_rectFull, m_asyncReadBuf);
+		}
+
+		// prefetch next frame while the graph processes this frame
+		int nextFrameNumber = frameNumber + 1;
+		int nextHandle = m_asyncReadIntoHandle ? !m_active_handle : -1;
+		m_asyncReadCountFrames = m_countFrames;
+		m_asyncReader.Submit([=]() { return ReadFrameAsync(nextFrameNumber, nextHandle); });
+		m_asyncReadFrameNumber = nextFrameNumber;
+		m_asyncReadHandle = nextHandle;
+
+		// process user requested directives
+		if (m_useSyncOpenCLWriteDirective) {
+			ERROR_CHECK_AND_WARN(vxDirective((vx_reference)m_image, VX_DIRECTIVE_AMD_COPY_TO_OPENCL), VX_ERROR_NOT_ALLOCATED);
+		}
+		return 0;
+	}
+
 	// make sure that input file is open when OpenCV camera is not active and input filename is specified
 #if ENABLE_OPENCV
 	if (!m_cvImage)
@@ -837,6 +968,139 @@ int CVxParamImage::ReadFrame(int frameNumber)
 	return 0;
 }
 
+// get a frame from memory-mapped input file: host images created from handle point directly at
+// the frame in the mapped file, other images get a copy of it
+//   returns 0 on SUCCESS and 1 on EOF
+int CVxParamImage::ReadFrameMapped(int frameNumber)
+{
+	int fileIndex = m_mappedFileActive;
+	if (m_fileNameForReadHasIndex || !m_mappedFile[fileIndex].IsOpen()) {
+		// with indexed file names, the previous file stays mapped until the image no longer points at it
+		if (m_mappedFile[fileIndex].IsOpen())
+			fileIndex = !fileIndex;
+		char fileName[MAX_FILE_NAME_LENGTH];
+		sprintf(fileName, m_fileNameRead.c_str(), frameNumber, m_width, m_height);
+		if (m_mappedFile[fileIndex].Open(fileName) < 0)
+			ReportError("ERROR: unable to open: %s\n", fileName);
+		m_mappedFrameIndex = m_fileNameForReadHasIndex ? 0 : m_captureFrameStart;
+	}
+
+	// update m_countFrames to be able to repeat after every m_repeatFrames
+	if (m_repeatFrames != 0) {
+		if (m_countFrames == m_repeatFrames) {
+			// go back to beginning after every m_repeatFrames frames
+			m_mappedFrameIndex = m_captureFrameStart;
+			m_countFrames = 0;
+		}
+		else {
+			m_countFrames++;
+		}
+	}
+
+	size_t offset = m_mappedFrameIndex * m_frameSize;
+	if (offset + m_frameSize > m_mappedFile[fileIndex].GetSize()) {
+		// report the caller that end of file has been detected -- no frames available in input
+		if (fileIndex != m_mappedFileActive)
+			m_mappedFile[fileIndex].Close();
+		return 1;
+	}
+	vx_uint8 * frame = m_mappedFile[fileIndex].GetData() + offset;
+	if (m_mmapReadIntoHandle && m_mappedFile[fileIndex].IsPadded()) {
+		void * ptrs[4] = { nullptr };
+		for (vx_uint32 plane = 0; plane < (vx_uint32)m_planes; plane++)
+			ptrs[plane] = frame + m_mappedPlaneOffset[plane];
+		vx_status status = vxSwapImageHandle(m_image, ptrs, nullptr, m_planes);
+		if (status)
+			ReportError("ERROR: vxSwapImageHandle(%s,*,*,%d) failed (%d)\n", m_vxObjName, (int)m_planes, status);
+	}
+	else {
+		ReadImageFromBuffer(m_image, &m_rectFull, frame);
+	}
+	m_mappedFrameIndex++;
+
+	// unmap the previous file after switching to the next one
+	if (fileIndex != m_mappedFileActive) {
+		m_mappedFile[m_mappedFileActive].Close();
+		m_mappedFileActive = fileIndex;
+	}
+
+	return 0;
+}
+
+// read a frame into m_asyncReadBuf and, when handle >= 0, into the specified handle set
+// runs on m_asyncReader thread: returns 0 on SUCCESS, 1 on EOF, and -1 when input file can't be opened
+int CVxParamImage::ReadFrameAsync(int frameNumber, int handle)
+{
+	if (!m_fpRead) {
+		char fileName[MAX_FILE_NAME_LENGTH];
+		sprintf(fileName, m_fileNameRead.c_str(), frameNumber, m_width, m_height);
+		m_fpRead = fopen(fileName, "rb");
+		if (!m_fpRead)
+			return -1;
+		if (!m_fileNameForReadHasIndex && m_captureFrameStart > 0) {
+			// skip to specified frame when starting frame is specified
+			fseek(m_fpRead, m_captureFrameStart*(long)m_frameSize, SEEK_SET);
+		}
+	}
+
+	// update m_countFrames to be able to repeat after every m_repeatFrames
+	if (m_repeatFrames != 0) {
+		if (m_countFrames == m_repeatFrames) {
+			// seek back to beginning after every m_repeatFrames frames
+			fseek(m_fpRead, m_captureFrameStart*(long)m_frameSize, SEEK_SET);
+			m_countFrames = 0;
+		}
+		else {
+			m_countFrames++;
+		}
+	}
+
+	// read the whole frame and close file if file names has indices
+	bool eofDetected = fread(m_asyncReadBuf, 1, m_frameSize, m_fpRead) != m_frameSize;
+	if (m_fileNameForReadHasIndex) {
+		fclose(m_fpRead);
+		m_fpRead = nullptr;
+	}
+	if (eofDetected)
+		return 1;
+
+	// scatter rows into the handle set using the same layout as ReadImage
+	if (handle >= 0) {
+		const vx_uint8 * src = m_asyncReadBuf;
+		for (vx_uint32 plane = 0; plane < (vx_uint32)m_planes; plane++) {
+			const vx_imagepatch_addressing_t * addr = &m_asyncPlaneAddr[plane];
+			for (vx_uint32 y = 0; y < addr->dim_y; y += addr->step_y) {
+				vx_uint8 * dst = (vx_uint8 *)vxFormatImagePatchAddress2d(m_memory_handle[handle][plane], 0, y, addr);
+				memcpy(dst, src, m_asyncPlaneWidthInBytes[plane]);
+				src += m_asyncPlaneWidthInBytes[plane];
+			}
+		}
+	}
+	return 0;
+}
+
+// discard the prefetched input frame, if any, so that a later ReadFrame continues from the same frame
+void CVxParamImage::DiscardPrefetchedFrame()
+{
+	if (m_asyncReadFrameNumber >= 0) {
+		if (m_asyncReader.Wait() == 0 && m_fpRead && !m_fileNameForReadHasIndex)
+			fseek(m_fpRead, -(long)m_frameSize, SEEK_CUR);
+		// the prefetch also advanced the repeat counter
+		m_countFrames = m_asyncReadCountFrames;
+		m_asyncReadFrameNumber = -1;
+		m_asyncReadHandle = -1;
+	}
+}
+
+int CVxParamImage::FlushFrame()
+{
+	DiscardPrefetchedFrame();
+	// complete pending writes and compares
+	int status = m_asyncWriter.Wait();
+	int compareStatus = m_asyncComparer.Wait();
+	return status < 0 ? status : compareStatus;
+}
+
 #if ENABLE_OPENCV
 int CVxParamImage::ViewFrame(int frameNumber)
 {
@@ -1171,7 +1435,26 @@ int CVxParamImage::WriteFrame(int frameNumber)
 		}
 	}
 
-	if (m_fpWrite) {
+	if (m_fpWrite && m_asyncFrameIO) {
+		// copy vx_image into m_asyncWriteBuf after the previous write is done and write it on m_asyncWriter thread
+		if (m_asyncWriter.Wait() < 0)
+			return -1;
+		if (!m_asyncWriteBuf) {
+			NULLPTR_CHECK(m_asyncWriteBuf = new vx_uint8[m_frameSize]);
+		}
+		WriteImageToBuffer(m_image, &m_rectFull, m_asyncWriteBuf);
+		FILE * fp = m_fpWrite;
+		bool closeFile = m_fileNameForWriteHasIndex;
+		if (closeFile)
+			m_fpWrite = nullptr;
+		m_asyncWriter.Submit([=]() {
+			fwrite(m_asyncWriteBuf, 1, m_frameSize, fp);
+			if (closeFile)
+				fclose(fp);
+			return 0;
+		});
+	}
+	else if (m_fpWrite) {
 		// write vx_image into file
 		WriteImage(m_image, &m_rectFull, m_fpWrite);
 
@@ -1187,6 +1470,12 @@ int CVxParamImage::WriteFrame(int frameNumber)
 
 int CVxParamImage::CompareFrame(int frameNumber)
 {
+	// with async frame I/O, get status of the compare of previous frame before reusing the compare file and snapshot
+	if (m_asyncFrameIO) {
+		if (m_asyncComparer.Wait() < 0)
+			return -1;
+	}
+
 	// make sure that compare reference data is opened
 	if (!m_fpCompare) {
 		if (m_fileNameCompare.length() > 0) {
@@ -1203,21 +1492,75 @@ int CVxParamImage::CompareFrame(int frameNumber)
 	}
 	if (!m_fpCompare) return 0;
 
+	if (m_asyncFrameIO) {
+		// take a snapshot of vx_image and compare it on m_asyncComparer thread
+		if (!m_asyncCompareImage) {
+			m_asyncCompareImage = vxCreateImage(vxGetContext((vx_reference)m_image), m_width, m_height, m_format);
+			ERROR_CHECK(vxGetStatus((vx_reference)m_asyncCompareImage));
+		}
+		for (vx_uint32 plane = 0; plane < (vx_uint32)m_planes; plane++) {
+			vx_imagepatch_addressing_t addr = { 0 }, addrSnapshot = { 0 };
+			vx_uint8 * src = NULL, * dst = NULL;
+			ERROR_CHECK(vxAccessImagePatch(m_image, &m_rectFull, plane, &addr, (void **)&src, VX_READ_ONLY));
+			ERROR_CHECK(vxAccessImagePatch(m_asyncCompareImage, &m_rectFull, plane, &addrSnapshot, (void **)&dst, VX_WRITE_ONLY));
+			for (vx_uint32 y = 0; y < addr.dim_y; y += addr.step_y) {
+				memcpy(vxFormatImagePatchAddress2d(dst, 0, y, &addrSnapshot), vxFormatImagePatchAddress2d(src, 0, y, &addr), m_asyncPlaneWidthInBytes[plane]);
+			}
+			ERROR_CHECK(vxCommitImagePatch(m_asyncCompareImage, &m_rectFull, plane, &addrSnapshot, dst));
+			ERROR_CHECK(vxCommitImagePatch(m_image, &m_rectFull, plane, &addr, src));
+		}
+		FILE * fp = m_fpCompare;
+		bool closeFile = m_fileNameForCompareHasIndex;
+		if (closeFile)
+			m_fpCompare = nullptr;
+		m_asyncComparer.Submit([=]() {
+			int status = CompareFrameWithReference(m_asyncCompareImage, frameNumber, fp);
+			if (closeFile)
+				fclose(fp);
+			return status;
+		});
+		return 0;
+	}
+
+	int status = CompareFrameWithReference(m_image, frameNumber, m_fpCompare);
+	if (status < 0)
+		return status;
+
+	// close the file if user requested separate file for each compare data
+	if (m_fileNameForCompareHasIndex) {
+		fclose(m_fpCompare);
+		m_fpCompare = nullptr;
+	}
+
+	return 0;
+}
+
+// compare image with reference data from fp (or generate checksum into fp)
+//   returns -1 on mismatch unless compare errors are discarded
+int CVxParamImage::CompareFrameWithReference(vx_image image, int frameNumber, FILE * fp)
+{
 	if (m_generateCheckSumForCompare)
 	{ // generate checksum //////////////////////////////////////////
 		char checkSumString[64];
-		ComputeChecksum(checkSumString, m_image, &m_rectCompare);
-		fprintf(m_fpCompare, "%s\n", checkSumString);
+		if (m_generateCheckSum64ForCompare)
+			ComputeChecksum64(checkSumString, image, &m_rectCompare);
+		else
+			ComputeChecksum(checkSumString, image, &m_rectCompare);
+		fprintf(fp, "%s\n", checkSumString);
 	}
 	else if (m_useCheckSumForCompare)
 	{ // compare checksum //////////////////////////////////////////
 		char checkSumStringRef[64] = { 0 };
-		if (fscanf(m_fpCompare, "%s", checkSumStringRef) != 1) {
+		if (fscanf(fp, "%s", checkSumStringRef) != 1) {
 			printf("ERROR: image checksum missing for frame#%d in %s\n", frameNumber, m_fileNameCompareCurrent);
 			throw - 1;
 		}
+		// reference with 16 hex digits is a 64-bit checksum, otherwise MD5
 		char checkSumString[64];
-		ComputeChecksum(checkSumString, m_image, &m_rectCompare);
+		if (strlen(checkSumStringRef) == 16)
+			ComputeChecksum64(checkSumString, image, &m_rectCompare);
+		else
+			ComputeChecksum(checkSumString, image, &m_rectCompare);
 		if (!strcmp(checkSumString, checkSumStringRef)) {
 			m_compareCountMatches++;
 			if (m_verbose) printf("OK: image CHECKSUM MATCHED for %s with frame#%d of %s\n", GetVxObjectName(), frameNumber, m_fileNameCompareCurrent);
@@ -1235,12 +1578,12 @@ int CVxParamImage::CompareFrame(int frameNumber)
 			NULLPTR_CHECK(m_bufForCompare = new vx_uint8[m_frameSize]);
 		}
 		// read data from frame
-		if (m_frameSize != fread(m_bufForCompare, 1, m_frameSize, m_fpCompare)) {
+		if (m_frameSize != fread(m_bufForCompare, 1, m_frameSize, fp)) {
 			// no more data to compare
 			ReportError("ERROR: image data missing for frame#%d in %s\n", frameNumber, m_fileNameCompareCurrent);
 		}
 		// compare image to reference from file
-		size_t errorPixelCountTotal = CompareImage(m_image, &m_rectCompare, m_bufForCompare, m_comparePixelErrorMin, m_comparePixelErrorMax, frameNumber, m_fileNameCompareCurrent);
+		size_t errorPixelCountTotal = CompareImage(image, &m_rectCompare, m_bufForCompare, m_comparePixelErrorMin, m_comparePixelErrorMax, frameNumber, m_fileNameCompareCurrent);
 		if (!errorPixelCountTotal) {
 			m_compareCountMatches++;
 			if (m_verbose) printf("OK: image COMPARE MATCHED for %s with frame#%d of %s\n", GetVxObjectName(), frameNumber, m_fileNameCompareCurrent);
@@ -1251,11 +1594,5 @@ int CVxParamImage::CompareFrame(int frameNumber)
 		}
 	}
 
-	// close the file if user requested separate file for each compare data
-	if (m_fileNameForCompareHasIndex) {
-		fclose(m_fpCompare);
-		m_fpCompare = nullptr;
-	}
-
 	return 0;
 }
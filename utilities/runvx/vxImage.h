@@ -40,6 +40,7 @@ public:
 	virtual int ReadFrame(int frameNumber);
 	virtual int WriteFrame(int frameNumber);
 	virtual int CompareFrame(int frameNumber);
+	virtual int FlushFrame();
 	virtual int Shutdown();
 	virtual void DisableWaitForKeyPress();
 
@@ -47,6 +48,10 @@ protected:
 #if ENABLE_OPENCV
 	int ViewFrame(int frameNumber);
 #endif
+	int ReadFrameAsync(int frameNumber, int handle);
+	void DiscardPrefetchedFrame();
+	int ReadFrameMapped(int frameNumber);
+	int CompareFrameWithReference(vx_image image, int frameNumber, FILE * fp);
 
 private:
 	// vx configuration
@@ -87,6 +92,7 @@ private:
 	vx_uint8 * m_bufForCompare;
 	bool m_useCheckSumForCompare;
 	bool m_generateCheckSumForCompare;
+	bool m_generateCheckSum64ForCompare;
 	char m_fileNameCompareCurrent[256];
 	int m_compareCountMatches;
 	int m_compareCountMismatches;
@@ -100,6 +106,28 @@ private:
 	int m_countInitializeIO;
 	int m_colorIndexDefault;
 	float m_radiusDefault;
+
+	// async frame I/O
+	CAsyncWorker m_asyncReader;
+	CAsyncWorker m_asyncWriter;
+	CAsyncWorker m_asyncComparer;
+	int m_asyncReadFrameNumber;    // frame being prefetched by m_asyncReader (-1 if none)
+	int m_asyncReadHandle;         // handle set being prefetched into (-1 when prefetched into m_asyncReadBuf)
+	int m_asyncReadCountFrames;    // m_countFrames before the prefetch, restored when the prefetched frame is discarded
+	bool m_asyncReadIntoHandle;    // host image created from two handle sets: prefetch directly into inactive set
+	vx_imagepatch_addressing_t m_asyncPlaneAddr[4];
+	vx_size m_asyncPlaneWidthInBytes[4];
+	vx_uint8 * m_asyncReadBuf;
+	vx_uint8 * m_asyncWriteBuf;
+	vx_image m_asyncCompareImage;  // snapshot of m_image being compared by m_asyncComparer
+
+	// memory-mapped frame input
+	bool m_mmapRead;               // read option "mmap": map the input file instead of reading frames
+	bool m_mmapReadIntoHandle;     // host image created from handle with packed planes: point the image at frames in the mapped file
+	CMappedFile m_mappedFile[2];   // current file and, with indexed file names, the next file being switched to
+	int m_mappedFileActive;
+	size_t m_mappedFrameIndex;     // index of the next frame in the mapped file
+	size_t m_mappedPlaneOffset[4];
 };
 
 
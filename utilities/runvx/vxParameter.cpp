@@ -55,6 +55,7 @@ CVxParameter::CVxParameter()
 	m_fpCompare = nullptr;
 	m_verbose = false;
 	m_discardCompareErrors = false;
+	m_asyncFrameIO = false;
 	m_usingMultiFrameCapture = false;
 	m_captureFrameStart = false;
 	m_isVirtualObject = false;
@@ -106,6 +107,11 @@ int CVxParameter::SyncFrame(int frameNumber)
 	return 0;
 }
 
+int CVxParameter::FlushFrame()
+{
+	return 0;
+}
+
 list<CVxParameter *> CVxParameter::m_paramList;
 
 ///////////////////////////////////////////////////////////////////
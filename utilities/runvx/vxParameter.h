@@ -48,6 +48,7 @@ public:
 	void SetCaptureFrameStart(vx_uint32 frameStart) { m_captureFrameStart = frameStart; }
 	void SetVerbose(bool verbose) { m_verbose = verbose; }
 	void SetDiscardCompareErrors(bool discardCompareErrors) { m_discardCompareErrors = discardCompareErrors; }
+	void SetAsyncFrameIO(bool asyncFrameIO) { m_asyncFrameIO = asyncFrameIO; }
 	bool IsVirtualObject() { return m_isVirtualObject; }
 
 	// Initialize: create OpenVX object and further uses InitializeIO to input/output initialization
@@ -75,11 +76,17 @@ public:
 	// frame-level sync, read, write, and compare
 	//   returns 0 on SUCCESS, else error code
 	//   ReadFrame() returns +ve value to indicate data unavailability
+	//   with async frame I/O, ReadFrame() prefetches the next frame, WriteFrame() and CompareFrame()
+	//   complete in background and CompareFrame() reports errors of the previous frame
 	virtual int SyncFrame(int frameNumber);
 	virtual int ReadFrame(int frameNumber) = 0;
 	virtual int WriteFrame(int frameNumber) = 0;
 	virtual int CompareFrame(int frameNumber) = 0;
 
+	// FlushFrame: wait for pending async frame I/O and discard unused prefetched input
+	//   returns 0 on SUCCESS, else error code of the pending writes and compares
+	virtual int FlushFrame();
+
 	// helper functions
 	//   GetDisplayName -- returns DISPLAY name specified as part of ":W,DISPLAY-<name>" I/O request
 	//   DisableWaitForKeyPress -- mark that there is no need to wait at the end 
@@ -117,6 +124,7 @@ protected:
 	FILE * m_fpCompare;
 	bool m_verbose;
 	bool m_discardCompareErrors;
+	bool m_asyncFrameIO;
 	bool m_isVirtualObject;
 	bool m_useSyncOpenCLWriteDirective;
 	// for multi-frame capture support
@@ -49,6 +49,7 @@ CVxParamPyramid::CVxParamPyramid()
 	m_fpCompareImage = nullptr;
 	m_useCheckSumForCompare = false;
 	m_generateCheckSumForCompare = false;
+	m_generateCheckSum64ForCompare = false;
 }
 
 CVxParamPyramid::~CVxParamPyramid()
@@ -161,7 +162,7 @@ int CVxParamPyramid::InitializeIO(vx_context context, vx_graph graph, vx_referen
 			if (!m_fileNameForWriteHasIndex) ReportError("ERROR: invalid pyramid output fileName (expects %%d format for each level): %s\n", ioType);
 		}
 		else if (!_stricmp(ioType, "compare"))
-		{ // compare syntax: compare,fileName[,rect{<start-x>;<start-y>;<end-x>;<end-y>}][,err{<min>;<max>}][,checksum|checksum-save-instead-of-test]
+		{ // compare syntax: compare,fileName[,rect{<start-x>;<start-y>;<end-x>;<end-y>}][,err{<min>;<max>}][,checksum|checksum-save-instead-of-test|checksum64-save-instead-of-test]
 			// save the reference image fileName
 			m_fileNameCompare.assign(RootDirUpdated(fileName));
 			m_fileNameForCompareHasIndex = (m_fileNameCompare.find("%") != m_fileNameCompare.npos) ? true : false;
@@ -176,7 +177,7 @@ int CVxParamPyramid::InitializeIO(vx_context context, vx_graph graph, vx_referen
 			m_rectCompare.end_y = m_height;
 			while (*io_params == ',') {
 				char option[64];
-				io_params = ScanParameters(io_params, ",rect{<start-x>;<start-y>;<end-x>;<end-y>}|err{<min>;<max>}|checksum|checksum-save-instead-of-test", ",s", option);
+				io_params = ScanParameters(io_params, ",rect{<start-x>;<start-y>;<end-x>;<end-y>}|err{<min>;<max>}|checksum|checksum-save-instead-of-test|checksum64-save-instead-of-test", ",s", option);
 				if (!_strnicmp(option, "rect", 4)) {
 					ScanParameters(option + 4, "{<start-x>;<start-y>;<end-x>;<end-y>}", "{d;d;d;d}", &m_rectCompare.start_x, &m_rectCompare.start_y, &m_rectCompare.end_x, &m_rectCompare.end_y);
 				}
@@ -191,6 +192,10 @@ int CVxParamPyramid::InitializeIO(vx_context context, vx_graph graph, vx_referen
 				else if (!_stricmp(option, "checksum-save-instead-of-test")) {
 					m_generateCheckSumForCompare = true;
 				}
+				else if (!_stricmp(option, "checksum64-save-instead-of-test")) {
+					m_generateCheckSumForCompare = true;
+					m_generateCheckSum64ForCompare = true;
+				}
 				else ReportError("ERROR: invalid compare option: %s\n", option);
 			}
 		}
@@ -355,7 +360,10 @@ int CVxParamPyramid::CompareFrame(int frameNumber)
 		if (m_generateCheckSumForCompare)
 		{ // generate checksum //////////////////////////////////////////
 			char checkSumString[64];
-			ComputeChecksum(checkSumString, image, &m_rectCompareLevel[level]);
+			if (m_generateCheckSum64ForCompare)
+				ComputeChecksum64(checkSumString, image, &m_rectCompareLevel[level]);
+			else
+				ComputeChecksum(checkSumString, image, &m_rectCompareLevel[level]);
 			fprintf(fp, "%s\n", checkSumString);
 		}
 		else if (m_useCheckSumForCompare)
@@ -365,8 +373,12 @@ int CVxParamPyramid::CompareFrame(int frameNumber)
 				printf("ERROR: pyramid level#%d checksum missing for %s with frame#%d\n", level, GetVxObjectName(), frameNumber);
 				throw - 1;
 			}
+			// reference with 16 hex digits is a 64-bit checksum, otherwise MD5
 			char checkSumString[64];
-			ComputeChecksum(checkSumString, image, &m_rectCompareLevel[level]);
+			if (strlen(checkSumStringRef) == 16)
+				ComputeChecksum64(checkSumString, image, &m_rectCompareLevel[level]);
+			else
+				ComputeChecksum(checkSumString, image, &m_rectCompareLevel[level]);
 			if (!strcmp(checkSumString, checkSumStringRef)) {
 				m_compareCountMatches++;
 				if (m_verbose) printf("OK: pyramid level#%d CHECKSUM MATCHED for %s with frame#%d\n", level, GetVxObjectName(), frameNumber);
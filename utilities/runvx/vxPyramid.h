@@ -59,6 +59,7 @@ private:
 	vx_uint8 * m_bufForCompare;
 	bool m_useCheckSumForCompare;
 	bool m_generateCheckSumForCompare;
+	bool m_generateCheckSum64ForCompare;
 	int m_compareCountMatches;
 	int m_compareCountMismatches;
 	size_t m_pyramidFrameSize;
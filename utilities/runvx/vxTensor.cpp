@@ -23,6 +23,39 @@ THE SOFTWARE.
 #define _CRT_SECURE_NO_WARNINGS
 #include "vxTensor.h"
 
+///////////////////////////////////////////////////////////////////////
+// <template>CompareTensorRows -- compares rows (along dims[0]) of tensor data with reference in parallel
+//   accumulates max and sum of squares of absolute error; rows that are bitwise identical are skipped
+//   toValue converts an element into ValueType used for error computation
+template<typename ElemType, typename ValueType, typename SumType, typename ToValue>
+static void CompareTensorRows(const vx_size * dims, const vx_uint8 * ptr, const vx_size * stride, const vx_uint8 * refData, const vx_size * refStride,
+	ToValue toValue, ValueType& maxError, SumType& sumError)
+{
+	std::mutex mutex;
+	maxError = 0;
+	sumError = 0;
+	RunParallel(dims[1] * dims[2] * dims[3], dims[0] * sizeof(ElemType), [&](size_t start, size_t end) {
+		ValueType rangeMaxError = 0;
+		SumType rangeSumError = 0;
+		for (size_t row = start; row < end; row++) {
+			vx_size d1 = row % dims[1], d2 = (row / dims[1]) % dims[2], d3 = row / (dims[1] * dims[2]);
+			const ElemType * buf1 = (const ElemType *)(ptr + stride[3] * d3 + stride[2] * d2 + stride[1] * d1);
+			const ElemType * buf2 = (const ElemType *)(refData + refStride[3] * d3 + refStride[2] * d2 + refStride[1] * d1);
+			if (!memcmp(buf1, buf2, dims[0] * sizeof(ElemType)))
+				continue;
+			for (vx_size d0 = 0; d0 < dims[0]; d0++) {
+				ValueType d = toValue(buf1[d0]) - toValue(buf2[d0]);
+				d = (d < 0) ? -d : d;
+				rangeMaxError = (d > rangeMaxError) ? d : rangeMaxError;
+				rangeSumError += (SumType)d * d;
+			}
+		}
+		std::lock_guard<std::mutex> lock(mutex);
+		maxError = (rangeMaxError > maxError) ? rangeMaxError : maxError;
+		sumError += rangeSumError;
+	});
+}
+
 ///////////////////////////////////////////////////////////////////////
 // class CVxParamTensor
 //
@@ -51,6 +84,16 @@ CVxParamTensor::CVxParamTensor()
 	m_vxObjRef = nullptr;
 	m_data = nullptr;
 	m_size = 0;
+	// async frame I/O
+	m_asyncReadFrameNumber = -1;
+	m_asyncReadBuf = nullptr;
+	m_asyncWriteBuf = nullptr;
+	m_asyncCompareBuf = nullptr;
+	m_asyncCompareRefBuf = nullptr;
+	m_mmapRead = false;
+	m_mmapReadIntoHandle = false;
+	memset(m_handleStride, 0, sizeof(m_handleStride));
+	m_mappedFileActive = 0;
 }
 
 CVxParamTensor::~CVxParamTensor()
@@ -60,9 +103,24 @@ CVxParamTensor::~CVxParamTensor()
 
 int CVxParamTensor::Shutdown(void)
 {
+	// complete pending async frame I/O before releasing buffers
+	FlushFrame();
+	vx_uint8 ** asyncBufList[] = { &m_asyncReadBuf, &m_asyncWriteBuf, &m_asyncCompareBuf, &m_asyncCompareRefBuf };
+	for (auto buf : asyncBufList) {
+		if (*buf) {
+			delete[] *buf;
+			*buf = nullptr;
+		}
+	}
 	if (m_compareCountMatches > 0 && m_compareCountMismatches == 0) {
 		printf("OK: tensor COMPARE MATCHED for %d frame(s) of %s\n", m_compareCountMatches, GetVxObjectName());
 	}
+	if (m_tensor && m_mmapReadIntoHandle && m_mappedFile[m_mappedFileActive].IsOpen()) {
+		// point the tensor back to its own buffer before unmapping the input file
+		vxSwapTensorHandle(m_tensor, m_memory_handle[m_active_handle], nullptr);
+	}
+	m_mappedFile[0].Close();
+	m_mappedFile[1].Close();
 	if (m_tensor) {
 		vxReleaseTensor(&m_tensor);
 		m_tensor = nullptr;
@@ -140,6 +198,7 @@ int CVxParamTensor::Initialize(vx_context context, vx_graph graph, const char *
 		if(m_num_handles > MAX_BUFFER_HANDLES)
 			ReportError("ERROR: num-handles is out of range: " VX_FMT_SIZE " (must be less than %d)\n", m_num_handles, MAX_BUFFER_HANDLES);
 		m_data_type = ovxName2Enum(data_type);
+		memcpy(m_handleStride, m_stride, sizeof(m_handleStride));
 		vx_uint64 memory_type = 0;
 		if (GetScalarValueFromString(VX_TYPE_ENUM, memory_type_str, &memory_type) < 0)
 			ReportError("ERROR: invalid memory type enum: %s\n", memory_type_str);
@@ -230,16 +289,20 @@ int CVxParamTensor::InitializeIO(vx_context context, vx_graph graph, vx_referenc
 		char ioType[64], fileName[256];
 		io_params = ScanParameters(io_params, "<io-operation>,<parameter>", "s,S", ioType, fileName);
 		if (!_stricmp(ioType, "read"))
-		{ // read request syntax: read,<fileName>[,ascii|binary]
+		{ // read request syntax: read,<fileName>[,ascii|binary|mmap]
 			m_fileNameRead.assign(RootDirUpdated(fileName));
 			m_fileNameForReadHasIndex = (m_fileNameRead.find("%") != m_fileNameRead.npos) ? true : false;
 			m_readFileIsBinary = true;
+			m_mmapRead = false;
 			while (*io_params == ',') {
 				char option[64];
-				io_params = ScanParameters(io_params, ",binary", ",s", option);
+				io_params = ScanParameters(io_params, ",binary|mmap", ",s", option);
 				if (!_stricmp(option, "binary")) {
 					m_readFileIsBinary = true;
 				}
+				else if (!_stricmp(option, "mmap")) {
+					m_mmapRead = true;
+				}
 				else ReportError("ERROR: invalid tensor read option: %s\n", option);
 			}
 		}
@@ -346,6 +409,10 @@ int CVxParamTensor::InitializeIO(vx_context context, vx_graph graph, vx_referenc
 
 int CVxParamTensor::Finalize()
 {
+	// check if memory-mapped input can be used directly as the handle: needs a single host handle with packed strides
+	m_mmapReadIntoHandle = m_mmapRead && m_memory_type == VX_MEMORY_TYPE_HOST && m_num_handles == 1 &&
+		!memcmp(m_handleStride, m_stride, m_num_of_dims * sizeof(m_stride[0]));
+
 	// process user requested directives
 	if (m_useSyncOpenCLWriteDirective) {
 		ERROR_CHECK_AND_WARN(vxDirective((vx_reference)m_tensor, VX_DIRECTIVE_AMD_COPY_TO_OPENCL), VX_ERROR_NOT_ALLOCATED);
@@ -377,7 +444,7 @@ int CVxParamTensor::ReadFrame(int frameNumber)
 
 	// for single frame reads, there is no need to read the array again
 	// as it is already read into the object
-	if (!m_fileNameForReadHasIndex && frameNumber != m_captureFrameStart) {
+	if (!m_fileNameForReadHasIndex && frameNumber != (int)m_captureFrameStart) {
 		return 0;
 	}
 
@@ -386,9 +453,57 @@ int CVxParamTensor::ReadFrame(int frameNumber)
 	if(!_stricmp(fileName + strlen(fileName) - 4, ".dat")) {
 		ReportError("ERROR: read from .dat files not supported: %s\n", fileName);
 	}
+	if (m_mmapRead) {
+		int status = ReadFrameMapped(frameNumber);
+		if (status < 0) {
+			if (frameNumber == (int)m_captureFrameStart) {
+				ReportError("ERROR: Unable to open: %s\n", fileName);
+			}
+			else {
+				return 1; // end of sequence detected for multiframe sequences
+			}
+		}
+		// process user requested directives
+		if (m_useSyncOpenCLWriteDirective) {
+			ERROR_CHECK_AND_WARN(vxDirective((vx_reference)m_tensor, VX_DIRECTIVE_AMD_COPY_TO_OPENCL), VX_ERROR_NOT_ALLOCATED);
+		}
+		return 0;
+	}
+	if (m_asyncFrameIO && m_fileNameForReadHasIndex) {
+		// files are read on m_asyncReader thread with the next frame prefetched while the graph processes this frame
+		if (!m_asyncReadBuf) {
+			NULLPTR_CHECK(m_asyncReadBuf = new vx_uint8[m_size]);
+		}
+		if (m_asyncReadFrameNumber != frameNumber) {
+			m_asyncReader.Submit([=]() { return ReadFrameAsync(frameNumber); });
+		}
+		int status = m_asyncReader.Wait();
+		m_asyncReadFrameNumber = -1;
+		if (status == -1) {
+			if (frameNumber == (int)m_captureFrameStart) {
+				ReportError("ERROR: Unable to open: %s\n", fileName);
+			}
+			else {
+				return 1; // end of sequence detected for multiframe sequences
+			}
+		}
+		else if (status < 0)
+			ReportError("ERROR: not enough data (%d bytes) in %s\n", (vx_uint32)m_size, fileName);
+		vx_status vxstatus = vxCopyTensorPatch(m_tensor, m_num_of_dims, nullptr, nullptr, m_stride, m_asyncReadBuf, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
+		if (vxstatus != VX_SUCCESS)
+			ReportError("ERROR: vxCopyTensorPatch: write failed (%d)\n", vxstatus);
+		int nextFrameNumber = frameNumber + 1;
+		m_asyncReader.Submit([=]() { return ReadFrameAsync(nextFrameNumber); });
+		m_asyncReadFrameNumber = nextFrameNumber;
+		// process user requested directives
+		if (m_useSyncOpenCLWriteDirective) {
+			ERROR_CHECK_AND_WARN(vxDirective((vx_reference)m_tensor, VX_DIRECTIVE_AMD_COPY_TO_OPENCL), VX_ERROR_NOT_ALLOCATED);
+		}
+		return 0;
+	}
 	FILE * fp = fopen(fileName, m_readFileIsBinary ? "rb" : "r");
 	if (!fp) {
-		if (frameNumber == m_captureFrameStart) {
+		if (frameNumber == (int)m_captureFrameStart) {
 			ReportError("ERROR: Unable to open: %s\n", fileName);
 		}
 		else {
@@ -410,16 +525,91 @@ int CVxParamTensor::ReadFrame(int frameNumber)
 	return 0;
 }
 
+// get tensor data from memory-mapped input file: host tensor created from handle points directly at
+// the mapped file, other tensors get a copy of it
+//   returns 0 on SUCCESS and -1 when file can't be opened
+int CVxParamTensor::ReadFrameMapped(int frameNumber)
+{
+	// the previous file stays mapped until the tensor no longer points at it
+	int fileIndex = m_mappedFile[m_mappedFileActive].IsOpen() ? !m_mappedFileActive : m_mappedFileActive;
+	char fileName[MAX_FILE_NAME_LENGTH]; sprintf(fileName, m_fileNameRead.c_str(), frameNumber);
+	if (m_mappedFile[fileIndex].Open(fileName) < 0)
+		return -1;
+	if (m_mappedFile[fileIndex].GetSize() < m_size)
+		ReportError("ERROR: not enough data (%d bytes) in %s\n", (vx_uint32)m_size, fileName);
+	if (m_mmapReadIntoHandle && m_mappedFile[fileIndex].IsPadded()) {
+		vx_status status = vxSwapTensorHandle(m_tensor, m_mappedFile[fileIndex].GetData(), nullptr);
+		if (status)
+			ReportError("ERROR: vxSwapTensorHandle(%s,*,*) failed (%d)\n", m_vxObjName, status);
+	}
+	else {
+		vx_status status = vxCopyTensorPatch(m_tensor, m_num_of_dims, nullptr, nullptr, m_stride, m_mappedFile[fileIndex].GetData(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST);
+		if (status != VX_SUCCESS)
+			ReportError("ERROR: vxCopyTensorPatch: write failed (%d)\n", status);
+		m_mappedFile[fileIndex].Close();
+		return 0;
+	}
+	if (fileIndex != m_mappedFileActive) {
+		m_mappedFile[m_mappedFileActive].Close();
+		m_mappedFileActive = fileIndex;
+	}
+	return 0;
+}
+
+// read a frame into m_asyncReadBuf on m_asyncReader thread
+//   returns 0 on SUCCESS, -1 when file can't be opened, and -2 when file doesn't have enough data
+int CVxParamTensor::ReadFrameAsync(int frameNumber)
+{
+	char fileName[MAX_FILE_NAME_LENGTH]; sprintf(fileName, m_fileNameRead.c_str(), frameNumber);
+	FILE * fp = fopen(fileName, m_readFileIsBinary ? "rb" : "r");
+	if (!fp)
+		return -1;
+	int status = (fread(m_asyncReadBuf, 1, m_size, fp) != m_size) ? -2 : 0;
+	fclose(fp);
+	return status;
+}
+
+int CVxParamTensor::FlushFrame()
+{
+	// discard the prefetched input frame, if any, and complete pending writes and compares
+	if (m_asyncReadFrameNumber >= 0) {
+		m_asyncReader.Wait();
+		m_asyncReadFrameNumber = -1;
+	}
+	int status = m_asyncWriter.Wait();
+	int compareStatus = m_asyncComparer.Wait();
+	return status < 0 ? status : compareStatus;
+}
+
 int CVxParamTensor::WriteFrame(int frameNumber)
 {
 	// check if there is no user request to write
 	if (m_fileNameWrite.length() < 1) return 0;
+	char fileName[MAX_FILE_NAME_LENGTH]; sprintf(fileName, m_fileNameWrite.c_str(), frameNumber);
+	if (m_asyncFrameIO) {
+		// copy tensor into m_asyncWriteBuf after the previous write is done and write it on m_asyncWriter thread
+		if (m_asyncWriter.Wait() < 0)
+			return -1;
+		if (!m_asyncWriteBuf) {
+			NULLPTR_CHECK(m_asyncWriteBuf = new vx_uint8[m_size]);
+		}
+		vx_status status = vxCopyTensorPatch(m_tensor, m_num_of_dims, nullptr, nullptr, m_stride, m_asyncWriteBuf, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+		if (status != VX_SUCCESS)
+			ReportError("ERROR: vxCopyTensorPatch: read failed (%d)\n", status);
+		std::string fileNameWrite = fileName;
+		m_asyncWriter.Submit([=]() { return WriteFrameToFile(fileNameWrite.c_str(), m_asyncWriteBuf); });
+		return 0;
+	}
 	// read data from tensor
 	vx_status status = vxCopyTensorPatch(m_tensor, m_num_of_dims, nullptr, nullptr, m_stride, m_data, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
 	if (status != VX_SUCCESS)
 		ReportError("ERROR: vxCopyTensorPatch: read failed (%d)\n", status);
 	// write data to output file
-	char fileName[MAX_FILE_NAME_LENGTH]; sprintf(fileName, m_fileNameWrite.c_str(), frameNumber);
+	return WriteFrameToFile(fileName, m_data);
+}
+
+int CVxParamTensor::WriteFrameToFile(const char * fileName, const vx_uint8 * data)
+{
 	FILE * fp = fopen(fileName, m_writeFileIsBinary ? "wb" : "w");
 	if (!fp) ReportError("ERROR: Unable to create: %s\n", fileName);
 	if(!_stricmp(fileName + strlen(fileName) - 4, ".dat")) {
@@ -472,7 +662,7 @@ int CVxParamTensor::WriteFrame(int frameNumber)
 		fwrite(&h2, 1, h1.num_dims * sizeof(vx_uint32), fp);
 		fwrite(&h3, 1, sizeof(h3), fp);
 	}
-	fwrite(m_data, 1, m_size, fp);
+	fwrite(data, 1, m_size, fp);
 	fclose(fp);
 
 	return 0;
@@ -483,6 +673,41 @@ int CVxParamTensor::CompareFrame(int frameNumber)
 	// check if there is no user request to compare
 	if (m_fileNameCompare.length() < 1) return 0;
 
+	if (m_asyncFrameIO) {
+		// report compare status of previous frame and compare a copy of this frame on m_asyncComparer thread
+		if (m_asyncComparer.Wait() < 0)
+			return -1;
+		if (!m_asyncCompareBuf) {
+			NULLPTR_CHECK(m_asyncCompareBuf = new vx_uint8[m_size]);
+			NULLPTR_CHECK(m_asyncCompareRefBuf = new vx_uint8[m_size]);
+		}
+		vx_status status = vxCopyTensorPatch(m_tensor, m_num_of_dims, nullptr, nullptr, m_stride, m_asyncCompareBuf, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+		if (status != VX_SUCCESS)
+			ReportError("ERROR: vxCopyTensorPatch: read failed (%d)\n", status);
+		m_asyncComparer.Submit([=]() { return CompareFrameWithReference(m_asyncCompareBuf, m_stride, m_asyncCompareRefBuf, frameNumber); });
+		return 0;
+	}
+
+	vx_map_id map_id;
+	vx_size stride[MAX_TENSOR_DIMENSIONS];
+	vx_uint8 * ptr;
+	vx_status status = vxMapTensorPatch(m_tensor, m_num_of_dims, nullptr, nullptr, &map_id, stride, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
+	if (status != VX_SUCCESS)
+		ReportError("ERROR: vxMapTensorPatch: read failed (%d)\n", status);
+
+	int compareStatus = CompareFrameWithReference(ptr, stride, m_data, frameNumber);
+
+	status = vxUnmapTensorPatch(m_tensor, map_id);
+	if (status != VX_SUCCESS)
+		ReportError("ERROR: vxUnmapTensorPatch: read failed (%d)\n", status);
+
+	return compareStatus;
+}
+
+// compare tensor data in ptr (with stride) with the reference file read into refData
+//   returns -1 on mismatch unless compare errors are discarded
+int CVxParamTensor::CompareFrameWithReference(const vx_uint8 * ptr, const vx_size * stride, vx_uint8 * refData, int frameNumber)
+{
 	// reading data from reference file
 	char fileName[MAX_FILE_NAME_LENGTH]; sprintf(fileName, m_fileNameCompare.c_str(), frameNumber);
 	if(!_stricmp(fileName + strlen(fileName) - 4, ".dat")) {
@@ -492,40 +717,16 @@ int CVxParamTensor::CompareFrame(int frameNumber)
 	if (!fp) {
 		ReportError("ERROR: Unable to open: %s\n", fileName);
 	}
-	if (fread(m_data, 1, m_size, fp) != m_size)
+	if (fread(refData, 1, m_size, fp) != m_size)
 		ReportError("ERROR: not enough data (%d bytes) in %s\n", (vx_uint32)m_size, fileName);
 	fclose(fp);
 
 	// compare
-	vx_map_id map_id;
-	vx_size stride[MAX_TENSOR_DIMENSIONS];
-	vx_uint8 * ptr;
-	vx_status status = vxMapTensorPatch(m_tensor, m_num_of_dims, nullptr, nullptr, &map_id, stride, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST);
-	if (status != VX_SUCCESS)
-		ReportError("ERROR: vxMapTensorPatch: read failed (%d)\n", status);
-
 	bool mismatchDetected = false;
 	if (m_data_type == VX_TYPE_INT16) {
 		vx_int32 maxError = 0;
 		vx_int64 sumError = 0;
-		for (vx_size d3 = 0; d3 < m_dims[3]; d3++) {
-			for (vx_size d2 = 0; d2 < m_dims[2]; d2++) {
-				for (vx_size d1 = 0; d1 < m_dims[1]; d1++) {
-					vx_size roffset = m_stride[3] * d3 + m_stride[2] * d2 + m_stride[1] * d1;
-					vx_size doffset = stride[3] * d3 + stride[2] * d2 + stride[1] * d1;
-					const vx_int16 * buf1 = (const vx_int16 *)(((vx_uint8 *)ptr) + doffset);
-					const vx_int16 * buf2 = (const vx_int16 *)(m_data + roffset);
-					for (vx_size d0 = 0; d0 < m_dims[0]; d0++) {
-						vx_int32 v1 = buf1[d0];
-						vx_int32 v2 = buf2[d0];
-						vx_int32 d = v1 - v2;
-						d = (d < 0) ? -d : d;
-						maxError = (d > maxError) ? d : maxError;
-						sumError += (long) d * d;
-					}
-				}
-			}
-		}
+		CompareTensorRows<vx_int16>(m_dims, ptr, stride, refData, m_stride, [](vx_int16 v) { return (vx_int32)v; }, maxError, sumError);
 		vx_size count = m_dims[0] * m_dims[1] * m_dims[2] * m_dims[3];
 		float avgError = (float)sumError / (float)count;
 		mismatchDetected = true;
@@ -536,61 +737,18 @@ int CVxParamTensor::CompareFrame(int frameNumber)
 		else if (m_verbose)
 			printf("OK: tensor COMPARE MATCHED [max-err: %d] [avg-err: %.6f] for %s with frame#%d of %s\n", maxError, avgError, GetVxObjectName(), frameNumber, fileName);
 	}
-	else if (m_data_type == VX_TYPE_FLOAT32) {
+	else if (m_data_type == VX_TYPE_FLOAT32 || m_data_type == VX_TYPE_FLOAT16) {
 		vx_float32 maxError = 0;
 		vx_float64 sumError = 0;
-		for (vx_size d3 = 0; d3 < m_dims[3]; d3++) {
-			for (vx_size d2 = 0; d2 < m_dims[2]; d2++) {
-				for (vx_size d1 = 0; d1 < m_dims[1]; d1++) {
-					vx_size roffset = m_stride[3] * d3 + m_stride[2] * d2 + m_stride[1] * d1;
-					vx_size doffset = stride[3] * d3 + stride[2] * d2 + stride[1] * d1;
-					const vx_float32 * buf1 = (const vx_float32 *)(((vx_uint8 *)ptr) + doffset);
-					const vx_float32 * buf2 = (const vx_float32 *)(m_data + roffset);
-					for (vx_size d0 = 0; d0 < m_dims[0]; d0++) {
-						vx_float32 v1 = buf1[d0];
-						vx_float32 v2 = buf2[d0];
-						vx_float32 d = v1 - v2;
-						d = (d < 0) ? -d : d;
-						maxError = (d > maxError) ? d : maxError;
-						sumError += (double) d * d;
-					}
-				}
-			}
+		if (m_data_type == VX_TYPE_FLOAT32) {
+			CompareTensorRows<vx_float32>(m_dims, ptr, stride, refData, m_stride, [](vx_float32 v) { return v; }, maxError, sumError);
 		}
-		vx_size count = m_dims[0] * m_dims[1] * m_dims[2] * m_dims[3];
-		float avgError = (float)sumError / (float)count;
-		mismatchDetected = true;
-		if ((maxError <= m_maxErrorLimit) && (avgError <= m_avgErrorLimit))
-		    mismatchDetected = false;
-		if (mismatchDetected)
-			printf("ERROR: tensor COMPARE MISMATCHED [max-err: %.6f] [avg-err: %.6f] for %s with frame#%d of %s\n", maxError, avgError, GetVxObjectName(), frameNumber, fileName);
-		else if (m_verbose)
-			printf("OK: tensor COMPARE MATCHED [max-err: %.6f] [avg-err: %.6f] for %s with frame#%d of %s\n", maxError, avgError, GetVxObjectName(), frameNumber, fileName);
-	}
-	else if (m_data_type == VX_TYPE_FLOAT16) {
-		vx_float32 maxError = 0;
-		vx_float64 sumError = 0;
-		for (vx_size d3 = 0; d3 < m_dims[3]; d3++) {
-			for (vx_size d2 = 0; d2 < m_dims[2]; d2++) {
-				for (vx_size d1 = 0; d1 < m_dims[1]; d1++) {
-					vx_size roffset = m_stride[3] * d3 + m_stride[2] * d2 + m_stride[1] * d1;
-					vx_size doffset = stride[3] * d3 + stride[2] * d2 + stride[1] * d1;
-					const vx_uint16 * buf1 = (const vx_uint16 *)(((vx_uint8 *)ptr) + doffset);
-					const vx_uint16 * buf2 = (const vx_uint16 *)(m_data + roffset);
-					for (vx_size d0 = 0; d0 < m_dims[0]; d0++) {
-						vx_uint16 h1 = buf1[d0];
-						vx_uint16 h2 = buf2[d0];
-						vx_uint32 d1 = ((h1 & 0x8000) << 16) | (((h1 & 0x7c00) + 0x1c000) << 13) | ((h1 & 0x03ff) << 13);
-						vx_uint32 d2 = ((h2 & 0x8000) << 16) | (((h2 & 0x7c00) + 0x1c000) << 13) | ((h2 & 0x03ff) << 13);
-						vx_float32 v1 = *(float *)&d1;
-						vx_float32 v2 = *(float *)&d2;
-						vx_float32 d = v1 - v2;
-						d = (d < 0) ? -d : d;
-						maxError = (d > maxError) ? d : maxError;
-						sumError += (double) d * d;
-					}
-				}
-			}
+		else {
+			CompareTensorRows<vx_uint16>(m_dims, ptr, stride, refData, m_stride, [](vx_uint16 h) {
+				vx_uint32 d = ((h & 0x8000) << 16) | (((h & 0x7c00) + 0x1c000) << 13) | ((h & 0x03ff) << 13);
+				vx_float32 v; memcpy(&v, &d, sizeof(v));
+				return v;
+			}, maxError, sumError);
 		}
 		vx_size count = m_dims[0] * m_dims[1] * m_dims[2] * m_dims[3];
 		float avgError = (float)sumError / (float)count;
@@ -603,32 +761,24 @@ int CVxParamTensor::CompareFrame(int frameNumber)
 			printf("OK: tensor COMPARE MATCHED [max-err: %.6f] [avg-err: %.6f] for %s with frame#%d of %s\n", maxError, avgError, GetVxObjectName(), frameNumber, fileName);
 	}
 	else {
-		for (vx_size d3 = 0; d3 < m_dims[3]; d3++) {
-			for (vx_size d2 = 0; d2 < m_dims[2]; d2++) {
-				for (vx_size d1 = 0; d1 < m_dims[1]; d1++) {
-					vx_size roffset = m_stride[3] * d3 + m_stride[2] * d2 + m_stride[1] * d1;
-					vx_size doffset = stride[3] * d3 + stride[2] * d2 + stride[1] * d1;
-					if (memcpy(((vx_uint8 *)ptr) + doffset, m_data + roffset, stride[0] * m_dims[0])) {
-						mismatchDetected = true;
-						break;
-					}
+		std::atomic<bool> mismatchFound(false);
+		RunParallel(m_dims[1] * m_dims[2] * m_dims[3], stride[0] * m_dims[0], [&](size_t start, size_t end) {
+			for (size_t row = start; row < end && !mismatchFound; row++) {
+				vx_size d1 = row % m_dims[1], d2 = (row / m_dims[1]) % m_dims[2], d3 = row / (m_dims[1] * m_dims[2]);
+				vx_size roffset = m_stride[3] * d3 + m_stride[2] * d2 + m_stride[1] * d1;
+				vx_size doffset = stride[3] * d3 + stride[2] * d2 + stride[1] * d1;
+				if (memcmp(ptr + doffset, refData + roffset, stride[0] * m_dims[0])) {
+					mismatchFound = true;
 				}
-				if (mismatchDetected)
-					break;
 			}
-			if (mismatchDetected)
-				break;
-		}
+		});
+		mismatchDetected = mismatchFound;
 		if (mismatchDetected)
 			printf("ERROR: tensor COMPARE MISMATCHED for %s with frame#%d of %s\n", GetVxObjectName(), frameNumber, fileName);
 		else if (m_verbose) 
 			printf("OK: tensor COMPARE MATCHED for %s with frame#%d of %s\n", GetVxObjectName(), frameNumber, fileName);
 	}
 
-	status = vxUnmapTensorPatch(m_tensor, map_id);
-	if (status != VX_SUCCESS)
-		ReportError("ERROR: vxUnmapTensorPatch: read failed (%d)\n", status);
-
 	// report error if mismatched
 	if (mismatchDetected) {
 		m_compareCountMismatches++;
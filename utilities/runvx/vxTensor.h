@@ -42,8 +42,15 @@ public:
 	virtual int ReadFrame(int frameNumber);
 	virtual int WriteFrame(int frameNumber);
 	virtual int CompareFrame(int frameNumber);
+	virtual int FlushFrame();
 	virtual int Shutdown();
 
+protected:
+	int ReadFrameAsync(int frameNumber);
+	int ReadFrameMapped(int frameNumber);
+	int WriteFrameToFile(const char * fileName, const vx_uint8 * data);
+	int CompareFrameWithReference(const vx_uint8 * ptr, const vx_size * stride, vx_uint8 * refData, int frameNumber);
+
 private:
 	// vx configuration
 	vx_size m_num_of_dims;
@@ -69,6 +76,21 @@ private:
 	vx_size m_num_handles;
 	vx_size m_active_handle;
 	void * m_memory_handle[MAX_BUFFER_HANDLES];
+	// async frame I/O
+	CAsyncWorker m_asyncReader;
+	CAsyncWorker m_asyncWriter;
+	CAsyncWorker m_asyncComparer;
+	int m_asyncReadFrameNumber;    // frame being prefetched by m_asyncReader (-1 if none)
+	vx_uint8 * m_asyncReadBuf;
+	vx_uint8 * m_asyncWriteBuf;
+	vx_uint8 * m_asyncCompareBuf;
+	vx_uint8 * m_asyncCompareRefBuf;
+	// memory-mapped input
+	bool m_mmapRead;               // read option "mmap": map the input file instead of reading it
+	bool m_mmapReadIntoHandle;     // host tensor created from single handle with packed strides: point the tensor at the mapped file
+	vx_size m_handleStride[MAX_TENSOR_DIMENSIONS];
+	CMappedFile m_mappedFile[2];   // current file and the next file being switched to
+	int m_mappedFileActive;
 };
 
 #endif /* __VX_TENSOR_H__ */
@@ -376,6 +376,306 @@ void CHasher::Shutdown(){
 #endif
 }
 
+CMappedFile::CMappedFile()
+{
+	m_isOpen = false;
+	m_data = nullptr;
+	m_size = 0;
+#if _WIN32
+	m_hFile = INVALID_HANDLE_VALUE;
+	m_hMapping = NULL;
+#else
+	m_mapSize = 0;
+#endif
+}
+
+CMappedFile::~CMappedFile()
+{
+	Close();
+}
+
+int CMappedFile::Open(const char * fileName)
+{
+	Close();
+#if _WIN32
+	m_hFile = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (m_hFile == INVALID_HANDLE_VALUE)
+		return -1;
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(m_hFile, &fileSize)) {
+		Close();
+		return -1;
+	}
+	m_size = (size_t)fileSize.QuadPart;
+	if (m_size > 0) {
+		m_hMapping = CreateFileMappingA(m_hFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+		if (m_hMapping)
+			m_data = (vx_uint8 *)MapViewOfFile(m_hMapping, FILE_MAP_COPY, 0, 0, 0);
+		if (!m_data) {
+			Close();
+			return -1;
+		}
+	}
+#else
+	int fd = open(fileName, O_RDONLY);
+	if (fd < 0)
+		return -1;
+	struct stat fileStat;
+	if (fstat(fd, &fileStat) < 0) {
+		close(fd);
+		return -1;
+	}
+	m_size = (size_t)fileStat.st_size;
+	if (m_size > 0) {
+		// reserve zero pages after the end of file, since SIMD kernels may read a few bytes past the end of their input
+		size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+		m_mapSize = (m_size + pageSize - 1) / pageSize * pageSize + pageSize;
+		void * data = mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (data != MAP_FAILED && mmap(data, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+			munmap(data, m_mapSize);
+			data = MAP_FAILED;
+		}
+		if (data == MAP_FAILED) {
+			close(fd);
+			m_size = m_mapSize = 0;
+			return -1;
+		}
+		madvise(data, m_size, MADV_SEQUENTIAL);
+		m_data = (vx_uint8 *)data;
+	}
+	// the mapping stays valid after the file descriptor is closed
+	close(fd);
+#endif
+	m_isOpen = true;
+	return 0;
+}
+
+bool CMappedFile::IsPadded()
+{
+#if _WIN32
+	return false;
+#else
+	return m_isOpen;
+#endif
+}
+
+void CMappedFile::Close()
+{
+#if _WIN32
+	if (m_data) UnmapViewOfFile(m_data);
+	if (m_hMapping) CloseHandle(m_hMapping);
+	if (m_hFile != INVALID_HANDLE_VALUE) CloseHandle(m_hFile);
+	m_hMapping = NULL;
+	m_hFile = INVALID_HANDLE_VALUE;
+#else
+	if (m_data) munmap(m_data, m_mapSize);
+	m_mapSize = 0;
+#endif
+	m_isOpen = false;
+	m_data = nullptr;
+	m_size = 0;
+}
+
+CAsyncWorker::CAsyncWorker()
+{
+	m_pending = false;
+	m_terminate = false;
+	m_status = 0;
+}
+
+CAsyncWorker::~CAsyncWorker()
+{
+	if (m_thread.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_terminate = true;
+		}
+		m_cv.notify_all();
+		m_thread.join();
+	}
+}
+
+int CAsyncWorker::Submit(std::function<int()> job)
+{
+	int status = Wait();
+	if (!m_thread.joinable()) {
+		// start the worker thread on first use
+		m_thread = std::thread(&CAsyncWorker::Run, this);
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_job = job;
+		m_pending = true;
+	}
+	m_cv.notify_all();
+	return status;
+}
+
+int CAsyncWorker::Wait()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_cv.wait(lock, [this] { return !m_pending; });
+	int status = m_status;
+	m_status = 0;
+	return status;
+}
+
+void CAsyncWorker::Run()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	for (;;) {
+		m_cv.wait(lock, [this] { return m_pending || m_terminate; });
+		if (!m_pending)
+			break;
+		std::function<int()> job = m_job;
+		lock.unlock();
+		int status;
+		try {
+			status = job();
+		}
+		catch (...) {
+			// error message has already been printed by ReportError
+			status = -1;
+		}
+		lock.lock();
+		m_job = nullptr;
+		m_status = status;
+		m_pending = false;
+		m_cv.notify_all();
+	}
+}
+
+// run job(start, end) on contiguous sub-ranges of [0,count) in parallel
+void RunParallel(size_t count, size_t bytesPerItem, std::function<void(size_t start, size_t end)> job)
+{
+	// at least 1MB of data per thread so that handing a range to a pool worker and waiting for it pays off
+	const size_t minBytesPerThread = 1 << 20;
+	size_t threadCount = std::thread::hardware_concurrency();
+	threadCount = min(threadCount, (count * bytesPerItem) / minBytesPerThread);
+	threadCount = min(threadCount, count);
+	if (threadCount <= 1) {
+		job(0, count);
+		return;
+	}
+	// ranges go to a static pool of CAsyncWorker threads that is started on first use and reused by later calls,
+	// and the calling thread processes the last range; calls are serialized on poolMutex, so concurrent callers
+	// such as the -async-io compare workers of several images run their parallel sections one at a time
+	static std::mutex poolMutex;
+	static std::vector<CAsyncWorker> pool(std::thread::hardware_concurrency() - 1);
+	std::lock_guard<std::mutex> lock(poolMutex);
+	size_t itemsPerThread = (count + threadCount - 1) / threadCount;
+	size_t start = 0, workerCount = 0;
+	for (; start + itemsPerThread < count; start += itemsPerThread) {
+		size_t end = start + itemsPerThread;
+		pool[workerCount++].Submit([&job, start, end]() { job(start, end); return 0; });
+	}
+	job(start, count);
+	for (size_t i = 0; i < workerCount; i++) {
+		pool[i].Wait();
+	}
+}
+
+// XXH64 helpers
+static const vx_uint64 XXH64_PRIME1 = 11400714785074694791ULL;
+static const vx_uint64 XXH64_PRIME2 = 14029467366897019727ULL;
+static const vx_uint64 XXH64_PRIME3 = 1609587929392839161ULL;
+static const vx_uint64 XXH64_PRIME4 = 9650029242287828579ULL;
+static const vx_uint64 XXH64_PRIME5 = 2870177450012600261ULL;
+static inline vx_uint64 XXH64_rotl(vx_uint64 x, int r) { return (x << r) | (x >> (64 - r)); }
+static inline vx_uint64 XXH64_read64(const vx_uint8 * p) { vx_uint64 v; memcpy(&v, p, sizeof(v)); return v; }
+static inline vx_uint32 XXH64_read32(const vx_uint8 * p) { vx_uint32 v; memcpy(&v, p, sizeof(v)); return v; }
+static inline vx_uint64 XXH64_round(vx_uint64 acc, vx_uint64 input)
+{
+	acc += input * XXH64_PRIME2;
+	return XXH64_rotl(acc, 31) * XXH64_PRIME1;
+}
+static inline vx_uint64 XXH64_mergeRound(vx_uint64 acc, vx_uint64 val)
+{
+	acc ^= XXH64_round(0, val);
+	return acc * XXH64_PRIME1 + XXH64_PRIME4;
+}
+
+// compute 64-bit xxHash (XXH64) of a buffer (little-endian)
+vx_uint64 ComputeHash64(const vx_uint8 * data, size_t count, vx_uint64 seed)
+{
+	const vx_uint8 * p = data;
+	const vx_uint8 * end = data + count;
+	vx_uint64 h;
+	if (count >= 32) {
+		vx_uint64 v1 = seed + XXH64_PRIME1 + XXH64_PRIME2;
+		vx_uint64 v2 = seed + XXH64_PRIME2;
+		vx_uint64 v3 = seed;
+		vx_uint64 v4 = seed - XXH64_PRIME1;
+		for (; p + 32 <= end; p += 32) {
+			v1 = XXH64_round(v1, XXH64_read64(p));
+			v2 = XXH64_round(v2, XXH64_read64(p + 8));
+			v3 = XXH64_round(v3, XXH64_read64(p + 16));
+			v4 = XXH64_round(v4, XXH64_read64(p + 24));
+		}
+		h = XXH64_rotl(v1, 1) + XXH64_rotl(v2, 7) + XXH64_rotl(v3, 12) + XXH64_rotl(v4, 18);
+		h = XXH64_mergeRound(h, v1);
+		h = XXH64_mergeRound(h, v2);
+		h = XXH64_mergeRound(h, v3);
+		h = XXH64_mergeRound(h, v4);
+	}
+	else {
+		h = seed + XXH64_PRIME5;
+	}
+	h += (vx_uint64)count;
+	for (; p + 8 <= end; p += 8) {
+		h ^= XXH64_round(0, XXH64_read64(p));
+		h = XXH64_rotl(h, 27) * XXH64_PRIME1 + XXH64_PRIME4;
+	}
+	if (p + 4 <= end) {
+		h ^= (vx_uint64)XXH64_read32(p) * XXH64_PRIME1;
+		h = XXH64_rotl(h, 23) * XXH64_PRIME2 + XXH64_PRIME3;
+		p += 4;
+	}
+	for (; p < end; p++) {
+		h ^= (*p) * XXH64_PRIME5;
+		h = XXH64_rotl(h, 11) * XXH64_PRIME1;
+	}
+	h ^= h >> 33;
+	h *= XXH64_PRIME2;
+	h ^= h >> 29;
+	h *= XXH64_PRIME3;
+	h ^= h >> 32;
+	return h;
+}
+
+// Compute 64-bit checksum of rectangular region specified within an image
+//   rows are hashed independently in parallel, so the result doesn't depend on the number of threads
+void ComputeChecksum64(char checkSumString[64], vx_image image, vx_rectangle_t * rectRegion)
+{
+	// get number of planes
+	vx_df_image format = VX_DF_IMAGE_VIRT;
+	vx_size num_planes = 0;
+	ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_FORMAT, &format, sizeof(format)));
+	ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_PLANES, &num_planes, sizeof(num_planes)));
+	// compute hash of each row
+	std::vector<vx_uint64> rowHash;
+	for (vx_uint32 plane = 0; plane < (vx_uint32)num_planes; plane++) {
+		vx_imagepatch_addressing_t addr;
+		vx_uint8 * base_ptr = nullptr;
+		ERROR_CHECK(vxAccessImagePatch(image, rectRegion, plane, &addr, (void **)&base_ptr, VX_READ_ONLY));
+		vx_uint32 width = ((addr.dim_x * addr.scale_x) / VX_SCALE_UNITY);
+		vx_uint32 height = ((addr.dim_y * addr.scale_y) / VX_SCALE_UNITY);
+		vx_uint32 width_in_bytes = (format == VX_DF_IMAGE_U1_AMD) ? ((width + 7) >> 3) : (width * addr.stride_x);
+		size_t rowHashOffset = rowHash.size();
+		rowHash.resize(rowHashOffset + height);
+		vx_uint64 * hash = rowHash.data() + rowHashOffset;
+		RunParallel(height, width_in_bytes, [=](size_t start, size_t end) {
+			for (size_t y = start; y < end; y++) {
+				hash[y] = ComputeHash64(base_ptr + y * addr.stride_y, width_in_bytes, 0);
+			}
+		});
+		ERROR_CHECK(vxCommitImagePatch(image, rectRegion, plane, &addr, base_ptr));
+	}
+	// hash of row hashes
+	vx_uint64 hash = ComputeHash64((const vx_uint8 *)rowHash.data(), rowHash.size() * sizeof(vx_uint64), 0);
+	sprintf(checkSumString, "%016" PRIx64, hash);
+}
+
 // Compute checksum of rectangular region specified within an image
 void ComputeChecksum(char checkSumString[64], vx_image image, vx_rectangle_t * rectRegion)
 {
@@ -403,19 +703,25 @@ void ComputeChecksum(char checkSumString[64], vx_image image, vx_rectangle_t * r
 }
 
 // <template>ComparePixels -- compares an image with a reference image
+//   rows that are bitwise identical are skipped with memcmp when zero error is within limits;
+//   the per-pixel loop is branch-free so that the compiler can vectorize it
 template<typename PixelType, typename CompareType>
 size_t ComparePixels(PixelType * pImg_, size_t img_stride_y, PixelType * pRef_, size_t ref_stride_y, vx_uint32 width, vx_uint32 height, CompareType errLimitMin, CompareType errLimitMax)
 {
 	const vx_uint8 * pImg = (const vx_uint8 *)pImg_;
 	const vx_uint8 * pRef = (const vx_uint8 *)pRef_;
+	bool skipIdenticalRows = (errLimitMin <= 0 && errLimitMax >= 0);
 	size_t errorPixelCount = 0;
 	for (vx_uint32 y = 0; y < height; y++) {
 		const PixelType * p = (const PixelType *)pImg;
 		const PixelType * q = (const PixelType *)pRef;
-		for (size_t x = 0; x < width; x++) {
-			CompareType err = (CompareType)p[x] - (CompareType)q[x];
-			if (err < errLimitMin || err > errLimitMax)
-				errorPixelCount++;
+		if (!skipIdenticalRows || memcmp(p, q, width * sizeof(PixelType))) {
+			size_t rowErrorPixelCount = 0;
+			for (size_t x = 0; x < width; x++) {
+				CompareType err = (CompareType)p[x] - (CompareType)q[x];
+				rowErrorPixelCount += (err < errLimitMin) | (err > errLimitMax);
+			}
+			errorPixelCount += rowErrorPixelCount;
 		}
 		pImg += img_stride_y;
 		pRef += ref_stride_y;
@@ -429,10 +735,12 @@ size_t ComparePixelsU001(vx_uint8 * pImg, size_t img_stride_y, vx_uint8 * pRef,
 	for (vx_uint32 y = 0; y < height; y++) {
 		const vx_uint8 * p = (const vx_uint8 *)pImg;
 		const vx_uint8 * q = (const vx_uint8 *)pRef;
-		for (size_t x = 0; x < width; x++) {
-			size_t bytepos = x >> 3, bitpos = x & 7;
-			if ((p[bytepos] ^ q[bytepos]) & (1 << bitpos)) {
-				errorPixelCount++;
+		if (memcmp(p, q, (width + 7) >> 3)) {
+			for (size_t x = 0; x < width; x++) {
+				size_t bytepos = x >> 3, bitpos = x & 7;
+				if ((p[bytepos] ^ q[bytepos]) & (1 << bitpos)) {
+					errorPixelCount++;
+				}
 			}
 		}
 		pImg += img_stride_y;
@@ -441,6 +749,30 @@ size_t ComparePixelsU001(vx_uint8 * pImg, size_t img_stride_y, vx_uint8 * pRef,
 	return errorPixelCount;
 }
 
+// compare rows of an image plane with reference and return number of pixels mismatching
+static size_t ComparePlane(vx_df_image format, vx_enum pixelType, vx_uint8 * pImg, size_t img_stride_y, vx_uint8 * pRef, size_t ref_stride_y, vx_uint32 width, vx_uint32 height, float errLimitMin, float errLimitMax)
+{
+	if (pixelType == VX_TYPE_INT16) {
+		return ComparePixels((vx_int16 *)pImg, img_stride_y, (vx_int16 *)pRef, ref_stride_y, width, height, (vx_int32)errLimitMin, (vx_int32)errLimitMax);
+	}
+	else if (pixelType == VX_TYPE_UINT16) {
+		return ComparePixels((vx_uint16 *)pImg, img_stride_y, (vx_uint16 *)pRef, ref_stride_y, width, height, (vx_int32)errLimitMin, (vx_int32)errLimitMax);
+	}
+	else if (pixelType == VX_TYPE_INT32) {
+		return ComparePixels((vx_int32 *)pImg, img_stride_y, (vx_int32 *)pRef, ref_stride_y, width, height, (vx_int64)errLimitMin, (vx_int64)errLimitMax);
+	}
+	else if (pixelType == VX_TYPE_UINT32) {
+		return ComparePixels((vx_uint32 *)pImg, img_stride_y, (vx_uint32 *)pRef, ref_stride_y, width, height, (vx_int64)errLimitMin, (vx_int64)errLimitMax);
+	}
+	else if (pixelType == VX_TYPE_FLOAT32) {
+		return ComparePixels((vx_float32 *)pImg, img_stride_y, (vx_float32 *)pRef, ref_stride_y, width, height, (vx_float32)errLimitMin, (vx_float32)errLimitMax);
+	}
+	else if (format == VX_DF_IMAGE_U1_AMD) {
+		return ComparePixelsU001(pImg, img_stride_y, pRef, ref_stride_y, width, height);
+	}
+	return ComparePixels(pImg, img_stride_y, pRef, ref_stride_y, width, height, (vx_int32)errLimitMin, (vx_int32)errLimitMax);
+}
+
 // Compare rectangular region specified within an image and return number of pixels mismatching
 size_t CompareImage(vx_image image, vx_rectangle_t * rectRegion, vx_uint8 * refImage, float errLimitMin, float errLimitMax, int frameNumber, const char * fileNameRef)
 {
@@ -473,28 +805,13 @@ size_t CompareImage(vx_image image, vx_rectangle_t * rectRegion, vx_uint8 * refI
 		vx_uint32 start_x = ((rectRegion->start_x * addr.scale_x) / VX_SCALE_UNITY);
 		vx_uint32 start_y = ((rectRegion->start_y * addr.scale_y) / VX_SCALE_UNITY);
 		vx_uint8 * pRef = pRefPlane + start_y * plane_width_in_bytes + start_x * addr.stride_x;
-		vx_size errorPixelCount = 0;
-		if (pixelType == VX_TYPE_INT16) {
-			errorPixelCount = ComparePixels((vx_int16 *)base_ptr, addr.stride_y, (vx_int16 *)pRef, plane_width_in_bytes, region_width, region_height, (vx_int32)errLimitMin, (vx_int32)errLimitMax);
-		}
-		else if (pixelType == VX_TYPE_UINT16) {
-			errorPixelCount = ComparePixels((vx_uint16 *)base_ptr, addr.stride_y, (vx_uint16 *)pRef, plane_width_in_bytes, region_width, region_height, (vx_int32)errLimitMin, (vx_int32)errLimitMax);
-		}
-		else if (pixelType == VX_TYPE_INT32) {
-			errorPixelCount = ComparePixels((vx_int32 *)base_ptr, addr.stride_y, (vx_int32 *)pRef, plane_width_in_bytes, region_width, region_height, (vx_int64)errLimitMin, (vx_int64)errLimitMax);
-		}
-		else if (pixelType == VX_TYPE_UINT32) {
-			errorPixelCount = ComparePixels((vx_uint32 *)base_ptr, addr.stride_y, (vx_uint32 *)pRef, plane_width_in_bytes, region_width, region_height, (vx_int64)errLimitMin, (vx_int64)errLimitMax);
-		}
-		else if (pixelType == VX_TYPE_FLOAT32) {
-			errorPixelCount = ComparePixels((vx_float32 *)base_ptr, addr.stride_y, (vx_float32 *)pRef, plane_width_in_bytes, region_width, region_height, (vx_float32)errLimitMin, (vx_float32)errLimitMax);
-		}
-		else if (format == VX_DF_IMAGE_U1_AMD) {
-			errorPixelCount = ComparePixelsU001((vx_uint8 *)base_ptr, addr.stride_y, (vx_uint8 *)pRef, plane_width_in_bytes, region_width, region_height);
-		}
-		else {
-			errorPixelCount = ComparePixels((vx_uint8 *)base_ptr, addr.stride_y, (vx_uint8 *)pRef, plane_width_in_bytes, region_width, region_height, (vx_int32)errLimitMin, (vx_int32)errLimitMax);
-		}
+		// compare groups of rows in parallel
+		std::atomic<size_t> errorPixelCountAtomic(0);
+		RunParallel(region_height, plane_width_in_bytes, [&](size_t start, size_t end) {
+			errorPixelCountAtomic += ComparePlane(format, pixelType, base_ptr + start * addr.stride_y, addr.stride_y, pRef + start * plane_width_in_bytes, plane_width_in_bytes,
+			                                      region_width, (vx_uint32)(end - start), errLimitMin, errLimitMax);
+		});
+		vx_size errorPixelCount = errorPixelCountAtomic;
 		ERROR_CHECK(vxCommitImagePatch(image, rectRegion, plane, &addr, base_ptr));
 		// report results
 		errorPixelCountTotal += errorPixelCount;
@@ -576,6 +893,56 @@ int WriteImage(vx_image image, vx_rectangle_t * rectFull, FILE * fp)
 	return 0;
 }
 
+// copy image from a buffer
+int ReadImageFromBuffer(vx_image image, vx_rectangle_t * rectFull, const vx_uint8 * buf)
+{
+	// get number of planes, image width in bytes for single plane
+	vx_size num_planes = 0;
+	ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_PLANES, &num_planes, sizeof(num_planes)));
+	vx_size width_in_bytes = (num_planes == 1) ? CalculateImageWidthInBytes(image) : 0;
+	// copy all image planes into vx_image in the same order as ReadImage
+	for (vx_uint32 plane = 0; plane < (vx_uint32)num_planes; plane++) {
+		vx_imagepatch_addressing_t addr;
+		vx_uint8 * dst = NULL;
+		ERROR_CHECK(vxAccessImagePatch(image, rectFull, plane, &addr, (void **)&dst, VX_WRITE_ONLY));
+		vx_size width = (addr.dim_x * addr.scale_x) / VX_SCALE_UNITY;
+		if (addr.stride_x != 0)
+			width_in_bytes = (width * addr.stride_x);
+		for (vx_uint32 y = 0; y < addr.dim_y; y += addr.step_y){
+			vx_uint8 *dstp = (vx_uint8 *)vxFormatImagePatchAddress2d(dst, 0, y, &addr);
+			memcpy(dstp, buf, width_in_bytes);
+			buf += width_in_bytes;
+		}
+		ERROR_CHECK(vxCommitImagePatch(image, rectFull, plane, &addr, dst));
+	}
+	return 0;
+}
+
+// copy image into a buffer
+int WriteImageToBuffer(vx_image image, vx_rectangle_t * rectFull, vx_uint8 * buf)
+{
+	// get number of planes, image width in bytes for single plane
+	vx_size num_planes = 0;
+	ERROR_CHECK(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_PLANES, &num_planes, sizeof(num_planes)));
+	vx_size width_in_bytes = (num_planes == 1) ? CalculateImageWidthInBytes(image) : 0;
+	// copy all image planes from vx_image in the same order as WriteImage
+	for (vx_uint32 plane = 0; plane < (vx_uint32)num_planes; plane++) {
+		vx_imagepatch_addressing_t addr;
+		vx_uint8 * src = NULL;
+		ERROR_CHECK(vxAccessImagePatch(image, rectFull, plane, &addr, (void **)&src, VX_READ_ONLY));
+		vx_size width = (addr.dim_x * addr.scale_x) / VX_SCALE_UNITY;
+		if (addr.stride_x != 0)
+			width_in_bytes = (width * addr.stride_x);
+		for (vx_uint32 y = 0; y < addr.dim_y; y += addr.step_y){
+			vx_uint8 *srcp = (vx_uint8 *)vxFormatImagePatchAddress2d(src, 0, y, &addr);
+			memcpy(buf, srcp, width_in_bytes);
+			buf += width_in_bytes;
+		}
+		ERROR_CHECK(vxCommitImagePatch(image, rectFull, plane, &addr, src));
+	}
+	return 0;
+}
+
 #if ENABLE_OPENCV
 // write image compressed
 int WriteImageCompressed(vx_image image, vx_rectangle_t * rectFull, const char * fileName) 
@@ -48,6 +48,11 @@ THE SOFTWARE.
 #include <map>
 #include <list>
 #include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
 
 #if _WIN32
 #include <Windows.h>
@@ -55,6 +60,9 @@ THE SOFTWARE.
 #else
 #include <chrono>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #if HAVE_OpenSSL
 #include <openssl/hmac.h>
 #include <openssl/md5.h>
@@ -131,6 +139,58 @@ inline int64_t utilGetClockFrequency()
 }
 
 
+///////////////////////////////////////////////////////////////////////////
+// class CAsyncWorker runs frame I/O jobs on a background thread, one at a time
+//   Submit -- waits for the previous job and queues the new one; returns status of the previous job
+//   Wait   -- waits for the pending job (if any) and returns its status
+//   jobs return 0 on SUCCESS, +ve for data unavailability, -ve on error (exceptions are reported as -1)
+class CAsyncWorker {
+public:
+	CAsyncWorker();
+	~CAsyncWorker();
+	int Submit(std::function<int()> job);
+	int Wait();
+
+private:
+	void Run();
+	std::thread m_thread;
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+	std::function<int()> m_job;
+	bool m_pending;
+	bool m_terminate;
+	int m_status;
+};
+
+///////////////////////////////////////////////////////////////////////////
+// class CMappedFile maps an input file into memory to read frames without copies
+//   pages are mapped copy-on-write, so a graph writing into its input doesn't modify the file
+//   on Linux, a page of zeros follows the file so that frames at the end of file can be used in place
+//   Open -- returns 0 on SUCCESS and -1 if file can't be opened or mapped
+class CMappedFile {
+public:
+	CMappedFile();
+	~CMappedFile();
+	int Open(const char * fileName);
+	void Close();
+	bool IsOpen() { return m_isOpen; }
+	vx_uint8 * GetData() { return m_data; }
+	size_t GetSize() { return m_size; }
+	// true when the mapping is followed by readable zero bytes, so kernels can use frames in place
+	bool IsPadded();
+
+private:
+	bool m_isOpen;
+	vx_uint8 * m_data;
+	size_t m_size;
+#if _WIN32
+	HANDLE m_hFile;
+	HANDLE m_hMapping;
+#else
+	size_t m_mapSize;
+#endif
+};
+
 ///////////////////////////////////////////////////////////////////////////
 // class CHasher for checksum computation
 ///////////////////////////////////////////////////////////////////////////
@@ -174,8 +234,18 @@ const char * ovxEnum2Name(vx_enum e);
 void ovxEnum2String(vx_enum e, char str[]);
 vx_enum ovxName2Enum(const char * name);
 
+// run job(start, end) on contiguous sub-ranges of [0,count) in parallel
+//   uses up to one thread per CPU core, only when count * bytesPerItem is at least 1MB per thread
+//   the threads come from a static CAsyncWorker pool reused across calls; calls are serialized on a mutex,
+//   so concurrent callers (e.g., -async-io compare workers) run one at a time
+void RunParallel(size_t count, size_t bytesPerItem, std::function<void(size_t start, size_t end)> job);
+// compute 64-bit xxHash (XXH64) of a buffer
+vx_uint64 ComputeHash64(const vx_uint8 * data, size_t count, vx_uint64 seed);
 // compute checksum of rectangular region specified within an image
+//   ComputeChecksum   -- MD5 of all rows (32 hex digits)
+//   ComputeChecksum64 -- XXH64 of per-row XXH64 values, computed in parallel (16 hex digits)
 void ComputeChecksum(char checkSumString[64], vx_image image, vx_rectangle_t * rectRegion);
+void ComputeChecksum64(char checkSumString[64], vx_image image, vx_rectangle_t * rectRegion);
 // compare rectangular region specified within an image and return number of pixels mismatching
 size_t CompareImage(vx_image image, vx_rectangle_t * rectRegion, vx_uint8 * refImage, float errLimitMin, float errLimitMax, int frameNumber, const char * fileNameRef);
 // get image width in bytes from image
@@ -184,6 +254,9 @@ vx_size CalculateImageWidthInBytes(vx_image image);
 int ReadImage(vx_image image, vx_rectangle_t * rectFull, FILE * fp);
 // write image
 int WriteImage(vx_image image, vx_rectangle_t * rectFull, FILE * fp);
+// copy image from/to a buffer with the same layout as ReadImage/WriteImage files
+int ReadImageFromBuffer(vx_image image, vx_rectangle_t * rectFull, const vx_uint8 * buf);
+int WriteImageToBuffer(vx_image image, vx_rectangle_t * rectFull, vx_uint8 * buf);
 // write image compressed
 int WriteImageCompressed(vx_image image, vx_rectangle_t * rectFull, const char * fileName);
 